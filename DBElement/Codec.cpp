@@ -0,0 +1,654 @@
+//////////////////////////////////////////////////////////////////
+// Codec.cpp        - Fast LZ Compression of DBElement          //
+//                    Data with trained Dictionaries.           //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "Codec.h"
+
+#include <chrono>
+#include <mutex>
+#include <queue>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+/* Registered Dictionaries by ID, ID 0 stands for no Dictionary */
+static std::atomic<const Codec::Dictionary*> dictionaries[Codec::MAX_DICTIONARIES + 1];
+static std::mutex registration;
+
+/* Process Wide Counters behind Codec::stats() */
+static std::atomic<uint64_t> compressions, rejected, dataBytes, frameBytes, compressNanos;
+static std::atomic<uint64_t> decompressions, decompressedBytes, decompressNanos;
+
+/* Hash Table of compress(), kept per thread so it is not Allocated on every call */
+static thread_local std::vector<uint32_t> matches;
+
+/// <summary>
+/// Function to get the Nanoseconds elapsed since start.
+/// </summary>
+/// <param name="start">Start Time</param>
+/// <returns>Nanoseconds</returns>
+static uint64_t elapsed(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// <summary>
+/// Function to Read 4 Bytes as an Integer.
+/// </summary>
+/// <param name="bytes">First Byte</param>
+/// <returns>Integer</returns>
+static uint32_t load32(const char * bytes) {
+	uint32_t value;
+	std::memcpy(&value, bytes, sizeof(value));
+	return value;
+}
+
+/// <summary>
+/// Constructor with the content as Argument, which is cut to MAX_DICTIONARY Bytes.
+/// The Hash Table of the content is Built once so compress() only has to copy it.
+/// </summary>
+/// <param name="content">Dictionary Bytes</param>
+Codec::Dictionary::Dictionary(std::string_view content) : _content(content.substr(content.size() > MAX_DICTIONARY ? content.size() - MAX_DICTIONARY : 0)), _table(1 << HASH_LOG, 0), _id(0) {
+	for (size_t position = 0; position + MIN_MATCH <= _content.size(); position++)
+		_table[hash(load32(_content.data() + position), HASH_LOG)] = (uint32_t)position + 1;
+}
+
+/// <summary>
+/// Function to Register a Dictionary with the given content. Only the last
+/// MAX_DICTIONARY Bytes are kept. A Dictionary is never Unregistered, so Frames
+/// Compressed with it can always be Decompressed.
+/// </summary>
+/// <param name="content">Dictionary Bytes</param>
+/// <returns>Dictionary, nullptr if the content is empty or MAX_DICTIONARIES are Registered</returns>
+const Codec::Dictionary * Codec::Dictionary::create(std::string_view content) {
+	if (content.empty())
+		return nullptr;
+	std::lock_guard<std::mutex> lock(registration);
+	for (size_t id = 1; id <= MAX_DICTIONARIES; id++) {
+		if (dictionaries[id].load(std::memory_order_relaxed) == nullptr) {
+			Dictionary * dictionary = new Dictionary(content);
+			dictionary->_id = (uint8_t)id;
+			dictionaries[id].store(dictionary, std::memory_order_release);
+			return dictionary;
+		}
+	}
+	return nullptr;
+}
+
+/// <summary>
+/// Function to Build and Register a Dictionary from sample Values.
+///
+/// Every sample is cut into overlapping Segments and a Segment is worth the number
+/// of times the 8 Byte sequences it holds occur across all samples. The most
+/// valuable Segment is picked over and over, and the sequences it holds stop counting
+/// for the Segments left, so the Dictionary does not repeat itself. The Segments
+/// picked first are placed at the end of the Dictionary, where the Offsets to them
+/// are the shortest.
+/// </summary>
+/// <param name="samples">Sample Values</param>
+/// <param name="capacity">Dictionary Size, at most MAX_DICTIONARY</param>
+/// <returns>Dictionary, nullptr if nothing in the samples repeats</returns>
+const Codec::Dictionary * Codec::Dictionary::train(const std::vector<std::string_view>& samples, size_t capacity) {
+	const size_t sequence = 8, segment = 64, stride = segment / 2;
+	if (capacity > MAX_DICTIONARY)
+		capacity = MAX_DICTIONARY;
+	auto load64 = [](const char * bytes) { uint64_t value; std::memcpy(&value, bytes, sizeof(value)); return value; };
+
+	std::unordered_map<uint64_t, uint32_t> frequencies;
+	for (std::string_view sample : samples)
+		for (size_t position = 0; position + sequence <= sample.size(); position++)
+			frequencies[load64(sample.data() + position)]++;
+
+	/* Value of a Segment is the sum of the frequencies of the sequences in it which repeat */
+	auto score = [&](std::string_view candidate) {
+		uint64_t value = 0;
+		std::unordered_map<uint64_t, bool> seen;
+		for (size_t position = 0; position + sequence <= candidate.size(); position++) {
+			uint64_t key = load64(candidate.data() + position);
+			uint32_t frequency = frequencies[key];
+			if (frequency > 1 && seen.emplace(key, true).second)
+				value += frequency;
+		}
+		return value;
+	};
+
+	typedef std::pair<uint64_t, std::string_view> Candidate;
+	std::priority_queue<Candidate, std::vector<Candidate>, bool(*)(const Candidate&, const Candidate&)> candidates(
+		[](const Candidate& a, const Candidate& b) { return a.first < b.first; });
+	for (std::string_view sample : samples) {
+		for (size_t position = 0; position + sequence <= sample.size(); position += stride) {
+			std::string_view candidate = sample.substr(position, segment);
+			uint64_t value = score(candidate);
+			if (value > 0)
+				candidates.emplace(value, candidate);
+		}
+	}
+
+	std::vector<std::string_view> picked;
+	size_t size = 0;
+	while (!candidates.empty() && size < capacity) {
+		Candidate top = candidates.top();
+		candidates.pop();
+		/* Values only ever drop, so a Segment whose Value is still current is the best left */
+		uint64_t value = score(top.second);
+		if (value == 0)
+			continue;
+		if (value < top.first) {
+			candidates.emplace(value, top.second);
+			continue;
+		}
+		picked.push_back(top.second.substr(0, capacity - size));
+		size += picked.back().size();
+		for (size_t position = 0; position + sequence <= top.second.size(); position++)
+			frequencies[load64(top.second.data() + position)] = 0;
+	}
+
+	std::string content;
+	content.reserve(size);
+	for (auto segment = picked.rbegin(); segment != picked.rend(); ++segment)
+		content.append(segment->data(), segment->size());
+	return create(content);
+}
+
+/// <summary>
+/// Function to get a Registered Dictionary by it's ID.
+/// </summary>
+/// <param name="id">Dictionary ID</param>
+/// <returns>Dictionary, nullptr if no Dictionary has the ID</returns>
+const Codec::Dictionary * Codec::Dictionary::find(uint8_t id) {
+	return dictionaries[id].load(std::memory_order_acquire);
+}
+
+/// <summary>
+/// Function to get the ID of the Dictionary which Frames record.
+/// </summary>
+/// <returns>Dictionary ID</returns>
+uint8_t Codec::Dictionary::id() const {
+	return _id;
+}
+
+/// <summary>
+/// Function to get the Bytes of the Dictionary.
+/// </summary>
+/// <returns>Dictionary Bytes</returns>
+std::string_view Codec::Dictionary::content() const {
+	return _content;
+}
+
+/// <summary>
+/// Function to get the Data Bytes per Frame Byte.
+/// </summary>
+/// <returns>Compression Ratio</returns>
+double Codec::Stats::ratio() const {
+	return frameBytes ? (double)dataBytes / frameBytes : 1.0;
+}
+
+/// <summary>
+/// Function to get the average time of a call to compress().
+/// </summary>
+/// <returns>Nanoseconds per call</returns>
+double Codec::Stats::nanosPerCompress() const {
+	return compressions + rejected ? (double)compressNanos / (compressions + rejected) : 0.0;
+}
+
+/// <summary>
+/// Function to get the average time of a call to decompress().
+/// </summary>
+/// <returns>Nanoseconds per call</returns>
+double Codec::Stats::nanosPerDecompress() const {
+	return decompressions ? (double)decompressNanos / decompressions : 0.0;
+}
+
+/// <summary>
+/// Function to Hash a 4 Byte sequence into hashLog bits.
+/// </summary>
+/// <param name="sequence">4 Bytes</param>
+/// <param name="hashLog">Bits of the Hash</param>
+/// <returns>Hash</returns>
+uint32_t Codec::hash(uint32_t sequence, unsigned hashLog) {
+	return (sequence * 2654435761U) >> (32 - hashLog);
+}
+
+/// <summary>
+/// Function to Append the part of a Length which did not fit in the Token.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="length">Length less the 15 held by the Token</param>
+void Codec::putLength(std::string& out, size_t length) {
+	for (; length >= 255; length -= 255)
+		out.push_back((char)255);
+	out.push_back((char)length);
+}
+
+/// <summary>
+/// Function to Read the part of a Length which did not fit in the Token.
+/// </summary>
+/// <param name="cursor">Next Byte, moved past the Length</param>
+/// <param name="end">End of the Frame</param>
+/// <param name="length">Length to add to</param>
+/// <returns>False if the Frame ends within the Length</returns>
+bool Codec::getLength(const unsigned char *& cursor, const unsigned char * end, size_t& length) {
+	unsigned char byte;
+	do {
+		if (cursor == end)
+			return false;
+		byte = *cursor++;
+		length += byte;
+	} while (byte == 255);
+	return true;
+}
+
+/// <summary>
+/// Function to Append the Sequences of the Data to a Frame.
+///
+/// The Dictionary and the Data are treated as one window, the Dictionary first, so
+/// a Match may start in the Dictionary and run on into the Data. Positions in the
+/// Data are Hashed into a Table sized to the Data, and where that finds no Match the
+/// Dictionary's own Table is tried, so the Dictionary is never Hashed again.
+/// </summary>
+/// <param name="data">Data to Compress</param>
+/// <param name="out">Frame to Append to</param>
+/// <param name="dictionary">Dictionary or nullptr</param>
+void Codec::encode(std::string_view data, std::string& out, const Dictionary * dictionary) {
+	const char * source = data.data();
+	const size_t size = data.size();
+	const char * prefix = dictionary ? dictionary->_content.data() : nullptr;
+	const size_t base = dictionary ? dictionary->_content.size() : 0;
+	auto at = [&](size_t position) { return position < base ? prefix[position] : source[position - base]; };
+
+	const uint32_t * dictionaryTable = dictionary ? dictionary->_table.data() : nullptr;
+	unsigned hashLog;
+	/* Small Data gets a small Hash Table, clearing it would cost more than the Compression */
+	for (hashLog = 8; hashLog < HASH_LOG && ((size_t)1 << hashLog) < size; hashLog++);
+	matches.assign((size_t)1 << hashLog, 0);
+
+	auto emit = [&out](const char * literals, size_t literalLength, size_t offset, size_t matchLength) {
+		size_t token = out.size();
+		out.push_back((char)(std::min<size_t>(literalLength, 15) << 4));
+		if (literalLength >= 15)
+			putLength(out, literalLength - 15);
+		out.append(literals, literalLength);
+		if (matchLength == 0)
+			return;
+		out[token] |= (char)std::min<size_t>(matchLength - MIN_MATCH, 15);
+		out.push_back((char)offset);
+		out.push_back((char)(offset >> 8));
+		if (matchLength - MIN_MATCH >= 15)
+			putLength(out, matchLength - MIN_MATCH - 15);
+	};
+
+	size_t anchor = 0, position = 0;
+	while (position + MIN_MATCH + LAST_LITERALS <= size) {
+		uint32_t sequence = load32(source + position);
+		uint32_t& slot = matches[hash(sequence, hashLog)];
+		size_t current = base + position;
+		size_t candidate = slot;
+		slot = (uint32_t)current + 1;
+		bool found = candidate != 0 && current - (candidate - 1) <= 65535 && load32(source + candidate - 1 - base) == sequence;
+		if (!found && dictionaryTable != nullptr) {
+			candidate = dictionaryTable[hash(sequence, HASH_LOG)];
+			found = candidate != 0 && current - (candidate - 1) <= 65535 && load32(prefix + candidate - 1) == sequence;
+		}
+		candidate--;
+		if (!found) {
+			position += 1 + ((position - anchor) >> 6);
+			continue;
+		}
+
+		size_t start = position, length = MIN_MATCH;
+		const size_t limit = size - LAST_LITERALS;
+		if (candidate >= base) {
+			const char * from = source + candidate - base;
+			while (start + length < limit && from[length] == source[start + length])
+				length++;
+		} else {
+			while (start + length < limit && at(candidate + length) == source[start + length])
+				length++;
+		}
+		while (start > anchor && candidate > 0 && at(candidate - 1) == source[start - 1]) {
+			start--;
+			candidate--;
+			length++;
+		}
+		emit(source + anchor, start - anchor, base + start - candidate, length);
+		position = anchor = start + length;
+		/* Remember a position inside the Match, it often starts the next one */
+		if (position >= 2 && position + MIN_MATCH <= size)
+			matches[hash(load32(source + position - 2), hashLog)] = (uint32_t)(base + position - 2) + 1;
+	}
+	emit(source + anchor, size - anchor, 0, 0);
+}
+
+/// <summary>
+/// Function to Compress Data into a Frame. Data which does not get smaller is
+/// rejected, the caller should keep it as it is.
+/// </summary>
+/// <param name="data">Data to Compress</param>
+/// <param name="frame">Frame, replaced</param>
+/// <param name="dictionary">Registered Dictionary or nullptr</param>
+/// <returns>True if the Frame is smaller than the Data</returns>
+bool Codec::compress(std::string_view data, std::string& frame, const Dictionary * dictionary) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	frame.clear();
+	frame.reserve(data.size());
+	frame.push_back((char)(dictionary ? dictionary->_id : 0));
+	for (uint64_t length = data.size(); ; length >>= 7) {
+		frame.push_back((char)((length & 0x7f) | (length >= 0x80 ? 0x80 : 0)));
+		if (length < 0x80)
+			break;
+	}
+	encode(data, frame, dictionary);
+	bool smaller = frame.size() < data.size();
+	if (smaller) {
+		compressions.fetch_add(1, std::memory_order_relaxed);
+		dataBytes.fetch_add(data.size(), std::memory_order_relaxed);
+		frameBytes.fetch_add(frame.size(), std::memory_order_relaxed);
+	} else {
+		rejected.fetch_add(1, std::memory_order_relaxed);
+	}
+	compressNanos.fetch_add(elapsed(start), std::memory_order_relaxed);
+	return smaller;
+}
+
+/// <summary>
+/// Function to Decompress a Frame. Every Length and Offset is Checked against the
+/// Frame, the Dictionary and the Data Length the Frame records, so a damaged Frame
+/// is reported rather than Read past.
+/// </summary>
+/// <param name="frame">Frame produced by compress()</param>
+/// <param name="data">Data, replaced</param>
+/// <returns>False if the Frame is damaged or it's Dictionary is not Registered</returns>
+bool Codec::decompress(std::string_view frame, std::string& data) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	const unsigned char * cursor = reinterpret_cast<const unsigned char*>(frame.data());
+	const unsigned char * end = cursor + frame.size();
+	if (cursor == end)
+		return false;
+	const Dictionary * dictionary = nullptr;
+	if (*cursor != 0 && (dictionary = Dictionary::find(*cursor)) == nullptr)
+		return false;
+	const char * prefix = dictionary ? dictionary->_content.data() : nullptr;
+	const size_t base = dictionary ? dictionary->_content.size() : 0;
+	size_t size = 0;
+	for (unsigned shift = 0; ; shift += 7) {
+		if (++cursor == end || shift >= 64)
+			return false;
+		size |= (size_t)(*cursor & 0x7f) << shift;
+		if ((*cursor & 0x80) == 0)
+			break;
+	}
+	cursor++;
+	/* No Sequence grows by more than 255 Bytes per Frame Byte */
+	if (size / 255 > frame.size())
+		return false;
+
+	data.resize(size);
+	char * out = &data[0];
+	size_t written = 0;
+	while (true) {
+		if (cursor == end)
+			return false;
+		unsigned char token = *cursor++;
+		size_t literals = token >> 4;
+		if (literals == 15 && !getLength(cursor, end, literals))
+			return false;
+		if (literals > (size_t)(end - cursor) || literals > size - written)
+			return false;
+		std::memcpy(out + written, cursor, literals);
+		cursor += literals;
+		written += literals;
+		if (cursor == end)
+			break;
+
+		if (end - cursor < 2)
+			return false;
+		size_t offset = cursor[0] | (cursor[1] << 8);
+		cursor += 2;
+		size_t length = (token & 15) + MIN_MATCH;
+		if ((token & 15) == 15 && !getLength(cursor, end, length))
+			return false;
+		if (offset == 0 || offset > written + base || length > size - written)
+			return false;
+		if (offset <= written && offset >= length) {
+			std::memcpy(out + written, out + written - offset, length);
+			written += length;
+		} else {
+			size_t from = base + written - offset;
+			if (from < base) {
+				size_t part = std::min(length, base - from);
+				std::memcpy(out + written, prefix + from, part);
+				written += part;
+				length -= part;
+				from += part;
+			}
+			/* Overlapping the Bytes being Written, Copy a Byte at a time */
+			for (from -= base; length > 0; length--)
+				out[written++] = out[from++];
+		}
+	}
+	if (written != size)
+		return false;
+	decompressions.fetch_add(1, std::memory_order_relaxed);
+	decompressedBytes.fetch_add(size, std::memory_order_relaxed);
+	decompressNanos.fetch_add(elapsed(start), std::memory_order_relaxed);
+	return true;
+}
+
+/// <summary>
+/// Function to get the Length of the Data a Frame holds without Decompressing it.
+/// </summary>
+/// <param name="frame">Frame produced by compress()</param>
+/// <returns>Data Length, 0 if the Frame is damaged</returns>
+size_t Codec::dataSize(std::string_view frame) {
+	uint64_t length = 0;
+	for (size_t index = 1, shift = 0; index < frame.size() && shift < 64; index++, shift += 7) {
+		length |= (uint64_t)(frame[index] & 0x7f) << shift;
+		if ((frame[index] & 0x80) == 0)
+			return (size_t)length;
+	}
+	return 0;
+}
+
+/// <summary>
+/// Function to get the Process Wide Counters of compress() and decompress().
+/// </summary>
+/// <returns>Stats</returns>
+Codec::Stats Codec::stats() {
+	Stats stats;
+	stats.compressions = compressions.load(std::memory_order_relaxed);
+	stats.rejected = rejected.load(std::memory_order_relaxed);
+	stats.dataBytes = dataBytes.load(std::memory_order_relaxed);
+	stats.frameBytes = frameBytes.load(std::memory_order_relaxed);
+	stats.compressNanos = compressNanos.load(std::memory_order_relaxed);
+	stats.decompressions = decompressions.load(std::memory_order_relaxed);
+	stats.decompressedBytes = decompressedBytes.load(std::memory_order_relaxed);
+	stats.decompressNanos = decompressNanos.load(std::memory_order_relaxed);
+	return stats;
+}
+
+#ifdef TEST_CODEC
+
+#include <random>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test Codec Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	std::string frame, data;
+
+	StringHelper::Title("TESTING CODEC PACKAGE", '=');
+	StringHelper::Title("Test compress and decompress");
+	std::mt19937 random(7);
+	std::string noise(4096, '\0');
+	for (char& byte : noise)
+		byte = (char)random();
+	std::string repeated;
+	while (repeated.size() < 100000)
+		repeated += "Anakin Skywalker, Tatooine, Podracer " + std::to_string(repeated.size() % 7) + "; ";
+	for (const std::string& value : { std::string("Darth Vader"), std::string(1000, 'a'), repeated, noise }) {
+		bool compressed = Codec::compress(value, frame);
+		std::cout << "\n > " << value.size() << " Bytes -> " << frame.size() << " Bytes, Compressed : " << compressed;
+		std::cout << ", Data Size : " << Codec::dataSize(frame) << ", Round Trip : " << (Codec::decompress(frame, data) && data == value);
+	}
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Dictionary");
+	std::vector<std::string> values;
+	for (int index = 0; index < 200; index++)
+		values.push_back("{\"name\":\"trooper" + std::to_string(index) + "\",\"rank\":\"TK-" + std::to_string(random() % 1000)
+			+ "\",\"division\":\"501st Legion\",\"homeworld\":\"Kamino\",\"armor\":\"Phase II\"}");
+	std::vector<std::string_view> samples(values.begin(), values.begin() + 100);
+	const Codec::Dictionary * dictionary = Codec::Dictionary::train(samples);
+	std::cout << "\n > Trained Dictionary : " << (dictionary != nullptr) << ", ID : " << (int)dictionary->id() << ", " << dictionary->content().size() << " Bytes";
+	std::cout << "\n > Found by ID : " << (Codec::Dictionary::find(dictionary->id()) == dictionary);
+	size_t plain = 0, trained = 0, intact = 0;
+	for (size_t index = 100; index < values.size(); index++) {
+		plain += Codec::compress(values[index], frame) ? frame.size() : values[index].size();
+		trained += Codec::compress(values[index], frame, dictionary) ? frame.size() : values[index].size();
+		intact += Codec::decompress(frame, data) && data == values[index];
+	}
+	std::cout << "\n > 100 unseen Values of " << values[100].size() << " Bytes : " << plain << " Bytes without, " << trained << " Bytes with the Dictionary";
+	std::cout << "\n > Round Trips : " << intact << std::endl;
+	putline();
+
+	StringHelper::Title("Test damaged Frames are Detected");
+	Codec::compress(repeated, frame);
+	std::cout << "\n > Truncated : " << Codec::decompress(frame.substr(0, frame.size() / 2), data);
+	std::string damaged = frame;
+	damaged[0] = (char)200;
+	std::cout << "\n > Unknown Dictionary : " << Codec::decompress(damaged, data);
+	damaged = frame;
+	damaged[1] = (char)0x7f;
+	std::cout << "\n > Wrong Data Size : " << Codec::decompress(damaged, data);
+	size_t detected = 0;
+	for (size_t index = 2; index < frame.size(); index++) {
+		damaged = frame;
+		damaged[index] ^= 0x5a;
+		detected += !Codec::decompress(damaged, data) || data != repeated;
+	}
+	std::cout << "\n > Single Byte Damage Detected or Changed the Data : " << detected << " of " << frame.size() - 2 << std::endl;
+	putline();
+
+	StringHelper::Title("Test stats");
+	Codec::Stats stats = Codec::stats();
+	std::cout << "\n > Compressions : " << stats.compressions << ", Rejected : " << stats.rejected << ", Ratio : " << stats.ratio();
+	std::cout << "\n > Decompressions : " << stats.decompressions << ", " << stats.decompressedBytes << " Bytes" << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_CODEC
+
+#ifdef BENCH_CODEC
+
+#include <chrono>
+#include <random>
+#include <iostream>
+
+#include "DBElement.h"
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Benchmark the Codec on Values shaped like small JSON Documents, first
+/// one at a time, then with a Dictionary trained on a sample of them, and to Compare
+/// the Memory and Read cost of Compressed DBElements against plain ones.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [values] [rounds]</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+	size_t rounds = argc > 2 ? std::stoul(argv[2]) : 5;
+	typedef std::chrono::steady_clock Clock;
+	auto elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::nano>(Clock::now() - start).count(); };
+	const char * planets[] = { "Tatooine", "Naboo", "Coruscant", "Kamino", "Hoth", "Endor", "Bespin", "Dagobah" };
+	const char * ranks[] = { "Trooper", "Sergeant", "Lieutenant", "Captain", "Commander" };
+
+	std::mt19937_64 random(42);
+	std::vector<std::string> values;
+	size_t total = 0;
+	for (size_t index = 0; index < count; index++) {
+		values.push_back("{\"id\":" + std::to_string(random() % 10000000) + ",\"name\":\"TK-" + std::to_string(random() % 10000)
+			+ "\",\"rank\":\"" + ranks[random() % 5] + "\",\"homeworld\":\"" + planets[random() % 8] + "\",\"station\":\"" + planets[random() % 8]
+			+ "\",\"division\":\"501st Legion\",\"armor\":{\"model\":\"Phase II\",\"condition\":" + std::to_string(random() % 100)
+			+ "},\"active\":" + (random() % 2 ? "true" : "false") + "}");
+		total += values.back().size();
+	}
+
+	StringHelper::Title("BENCHMARKING CODEC", '=');
+	std::cout << "\n Values : " << count << ", Average Size : " << total / count << " B";
+	std::vector<std::string_view> samples(values.begin(), values.begin() + std::min<size_t>(count, 1000));
+	Clock::time_point start = Clock::now();
+	const Codec::Dictionary * dictionary = Codec::Dictionary::train(samples);
+	std::cout << "\n Dictionary : " << dictionary->content().size() << " B trained on " << samples.size() << " Values in " << elapsed(start) / 1e6 << " ms";
+	for (const Codec::Dictionary * with : { (const Codec::Dictionary*)nullptr, dictionary }) {
+		std::vector<std::string> frames(count);
+		size_t bytes = 0;
+		double compressing = 0, decompressing = 0;
+		std::string data;
+		for (size_t round = 0; round < rounds; round++) {
+			bytes = 0;
+			start = Clock::now();
+			for (size_t index = 0; index < count; index++)
+				bytes += Codec::compress(values[index], frames[index], with) ? frames[index].size() : values[index].size();
+			compressing += elapsed(start);
+			start = Clock::now();
+			for (size_t index = 0; index < count; index++)
+				Codec::decompress(frames[index], data);
+			decompressing += elapsed(start);
+		}
+		std::cout << "\n\n " << (with ? "Trained Dictionary" : "No Dictionary");
+		std::cout << "\n Ratio : " << (double)total / bytes << " (" << total / (1 << 10) << " KB -> " << bytes / (1 << 10) << " KB)";
+		std::cout << "\n Compress : " << compressing / (rounds * count) << " ns/Value, " << total * rounds / compressing * 1000 << " MB/s";
+		std::cout << "\n Decompress : " << decompressing / (rounds * count) << " ns/Value, " << total * rounds / decompressing * 1000 << " MB/s";
+	}
+
+	/* The same Values held as DBElements, with getData paying for the Decompression */
+	for (bool compressed : { false, true }) {
+		std::vector<DBElement> elements;
+		elements.reserve(count);
+		size_t stored = 0, read = 0;
+		for (size_t index = 0; index < count; index++) {
+			elements.emplace_back(values[index]);
+			if (compressed)
+				elements.back().compress(64, dictionary);
+			stored += elements.back().getDataView().size();
+		}
+		start = Clock::now();
+		for (size_t round = 0; round < rounds; round++)
+			for (const DBElement& element : elements)
+				read += element.getData().size();
+		double reading = elapsed(start);
+		std::cout << "\n\n " << (compressed ? "Compressed DBElements" : "Plain DBElements") << "\t Stored Data : " << stored / (1 << 10) << " KB";
+		std::cout << "\n getData : " << reading / (rounds * count) << " ns/Value (" << read / rounds << " Bytes)";
+	}
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_CODEC
@@ -0,0 +1,160 @@
+//////////////////////////////////////////////////////////////////
+// Codec.h          - Fast LZ Compression of DBElement          //
+//                    Data with trained Dictionaries.           //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides Codec class which Compresses the Data of DBElements with
+ * a fast byte oriented LZ77 Codec in the spirit of LZ4 : there is no Entropy Coding,
+ * so Decompressing is little more than copying Literals and earlier Bytes, and
+ * Compressing finds Matches through a single Hash Table of 4 Byte sequences.
+ *
+ * A Frame produced by compress() is laid out as :
+ *   [u8 Dictionary ID][varint Data Length][Sequence]...
+ * and every Sequence is :
+ *   [Token : Literal Length << 4 | Match Length - 4][Literal Length Bytes][Literals]
+ *   [u16 Offset][Match Length Bytes]
+ * A Length of 15 in the Token continues in extra Bytes which are added to it, the
+ * last one being less than 255. The last Sequence only holds Literals. The Offset
+ * counts back from the current position and may reach into the Dictionary.
+ *
+ * Small Values rarely repeat themselves, but they often repeat each other. A
+ * Dictionary is a block of up to MAX_DICTIONARY Bytes which is treated as if it
+ * preceded every Value, so Matches can refer to it. Dictionary::train builds one
+ * from sample Values by picking the Segments whose 8 Byte sequences occur in the
+ * most Samples. Dictionaries are Registered under a one Byte ID which the Frame
+ * records, and live as long as the process, so a Frame can always be Decompressed.
+ * Frames only live in memory : the Write Ahead Log, Snapshots and SSTables store
+ * the Data Decompressed.
+ *
+ * Every call is counted in Process Wide Stats : how many Bytes went in and came
+ * out and how much time Compressing and Decompressing took.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - static bool compress(std::string_view data, std::string& frame, const Dictionary * dictionary)
+ * Method to Compress Data into a Frame, if that makes it smaller.
+ *
+ * - static bool decompress(std::string_view frame, std::string& data)
+ * Method to Decompress a Frame, Checking it is well formed.
+ *
+ * - static size_t dataSize(std::string_view frame)
+ * Method to get the Length of the Data held by a Frame without Decompressing it.
+ *
+ * - static Stats stats()
+ * Method to get the Process Wide Compression Counters.
+ *
+ * - static const Dictionary * Dictionary::train(const std::vector<std::string_view>& samples, size_t capacity)
+ * Method to Build and Register a Dictionary from sample Values.
+ *
+ * - static const Dictionary * Dictionary::create(std::string_view content)
+ * Method to Register a Dictionary with the given content.
+ *
+ * - static const Dictionary * Dictionary::find(uint8_t id)
+ * Method to get a Registered Dictionary by it's ID.
+ *
+ * - uint8_t Dictionary::id() const / std::string_view Dictionary::content() const
+ * Methods to get the ID and the Bytes of a Dictionary.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+/// <summary>
+/// LZ77 Codec for the Data of DBElements.
+/// </summary>
+class Codec {
+public:
+	static const size_t MAX_DICTIONARY = 65535;			// Offsets are 16 bits
+	static const size_t MAX_DICTIONARIES = 255;
+
+	/// <summary>
+	/// Registered block of Bytes every Value Compressed with it may refer to.
+	/// </summary>
+	class Dictionary {
+	private:
+		std::string _content;
+		std::vector<uint32_t> _table;						// Hash Table of the content, Position + 1 of every 4 Byte sequence
+		uint8_t _id;
+
+		explicit Dictionary(std::string_view content);
+		friend class Codec;
+	public:
+		Dictionary(const Dictionary&) = delete;
+		Dictionary& operator=(const Dictionary&) = delete;
+
+		/* Member Functions */
+		static const Dictionary * train(const std::vector<std::string_view>& samples, size_t capacity = 16 << 10);
+		static const Dictionary * create(std::string_view content);
+		static const Dictionary * find(uint8_t id);
+		uint8_t id() const;
+		std::string_view content() const;
+	};
+
+	/// <summary>
+	/// Data at least threshold Bytes large is Compressed, with the Dictionary if set.
+	/// </summary>
+	struct Options {
+		size_t threshold = 0;								// 0 to never Compress
+		const Dictionary * dictionary = nullptr;
+	};
+
+	/// <summary>
+	/// Process Wide Counters of compress() and decompress().
+	/// </summary>
+	struct Stats {
+		uint64_t compressions = 0;							// Frames produced
+		uint64_t rejected = 0;								// Data which did not get smaller and was kept as it is
+		uint64_t dataBytes = 0;								// Bytes of Data which were Compressed into Frames
+		uint64_t frameBytes = 0;							// Bytes of those Frames
+		uint64_t compressNanos = 0;							// Time spent Compressing, rejected Data included
+		uint64_t decompressions = 0;
+		uint64_t decompressedBytes = 0;
+		uint64_t decompressNanos = 0;
+
+		double ratio() const;								// Data Bytes per Frame Byte
+		double nanosPerCompress() const;
+		double nanosPerDecompress() const;
+	};
+private:
+	static const unsigned HASH_LOG = 12;
+	static const size_t MIN_MATCH = 4;
+	static const size_t LAST_LITERALS = 5;					// Matches end at least this many Bytes before the end of the Data
+
+	static uint32_t hash(uint32_t sequence, unsigned hashLog);
+	static void putLength(std::string& out, size_t length);
+	static bool getLength(const unsigned char *& cursor, const unsigned char * end, size_t& length);
+	static void encode(std::string_view data, std::string& out, const Dictionary * dictionary);
+public:
+	/* Member Functions */
+	static bool compress(std::string_view data, std::string& frame, const Dictionary * dictionary = nullptr);
+	static bool decompress(std::string_view frame, std::string& data);
+	static size_t dataSize(std::string_view frame);
+	static Stats stats();
+};
+
+#endif // !CODEC_H
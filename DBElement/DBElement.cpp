@@ -1,8 +1,8 @@
 //////////////////////////////////////////////////////////////////
 // DBElement.cpp    - Defines DBElement Object for use in noSQL //
 //                    Database.                                 //
-// Version          - 1.0                                       //
-// Last Modified    - 08/05/2017                                //
+// Version          - 1.9                                       //
+// Last Modified    - 10/17/2026                                //
 // Language         - Visual C++, Visual Studio 2017            //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
 // Author           - Venkata Bharani Krishna Chekuri           //
@@ -11,31 +11,203 @@
 
 #include "DBElement.h"
 
+#include <algorithm>
+
 /// <summary>
 /// Constructor with Data and Tags as Arguments.
 /// </summary>
 /// <param name="data">Data</param>
 /// <param name="tags">Metadata Tags</param>
-DBElement::DBElement(std::string data, std::unordered_set<std::string> tags) {
-	_data = data;
-	_tags = tags;
+DBElement::DBElement(std::string_view data, const std::unordered_set<std::string>& tags) : _data(data) {
+	for (const std::string& tag : tags)
+		insertTagId(_dictionary->intern(tag));
 	setTimestamp();
 }
 
+/// <summary>
+/// Copy Constructor. The copy Allocates it's Data and Tags from the Default Resource
+/// and Interns it's Tags in the Default TagDictionary.
+/// </summary>
+/// <param name="other">DBElement to Copy</param>
+DBElement::DBElement(const DBElement& other) : _data(other._data), _timestamp(other._timestamp), _compressed(other._compressed), _access(other.getAccess()), _expiry(other._expiry), _version(other._version) {
+	copyTags(other);
+}
+
+/// <summary>
+/// Allocator Extended Copy Constructor. The copy Allocates it's Data and Tags from
+/// the given Resource and Interns it's Tags in the given TagDictionary.
+/// </summary>
+/// <param name="other">DBElement to Copy</param>
+/// <param name="resource">Resource to Allocate Data and Tags from</param>
+/// <param name="dictionary">TagDictionary to Intern Tags in</param>
+DBElement::DBElement(const DBElement& other, std::pmr::memory_resource * resource, TagDictionary * dictionary)
+	: _data(other._data, resource), _timestamp(other._timestamp), _dictionary(dictionary), _compressed(other._compressed), _access(other.getAccess()), _expiry(other._expiry), _version(other._version) {
+	copyTags(other);
+}
+
+/// <summary>
+/// Move Constructor. Steals the Data and Tags, so the DBElement keeps the Resource
+/// and TagDictionary of the moved DBElement.
+/// </summary>
+/// <param name="other">DBElement to Move, left without Data and Tags</param>
+DBElement::DBElement(DBElement&& other) noexcept
+	: _data(std::move(other._data)), _timestamp(other._timestamp), _dictionary(other._dictionary), _compressed(other._compressed), _access(other.getAccess()), _expiry(other._expiry), _version(other._version) {
+	stealTags(other);
+}
+
+/// <summary>
+/// Allocator Extended Move Constructor. Steals the Data and Tags when the other
+/// DBElement uses the same Resource and TagDictionary, copies them otherwise.
+/// </summary>
+/// <param name="other">DBElement to Move</param>
+/// <param name="resource">Resource to Allocate Data and Tags from</param>
+/// <param name="dictionary">TagDictionary to Intern Tags in</param>
+DBElement::DBElement(DBElement&& other, std::pmr::memory_resource * resource, TagDictionary * dictionary)
+	: _data(std::move(other._data), resource), _timestamp(other._timestamp), _dictionary(dictionary), _compressed(other._compressed), _access(other.getAccess()), _expiry(other._expiry), _version(other._version) {
+	if (other.resource() == resource && other._dictionary == dictionary)
+		stealTags(other);
+	else
+		copyTags(other);
+}
+
+/// <summary>
+/// Copy Assignment Operator. Keeps the Resource and TagDictionary of this DBElement.
+/// </summary>
+/// <param name="other">DBElement to Copy</param>
+/// <returns>This DBElement</returns>
+DBElement& DBElement::operator=(const DBElement& other) {
+	if (this == &other)
+		return *this;
+	_data = other._data;
+	_timestamp = other._timestamp;
+	_compressed = other._compressed;
+	_expiry = other._expiry;
+	_version = other._version;
+	setAccess(other.getAccess());
+	_tagCount = 0;
+	copyTags(other);
+	return *this;
+}
+
+/// <summary>
+/// Move Assignment Operator. Keeps the Resource and TagDictionary of this DBElement,
+/// the Tags are only stolen when both DBElements share them.
+/// </summary>
+/// <param name="other">DBElement to Move</param>
+/// <returns>This DBElement</returns>
+DBElement& DBElement::operator=(DBElement&& other) {
+	if (this == &other)
+		return *this;
+	_data = std::move(other._data);
+	_timestamp = other._timestamp;
+	_compressed = other._compressed;
+	_expiry = other._expiry;
+	_version = other._version;
+	setAccess(other.getAccess());
+	_tagCount = 0;
+	if (other.resource() == resource() && other._dictionary == _dictionary) {
+		freeTags();
+		stealTags(other);
+	} else {
+		copyTags(other);
+	}
+	return *this;
+}
+
 /// <summary>
 /// Default Constructor.
 /// </summary>
 DBElement::~DBElement() {
 	_data.clear();
-	_tags.clear();
+	freeTags();
+}
+
+/// <summary>
+/// Method to Grow the Tag ID array to hold at least the given Number of Tag IDs.
+/// Arrays which do not fit inline are Allocated from the DBElement's Resource.
+/// </summary>
+/// <param name="capacity">Required Capacity</param>
+void DBElement::reserveTags(uint32_t capacity) {
+	if (capacity <= _tagCapacity)
+		return;
+	if (capacity < _tagCapacity * 2)
+		capacity = _tagCapacity * 2;
+	uint32_t * tagIds = static_cast<uint32_t*>(resource()->allocate(capacity * sizeof(uint32_t), alignof(uint32_t)));
+	std::copy(_tagIds, _tagIds + _tagCount, tagIds);
+	freeTags();
+	_tagIds = tagIds;
+	_tagCapacity = capacity;
+}
+
+/// <summary>
+/// Method to Free the Tag ID array if it is not stored inline.
+/// </summary>
+void DBElement::freeTags() {
+	if (_tagIds != _inlineTags)
+		resource()->deallocate(_tagIds, _tagCapacity * sizeof(uint32_t), alignof(uint32_t));
+	_tagIds = _inlineTags;
+	_tagCapacity = INLINE_TAGS;
+}
+
+/// <summary>
+/// Method to Copy the Tags of another DBElement. Tag IDs are translated when the
+/// other DBElement uses a different TagDictionary.
+/// </summary>
+/// <param name="other">DBElement whose Tags are Copied</param>
+void DBElement::copyTags(const DBElement& other) {
+	reserveTags(other._tagCount);
+	if (other._dictionary == _dictionary) {
+		std::copy(other._tagIds, other._tagIds + other._tagCount, _tagIds);
+		_tagCount = other._tagCount;
+		return;
+	}
+	for (uint32_t index = 0; index < other._tagCount; index++)
+		_tagIds[index] = _dictionary->intern(other._dictionary->name(other._tagIds[index]));
+	_tagCount = other._tagCount;
+	std::sort(_tagIds, _tagIds + _tagCount);
+}
+
+/// <summary>
+/// Method to take the Tags of another DBElement which uses the same Resource and
+/// TagDictionary. Spilled Tag ID arrays change owner, inline ones are copied. The
+/// other DBElement is left without Tags.
+/// </summary>
+/// <param name="other">DBElement whose Tags are Stolen</param>
+void DBElement::stealTags(DBElement& other) {
+	if (other._tagIds == other._inlineTags) {
+		std::copy(other._inlineTags, other._inlineTags + other._tagCount, _inlineTags);
+	} else {
+		_tagIds = other._tagIds;
+		_tagCapacity = other._tagCapacity;
+		other._tagIds = other._inlineTags;
+		other._tagCapacity = INLINE_TAGS;
+	}
+	_tagCount = other._tagCount;
+	other._tagCount = 0;
+}
+
+/// <summary>
+/// Method to Insert a Tag ID into the sorted Tag ID array without touching the Timestamp.
+/// </summary>
+/// <param name="id">Tag ID</param>
+/// <returns>True if Tag ID is Inserted, False if it was already present</returns>
+bool DBElement::insertTagId(uint32_t id) {
+	uint32_t * position = std::lower_bound(_tagIds, _tagIds + _tagCount, id);
+	if (position != _tagIds + _tagCount && *position == id)
+		return false;
+	size_t offset = position - _tagIds;
+	reserveTags(_tagCount + 1);
+	std::copy_backward(_tagIds + offset, _tagIds + _tagCount, _tagIds + _tagCount + 1);
+	_tagIds[offset] = id;
+	_tagCount++;
+	return true;
 }
 
 /// <summary>
 /// Constructor with Data as Argument.
 /// </summary>
 /// <param name="data">Data</param>
-DBElement::DBElement(std::string data) {
-	_data = data;
+DBElement::DBElement(std::string_view data) : _data(data) {
 	setTimestamp();
 }
 
@@ -62,31 +234,202 @@ long long int DBElement::getlastModified() const {
 	return _timestamp;
 }
 
+/// <summary>
+/// Method to Restore a Last Modified Timestamp which was Recorded earlier.
+/// </summary>
+/// <param name="timestamp">Timestamp in YYYYmmDDHHMMSS Format</param>
+void DBElement::setlastModified(long long int timestamp) {
+	_timestamp = timestamp;
+}
+
+/// <summary>
+/// Method to Set the Expiry Deadline. Does not change the Last Modified Timestamp.
+/// </summary>
+/// <param name="deadline">Milliseconds since the Unix Epoch, 0 to never Expire</param>
+void DBElement::setExpiry(long long int deadline) {
+	_expiry = deadline;
+}
+
+/// <summary>
+/// Method to Retrieve the Expiry Deadline.
+/// </summary>
+/// <returns>Milliseconds since the Unix Epoch, 0 if the DBElement never Expires</returns>
+long long int DBElement::getExpiry() const {
+	return _expiry;
+}
+
+/// <summary>
+/// Method to Check whether the Expiry Deadline has passed.
+/// </summary>
+/// <param name="now">Current time in Milliseconds since the Unix Epoch</param>
+/// <returns>True if the DBElement has a Deadline which is not after now</returns>
+bool DBElement::isExpired(long long int now) const {
+	return _expiry != 0 && _expiry <= now;
+}
+
+/// <summary>
+/// Method to Retrieve the Access Word kept for the Eviction Policy of the DBEngine.
+/// </summary>
+/// <returns>Access Word, 0 if it was never set</returns>
+uint32_t DBElement::getAccess() const {
+	return _access.load(std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Method to Set the Access Word. Callable on a const DBElement since Readers record
+/// their Reads in it, a Relaxed store so concurrent Readers only lose updates.
+/// </summary>
+/// <param name="access">Access Word</param>
+void DBElement::setAccess(uint32_t access) const {
+	_access.store(access, std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Method to Set the Access Word unless another Thread changed it since it was Read,
+/// so a Reader cannot overwrite bits a Writer changed meanwhile.
+/// </summary>
+/// <param name="expected">Access Word the Caller Read</param>
+/// <param name="access">New Access Word</param>
+/// <returns>True if the Access Word was Set</returns>
+bool DBElement::replaceAccess(uint32_t expected, uint32_t access) const {
+	return _access.compare_exchange_strong(expected, access, std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Method to Retrieve the Version, the Sequence Number the DBEngine gave the Write
+/// which created this DBElement.
+/// </summary>
+/// <returns>Version, 0 if the DBElement was not Written by a DBEngine</returns>
+uint64_t DBElement::getVersion() const {
+	return _version;
+}
+
+/// <summary>
+/// Method to Set the Version. Only set before the DBElement is Published.
+/// </summary>
+/// <param name="version">Sequence Number of the Write</param>
+void DBElement::setVersion(uint64_t version) {
+	_version = version;
+}
+
+/// <summary>
+/// Method to Retrieve the older Version this DBElement Replaced. Readers follow the
+/// Link without Locks while the DBEngine may cut it, so it is an Acquire load.
+/// </summary>
+/// <returns>Older Version, NULL if none is kept</returns>
+DBElement * DBElement::getOlder() const {
+	return _older.load(std::memory_order_acquire);
+}
+
+/// <summary>
+/// Method to Link the older Version this DBElement Replaced, or to cut the Link
+/// once no Reader needs the older Versions.
+/// </summary>
+/// <param name="older">Older Version, NULL to cut the Link</param>
+void DBElement::setOlder(DBElement * older) {
+	_older.store(older, std::memory_order_release);
+}
+
 /// <summary>
 /// Method to Set Data variable.
 /// </summary>
 /// <param name="data">Data</param>
 /// <returns></returns>
-std::string DBElement::setData(std::string data) {
+std::string DBElement::setData(std::string_view data) {
 	_data = data;
+	_compressed = false;
 	setTimestamp();
 	return getData();
 }
 
 /// <summary>
-/// Method to Get Data.
+/// Method to Get Data, Decompressed if it is stored Compressed.
 /// </summary>
 /// <returns>Data</returns>
 std::string DBElement::getData() {
-	return _data;
+	return static_cast<const DBElement*>(this)->getData();
 }
 
 /// <summary>
-/// Method to Get Data as const.
+/// Method to Get Data as const, Decompressed if it is stored Compressed.
 /// </summary>
 /// <returns>Data</returns>
 std::string DBElement::getData() const {
-	return _data;
+	if (!_compressed)
+		return std::string(_data);
+	std::string data;
+	Codec::decompress(getDataView(), data);
+	return data;
+}
+
+/// <summary>
+/// Method to Get a View of the stored Data, which is a Codec Frame when the
+/// DBElement is Compressed. The View is valid till the Data is changed or the
+/// DBElement is Destroyed.
+/// </summary>
+/// <returns>View of the stored Data</returns>
+std::string_view DBElement::getDataView() const {
+	return std::string_view(_data.data(), _data.size());
+}
+
+/// <summary>
+/// Method to Get a View of the Data. Data stored as it is is Viewed without copies,
+/// Compressed Data is Decompressed into the buffer and the View points into it.
+/// </summary>
+/// <param name="buffer">String to Decompress into</param>
+/// <returns>View of the Data</returns>
+std::string_view DBElement::getDataView(std::string& buffer) const {
+	if (!_compressed)
+		return getDataView();
+	Codec::decompress(getDataView(), buffer);
+	return buffer;
+}
+
+/// <summary>
+/// Method to get the Length of the Data, without Decompressing it.
+/// </summary>
+/// <returns>Data Length</returns>
+size_t DBElement::getDataSize() const {
+	return _compressed ? Codec::dataSize(getDataView()) : _data.size();
+}
+
+/// <summary>
+/// Method to Compress the Data if it is at least threshold Bytes large and gets
+/// smaller. The Frame replaces the Data in a String of it's own size, so the memory
+/// of the Data is given back to the Resource. The Timestamp is left as it is.
+/// </summary>
+/// <param name="threshold">Smallest Data Length to Compress, 0 to never Compress</param>
+/// <param name="dictionary">Registered Dictionary or nullptr</param>
+/// <returns>True if the Data is now stored Compressed</returns>
+bool DBElement::compress(size_t threshold, const Codec::Dictionary * dictionary) {
+	if (_compressed || threshold == 0 || _data.size() < threshold)
+		return false;
+	std::string frame;
+	if (!Codec::compress(getDataView(), frame, dictionary))
+		return false;
+	std::pmr::string(frame, resource()).swap(_data);
+	_compressed = true;
+	return true;
+}
+
+/// <summary>
+/// Method to store Compressed Data Decompressed again.
+/// </summary>
+void DBElement::decompress() {
+	if (!_compressed)
+		return;
+	std::string data;
+	Codec::decompress(getDataView(), data);
+	std::pmr::string(data, resource()).swap(_data);
+	_compressed = false;
+}
+
+/// <summary>
+/// Method to Check whether the Data is stored Compressed.
+/// </summary>
+/// <returns>True if getDataView() is a Codec Frame</returns>
+bool DBElement::isCompressed() const {
+	return _compressed;
 }
 
 /// <summary>
@@ -94,33 +437,74 @@ std::string DBElement::getData() const {
 /// </summary>
 /// <param name="tag">Tag</param>
 /// <returns>True if Tag Exist, False if otherwise</returns>
-bool DBElement::tagExist(std::string tag) {
-	if (_tags.find(tag) != _tags.end())
-		return true;
-	return false;
+bool DBElement::tagExist(std::string_view tag) const {
+	uint32_t id;
+	if (!_dictionary->find(tag, id))
+		return false;
+	return tagIdExist(id);
 }
 
 /// <summary>
-/// Method to Add Tag to the Metadata Tags.
+/// Method to Check if a Tag ID Exists in Metadata Tags.
 /// </summary>
-/// <param name="tag">Tag</param>
-/// <returns>True if Tag has been Added, False if tag was already present</returns>
-bool DBElement::addTag(std::string tag) {
-	if (tagExist(tag))
+/// <param name="id">Tag ID</param>
+/// <returns>True if Tag ID Exist, False if otherwise</returns>
+bool DBElement::tagIdExist(uint32_t id) const {
+	return std::binary_search(_tagIds, _tagIds + _tagCount, id);
+}
+
+/// <summary>
+/// Method to Add a Tag ID to Metadata Tags.
+/// </summary>
+/// <param name="id">Tag ID Interned in this DBElement's TagDictionary</param>
+/// <returns>True if Tag ID is Inserted, False if Tag ID is already present in Metadata Tags</returns>
+bool DBElement::addTagId(uint32_t id) {
+	if (!insertTagId(id))
+		return false;
+	setTimestamp();
+	return true;
+}
+
+/// <summary>
+/// Method to Remove a Tag ID from Metadata Tags.
+/// </summary>
+/// <param name="id">Tag ID</param>
+/// <returns>True if Tag ID is removed, False if Tag ID is not present in Metadata Tags</returns>
+bool DBElement::removeTagId(uint32_t id) {
+	uint32_t * position = std::lower_bound(_tagIds, _tagIds + _tagCount, id);
+	if (position == _tagIds + _tagCount || *position != id)
 		return false;
-	_tags.insert(tag);
+	std::copy(position + 1, _tagIds + _tagCount, position);
+	_tagCount--;
 	setTimestamp();
 	return true;
 }
 
+/// <summary>
+/// Method to get the sorted Tag IDs of the Metadata Tags.
+/// </summary>
+/// <returns>Array of getTagCount() Tag IDs</returns>
+const uint32_t * DBElement::tagIds() const {
+	return _tagIds;
+}
+
+/// <summary>
+/// Method to Add Tag to the Metadata Tags.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <returns>True if Tag has been Added, False if tag was already present</returns>
+bool DBElement::addTag(std::string_view tag) {
+	return addTagId(_dictionary->intern(tag));
+}
+
 /// <summary>
 /// Method to Add Multiple set of Tags to Metadata Tags.
 /// </summary>
 /// <param name="tags">Vector of Tags</param>
 /// <returns>Number of Tags that have been successfully added</returns>
-size_t DBElement::addTags(std::vector<std::string> tags) {
+size_t DBElement::addTags(const std::vector<std::string>& tags) {
 	size_t inserted = 0;
-	for (std::string tag : tags) {
+	for (const std::string& tag : tags) {
 		if (addTag(tag))
 			inserted++;
 	}
@@ -134,7 +518,15 @@ size_t DBElement::addTags(std::vector<std::string> tags) {
 /// </summary>
 /// <returns>Number of Metadata Tags</returns>
 size_t DBElement::getTagCount() {
-	return _tags.size();
+	return _tagCount;
+}
+
+/// <summary>
+/// Get the count of Metadata Tags as const.
+/// </summary>
+/// <returns>Number of Metadata Tags</returns>
+size_t DBElement::getTagCount() const {
+	return _tagCount;
 }
 
 /// <summary>
@@ -142,12 +534,11 @@ size_t DBElement::getTagCount() {
 /// </summary>
 /// <param name="tag">Tag</param>
 /// <returns>True if Tag is removed, False if Tag is not present in Metadata Tags</returns>
-bool DBElement::removeTag(std::string tag) {
-	if (!tagExist(tag))
+bool DBElement::removeTag(std::string_view tag) {
+	uint32_t id;
+	if (!_dictionary->find(tag, id))
 		return false;
-	_tags.erase(tag);
-	setTimestamp();
-	return true;
+	return removeTagId(id);
 }
 
 /// <summary>
@@ -155,7 +546,10 @@ bool DBElement::removeTag(std::string tag) {
 /// </summary>
 /// <returns>All the Tags Present in Metadata Tags</returns>
 std::unordered_set<std::string> DBElement::getTags() {
-	return _tags;
+	std::unordered_set<std::string> tags;
+	for (uint32_t index = 0; index < _tagCount; index++)
+		tags.insert(_dictionary->name(_tagIds[index]));
+	return tags;
 }
 
 /// <summary>
@@ -163,7 +557,26 @@ std::unordered_set<std::string> DBElement::getTags() {
 /// </summary>
 /// <returns>All the Tags Present in Metadata Tags</returns>
 std::unordered_set<std::string> DBElement::getTags() const {
-	return _tags;
+	std::unordered_set<std::string> tags;
+	for (uint32_t index = 0; index < _tagCount; index++)
+		tags.insert(_dictionary->name(_tagIds[index]));
+	return tags;
+}
+
+/// <summary>
+/// Method to get the Resource from which Data and Tags are Allocated.
+/// </summary>
+/// <returns>Memory Resource of the DBElement</returns>
+std::pmr::memory_resource * DBElement::resource() const {
+	return _data.get_allocator().resource();
+}
+
+/// <summary>
+/// Method to get the TagDictionary in which Tags are Interned.
+/// </summary>
+/// <returns>TagDictionary of the DBElement</returns>
+TagDictionary * DBElement::dictionary() const {
+	return _dictionary;
 }
 
 /// <summary>
@@ -172,25 +585,31 @@ std::unordered_set<std::string> DBElement::getTags() const {
 /// <returns>DBElement in a nicely Formatter Manner</returns>
 std::string DBElement::show() {
 	std::string aggregator;
-	aggregator.append(" Data      : " + getData() + "\n");
-	aggregator.append(" Timestamp : " + Utilities::TimeHelper::timestamptoStrimg(_timestamp) + "\n");
+	show(aggregator);
+	return aggregator;
+}
+
+/// <summary>
+/// Method to Append DBElement in a nice Formatted Manner to a String. Data and Tags
+/// are appended straight from the DBElement without intermediate copies.
+/// </summary>
+/// <param name="aggregator">String to which the DBElement is Appended</param>
+void DBElement::show(std::string& aggregator) const {
+	std::string buffer;
+	aggregator.append(" Data      : ").append(getDataView(buffer)).append("\n");
+	aggregator.append(" Timestamp : ").append(Utilities::TimeHelper::timestamptoStrimg(_timestamp)).append("\n");
 	aggregator.append(" Tags      : ");
-	if (_tags.empty()) {
+	if (_tagCount == 0) {
 		aggregator.append("\"N/A\"\n");
 	} else {
 		bool first = true;
-		for (std::string tag : _tags) {
-			if (first) {
-				aggregator.append("\"" + tag + "\"");
-				first = false;
-			}
-			else {
-				aggregator.append(", \"" + tag + "\"");
-			}
+		for (uint32_t index = 0; index < _tagCount; index++) {
+			const std::string& tag = _dictionary->name(_tagIds[index]);
+			aggregator.append(first ? "\"" : ", \"").append(tag).append("\"");
+			first = false;
 		}
 		aggregator.push_back('\n');
 	}
-	return aggregator;
 }
 
 #ifdef TEST_DBELEMENT
@@ -250,6 +669,66 @@ int main(int argc, char* argv[]) {
 	std::cout << "\n > Tag Exists : " << object->tagExist("Sith") << std::endl;
 	putline();
 
+	StringHelper::Title("Test Tag IDs");
+	std::cout << "\n Add Tags := 'Jedi', 'Padawan', 'Tatooine', 'Podracer' to DBElement";
+	object->addTags({ "Jedi", "Padawan", "Tatooine", "Podracer" });
+	std::cout << "\n > DBElement Tag IDs : ";
+	for (size_t index = 0; index < object->getTagCount(); index++) {
+		uint32_t id = object->tagIds()[index];
+		std::cout << id << ":\"" << object->dictionary()->name(id) << "\" ";
+	}
+	std::cout << "\n > Copy has same Tag Count : " << (DBElement(*object).getTagCount() == object->getTagCount()) << std::endl;
+	putline();
+
+	StringHelper::Title("Test Move Constructor, getDataView and forEachTag");
+	DBElement copy(*object);
+	DBElement moved(std::move(copy));
+	std::cout << "\n > Moved Data : " << moved.getDataView() << ", Tags left in Source : " << copy.getTagCount();
+	std::cout << "\n > Moved Tags : ";
+	moved.forEachTag([](const std::string& tag) { std::cout << "\"" << tag << "\" "; });
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test compress Method");
+	DBElement compressed(std::string(4000, 'R') + "2-D2", { "Droid" });
+	std::string buffer;
+	std::cout << "\n > Below Threshold Compressed : " << compressed.compress(5000);
+	std::cout << "\n > Compressed : " << compressed.compress(1000) << ", isCompressed : " << compressed.isCompressed();
+	std::cout << "\n > Stored Bytes : " << compressed.getDataView().size() << ", Data Size : " << compressed.getDataSize();
+	std::cout << "\n > getData Tail : " << compressed.getData().substr(3998) << ", getDataView(buffer) Tail : " << compressed.getDataView(buffer).substr(3998);
+	std::cout << "\n > Copy isCompressed : " << DBElement(compressed).isCompressed();
+	compressed.decompress();
+	std::cout << "\n > Decompressed Stored Bytes : " << compressed.getDataView().size() << ", isCompressed : " << compressed.isCompressed() << std::endl;
+	putline();
+
+	StringHelper::Title("Test Expiry Deadline");
+	std::cout << "\n > Default Expiry : " << object->getExpiry() << ", isExpired : " << object->isExpired(4102444800000LL);
+	object->setExpiry(1000);
+	std::cout << "\n > isExpired before Deadline : " << object->isExpired(999) << ", at Deadline : " << object->isExpired(1000);
+	std::cout << "\n > Copy Expiry : " << DBElement(*object).getExpiry() << std::endl;
+	object->setExpiry(0);
+	putline();
+
+	StringHelper::Title("Test Access Word");
+	std::cout << "\n > Default Access : " << object->getAccess();
+	object->setAccess(0xABCDEF05);
+	std::cout << "\n > Access : " << std::hex << object->getAccess() << ", Copy Access : " << DBElement(*object).getAccess() << std::dec;
+	bool stale = object->replaceAccess(0, 1), replaced = object->replaceAccess(0xABCDEF05, 0xABCDEF06);
+	std::cout << "\n > Stale replaceAccess : " << stale << ", replaceAccess : " << replaced << ", Access : " << std::hex << object->getAccess() << std::dec;
+	std::cout << "\n > sizeof(DBElement) : " << sizeof(DBElement) << std::endl;
+	object->setAccess(0);
+	putline();
+
+	StringHelper::Title("Test Versions");
+	DBElement older("Older");
+	object->setVersion(7);
+	object->setOlder(&older);
+	DBElement version(*object);
+	std::cout << "\n > Version : " << object->getVersion() << ", Older : " << object->getOlder()->getData();
+	std::cout << "\n > Copy Version : " << version.getVersion() << ", Copy has no Older : " << (version.getOlder() == nullptr) << std::endl;
+	object->setOlder(nullptr);
+	putline();
+
 	StringHelper::Title("Test show Method");
 	std::cout << "\n" << object->show();
 	putline();
@@ -1,8 +1,8 @@
 //////////////////////////////////////////////////////////////////
 // DBElement.h	    - Defines DBElement Object for use in noSQL //
 //                    Database.                                 //
-// Version          - 1.0                                       //
-// Last Modified    - 08/05/2017                                //
+// Version          - 1.9                                       //
+// Last Modified    - 10/17/2026                                //
 // Language         - Visual C++, Visual Studio 2017            //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
 // Author           - Venkata Bharani Krishna Chekuri           //
@@ -14,17 +14,70 @@
  * This package provides DBElement class and methods to perform operations on it.
  * The DBElement class holds data and metadata to and has methods to set and get
  * them.
+ *
+ * The Data and Tags of a DBElement are allocated from a std::pmr::memory_resource.
+ * DBElements created by users use the Default Resource (the heap), DBEngine copies
+ * them into it's own SlabAllocator using the Allocator Extended Copy Constructor.
+ * Copying a DBElement using the Copy Constructor always allocates from the Default
+ * Resource so copies handed back to users do not depend on the DBEngine.
+ *
+ * Tags are not stored as Strings. Each Tag is Interned in a TagDictionary and the
+ * DBElement keeps a sorted array of Tag IDs, the first few of them inline, so
+ * checking, adding and removing Tags compares integers. DBElements created by users
+ * use the Default TagDictionary, DBEngine copies them into it's own TagDictionary.
+ *
+ * Data can be stored Compressed with Codec. compress() replaces Data of at least a
+ * threshold Length with a Codec Frame when that is smaller, optionally against a
+ * trained Codec::Dictionary, and getData() and show() Decompress it transparently.
+ * getDataView() always Views the stored Bytes, so it is a Frame when isCompressed()
+ * is set : readers which want the Data either pass a buffer to getDataView(buffer),
+ * which only Decompresses into it when it has to, or handle the Frame themselves.
+ *
+ * A DBElement may carry an Expiry Deadline in Milliseconds since the Unix Epoch, after
+ * which DBEngine treats it's Key as Removed. The Deadline is Metadata only, it is
+ * Copied along with the DBElement and is not shown.
+ *
+ * Every DBElement also carries a 32 bit Access Word for the Eviction Policy of the
+ * DBEngine (recency and frequency of Reads). It is an atomic which Readers may set
+ * through a const DBElement, is Copied along with the DBElement and means nothing
+ * to the DBElement itself.
+ *
+ * DBEngine keeps old Versions of a DBElement for Readers of an older point in time.
+ * Every DBElement carries the Version (the DBEngine's Sequence Number of the Write
+ * which created it) and a Link to the Version it Replaced. The Version is Copied
+ * along with the DBElement, the Link is not since it belongs to the DBEngine.
+ *
+ * Data and Tags are passed as std::string_view and can be read without copies using
+ * getDataView and forEachTag. Moving a DBElement steals it's Data and Tags, the
+ * Allocator Extended Move Constructor only steals them when the Resource and the
+ * TagDictionary are the same and copies them otherwise.
  * 
  *
  * PACKAGE OPERATIONS
  * ------------------
- * - DBElement(std::string data)
+ * - DBElement(std::string_view data)
  * Constructor with Data as Argument.
  *
- * - DBElement(std::string data, std::unordered_set<std::string> tags)
+ * - DBElement(std::string_view data, const std::unordered_set<std::string>& tags)
  * Constructor with Data and Tags Arguments.
+ *
+ * - DBElement(DBElement&& other)
+ * Move Constructor. Keeps the Resource and TagDictionary of the moved DBElement.
+ *
+ * - DBElement(const DBElement& other, std::pmr::memory_resource * resource, TagDictionary * dictionary)
+ * Allocator Extended Copy Constructor. Allocates Data and Tags of the copy from the Resource
+ * and Interns it's Tags in the Dictionary.
+ *
+ * - DBElement(DBElement&& other, std::pmr::memory_resource * resource, TagDictionary * dictionary)
+ * Allocator Extended Move Constructor.
+ *
+ * - std::pmr::memory_resource * resource() const
+ * Method to get the Resource from which Data and Tags are Allocated.
+ *
+ * - TagDictionary * dictionary() const
+ * Method to get the TagDictionary in which Tags are Interned.
  * 
- * - std::string setData(std::string data)
+ * - std::string setData(std::string_view data)
  * Method to Set Data.
  *
  * - std::string getData()
@@ -33,39 +86,97 @@
  * - std::string getData() const
  * Method to Get Data as const String.
  *
- * - bool addTag(std::string tag)
+ * - std::string_view getDataView() const
+ * Method to Get a View of the stored Data without copying it, a Codec Frame if it is Compressed.
+ *
+ * - std::string_view getDataView(std::string& buffer) const
+ * Method to Get a View of the Data, Decompressing into the buffer only if it is Compressed.
+ *
+ * - size_t getDataSize() const
+ * Method to Get the Length of the Data without Decompressing it.
+ *
+ * - bool compress(size_t threshold, const Codec::Dictionary * dictionary)
+ * Method to store the Data Compressed if it is at least threshold Bytes and gets smaller.
+ *
+ * - void decompress()
+ * Method to store Compressed Data Decompressed again.
+ *
+ * - bool isCompressed() const
+ * Method to Check whether the Data is stored Compressed.
+ *
+ * - bool addTag(std::string_view tag)
  * Method to Add Tag to Metadata Tags.
  *
- * - size_t addTags(std::vector<std::string> tags)
+ * - size_t addTags(const std::vector<std::string>& tags)
  * Method to Add Multiple Tags to Metadata Tags.
  * 
- * - bool removeTag(std::string tag)
+ * - bool removeTag(std::string_view tag)
  * Method to Remove Tag from Metadata Tags.
  * 
- * - bool tagExist(std::string tag)
+ * - bool tagExist(std::string_view tag) const
  * Method to Check if a Tag exists in Metadata Tags.
  *
+ * - bool addTagId(uint32_t id), bool removeTagId(uint32_t id), bool tagIdExist(uint32_t id)
+ * Methods to Add, Remove and Check Tags using their Tag IDs.
+ *
+ * - const uint32_t * tagIds() const
+ * Method to get the sorted Tag IDs of the Metadata Tags (getTagCount() of them).
+ *
  * - std::unordered_set<std::string> getTags()
  * Method to get all the Metadata Tags.
  *
  * - std::unordered_set<std::string> getTags() const
  * Method to get all the Metadata Tags as const String.
  *
+ * - void forEachTag(Function function) const
+ * Method to call function(tag) for every Metadata Tag without building a set.
+ *
  * - size_t getTagCount()
  * Method to Get the Number of Tags in the Metadata Tags.
  *
+ * - size_t getTagCount() const
+ * Method to Get the Number of Tags in the Metadata Tags as const.
+ *
  * - long long int getlastModified()
  * Method to get the Last Modified Timestamp as long long int in YYYYmmDDHHMMSS Format.
  * 
  * - long long int getlastModified() const
  * Method to get the Last Modified Timestamp as const long long int in YYYYmmDDHHMMSS Format.
  * 
+ * - void setlastModified(long long int timestamp)
+ * Method to Restore a Last Modified Timestamp, used when Replaying a Log.
+ * 
+ * - void setExpiry(long long int deadline)
+ * Method to set the Expiry Deadline in Milliseconds since the Unix Epoch, 0 to never Expire.
+ *
+ * - long long int getExpiry() const
+ * Method to get the Expiry Deadline, 0 if the DBElement never Expires.
+ *
+ * - bool isExpired(long long int now) const
+ * Method to Check whether the Expiry Deadline has passed at the given time.
+ *
+ * - uint32_t getAccess() const / void setAccess(uint32_t access) const
+ * Methods to get and set the Access Word kept for the Eviction Policy of the DBEngine.
+ *
+ * - bool replaceAccess(uint32_t expected, uint32_t access) const
+ * Method to set the Access Word only if it still holds the expected value.
+ *
+ * - uint64_t getVersion() const / void setVersion(uint64_t version)
+ * Methods to get and set the Sequence Number of the Write which created this Version.
+ *
+ * - DBElement * getOlder() const / void setOlder(DBElement * older)
+ * Methods to get and set the Link to the Version this DBElement Replaced.
+ *
  * - std::string show();
  * Method to get the DBElement Contents in a Nicely Formatted Manner.
  *
+ * - void show(std::string& aggregator) const
+ * Method to Append the DBElement Contents in a Nicely Formatted Manner to a String.
+ *
  *
  * REQUIRED FILES
  * --------------
+ * TagDictionary.h, TagDictionary.cpp, TagTrie.h, TagTrie.cpp, Codec.h, Codec.cpp,
  * Utilities.h, Utilities.cpp
  *
  *
@@ -79,14 +190,50 @@
  * ver 1.0 : 08/05/2017
  * - First release.
  *
+ * ver 1.1 : 10/17/2026
+ * - Data and Tags are Allocated from a std::pmr::memory_resource.
+ *
+ * ver 1.2 : 10/17/2026
+ * - Tags are stored as a small inline array of Tag IDs Interned in a TagDictionary.
+ *
+ * ver 1.3 : 10/17/2026
+ * - Data and Tags are taken as std::string_view.
+ * - Added Move Constructors, Move Assignment, getDataView() and forEachTag().
+ *
+ * ver 1.4 : 10/17/2026
+ * - Added const getTagCount() and show(aggregator) which Appends without copying
+ *   the Data.
+ *
+ * ver 1.5 : 10/17/2026
+ * - Added setlastModified() to Restore Timestamps of Logged DBElements.
+ *
+ * ver 1.6 : 10/17/2026
+ * - Data can be stored Compressed with Codec, added compress(), decompress(),
+ *   isCompressed(), getDataSize() and getDataView(buffer).
+ *
+ * ver 1.7 : 10/17/2026
+ * - Added an Expiry Deadline, setExpiry(), getExpiry() and isExpired().
+ *
+ * ver 1.8 : 10/17/2026
+ * - Added an atomic Access Word for Eviction, getAccess(), setAccess() and replaceAccess().
+ *
+ * ver 1.9 : 10/17/2026
+ * - Added a Version and a Link to the older Version for Multi Version Reads,
+ *   getVersion(), setVersion(), getOlder() and setOlder().
+ *
  */
 #ifndef DBELEMENT_H
 #define DBELEMENT_H
 
+#include "Codec.h"
+#include "TagDictionary.h"
 #include "../Utilities/Utilities.h"
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <unordered_set>
+#include <memory_resource>
 
 /// <summary>
 /// Class to hold Objects which can be Inserted into DBEngine. Stores Data
@@ -95,34 +242,93 @@
 /// </summary>
 class DBElement {
 private:
-	std::string _data;							// data
-	long long int _timestamp;					// metadata timestamp
-	std::unordered_set<std::string> _tags;		// metadata tags
+	static const uint32_t INLINE_TAGS = 4;
+
+	std::pmr::string _data;												// data
+	long long int _timestamp;											// metadata timestamp
+	TagDictionary * _dictionary = TagDictionary::defaultDictionary();	// dictionary in which metadata tags are interned
+	uint32_t * _tagIds = _inlineTags;									// metadata tag ids (sorted)
+	uint32_t _tagCount = 0;												// number of metadata tags
+	uint32_t _tagCapacity = INLINE_TAGS;								// capacity of the tag id array
+	uint32_t _inlineTags[INLINE_TAGS];									// inline storage for the first few tag ids
+	bool _compressed = false;											// data holds a codec frame
+	mutable std::atomic<uint32_t> _access{ 0 };							// access word of the eviction policy, set by readers
+	long long int _expiry = 0;											// expiry deadline in milliseconds since the unix epoch, 0 if never
+	uint64_t _version = 0;												// sequence number of the write which created this version
+	std::atomic<DBElement*> _older{ nullptr };							// version this one replaced, kept for older readers, not copied
 
 	/* Member Functions */
 	void setTimestamp();
+	bool insertTagId(uint32_t id);
+	void reserveTags(uint32_t capacity);
+	void copyTags(const DBElement& other);
+	void stealTags(DBElement& other);
+	void freeTags();
 public:
 	/* Constructors */
-	DBElement(std::string data);
-	DBElement(std::string data, std::unordered_set<std::string> tags);
+	DBElement(std::string_view data);
+	DBElement(std::string_view data, const std::unordered_set<std::string>& tags);
+	DBElement(const DBElement& other);
+	DBElement(const DBElement& other, std::pmr::memory_resource * resource, TagDictionary * dictionary);
+	DBElement(DBElement&& other) noexcept;
+	DBElement(DBElement&& other, std::pmr::memory_resource * resource, TagDictionary * dictionary);
+	DBElement& operator=(const DBElement& other);
+	DBElement& operator=(DBElement&& other);
 
 	/* Destructor */
 	~DBElement();
 
 	/* Member Functions */
-	std::string setData(std::string data);
+	std::string setData(std::string_view data);
 	std::string getData();
 	std::string getData() const;
-	bool addTag(std::string tag);
-	size_t addTags(std::vector<std::string> tags);
-	bool removeTag(std::string tag);
-	bool tagExist(std::string tag);
+	std::string_view getDataView() const;
+	std::string_view getDataView(std::string& buffer) const;
+	size_t getDataSize() const;
+	bool compress(size_t threshold, const Codec::Dictionary * dictionary = nullptr);
+	void decompress();
+	bool isCompressed() const;
+	bool addTag(std::string_view tag);
+	size_t addTags(const std::vector<std::string>& tags);
+	bool removeTag(std::string_view tag);
+	bool tagExist(std::string_view tag) const;
+	bool addTagId(uint32_t id);
+	bool removeTagId(uint32_t id);
+	bool tagIdExist(uint32_t id) const;
+	const uint32_t * tagIds() const;
 	std::unordered_set<std::string> getTags();
 	std::unordered_set<std::string> getTags() const;
+	template <typename Function> void forEachTag(Function function) const;
 	size_t getTagCount();
+	size_t getTagCount() const;
 	long long int getlastModified();
 	long long int getlastModified() const;
+	void setlastModified(long long int timestamp);
+	void setExpiry(long long int deadline);
+	long long int getExpiry() const;
+	bool isExpired(long long int now) const;
+	uint32_t getAccess() const;
+	void setAccess(uint32_t access) const;
+	bool replaceAccess(uint32_t expected, uint32_t access) const;
+	uint64_t getVersion() const;
+	void setVersion(uint64_t version);
+	DBElement * getOlder() const;
+	void setOlder(DBElement * older);
+	std::pmr::memory_resource * resource() const;
+	TagDictionary * dictionary() const;
 	std::string show();
+	void show(std::string& aggregator) const;
 };
 
+/// <summary>
+/// Method to call function(tag) for every Metadata Tag in Tag ID order. The Tags
+/// are read from the TagDictionary so no Strings are copied.
+/// </summary>
+/// <param name="function">Function accepting (const std::string&amp;)</param>
+template <typename Function>
+void DBElement::forEachTag(Function function) const {
+	for (uint32_t index = 0; index < _tagCount; index++)
+		function(_dictionary->name(_tagIds[index]));
+}
+
 #endif // !DBELEMENT_H
@@ -0,0 +1,179 @@
+//////////////////////////////////////////////////////////////////
+// TagDictionary.cpp - Interns Tags of DBElements as dense      //
+//                     32-bit Tag IDs.                          //
+// Version          - 1.2                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "TagDictionary.h"
+
+#include <mutex>
+
+/// <summary>
+/// Function to get the Process Wide TagDictionary used by DBElements which
+/// are not in a DBEngine.
+/// </summary>
+/// <returns>Default TagDictionary</returns>
+TagDictionary * TagDictionary::defaultDictionary() {
+	static TagDictionary dictionary;
+	return &dictionary;
+}
+
+/// <summary>
+/// Function to get the Tag ID of a Tag, assigning the next Tag ID if the Tag
+/// was not seen before.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <returns>Tag ID of the Tag</returns>
+uint32_t TagDictionary::intern(std::string_view tag) {
+	{
+		std::shared_lock<std::shared_mutex> lock(_lock);
+		auto index = _ids.find(tag);
+		if (index != _ids.end())
+			return index->second;
+	}
+	std::unique_lock<std::shared_mutex> lock(_lock);
+	auto index = _ids.find(tag);
+	if (index != _ids.end())
+		return index->second;
+	uint32_t id = static_cast<uint32_t>(_names.size());
+	_names.emplace_back(tag);
+	_ids.emplace(_names.back(), id);
+	_trie.insert(tag, id);
+	return id;
+}
+
+/// <summary>
+/// Function to get the Tag ID of a Tag without assigning a new one.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <param name="id">Set to the Tag ID if the Tag is present</param>
+/// <returns>True if the Tag is present in the Dictionary, False if otherwise</returns>
+bool TagDictionary::find(std::string_view tag, uint32_t& id) {
+	std::shared_lock<std::shared_mutex> lock(_lock);
+	auto index = _ids.find(tag);
+	if (index == _ids.end())
+		return false;
+	id = index->second;
+	return true;
+}
+
+/// <summary>
+/// Function to get the Tag String of a Tag ID. The returned reference stays
+/// valid for the lifetime of the Dictionary.
+/// </summary>
+/// <param name="id">Tag ID</param>
+/// <returns>Tag String</returns>
+const std::string& TagDictionary::name(uint32_t id) {
+	std::shared_lock<std::shared_mutex> lock(_lock);
+	return _names[id];
+}
+
+/// <summary>
+/// Function to get the Tag IDs of the Tags starting with a Prefix.
+/// </summary>
+/// <param name="prefix">Prefix, empty for every Tag</param>
+/// <returns>Tag IDs, in the order of their Tags</returns>
+std::vector<uint32_t> TagDictionary::matchPrefix(std::string_view prefix) {
+	std::vector<uint32_t> ids;
+	std::shared_lock<std::shared_mutex> lock(_lock);
+	_trie.matchPrefix(prefix, ids);
+	return ids;
+}
+
+/// <summary>
+/// Function to get the Tag IDs of the Tags matching a Glob Pattern, where ? matches
+/// a character and * a run of characters within a '/' Separated Segment, and **
+/// matches across Segments.
+/// </summary>
+/// <param name="pattern">Glob Pattern</param>
+/// <returns>Tag IDs, each once</returns>
+std::vector<uint32_t> TagDictionary::matchGlob(std::string_view pattern) {
+	std::vector<uint32_t> ids;
+	std::shared_lock<std::shared_mutex> lock(_lock);
+	_trie.matchGlob(pattern, ids);
+	return ids;
+}
+
+/// <summary>
+/// Function to get the Number of Tags in the Dictionary.
+/// </summary>
+/// <returns>Number of Tags</returns>
+size_t TagDictionary::size() {
+	std::shared_lock<std::shared_mutex> lock(_lock);
+	return _names.size();
+}
+
+#ifdef TEST_TAGDICTIONARY
+
+#include <thread>
+#include <vector>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test TagDictionary Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	TagDictionary dictionary;
+
+	StringHelper::Title("TESTING TAGDICTIONARY PACKAGE", '=');
+	StringHelper::Title("Test intern Method");
+	std::cout << "\n > Tag ID of \"Jedi\" : " << dictionary.intern("Jedi");
+	std::cout << "\n > Tag ID of \"Sith\" : " << dictionary.intern("Sith");
+	std::cout << "\n > Tag ID of \"Jedi\" again : " << dictionary.intern("Jedi") << std::endl;
+	putline();
+
+	StringHelper::Title("Test find and name Methods");
+	uint32_t id = TagDictionary::INVALID;
+	std::cout << "\n > Found \"Sith\" : " << dictionary.find("Sith", id) << ", Tag ID : " << id << ", Name : " << dictionary.name(id);
+	std::cout << "\n > Found \"Droid\" : " << dictionary.find("Droid", id) << std::endl;
+	putline();
+
+	StringHelper::Title("Test matchPrefix and matchGlob Methods");
+	for (const char * tag : { "region/us/east", "region/us/west", "region/eu/east" })
+		dictionary.intern(tag);
+	std::cout << "\n > Prefix \"region/us/\" :";
+	for (uint32_t match : dictionary.matchPrefix("region/us/"))
+		std::cout << " " << dictionary.name(match);
+	std::cout << "\n > Glob \"region/*/east\" :";
+	for (uint32_t match : dictionary.matchGlob("region/*/east"))
+		std::cout << " " << dictionary.name(match);
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Concurrent intern");
+	std::vector<std::thread> threads;
+	for (int thread = 0; thread < 4; thread++) {
+		threads.push_back(std::thread([&dictionary]() {
+			for (int index = 0; index < 10000; index++) {
+				std::string tag = "tag" + std::to_string(index);
+				if (dictionary.name(dictionary.intern(tag)) != tag)
+					std::cout << "\n > Mismatch for " << tag;
+			}
+		}));
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+	std::cout << "\n > Tags in Dictionary : " << dictionary.size() << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_TAGDICTIONARY
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////
+// TagDictionary.h  - Interns Tags of DBElements as dense       //
+//                    32-bit Tag IDs.                           //
+// Version          - 1.2                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides TagDictionary class which maps Tag Strings to dense 32-bit
+ * Tag IDs and back. Every Tag String is stored exactly once no matter how many
+ * DBElements carry it, DBElements and the DBEngine Tag Index only store Tag IDs.
+ *
+ * Tag IDs are handed out in the order Tags are first seen starting from 0, and are
+ * never reused or removed, so a Tag ID stays valid for the lifetime of the
+ * TagDictionary. Every DBEngine owns a TagDictionary, DBElements which are not in a
+ * DBEngine use the Default TagDictionary.
+ *
+ * Lookups take std::string_view and are served straight from the Map keyed on
+ * views of the stored Tag Strings, so looking up a Tag never Allocates.
+ *
+ * Every Tag is also added to a TagTrie, so the Tag IDs of the Tags starting with a
+ * Prefix or matching a Glob Pattern such as "region/??/east" are found without testing
+ * every Tag (see TagTrie).
+ *
+ * The TagDictionary is Thread Safe. Lookups run in parallel, Interning a new Tag
+ * briefly blocks them.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - static TagDictionary * defaultDictionary()
+ * Method to get the Process Wide TagDictionary used by DBElements outside a DBEngine.
+ *
+ * - uint32_t intern(std::string_view tag)
+ * Method to get the Tag ID of a Tag, assigning a new one if the Tag was not seen before.
+ *
+ * - bool find(std::string_view tag, uint32_t& id)
+ * Method to get the Tag ID of a Tag without assigning a new one.
+ *
+ * - const std::string& name(uint32_t id)
+ * Method to get the Tag String of a Tag ID.
+ *
+ * - std::vector<uint32_t> matchPrefix(std::string_view prefix)
+ * Method to get the Tag IDs of the Tags starting with a Prefix.
+ *
+ * - std::vector<uint32_t> matchGlob(std::string_view pattern)
+ * Method to get the Tag IDs of the Tags matching a Glob Pattern using ?, * and **.
+ *
+ * - size_t size()
+ * Method to get the Number of Tags in the TagDictionary.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * TagTrie.h, TagTrie.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - intern and find take std::string_view.
+ *
+ * ver 1.2 : 10/17/2026
+ * - Tags are kept in a TagTrie, added matchPrefix() and matchGlob().
+ *
+ */
+#ifndef TAGDICTIONARY_H
+#define TAGDICTIONARY_H
+
+#include "TagTrie.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <shared_mutex>
+#include <unordered_map>
+
+/// <summary>
+/// Thread Safe Dictionary which Interns Tag Strings as dense Tag IDs.
+/// </summary>
+class TagDictionary {
+private:
+	std::shared_mutex _lock;									// Reader/Writer Lock guarding the Dictionary
+	std::deque<std::string> _names;								// Tag Strings indexed by Tag ID
+	std::unordered_map<std::string_view, uint32_t> _ids;		// Tag IDs keyed by views of the Tag Strings
+	TagTrie _trie;												// Tag IDs keyed by the Tag Strings in order
+public:
+	static const uint32_t INVALID = UINT32_MAX;
+
+	/* Constructor */
+	TagDictionary() = default;
+	TagDictionary(const TagDictionary&) = delete;
+	TagDictionary& operator=(const TagDictionary&) = delete;
+
+	/* Member Functions */
+	static TagDictionary * defaultDictionary();
+	uint32_t intern(std::string_view tag);
+	bool find(std::string_view tag, uint32_t& id);
+	const std::string& name(uint32_t id);
+	std::vector<uint32_t> matchPrefix(std::string_view prefix);
+	std::vector<uint32_t> matchGlob(std::string_view pattern);
+	size_t size();
+};
+
+#endif // !TAGDICTIONARY_H
@@ -0,0 +1,323 @@
+//////////////////////////////////////////////////////////////////
+// TagTrie.cpp      - Compressed Trie of Tag Names for          //
+//                    Prefix and Glob Tag Lookups.              //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "TagTrie.h"
+
+#include <algorithm>
+
+/// <summary>
+/// Function to find where a Child whose Label starts with a character is, or
+/// would be Inserted. Children are ordered like std::string orders characters.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="first">First character of the Label</param>
+/// <returns>Position of the Child</returns>
+size_t TagTrie::childIndex(const Node * node, char first) {
+	auto child = std::lower_bound(node->children.begin(), node->children.end(), first,
+		[](const std::unique_ptr<Node>& left, char right) { return (unsigned char)left->label[0] < (unsigned char)right; });
+	return (size_t)(child - node->children.begin());
+}
+
+/// <summary>
+/// Function to add a Tag and it's Tag ID. Descends while the Tag matches the Labels,
+/// Splits the Edge where the Tag branches off in the middle of a Label and hangs the
+/// rest of the Tag below as a new Leaf.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <param name="id">Tag ID</param>
+void TagTrie::insert(std::string_view tag, uint32_t id) {
+	Node * node = &_root;
+	size_t position = 0;
+	while (position < tag.size()) {
+		size_t index = childIndex(node, tag[position]);
+		if (index == node->children.size() || node->children[index]->label[0] != tag[position]) {
+			std::unique_ptr<Node> leaf(new Node());
+			leaf->label.assign(tag.substr(position));
+			leaf->id = id;
+			node->children.insert(node->children.begin() + index, std::move(leaf));
+			_nodes++;
+			_size++;
+			return;
+		}
+		Node * child = node->children[index].get();
+		size_t common = 1;
+		while (common < child->label.size() && position + common < tag.size() && child->label[common] == tag[position + common])
+			common++;
+		if (common < child->label.size()) {
+			std::unique_ptr<Node> middle(new Node());
+			middle->label = child->label.substr(0, common);
+			child->label.erase(0, common);
+			middle->children.push_back(std::move(node->children[index]));
+			node->children[index] = std::move(middle);
+			child = node->children[index].get();
+			_nodes++;
+		}
+		node = child;
+		position += common;
+	}
+	if (node->id == NONE)
+		_size++;
+	node->id = id;
+}
+
+/// <summary>
+/// Function to Append the Tag IDs of a Node and of every Node below it, in Tag order.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="ids">Tag IDs to Append to</param>
+void TagTrie::collect(const Node * node, std::vector<uint32_t>& ids) {
+	if (node->id != NONE)
+		ids.push_back(node->id);
+	for (const std::unique_ptr<Node>& child : node->children)
+		collect(child.get(), ids);
+}
+
+/// <summary>
+/// Function to Append the Tag IDs of the Tags starting with a Prefix. Descends the
+/// Prefix, which may end in the middle of a Label, and collects the Subtree below.
+/// </summary>
+/// <param name="prefix">Prefix, empty for every Tag</param>
+/// <param name="ids">Tag IDs to Append to, in Tag order</param>
+void TagTrie::matchPrefix(std::string_view prefix, std::vector<uint32_t>& ids) const {
+	const Node * node = &_root;
+	size_t position = 0;
+	while (position < prefix.size()) {
+		size_t index = childIndex(node, prefix[position]);
+		if (index == node->children.size())
+			return;
+		const Node * child = node->children[index].get();
+		size_t length = std::min(child->label.size(), prefix.size() - position);
+		if (child->label.compare(0, length, prefix.substr(position, length)) != 0)
+			return;
+		node = child;
+		position += length;
+	}
+	collect(node, ids);
+}
+
+/// <summary>
+/// Function to Match the rest of a Glob Pattern against the Trie from a point within
+/// a Node's Label. Literal characters follow at most one Edge, so only the Subtrees a
+/// Wildcard can match are walked.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="offset">Characters of the Node's Label matched so far</param>
+/// <param name="pattern">Glob Pattern</param>
+/// <param name="position">Characters of the Pattern matched so far</param>
+/// <param name="ids">Tag IDs to Append to</param>
+void TagTrie::glob(const Node * node, size_t offset, std::string_view pattern, size_t position, std::vector<uint32_t>& ids) {
+	if (position == pattern.size()) {
+		if (offset == node->label.size() && node->id != NONE)
+			ids.push_back(node->id);
+		return;
+	}
+	char wanted = pattern[position];
+	if (wanted == '*') {
+		size_t next = position + 1;
+		bool deep = false;
+		while (next < pattern.size() && pattern[next] == '*') {
+			deep = true;
+			next++;
+		}
+		/* The run of the Wildcard ends here, or goes on by one more character */
+		glob(node, offset, pattern, next, ids);
+		if (offset < node->label.size()) {
+			if (deep || node->label[offset] != '/')
+				glob(node, offset + 1, pattern, position, ids);
+			return;
+		}
+		for (const std::unique_ptr<Node>& child : node->children) {
+			if (deep || child->label[0] != '/')
+				glob(child.get(), 1, pattern, position, ids);
+		}
+		return;
+	}
+	if (wanted == '?') {
+		if (offset < node->label.size()) {
+			if (node->label[offset] != '/')
+				glob(node, offset + 1, pattern, position + 1, ids);
+			return;
+		}
+		for (const std::unique_ptr<Node>& child : node->children) {
+			if (child->label[0] != '/')
+				glob(child.get(), 1, pattern, position + 1, ids);
+		}
+		return;
+	}
+	if (offset < node->label.size()) {
+		if (node->label[offset] == wanted)
+			glob(node, offset + 1, pattern, position + 1, ids);
+		return;
+	}
+	size_t index = childIndex(node, wanted);
+	if (index < node->children.size() && node->children[index]->label[0] == wanted)
+		glob(node->children[index].get(), 1, pattern, position + 1, ids);
+}
+
+/// <summary>
+/// Function to Append the Tag IDs of the Tags matching a Glob Pattern. A Tag can be
+/// reached by more than one way of Matching the Wildcards, the Tag IDs Appended are
+/// made unique.
+/// </summary>
+/// <param name="pattern">Glob Pattern using ?, * and **</param>
+/// <param name="ids">Tag IDs to Append to</param>
+void TagTrie::matchGlob(std::string_view pattern, std::vector<uint32_t>& ids) const {
+	size_t start = ids.size();
+	glob(&_root, 0, pattern, 0, ids);
+	std::sort(ids.begin() + start, ids.end());
+	ids.erase(std::unique(ids.begin() + start, ids.end()), ids.end());
+}
+
+/// <summary>
+/// Function to Check whether a Pattern holds any Wildcards, so it must be Matched as
+/// a Glob instead of being looked up as a Tag.
+/// </summary>
+/// <param name="pattern">Pattern</param>
+/// <returns>True if the Pattern holds '*' or '?'</returns>
+bool TagTrie::isGlob(std::string_view pattern) {
+	return pattern.find_first_of("*?") != std::string_view::npos;
+}
+
+/// <summary>
+/// Function to get the Number of Tags.
+/// </summary>
+/// <returns>Number of Tags</returns>
+size_t TagTrie::size() const {
+	return _size;
+}
+
+/// <summary>
+/// Function to get the Number of Nodes, the Root included.
+/// </summary>
+/// <returns>Number of Nodes</returns>
+size_t TagTrie::nodes() const {
+	return _nodes;
+}
+
+#ifdef TEST_TAGTRIE
+
+#include <random>
+#include <iostream>
+#include <algorithm>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Match a Tag against a Glob Pattern character by character, which the
+/// TagTrie is Checked against.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <param name="pattern">Glob Pattern</param>
+/// <returns>True if the Tag matches the Pattern</returns>
+bool globMatches(std::string_view tag, std::string_view pattern) {
+	if (pattern.empty())
+		return tag.empty();
+	if (pattern[0] == '*') {
+		size_t next = 1;
+		while (next < pattern.size() && pattern[next] == '*')
+			next++;
+		for (size_t length = 0; length <= tag.size(); length++) {
+			if (globMatches(tag.substr(length), pattern.substr(next)))
+				return true;
+			if (length < tag.size() && tag[length] == '/' && next == 1)
+				return false;
+		}
+		return false;
+	}
+	if (tag.empty() || (pattern[0] == '?' ? tag[0] == '/' : tag[0] != pattern[0]))
+		return false;
+	return globMatches(tag.substr(1), pattern.substr(1));
+}
+
+/// <summary>
+/// Function to Print the Tags of Tag IDs.
+/// </summary>
+/// <param name="tags">Tags indexed by Tag ID</param>
+/// <param name="ids">Tag IDs</param>
+void printTags(const std::vector<std::string>& tags, const std::vector<uint32_t>& ids) {
+	for (uint32_t id : ids)
+		std::cout << " " << tags[id];
+}
+
+/// <summary>
+/// Function to Test TagTrie Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+
+	StringHelper::Title("TESTING TAGTRIE PACKAGE", '=');
+	StringHelper::Title("Test Prefix and Glob Matches of Hierarchical Tags");
+	std::vector<std::string> tags = { "region/us/east", "region/us/west", "region/eu/east", "region/eu", "region/usa/east", "role/admin", "Jedi" };
+	TagTrie trie;
+	for (uint32_t id = 0; id < tags.size(); id++)
+		trie.insert(tags[id], id);
+	std::vector<uint32_t> ids;
+	std::cout << "\n > Tags : " << trie.size() << ", Nodes : " << trie.nodes();
+	trie.matchPrefix("region/us", ids);
+	std::cout << "\n > Prefix \"region/us\" :";
+	printTags(tags, ids);
+	ids.clear();
+	trie.matchPrefix("r", ids);
+	std::cout << "\n > Prefix \"r\" : " << ids.size() << " Tags";
+	for (const char * pattern : { "region/*/east", "region/?\?/*", "region/**", "*", "r*/admin", "region/u*" }) {
+		ids.clear();
+		trie.matchGlob(pattern, ids);
+		std::cout << "\n > Glob \"" << pattern << "\" :";
+		printTags(tags, ids);
+	}
+	std::cout << "\n > isGlob(\"region/*/east\") : " << TagTrie::isGlob("region/*/east") << ", isGlob(\"region/us\") : " << TagTrie::isGlob("region/us") << std::endl;
+	putline();
+
+	StringHelper::Title("Test against Matching every Tag");
+	TagTrie random;
+	std::vector<std::string> names;
+	std::mt19937_64 generator(11);
+	const char * segments[] = { "a", "ab", "abc", "b", "ba", "east", "eas" };
+	for (int attempt = 0; attempt < 20000; attempt++) {
+		std::string tag;
+		for (size_t count = 1 + generator() % 4; count-- > 0;)
+			tag.append(segments[generator() % 7]).push_back(count == 0 ? '\0' : '/');
+		tag.pop_back();
+		/* Tags are Inserted once, like TagDictionary Interns them */
+		if (std::find(names.begin(), names.end(), tag) != names.end())
+			continue;
+		uint32_t id = (uint32_t)names.size();
+		names.push_back(tag);
+		random.insert(tag, id);
+	}
+	bool agree = true;
+	const char * patterns[] = { "a/*", "*/east", "a*/b*", "?b/**", "**/eas?", "a/**/a", "*", "**", "ab?/e*t/*", "b/ba/abc" };
+	for (const char * pattern : patterns) {
+		ids.clear();
+		random.matchGlob(pattern, ids);
+		std::vector<uint32_t> expected;
+		for (uint32_t id = 0; id < names.size(); id++) {
+			if (globMatches(names[id], pattern))
+				expected.push_back(id);
+		}
+		agree = agree && ids == expected;
+	}
+	std::cout << "\n > Tags : " << random.size() << ", Nodes : " << random.nodes() << ", Globs agree : " << agree << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_TAGTRIE
@@ -0,0 +1,114 @@
+//////////////////////////////////////////////////////////////////
+// TagTrie.h        - Compressed Trie of Tag Names for          //
+//                    Prefix and Glob Tag Lookups.              //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides TagTrie class, a Compressed (Radix) Trie which maps Tag
+ * Strings to their Tag IDs in order. Every Edge is labelled with a run of characters
+ * and a Node only branches where two Tags differ, so the Trie has at most two Nodes
+ * per Tag however long the Tags are.
+ *
+ * Tags are often Hierarchical ("region/us/east", "region/us/west"). The TagTrie finds
+ * the Tag IDs of every Tag starting with a Prefix by descending the Prefix and
+ * collecting the Subtree below it, and the Tag IDs of every Tag matching a Glob
+ * Pattern by walking only the Edges the Pattern can match :
+ *
+ * - ?  matches any one character except '/'.
+ * - *  matches any run of characters except '/', so it stays within a Segment.
+ * - ** matches any run of characters including '/'.
+ * - Any other character matches itself.
+ *
+ * A Pattern for the "east" Tag of every Region below "region/" therefore only visits
+ * the Tags below "region/" and, within them, only the Subtrees whose next Segment is
+ * followed by "/east", instead of testing every Tag.
+ *
+ * Tags are never Removed, just like the Tag IDs of a TagDictionary. TagTrie is not
+ * Thread Safe, TagDictionary guards it with it's Lock.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - void insert(std::string_view tag, uint32_t id)
+ * Method to add a Tag and it's Tag ID, Splitting the Edge where the Tag branches off.
+ *
+ * - void matchPrefix(std::string_view prefix, std::vector<uint32_t>& ids) const
+ * Method to Append the Tag IDs of the Tags starting with a Prefix, in Tag order.
+ *
+ * - void matchGlob(std::string_view pattern, std::vector<uint32_t>& ids) const
+ * Method to Append the Tag IDs of the Tags matching a Glob Pattern, each once.
+ *
+ * - static bool isGlob(std::string_view pattern)
+ * Method to Check whether a Pattern holds any Wildcards.
+ *
+ * - size_t size() const / size_t nodes() const
+ * Methods to get the Number of Tags and of Nodes.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef TAGTRIE_H
+#define TAGTRIE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+/// <summary>
+/// Compressed Trie of Tag Strings for Prefix and Glob Lookups of Tag IDs.
+/// </summary>
+class TagTrie {
+private:
+	static const uint32_t NONE = UINT32_MAX;									// Tag ID of a Node which ends no Tag
+
+	/// <summary>
+	/// Node of the Trie. The Label is the run of characters on the Edge into the Node,
+	/// Children are kept sorted by the first character of their Label.
+	/// </summary>
+	struct Node {
+		std::string label;
+		uint32_t id = NONE;														// Tag ID of the Tag ending at this Node, NONE if no Tag does
+		std::vector<std::unique_ptr<Node>> children;
+	};
+
+	Node _root;
+	size_t _size = 0;
+	size_t _nodes = 1;
+
+	static size_t childIndex(const Node * node, char first);
+	static void collect(const Node * node, std::vector<uint32_t>& ids);
+	static void glob(const Node * node, size_t offset, std::string_view pattern, size_t position, std::vector<uint32_t>& ids);
+public:
+	/* Constructor */
+	TagTrie() = default;
+	TagTrie(const TagTrie&) = delete;
+	TagTrie& operator=(const TagTrie&) = delete;
+
+	/* Member Functions */
+	void insert(std::string_view tag, uint32_t id);
+	void matchPrefix(std::string_view prefix, std::vector<uint32_t>& ids) const;
+	void matchGlob(std::string_view pattern, std::vector<uint32_t>& ids) const;
+	static bool isGlob(std::string_view pattern);
+	size_t size() const;
+	size_t nodes() const;
+};
+
+#endif // !TAGTRIE_H
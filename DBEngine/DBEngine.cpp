@@ -2,8 +2,8 @@
 // DBEngine.cpp     - Defines DBEngine Class to hold DBElement  //
 //                    Objects in an unordered_map and Perform   //
 //                    various operations on them.               //
-// Version          - 1.1                                       //
-// Last Modified    - 08/06/2017                                //
+// Version          - 3.5                                       //
+// Last Modified    - 10/17/2026                                //
 // Language         - Visual C++, Visual Studio 2017            //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
 // Author           - Venkata Bharani Krishna Chekuri           //
@@ -12,36 +12,504 @@
 
 #include "DBEngine.h"
 
+#include <queue>
+#include <chrono>
+#include <climits>
+#include <iterator>
+#include <algorithm>
+
+/* Sequence Number shared by the Writes of the Batch the calling Thread Applies, 0 outside of write */
+static thread_local uint64_t batchVersion = 0;
+
+/// <summary>
+/// Constructor for DBEngine with Owner and Number of Shards as Arguments.
+/// </summary>
+/// <param name="owner">Owner of the Database</param>
+/// <param name="shards">Number of Shards the Database is Partitioned into (Minimum 1)</param>
+DBEngine::DBEngine(std::string owner, size_t shards) : DBEngine(owner, DBEngineConfig(shards)) {}
+
 /// <summary>
-/// Constructor for DBEngine with Owner as Argument.
+/// Constructor for DBEngine with Owner and Configuration as Arguments. If a Snapshot
+/// is Configured it is Attached (or Loaded) first, then the Write Ahead Log is
+/// Replayed on top of it before the Log is opened for new Mutations. An Attached
+/// Snapshot decides the Number of Shards.
+///
+/// With an LSM Tier, the Tier decides the Number of Shards and the Keys, Document
+/// IDs and Tag Index are Rebuilt from it's SSTables. The Snapshot is then only
+/// Loaded, and only into an empty Tier.
+///
+/// Deadlines Replayed from the Log are kept in the TimingWheels, the background
+/// Thread which Removes Expired Keys is Started once Construction is done. Keys are
+/// not Evicted while the Database is Rebuilt, only once Construction is done.
 /// </summary>
 /// <param name="owner">Owner of the Database</param>
-DBEngine::DBEngine(std::string owner) {
+/// <param name="config">Number of Shards, Snapshot, Write Ahead Log, LSM Tier and Eviction Options</param>
+DBEngine::DBEngine(std::string owner, const DBEngineConfig& config) : _memtableBytes(0), _expiring(0), _residentBytes(0), _windowBytes(0), _evictCursor(0), _sequence(0), _readers(0) {
 	_dbOwner = owner;
+	_versionMillis = config.versionMillis <= 0 ? 1 : config.versionMillis;
+	_compression = config.compression;
+	_keyIndex = config.keyIndex;
+	_expiryBatch = config.expiryBatch == 0 ? 1 : config.expiryBatch;
+	size_t shards = config.shards == 0 ? 1 : config.shards;
+	std::vector<std::string> tags;
+	bool tiered = !config.lsm.directory.empty() && _lsm.open(config.lsm, shards, tags);
+	bool restore = !config.snapshot.empty() && (!tiered || tags.empty()) && _snapshot.open(config.snapshot);
+	if (!tiered)
+		_eviction.configure(config.eviction);
+	if (restore && config.mapSnapshot && !tiered)
+		shards = _snapshot.shardCount();
+	for (size_t index = 0; index < shards; index++) {
+		_shards.push_back(new Shard());
+		_shards.back()->number = index;
+		_shards.back()->wheel = TimingWheel(config.expiryTickMillis);
+		_shards.back()->table.setRehashSlots(config.rehashSlots);
+	}
+	if (tiered) {
+		_memtableLimit = std::max<size_t>(1, config.lsm.memtableBytes);
+		/* Interned into an empty TagDictionary, so the SSTables' Tag IDs stay valid */
+		for (const std::string& tag : tags)
+			_dictionary.intern(tag);
+		for (Shard * shard : _shards) {
+			_lsm.scan(shard->number, [this, shard](const SSTable::Entry& entry) {
+				if (shard->docKeys.size() <= entry.document)
+					shard->docKeys.resize(entry.document + 1);
+				shard->docKeys[entry.document].assign(entry.key.data(), entry.key.size());
+				shard->liveDocs.add(entry.document);
+				for (uint32_t index = 0; index < entry.tagCount; index++)
+					shard->tagMap[entry.tagId(index)].add(entry.document);
+				stampDocument(shard, entry.document, entry.timestamp);
+			});
+			/* Pushed in descending order so the lowest Document IDs are reused first */
+			for (uint32_t document = (uint32_t)shard->docKeys.size(); document-- > 0;) {
+				if (!shard->liveDocs.contains(document))
+					shard->freeDocs.push_back(document);
+			}
+			if (_keyIndex)
+				shard->liveDocs.forEach([shard](uint32_t document) { shard->keys.insert(shard->docKeys[document], document); });
+			restore = restore && shard->liveDocs.empty();
+		}
+		if (!restore)
+			_snapshot.close();
+	}
+	if (restore && tiered) {
+		for (const std::string& tag : _snapshot.tags())
+			_dictionary.intern(tag);
+		loadSnapshot();
+	} else if (restore) {
+		/* Interned into an empty TagDictionary, so the Snapshot's Tag IDs stay valid */
+		for (const std::string& tag : _snapshot.tags())
+			_dictionary.intern(tag);
+		if (config.mapSnapshot)
+			attachSnapshot();
+		else
+			loadSnapshot();
+	}
+	if (!config.wal.path.empty())
+		_wal.open(config.wal, [this](const WriteAheadLog::Record& record) { replayRecord(record); });
+	_ready = true;
+	memtableWrite(0);
+	evict();
+	if (_expiring != 0)
+		startExpiry();
 }
 
 /// <summary>
-/// Default Destructor for DBEngine. Frees Memory by clearing
-/// DB Map and Tag Map.	
+/// Default Destructor for DBEngine. Waits for Lock-Free Readers to finish and
+/// Frees Memory by Releasing the Slabs of every Shard. Live DBElements are not
+/// visited, their Memory is Released along with the Slabs, and so are the old
+/// Versions kept for Readers. With an LSM Tier the Memtables are Flushed first. The
+/// Expiry and Version Threads are Stopped before anything else.
 /// </summary>
 DBEngine::~DBEngine() {
-	/* Free Memory allocated to DBElements and the hash tables */
-	for (std::pair<std::string, DBElement*> pr : _dbMap) {
-		delete pr.second;
+	{
+		std::lock_guard<std::mutex> lock(_expiryLock);
+		_expiryStop = true;
+	}
+	_expiryWake.notify_all();
+	if (_expiryThread.joinable())
+		_expiryThread.join();
+	{
+		std::lock_guard<std::mutex> lock(_versionLock);
+		_versionStop = true;
+	}
+	_versionWake.notify_all();
+	if (_versionThread.joinable())
+		_versionThread.join();
+	waitSnapshot();
+	if (_flushThread.joinable())
+		_flushThread.join();
+	if (_lsm.isOpen()) {
+		bool pending = false;
+		for (Shard * shard : _shards)
+			pending = pending || shard->table.size() != 0 || !shard->tombstones.empty();
+		if (pending) {
+			_flushing = true;
+			flushMemtable();
+		}
+	}
+	_wal.close();
+	_lsm.close();
+	/* Free DBElements Retired by Writers while their Slabs are still alive */
+	EpochManager::instance().synchronize();
+	for (Shard * shard : _shards)
+		delete shard;
+	_shards.clear();
+}
+
+/// <summary>
+/// Function to get the Shard which holds the given Key. Uses the stable Hash of
+/// Snapshot so the Shards of a Snapshot match the Shards of the DBEngine.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>Shard to which the Key hashes</returns>
+DBEngine::Shard * DBEngine::shardFor(std::string_view key) {
+	if (_shards.size() == 1)
+		return _shards[0];
+	return _shards[(Snapshot::hashKey(key) >> 32) % _shards.size()];
+}
+
+/// <summary>
+/// Function to get the Key of a Document ID. Keys of Snapshot Document IDs are Read
+/// from the Snapshot. Caller must hold the Shard's Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="document">Live Document ID</param>
+/// <returns>Key of the Document ID</returns>
+std::string_view DBEngine::documentKey(Shard * shard, uint32_t document) {
+	if (document < shard->baseDocs)
+		return _snapshot.key(shard->number, document);
+	return shard->docKeys[document - shard->baseDocs];
+}
+
+/// <summary>
+/// Function to Assign a Document ID to a new Key. Reuses Document IDs of Removed
+/// Keys so Document IDs stay dense, and adds the Key to the KeyIndex. Caller must
+/// hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which will hold the Key</param>
+/// <param name="key">Key</param>
+/// <returns>Document ID of the Key</returns>
+uint32_t DBEngine::assignDocument(Shard * shard, std::string_view key) {
+	uint32_t document;
+	if (shard->freeDocs.empty()) {
+		document = shard->baseDocs + (uint32_t)shard->docKeys.size();
+		shard->docKeys.emplace_back(key);
+	} else {
+		document = shard->freeDocs.back();
+		shard->freeDocs.pop_back();
+		shard->docKeys[document - shard->baseDocs].assign(key.data(), key.size());
+	}
+	shard->liveDocs.add(document);
+	if (_keyIndex)
+		shard->keys.insert(key, document);
+	return document;
+}
+
+/// <summary>
+/// Function to Release the Document ID of a Removed Key for reuse. Snapshot Document
+/// IDs are never reused since their Keys are Read from the Snapshot. Caller must
+/// hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which held the Key</param>
+/// <param name="document">Document ID of the Removed Key</param>
+void DBEngine::releaseDocument(Shard * shard, uint32_t document) {
+	if (_keyIndex)
+		shard->keys.erase(documentKey(shard, document));
+	if (document < shard->docTimes.size() && shard->docTimes[document] != 0) {
+		shard->times.erase(timeKey(shard->docTimes[document], document));
+		shard->docTimes[document] = 0;
+	}
+	shard->liveDocs.remove(document);
+	if (document < shard->baseDocs)
+		return;
+	std::string().swap(shard->docKeys[document - shard->baseDocs]);
+	shard->freeDocs.push_back(document);
+}
+
+/// <summary>
+/// Function to Copy a DBElement into the Shard's SlabAllocator. Caller must hold
+/// the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which will hold the DBElement</param>
+/// <param name="value">DBElement to Copy</param>
+/// <returns>Copy of the DBElement Allocated from the Shard's Slabs</returns>
+DBElement * DBEngine::createElement(Shard * shard, const DBElement& value) {
+	void * memory = shard->allocator.allocate(sizeof(DBElement), alignof(DBElement));
+	return new (memory) DBElement(value, &shard->allocator, &_dictionary);
+}
+
+/// <summary>
+/// Function to Move a DBElement into the Shard's SlabAllocator. Caller must hold
+/// the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which will hold the DBElement</param>
+/// <param name="value">DBElement to Move</param>
+/// <returns>DBElement Allocated from the Shard's Slabs</returns>
+DBElement * DBEngine::createElement(Shard * shard, DBElement&& value) {
+	void * memory = shard->allocator.allocate(sizeof(DBElement), alignof(DBElement));
+	return new (memory) DBElement(std::move(value), &shard->allocator, &_dictionary);
+}
+
+/// <summary>
+/// Function to Retire a DBElement created using createElement. It is Destroyed
+/// and given back to it's Slab once no reader can see it.
+/// </summary>
+/// <param name="value">DBElement which has been Unpublished</param>
+void DBEngine::retireElement(DBElement * value) {
+	EpochManager::instance().retire(value, &DBEngine::destroyElement);
+}
+
+/// <summary>
+/// Function to Destroy a DBElement created using createElement and give it's
+/// Memory back to the SlabAllocator it was Allocated from.
+/// </summary>
+/// <param name="value">DBElement to Destroy</param>
+void DBEngine::destroyElement(void * value) {
+	DBElement * element = static_cast<DBElement*>(value);
+	std::pmr::memory_resource * resource = element->resource();
+	element->~DBElement();
+	resource->deallocate(element, sizeof(DBElement), alignof(DBElement));
+}
+
+/// <summary>
+/// Function to Create a DBElement in the Shard's SlabAllocator from a Snapshot
+/// Record. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which will hold the DBElement</param>
+/// <param name="record">Record whose Tag IDs are valid in the DBEngine's TagDictionary</param>
+/// <returns>DBElement Allocated from the Shard's Slabs, not Published yet</returns>
+DBElement * DBEngine::restoreElement(Shard * shard, const Snapshot::Record& record) {
+	DBElement value(record.data);
+	compressElement(value);
+	DBElement * object = createElement(shard, std::move(value));
+	for (uint32_t index = 0; index < record.tagCount; index++)
+		object->addTagId(record.tagId(index));
+	object->setlastModified(record.timestamp);
+	object->setAccess(_eviction.initial());
+	return object;
+}
+
+/// <summary>
+/// Function to Create a DBElement from a Version Read from the LSM Tier. Writers
+/// Create it in the Shard's SlabAllocator and must hold the Shard's Writer Lock,
+/// Readers pass no Shard and get a DBElement on the Heap which they must Retire.
+/// </summary>
+/// <param name="shard">Shard which will hold the DBElement, NULL for a Reader's Copy</param>
+/// <param name="value">Version whose Tag IDs are valid in the DBEngine's TagDictionary</param>
+/// <returns>DBElement, not Published</returns>
+DBElement * DBEngine::restoreElement(Shard * shard, const LSMTree::Value& value) {
+	std::pmr::memory_resource * resource = shard != nullptr ? static_cast<std::pmr::memory_resource*>(&shard->allocator) : std::pmr::new_delete_resource();
+	DBElement data(value.data);
+	if (shard != nullptr)
+		compressElement(data);
+	void * memory = resource->allocate(sizeof(DBElement), alignof(DBElement));
+	DBElement * object = new (memory) DBElement(std::move(data), resource, &_dictionary);
+	for (uint32_t tag : value.tags)
+		object->addTagId(tag);
+	object->setlastModified(value.timestamp);
+	object->setAccess(_eviction.initial());
+	return object;
+}
+
+/// <summary>
+/// Function to Attach the opened Snapshot. Only the Live Document IDs and the Tag
+/// Index of every Shard are Loaded, DBElements are Loaded from the Mapping when
+/// their Key is first used and Keys are added to the KeyIndex when the Shard is
+/// first Scanned.
+/// </summary>
+void DBEngine::attachSnapshot() {
+	for (Shard * shard : _shards) {
+		if (!_snapshot.postings(shard->number, shard->liveDocs, shard->tagMap)) {
+			for (Shard * other : _shards) {
+				other->liveDocs = PostingList();
+				other->tagMap.clear();
+				other->baseLive = PostingList();
+				other->baseDocs = 0;
+				other->baseIndexed = true;
+				other->baseTimed = true;
+			}
+			_snapshot.close();
+			return;
+		}
+		shard->baseLive = shard->liveDocs;
+		shard->baseDocs = _snapshot.documentCount(shard->number);
+		shard->baseIndexed = !_keyIndex || shard->liveDocs.empty();
+		shard->baseTimed = shard->liveDocs.empty();
+	}
+}
+
+/// <summary>
+/// Function to Load every DBElement of the opened Snapshot into the Shards and
+/// Close it. Used when the Snapshot is not Attached, the Number of Shards may
+/// differ from the Snapshot's. Records failing their CRC32C are skipped.
+/// </summary>
+void DBEngine::loadSnapshot() {
+	Snapshot::Record record;
+	for (size_t number = 0; number < _snapshot.shardCount(); number++) {
+		for (uint32_t document = 0; document < _snapshot.documentCount(number); document++) {
+			if (!_snapshot.record(number, document, record))
+				continue;
+			Shard * shard = shardFor(record.key);
+			insertElement(shard, record.key, restoreElement(shard, record));
+		}
+	}
+	_snapshot.close();
+}
+
+/// <summary>
+/// Function to Load a Key from the Attached Snapshot or the LSM Tier into the DB
+/// Table, unless it is already Loaded, was Removed or is not there. A Key Loaded
+/// from the LSM Tier keeps it's Document ID. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+void DBEngine::faultElement(Shard * shard, std::string_view key) {
+	if (_lsm.isOpen()) {
+		LSMTree::Value value;
+		if (shard->table.find(key) == nullptr && shard->tombstones.find(std::string(key)) == shard->tombstones.end() &&
+			_lsm.get(shard->number, key, value) && !value.removed) {
+			DBElement * object = restoreElement(shard, value);
+			shard->table.insert(key, object, value.document);
+			account(key, object, nullptr);
+		}
+		return;
+	}
+	if (shard->baseLive.empty())
+		return;
+	uint32_t document;
+	Snapshot::Record record;
+	if (!_snapshot.find(shard->number, key, document) || !shard->baseLive.contains(document) ||
+		shard->table.find(key) != nullptr || !_snapshot.record(shard->number, document, record))
+		return;
+	DBElement * object = restoreElement(shard, record);
+	shard->table.insert(key, object, document);
+	account(key, object, nullptr);
+	shard->baseLive.remove(document);
+}
+
+/// <summary>
+/// Function to Load every remaining Key of the Attached Snapshot into the DB Table
+/// of a Shard. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard to Load</param>
+void DBEngine::faultShard(Shard * shard) {
+	std::vector<uint32_t> documents;
+	documents.reserve(shard->baseLive.cardinality());
+	shard->baseLive.forEach([&documents](uint32_t document) { documents.push_back(document); });
+	Snapshot::Record record;
+	for (uint32_t document : documents) {
+		if (!_snapshot.record(shard->number, document, record))
+			continue;
+		DBElement * object = restoreElement(shard, record);
+		shard->table.insert(record.key, object, document);
+		account(record.key, object, nullptr);
+	}
+	shard->baseLive = PostingList();
+}
+
+/// <summary>
+/// Function to Find the DBElement of a Key for a Reader. Keys which are only in the
+/// Attached Snapshot are Loaded under the Shard's Writer Lock the first time they
+/// are Read, later Reads take no Locks. Keys which are only in the LSM Tier are
+/// Read into a Copy which is Retired right away, so it lives as long as the
+/// Caller's Pin and the Memtable does not grow on Reads. A DBElement whose Deadline
+/// has passed is Removed and reported as missing. With a Memory Limit the Read is
+/// Recorded for the Eviction Policy, and Keys Loaded from the Attached Snapshot may
+/// make other Keys be Evicted. Caller must be Pinned by an EpochGuard.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <returns>DBElement of the Key, NULL if the Key does not Exist</returns>
+DBElement * DBEngine::lookup(Shard * shard, std::string_view key) {
+	return resolve(shard, key, shard->table.find(key));
+}
+
+/// <summary>
+/// Function to finish the Lookup of a Key for a Reader given the DBElement the DB
+/// Table holds for it, as described for lookup. Caller must be Pinned by an
+/// EpochGuard.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement the Shard's DB Table holds for the Key, NULL if none</param>
+/// <returns>DBElement of the Key, NULL if the Key does not Exist</returns>
+DBElement * DBEngine::resolve(Shard * shard, std::string_view key, DBElement * value) {
+	if (_eviction.enabled())
+		_eviction.record(key);
+	if (value != nullptr && value->getExpiry() != 0 && value->isExpired(TimingWheel::now())) {
+		expireKey(shard, key);
+		return nullptr;
+	}
+	if (value != nullptr && _eviction.enabled())
+		_eviction.touch(value);
+	uint32_t document;
+	if (value == nullptr && _lsm.isOpen()) {
+		{
+			std::shared_lock<std::shared_mutex> lock(shard->lock);
+			if (shard->tombstones.find(std::string(key)) != shard->tombstones.end())
+				return nullptr;
+		}
+		LSMTree::Value version;
+		if (!_lsm.get(shard->number, key, version) || version.removed)
+			return nullptr;
+		value = restoreElement(nullptr, version);
+		retireElement(value);
+		return value;
+	}
+	if (value != nullptr || shard->baseDocs == 0 || !_snapshot.find(shard->number, key, document))
+		return value;
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	value = shard->table.find(key);
+	lock.unlock();
+	evict();
+	return value;
+}
+
+/// <summary>
+/// Function to Find the DBElements of many Keys for a Reader. The Lookups of a window
+/// of Keys are run in Stages, each Stage over every Key of the window before the
+/// next : Hash the Key and Prefetch it's Control Group, Prefetch it's Slot, Find the
+/// DBElement and Prefetch it, and finally resolve it. So the Cache Misses of the
+/// Keys are waited for together. Caller must be Pinned by an EpochGuard.
+/// </summary>
+/// <param name="keys">Keys</param>
+/// <param name="count">Number of Keys</param>
+/// <param name="values">Set to the DBElement of each Key, NULL if the Key does not Exist</param>
+void DBEngine::lookup(const std::string * keys, size_t count, DBElement ** values) {
+	Shard * shards[LOOKUP_WINDOW];
+	size_t hashes[LOOKUP_WINDOW];
+	for (size_t first = 0; first < count; first += LOOKUP_WINDOW) {
+		size_t window = std::min(count - first, (size_t)LOOKUP_WINDOW);
+		const std::string * key = keys + first;
+		DBElement ** value = values + first;
+		for (size_t index = 0; index < window; index++) {
+			shards[index] = shardFor(key[index]);
+			hashes[index] = shards[index]->table.prefetch(key[index]);
+		}
+		for (size_t index = 0; index < window; index++)
+			shards[index]->table.prefetchSlot(hashes[index]);
+		for (size_t index = 0; index < window; index++) {
+			value[index] = shards[index]->table.find(key[index], hashes[index]);
+			if (value[index] != nullptr)
+				ElementTable::prefetchAddress(value[index]);
+		}
+		for (size_t index = 0; index < window; index++)
+			value[index] = resolve(shards[index], key[index], value[index]);
 	}
-	_dbMap.clear();
-	_tagMap.clear();
 }
 
 /// <summary>
-/// Function to Check whether Key Exists in Database or not.
+/// Function to Check whether Key Exists in Database or not. Usually takes no Locks,
+/// but a Key whose Deadline has passed is Removed under the Shard's Writer Lock, a
+/// Key only in the Attached Snapshot is Loaded under it, and with a Memory Limit
+/// that Load may Evict other Keys.
 /// </summary>
 /// <param name="key">Key to Check</param>
 /// <returns>True if Key Exists in Database, False if otherwise</returns>
-bool DBEngine::exists(std::string key) {
-	if (_dbMap.find(key) != _dbMap.end())
-		return true;
-	return false;
+bool DBEngine::exists(std::string_view key) {
+	EpochGuard guard;
+	return lookup(shardFor(key), key) != nullptr;
 }
 
 /// <summary>
@@ -50,14 +518,22 @@ bool DBEngine::exists(std::string key) {
 /// <param name="key">Key associated with Object to which Tag is intended to be added</param>
 /// <param name="tag">Tag to be Added</param>
 /// <returns></returns>
-bool DBEngine::addTag(std::string key, std::string tag) {
-	if (!exists(key))
-		return false;
-	if (_dbMap[key]->tagExist(tag))
-		return true;
-	_dbMap[key]->addTag(tag);
-	_tagMap[tag].insert(key);
-	return true;
+bool DBEngine::addTag(std::string_view key, std::string_view tag) {
+	uint32_t id = _dictionary.intern(tag);
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	DBElement * replaced = nullptr;
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	bool found = tagElement(shard, key, tag, id, true, lsn, bytes, replaced);
+	lock.unlock();
+	if (replaced != nullptr)
+		retireElement(replaced);
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn) && found;
 }
 
 /// <summary>
@@ -66,37 +542,96 @@ bool DBEngine::addTag(std::string key, std::string tag) {
 /// <param name="key">Key associated with Object to which Tag is intended to be removed from</param>
 /// <param name="tag">Tag to be Removed</param>
 /// <returns></returns>
-bool DBEngine::removeTag(std::string key, std::string tag) {
-	if (!exists(key))
-		return false;
-	if (!_dbMap[key]->tagExist(tag))
-		return true;
-	_dbMap[key]->removeTag(tag);
-	_tagMap[tag].erase(key);
-	return true;
+bool DBEngine::removeTag(std::string_view key, std::string_view tag) {
+	uint32_t id = TagDictionary::INVALID;
+	_dictionary.find(tag, id);
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	DBElement * replaced = nullptr;
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	bool found = tagElement(shard, key, tag, id, false, lsn, bytes, replaced);
+	lock.unlock();
+	if (replaced != nullptr)
+		retireElement(replaced);
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn) && found;
+}
+
+/// <summary>
+/// Function to Add a Tag to or Remove it from the DBElement of a Key and Log it. The
+/// DBElement is left as it is if it already has (Add) or lacks (Remove) the Tag.
+/// Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="tag">Tag</param>
+/// <param name="id">Tag ID, TagDictionary::INVALID if the Tag was never Interned</param>
+/// <param name="add">True to Add the Tag, False to Remove it</param>
+/// <param name="lsn">Set to the LSN of the Record Logged</param>
+/// <param name="bytes">Increased by the Footprint of the Key and new DBElement</param>
+/// <param name="replaced">Set to the DBElement to Retire, NULL if there is none or Readers keep it</param>
+/// <returns>True if the Key Exists</returns>
+bool DBEngine::tagElement(Shard * shard, std::string_view key, std::string_view tag, uint32_t id, bool add, uint64_t& lsn, size_t& bytes, DBElement *& replaced) {
+	replaced = nullptr;
+	return shard->table.modify(key, [&](DBElement * current, uint32_t document) {
+		if (current->tagIdExist(id) == add)
+			return current;
+		DBElement * object = createElement(shard, *current);
+		if (add) {
+			object->addTagId(id);
+			shard->tagMap[id].add(document);
+		}
+		else {
+			object->removeTagId(id);
+			auto index = shard->tagMap.find(id);
+			if (index != shard->tagMap.end()) {
+				index->second.remove(document);
+				if (index->second.empty())
+					shard->tagMap.erase(index);
+			}
+		}
+		stampDocument(shard, document, object->getlastModified());
+		lsn = _wal.append(add ? WriteAheadLog::ADD_TAG : WriteAheadLog::REMOVE_TAG, key, tag, object->getlastModified());
+		bytes += footprint(key, object);
+		account(key, object, current);
+		replaced = supersede(shard, document, key, object, current);
+		return object;
+	});
 }
 
 /// <summary>
 /// Function to Simultaneously Index Tags Whenever a new Object is Added to the Database.
+/// Caller must hold the Shard's Writer Lock.
 /// </summary>
-/// <param name="key">Key of the Object which will be Indexed on it's Tags</param>
-void DBEngine::insertIndexTags(std::string key) {
-	for (std::string tag : _dbMap[key]->getTags()) {
-		if (_tagMap.find(tag) == _tagMap.end())
-			_tagMap[tag] = std::unordered_set<std::string>();
-		_tagMap[tag].insert(key);
-	}
+/// <param name="shard">Shard which holds the Object</param>
+/// <param name="document">Document ID of the Object which will be Indexed on it's Tags</param>
+/// <param name="value">Object which will be Indexed on it's Tags</param>
+void DBEngine::insertIndexTags(Shard * shard, uint32_t document, DBElement * value) {
+	const uint32_t * tagIds = value->tagIds();
+	for (size_t index = 0; index < value->getTagCount(); index++)
+		shard->tagMap[tagIds[index]].add(document);
 }
 
 /// <summary>
 /// Function to Simultaneously Index Tags Whenevr an Object is Removed from the Database.
+/// Caller must hold the Shard's Writer Lock.
 /// </summary>
-/// <param name="key">Key of the Object which is being removed or whose Ta</param>
-void DBEngine::deleteIndexTags(std::string key) {
-	for (std::string tag : _dbMap[key]->getTags()) {
-		if (_tagMap.find(tag) == _tagMap.end())
-			return;
-		_tagMap[tag].erase(key);
+/// <param name="shard">Shard which holds the Object</param>
+/// <param name="document">Document ID of the Object which is being removed or whose Tags are being replaced</param>
+/// <param name="value">Object which is being removed or replaced</param>
+void DBEngine::deleteIndexTags(Shard * shard, uint32_t document, DBElement * value) {
+	const uint32_t * tagIds = value->tagIds();
+	for (size_t position = 0; position < value->getTagCount(); position++) {
+		auto index = shard->tagMap.find(tagIds[position]);
+		if (index == shard->tagMap.end())
+			continue;
+		index->second.remove(document);
+		if (index->second.empty())
+			shard->tagMap.erase(index);
 	}
 }
 
@@ -105,15 +640,58 @@ void DBEngine::deleteIndexTags(std::string key) {
 /// </summary>
 /// <returns>Owner of the Database</returns>
 std::string DBEngine::getOwner() {
+	std::lock_guard<std::mutex> lock(_ownerLock);
 	return _dbOwner;
 }
 
 /// <summary>
-/// Function to Retrieve the Number of Objects in the Database.
+/// Function to Retrieve the Number of Objects in the Database. With an LSM Tier the
+/// DB Table only holds the Memtable, so the Live Document IDs are Counted instead.
 /// </summary>
 /// <returns>Number of Objects in the Database</returns>
 size_t DBEngine::size() {
-	return _dbMap.size();
+	size_t count = 0;
+	for (Shard * shard : _shards) {
+		if (_lsm.isOpen()) {
+			std::shared_lock<std::shared_mutex> lock(shard->lock);
+			count += shard->liveDocs.cardinality();
+			continue;
+		}
+		count += shard->table.size();
+		if (shard->baseDocs != 0) {
+			std::shared_lock<std::shared_mutex> lock(shard->lock);
+			count += shard->baseLive.cardinality();
+		}
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to Retrieve the Number of Shards the Database is Partitioned into.
+/// </summary>
+/// <returns>Number of Shards</returns>
+size_t DBEngine::shardCount() {
+	return _shards.size();
+}
+
+/// <summary>
+/// Function to Retrieve the Statistics of the SlabAllocators of all Shards.
+/// </summary>
+/// <returns>Sum of the Allocator Statistics of every Shard</returns>
+SlabAllocator::Stats DBEngine::allocatorStats() {
+	SlabAllocator::Stats stats;
+	for (Shard * shard : _shards)
+		stats += shard->allocator.stats();
+	return stats;
+}
+
+/// <summary>
+/// Function to Retrieve the Number of distinct Tags Interned by the Database.
+/// Tags stay Interned after the last DBElement carrying them is Removed.
+/// </summary>
+/// <returns>Number of Tags in the Database's TagDictionary</returns>
+size_t DBEngine::tagCount() {
+	return _dictionary.size();
 }
 
 /// <summary>
@@ -121,24 +699,163 @@ size_t DBEngine::size() {
 /// </summary>
 /// <param name="newOwner">New Owner</param>
 /// <returns>Owner Value after it's Updated to New Owner</returns>
-std::string DBEngine::setOwner(std::string newOwner) {
+std::string DBEngine::setOwner(std::string_view newOwner) {
+	std::lock_guard<std::mutex> lock(_ownerLock);
 	_dbOwner = newOwner;
-	return getOwner();
+	return _dbOwner;
 }
 
 /// <summary>
-/// Function to Insert DBElement into Database.
+/// Function to Insert a DBElement created in the Shard's Slabs. If the Key already
+/// Exists the DBElement is Destroyed again before a Document ID is Assigned, so the
+/// KeyIndex entry of the Existing Key is left alone. The DBElement starts with a
+/// fresh Access Word. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which will hold the Key</param>
+/// <param name="key">Key</param>
+/// <param name="object">DBElement created using createElement</param>
+/// <returns>True if DBElement Successfully Inserted, False if Key already Exists</returns>
+bool DBEngine::insertElement(Shard * shard, std::string_view key, DBElement * object) {
+	if (shard->table.find(key) != nullptr) {
+		destroyElement(object);
+		return false;
+	}
+	uint32_t document = assignDocument(shard, key);
+	object->setVersion(nextVersion());
+	if (!shard->table.insert(key, object, document)) {
+		releaseDocument(shard, document);
+		destroyElement(object);
+		return false;
+	}
+	insertIndexTags(shard, document, object);
+	stampDocument(shard, document, object->getlastModified());
+	object->setAccess(_eviction.initial());
+	account(key, object, nullptr);
+	return true;
+}
+
+/// <summary>
+/// Function to Replace the DBElement of a Key with a DBElement created in the Shard's
+/// Slabs. The Key is only looked up once, if it does not Exist the DBElement is
+/// Destroyed again. The Update counts as a Read of the Old DBElement for the
+/// Eviction Policy. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="object">DBElement created using createElement</param>
+/// <returns>True if DBElement Successfully Updated, False if Key does not Exist</returns>
+bool DBEngine::updateElement(Shard * shard, std::string_view key, DBElement * object) {
+	DBElement * replaced = nullptr;
+	bool found = shard->table.modify(key, [&](DBElement * current, uint32_t document) {
+		deleteIndexTags(shard, document, current);
+		insertIndexTags(shard, document, object);
+		stampDocument(shard, document, object->getlastModified());
+		object->setAccess(_eviction.touch(current->getAccess()));
+		account(key, object, current);
+		replaced = supersede(shard, document, key, object, current);
+		return object;
+	});
+	if (!found) {
+		destroyElement(object);
+		return false;
+	}
+	if (replaced != nullptr)
+		retireElement(replaced);
+	return true;
+}
+
+/// <summary>
+/// Function to Insert or Update a Key with a DBElement created in the Shard's Slabs
+/// and Log it, along with the Deadline of the DBElement if it has one. Caller must
+/// hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="operation">INSERT or UPDATE</param>
+/// <param name="key">Key</param>
+/// <param name="object">DBElement created using createElement, Destroyed if it is not Stored</param>
+/// <param name="lsn">Set to the LSN of the last Record Logged</param>
+/// <param name="bytes">Increased by the Footprint of the Key and DBElement</param>
+/// <returns>True if the DBElement was Stored, False if the Key Exists (INSERT) or does not (UPDATE)</returns>
+bool DBEngine::storeElement(Shard * shard, WriteAheadLog::Operation operation, std::string_view key, DBElement * object, uint64_t& lsn, size_t& bytes) {
+	if (operation == WriteAheadLog::INSERT) {
+		if (!insertElement(shard, key, object))
+			return false;
+		if (!shard->tombstones.empty())
+			shard->tombstones.erase(std::string(key));
+	}
+	else if (!updateElement(shard, key, object))
+		return false;
+	lsn = _wal.append(operation, key, *object);
+	long long int deadline = object->getExpiry();
+	if (deadline != 0)
+		lsn = scheduleExpiry(shard, key, deadline);
+	bytes += footprint(key, object);
+	return true;
+}
+
+/// <summary>
+/// Function to Compress the Data of a DBElement if DBEngineConfig::compression asks
+/// for it. Called before the Shard's Writer Lock is taken, so Writers of the Shard
+/// do not Wait for the Codec.
+/// </summary>
+/// <param name="value">DBElement not Published yet</param>
+/// <returns>True if the DBElement is now stored Compressed</returns>
+bool DBEngine::compressElement(DBElement& value) {
+	return value.compress(_compression.threshold, _compression.dictionary);
+}
+
+/// <summary>
+/// Function to Insert a Copy of a DBElement into Database. With a Memory Limit, Keys
+/// may be Evicted to make room, with TinyLFU possibly the new Key itself.
 /// </summary>
 /// <param name="key">Key</param>
 /// <param name="value">DBElement to be Inserted</param>
 /// <returns>True if DBElement Successfully Inserted, False if Otherwise</returns>
-bool DBEngine::insert(std::string key, DBElement value) {
-	if (exists(key))
+bool DBEngine::insert(std::string_view key, const DBElement& value) {
+	if (_compression.threshold != 0 && !value.isCompressed() && value.getDataView().size() >= _compression.threshold)
+		return insert(key, DBElement(value));
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	DBElement * object = createElement(shard, value);
+	if (!storeElement(shard, WriteAheadLog::INSERT, key, object, lsn, bytes))
 		return false;
-	DBElement * object = new DBElement(value);
-	_dbMap[key] = object;
-	insertIndexTags(key);
-	return true;
+	bool expiring = object->getExpiry() != 0;
+	lock.unlock();
+	if (expiring)
+		startExpiry();
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn);
+}
+
+/// <summary>
+/// Function to Insert DBElement into Database by Moving it into the Database.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement to be Inserted, left without Data and Tags</param>
+/// <returns>True if DBElement Successfully Inserted, False if Otherwise</returns>
+bool DBEngine::insert(std::string_view key, DBElement&& value) {
+	compressElement(value);
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	DBElement * object = createElement(shard, std::move(value));
+	if (!storeElement(shard, WriteAheadLog::INSERT, key, object, lsn, bytes))
+		return false;
+	bool expiring = object->getExpiry() != 0;
+	lock.unlock();
+	if (expiring)
+		startExpiry();
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn);
 }
 
 /// <summary>
@@ -147,13 +864,8 @@ bool DBEngine::insert(std::string key, DBElement value) {
 /// <param name="key">Key</param>
 /// <param name="value">Pointer to the DBElement Which is to be Inserted</param>
 /// <returns>True if DBElement Successfully Inserted, False if Otherwise</returns>
-bool DBEngine::insert(std::string key, DBElement * value) {
-	if(exists(key))
-		return false;
-	DBElement * object = new DBElement(*value);
-	_dbMap[key] = object;
-	insertIndexTags(key);
-	return true;
+bool DBEngine::insert(std::string_view key, DBElement * value) {
+	return insert(key, *value);
 }
 
 /// <summary>
@@ -162,15 +874,52 @@ bool DBEngine::insert(std::string key, DBElement * value) {
 /// <param name="key">Key</param>
 /// <param name="value">New Object to be Associated with the Key</param>
 /// <returns>True if DBElement Associated with given Key is Successfully Updated in Database, False if Otherwise</returns>
-bool DBEngine::update(std::string key, DBElement value) {
-	if(!exists(key))
+bool DBEngine::update(std::string_view key, const DBElement& value) {
+	if (_compression.threshold != 0 && !value.isCompressed() && value.getDataView().size() >= _compression.threshold)
+		return update(key, DBElement(value));
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	DBElement * object = createElement(shard, value);
+	if (!storeElement(shard, WriteAheadLog::UPDATE, key, object, lsn, bytes))
 		return false;
-	deleteIndexTags(key);
-	DBElement * object = new DBElement(value);
-	delete _dbMap[key];
-	_dbMap[key] = object;
-	insertIndexTags(key);
-	return true;
+	bool expiring = object->getExpiry() != 0;
+	lock.unlock();
+	if (expiring)
+		startExpiry();
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn);
+}
+
+/// <summary>
+/// Function to Update DBElement associated with Key in Arguments in the Database by
+/// Moving the New Object into the Database.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">New Object to be Associated with the Key, left without Data and Tags</param>
+/// <returns>True if DBElement Associated with given Key is Successfully Updated in Database, False if Otherwise</returns>
+bool DBEngine::update(std::string_view key, DBElement&& value) {
+	compressElement(value);
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	DBElement * object = createElement(shard, std::move(value));
+	if (!storeElement(shard, WriteAheadLog::UPDATE, key, object, lsn, bytes))
+		return false;
+	bool expiring = object->getExpiry() != 0;
+	lock.unlock();
+	if (expiring)
+		startExpiry();
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn);
 }
 
 /// <summary>
@@ -179,15 +928,8 @@ bool DBEngine::update(std::string key, DBElement value) {
 /// <param name="key">Key</param>
 /// <param name="value">Pointer to New Object to be Associated with the Key</param>
 /// <returns>True if DBElement Associated with given Key is Successfully Updated in Database, False if Otherwise</returns>
-bool DBEngine::update(std::string key, DBElement * value) {
-	if(!exists(key))
-		return false;
-	deleteIndexTags(key);
-	DBElement * object = new DBElement(*value);
-	delete _dbMap[key];
-	_dbMap[key] = object;
-	insertIndexTags(key);
-	return true;
+bool DBEngine::update(std::string_view key, DBElement * value) {
+	return update(key, *value);
 }
 
 /// <summary>
@@ -195,117 +937,2236 @@ bool DBEngine::update(std::string key, DBElement * value) {
 /// </summary>
 /// <param name="key">Key</param>
 /// <returns>True if Key and the DBElement Associated with it are Successfully Removed from Database, False if Otherwise</returns>
-bool DBEngine::remove(std::string key) {
-	if(!exists(key))
+bool DBEngine::remove(std::string_view key) {
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	uint64_t lsn = 0;
+	DBElement * retired = nullptr;
+	if (!eraseElement(shard, key, lsn, retired))
 		return false;
-	deleteIndexTags(key);
-	delete _dbMap[key];
-	_dbMap.erase(key);
-	return true;
+	lock.unlock();
+	if (retired != nullptr)
+		retireElement(retired);
+	memtableWrite(footprint(key, nullptr));
+	return _wal.commit(lsn);
 }
 
 /// <summary>
-/// Function to Get Object Associated with given Key from Database in nicely Formatted Manner.
+/// Function to Remove a Key from a Shard : it's DBElement, Document ID and Tag Index
+/// entries, leaving a Tombstone with an LSM Tier, and to Log the Removal. Caller must
+/// hold the Shard's Writer Lock and Retire the Removed DBElement once it is Released,
+/// unless it is kept for Pinned Readers.
 /// </summary>
+/// <param name="shard">Shard which holds the Key</param>
 /// <param name="key">Key</param>
-/// <returns>If Key Exists then returns Object Associated with given Key from Database in nicely Formatted Manner, Else return Invalid</returns>
-std::string DBEngine::getData(std::string key) {
-	if (!exists(key))
-		return "Invalid Key";
-	std::string aggregator;
-	aggregator.append(" Key : " + key + "\n");
-	aggregator.append(" -----\n");
-	aggregator.append(_dbMap[key]->show());
-	return aggregator;
+/// <param name="lsn">Set to the LSN of the REMOVE Record</param>
+/// <param name="retired">Set to the DBElement to Retire, NULL if Readers keep it</param>
+/// <returns>True if the Key was Removed, False if it does not Exist</returns>
+bool DBEngine::eraseElement(Shard * shard, std::string_view key, uint64_t& lsn, DBElement *& retired) {
+	uint32_t document;
+	DBElement * current = shard->table.erase(key, &document);
+	retired = nullptr;
+	if (current == nullptr)
+		return false;
+	retired = bury(shard, key, current);
+	account(key, nullptr, current);
+	preserve(shard, document, key, current);
+	deleteIndexTags(shard, document, current);
+	releaseDocument(shard, document);
+	if (_lsm.isOpen())
+		shard->tombstones[std::string(key)] = ++shard->removals;
+	lsn = _wal.append(WriteAheadLog::REMOVE, key, std::string_view(), 0);
+	return true;
 }
 
 /// <summary>
-/// Function to Get Object Associated with given Key from Database in Raw Format (as DBEngine)
+/// Function to get the Sequence Number of a Write. Writers take it under the Shard's
+/// Writer Lock and Publish before they Release it, which is what lets beginRead
+/// wait for every Write up to the Sequence Number it Pins. The Writes of a Batch
+/// share the Sequence Number the Batch took first.
 /// </summary>
+/// <returns>Sequence Number, higher than that of every earlier Write</returns>
+uint64_t DBEngine::nextVersion() {
+	if (batchVersion != 0)
+		return batchVersion;
+	return _sequence.fetch_add(1) + 1;
+}
+
+/// <summary>
+/// Function to Stamp a new Version of a DBElement which Replaces the current one.
+/// While a Reader is Pinned, or older Versions kept for an earlier Reader are still
+/// Linked behind it, the current Version is Linked behind the new one and the Key
+/// stays Listed for the Version Thread until the Chain is Trimmed, otherwise it goes
+/// to the Caller to be Retired. The Sequence Number is taken before the Readers are Counted, and
+/// beginRead Counts itself before it Reads the Sequence Number, so a Reader this
+/// misses sees the new Version anyway. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="document">Document ID of the Key</param>
 /// <param name="key">Key</param>
-/// <returns>If given Key Exists in the Database then Return the DBElement associated with it, Else return DBElement with Invalid Key as Data</returns>
-DBElement DBEngine::getDataRaw(std::string key) {
-	if (!exists(key))
-		return DBElement("> invalid key");
-	return *_dbMap[key];
+/// <param name="object">New Version, not Published yet</param>
+/// <param name="current">Version being Replaced</param>
+/// <returns>Version the Caller must Retire, NULL if Readers keep it</returns>
+DBElement * DBEngine::supersede(Shard * shard, uint32_t document, std::string_view key, DBElement * object, DBElement * current) {
+	preserve(shard, document, key, current);
+	object->setVersion(nextVersion());
+	if (_readers.load() == 0 && current->getOlder() == nullptr)
+		return current;
+	if (current->getOlder() == nullptr)
+		shard->versioned.emplace_back(key);
+	object->setOlder(current);
+	return nullptr;
 }
 
 /// <summary>
-/// Function to Update Data of the DBElement Associated with given Key in the Database.
+/// Function to keep the DBElement of a Removed Key, with the Sequence Number of the
+/// Removal, for the Readers which are Pinned. It is also kept if older Versions are
+/// still Linked behind it, so the Version Thread Retires the whole Chain. Caller must
+/// hold the Shard's Writer Lock.
 /// </summary>
+/// <param name="shard">Shard which held the Key</param>
 /// <param name="key">Key</param>
-/// <param name="data">New Value of Data</param>
-/// <returns></returns>
-bool DBEngine::updateData(std::string key, std::string data)
-{
-	if(!exists(key))
-		return false;
-	_dbMap[key]->setData(data);
-	return true;
+/// <param name="current">DBElement which was Removed</param>
+/// <returns>DBElement the Caller must Retire, NULL if Readers keep it</returns>
+DBElement * DBEngine::bury(Shard * shard, std::string_view key, DBElement * current) {
+	uint64_t sequence = nextVersion();
+	if (_readers.load() == 0 && current->getOlder() == nullptr)
+		return current;
+	shard->removed.emplace(std::string(key), std::make_pair(current, sequence));
+	return nullptr;
 }
 
 /// <summary>
-/// Function to Show Entire Database.
+/// Function to get the Sequence Number of the oldest Pinned Reader. Every Version
+/// older than the newest one not after it can be dropped. A Reader which Pins
+/// later gets at least the current Sequence Number.
 /// </summary>
-/// <returns>Entire Database in Nicely Formatted Manner</returns>
-std::string DBEngine::show() {
-	std::string aggregator;
-	for (std::pair<std::string, DBElement*> pr : _dbMap) {
-		aggregator.append(getData(pr.first) + "\n");
+/// <returns>Oldest Pinned Sequence Number, the current one if no Reader is Pinned</returns>
+uint64_t DBEngine::oldestRead() {
+	std::lock_guard<std::mutex> lock(_readLock);
+	if (_readSequences.empty())
+		return _sequence.load();
+	return *_readSequences.begin();
+}
+
+/// <summary>
+/// Function to walk back from a Version to the newest Version which is not after a
+/// Sequence Number. Caller must be Pinned by an EpochGuard.
+/// </summary>
+/// <param name="value">Newest Version, may be NULL</param>
+/// <param name="sequence">Sequence Number of the Reader</param>
+/// <returns>Version the Reader sees, NULL if the Key did not Exist yet</returns>
+DBElement * DBEngine::visibleVersion(DBElement * value, uint64_t sequence) {
+	while (value != nullptr && value->getVersion() > sequence)
+		value = value->getOlder();
+	return value;
+}
+
+/// <summary>
+/// Function to Unlink the Versions behind the newest Version which is not after the
+/// oldest Pinned Sequence Number, no Reader can see them. Readers still walking them
+/// are safe since they are Retired. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="value">Newest Version</param>
+/// <param name="oldest">Sequence Number of the oldest Pinned Reader</param>
+/// <param name="retired">Unlinked Versions are added to it</param>
+/// <returns>True if older Versions are still Linked</returns>
+bool DBEngine::trimVersions(DBElement * value, uint64_t oldest, std::vector<DBElement*>& retired) {
+	DBElement * kept = value;
+	while (kept->getVersion() > oldest && kept->getOlder() != nullptr)
+		kept = kept->getOlder();
+	DBElement * older = kept->getOlder();
+	if (older != nullptr) {
+		kept->setOlder(nullptr);
+		for (; older != nullptr; older = older->getOlder())
+			retired.push_back(older);
 	}
-	return aggregator;
+	return value->getOlder() != nullptr;
 }
 
 /// <summary>
-/// Function to Show all the Objects associated with Keys in the Arguments which 
-/// are Present in the Datbaase.
+/// Function to Find the Version of a Key a Reader Pinned to a Sequence Number sees.
+/// Keys in the DB Table walk back through their Versions, Keys Removed since are
+/// found among the kept DBElements. Keys only on Disk were not Written since any
+/// Reader was Pinned, so their newest Version is the one to see. Caller must be
+/// Pinned by an EpochGuard.
 /// </summary>
-/// <param name="keys">List of Keys who's associated Objects are to be retrieved</param>
-/// <returns>Objects associated with Keys in the Arguments which are Present in the Datbaase, in Nicely Formatter Manner</returns>
-std::string DBEngine::show(std::unordered_set<std::string> keys) {
-	std::string aggregator;
-	for (std::string key : keys) {
-		if (exists(key)) {
-			aggregator.append(getData(key) + "\n");
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="sequence">Pinned Sequence Number</param>
+/// <returns>Version of the Key, NULL if it did not Exist at the Sequence Number</returns>
+DBElement * DBEngine::lookupAt(Shard * shard, std::string_view key, uint64_t sequence) {
+	DBElement * newest = shard->table.find(key);
+	DBElement * value = visibleVersion(newest, sequence);
+	if (value != nullptr)
+		return value;
+	{
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		auto range = shard->removed.equal_range(std::string(key));
+		for (auto entry = range.first; entry != range.second; ++entry) {
+			if (entry->second.second > sequence && (value = visibleVersion(entry->second.first, sequence)) != nullptr)
+				return value;
 		}
 	}
-	return aggregator;
+	if (newest != nullptr)
+		return nullptr;
+	/* Written after the Sequence Number if it is in the DB Table by now */
+	return visibleVersion(lookup(shard, key), sequence);
 }
 
 /// <summary>
-/// Function to Retrieve All the Keys of DBElements who have a Tag which is Exactly same 
-/// as Argument.
+/// Function to add the Keys which Link older Versions or were Removed while Readers
+/// were Pinned, the Tag Index does not hold the Tags of their older Versions.
 /// </summary>
-/// <param name="tag">Tag</param>
-/// <returns>All the Keys of DBElements who have a Tag which is Exactly same as Argument</returns>
-std::unordered_set<std::string> DBEngine::getKeysWithTag(std::string tag) {
-	if (_tagMap.find(tag) == _tagMap.end())
-		return std::unordered_set<std::string>();
-	return _tagMap[tag];
+/// <param name="keys">Keys are added to it</param>
+void DBEngine::versionedKeys(std::unordered_set<std::string>& keys) {
+	for (Shard * shard : _shards) {
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		keys.insert(shard->versioned.begin(), shard->versioned.end());
+		for (const auto& entry : shard->removed)
+			keys.insert(entry.first);
+	}
 }
 
-
 /// <summary>
-/// Function to Show all DBElements who have a Tag which is Exactly same 
-/// as Argument.
+/// Function to get the Keys within a Range which Link older Versions or were Removed
+/// while Readers were Pinned, in order. The Key and Time Indexes only hold the newest
+/// Version of every Key, so Scans add these like the Tag Queries do.
 /// </summary>
-/// <param name="tag">Tag</param>
-/// <returns>All DBElements who have a Tag which is Exactly same as Argument, in a Nicely Formatted Manner. Returns N/A if no such Tag Exists in Database</returns>
-std::string DBEngine::showUsingTag(std::string tag) {
-	if (_tagMap.find(tag) == _tagMap.end())
-		return "N/A";
-	return show(getKeysWithTag(tag));
+/// <param name="from">Smallest Key to return</param>
+/// <param name="within">Returns True for the Keys, from the given Key on, within the Range</param>
+/// <returns>Versioned and Removed Keys within the Range, in order</returns>
+std::vector<std::string> DBEngine::versionedKeys(std::string_view from, const std::function<bool(std::string_view)>& within) {
+	std::unordered_set<std::string> versioned;
+	versionedKeys(versioned);
+	std::vector<std::string> keys;
+	for (const std::string& key : versioned) {
+		if (key >= from && within(key))
+			keys.push_back(key);
+	}
+	std::sort(keys.begin(), keys.end());
+	return keys;
 }
 
-#ifdef TEST_CREATE_DBENGINE
+/// <summary>
+/// Function to keep only the Keys whose Version a Reader Pinned to a Sequence Number
+/// sees and which match a Filter, in their order.
+/// </summary>
+/// <param name="keys">Keys, the others are dropped from it</param>
+/// <param name="sequence">Pinned Sequence Number</param>
+/// <param name="matches">Filter on the Version, empty to keep every Key which Existed</param>
+void DBEngine::visibleKeys(std::vector<std::string>& keys, uint64_t sequence, const std::function<bool(const DBElement*)>& matches) {
+	EpochGuard guard;
+	size_t kept = 0;
+	for (size_t index = 0; index < keys.size(); index++) {
+		DBElement * value = lookupAt(shardFor(keys[index]), keys[index], sequence);
+		if (value == nullptr || (matches && !matches(value)))
+			continue;
+		if (kept != index)
+			keys[kept] = std::move(keys[index]);
+		kept++;
+	}
+	keys.resize(kept);
+}
 
-/* Include Utilities Namespace for StringHelper Functions */
-using namespace Utilities;
+/// <summary>
+/// Function to Show the Versions of Keys a Reader Pinned to a Sequence Number sees,
+/// only those which match a Filter, in the order of the Keys.
+/// </summary>
+/// <param name="keys">Keys, an unordered_set or a vector</param>
+/// <param name="sequence">Pinned Sequence Number</param>
+/// <param name="matches">Filter on the Version, empty to Show every Version</param>
+/// <returns>Matching Versions in a Nicely Formatted Manner</returns>
+template <typename Keys>
+std::string DBEngine::showAt(const Keys& keys, uint64_t sequence, const std::function<bool(const DBElement*)>& matches) {
+	std::string aggregator;
+	EpochGuard guard;
+	long long int now = TimingWheel::now();
+	for (const std::string& key : keys) {
+		DBElement * value = lookupAt(shardFor(key), key, sequence);
+		if (value == nullptr || value->isExpired(now) || (matches && !matches(value)))
+			continue;
+		formatElement(aggregator, key, value);
+		aggregator.push_back('\n');
+	}
+	return aggregator;
+}
 
 /// <summary>
-/// Test Function to Create DBElements to be Inserted into DBEngine.
+/// Function to Pin the current Sequence Number. Until endRead, every Reader method
+/// given it sees the Database as it was at that point, and Writers keep the Versions
+/// it needs. Waits for the Writers which took a Sequence Number up to it to Publish,
+/// by passing through every Shard's Lock once.
 /// </summary>
-/// <returns>Vector of DBElements which are to be Inserted into DBEngine</returns>
+/// <returns>Pinned Sequence Number</returns>
+uint64_t DBEngine::beginRead() {
+	_readers.fetch_add(1);
+	uint64_t sequence;
+	{
+		std::lock_guard<std::mutex> lock(_readLock);
+		sequence = _sequence.load();
+		_readSequences.insert(sequence);
+	}
+	for (Shard * shard : _shards)
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+	startVersions();
+	return sequence;
+}
+
+/// <summary>
+/// Function to Unpin a Sequence Number Pinned by beginRead. The Versions only it
+/// could see are dropped by the Version Thread.
+/// </summary>
+/// <param name="sequence">Pinned Sequence Number</param>
+void DBEngine::endRead(uint64_t sequence) {
+	{
+		std::lock_guard<std::mutex> lock(_readLock);
+		auto pinned = _readSequences.find(sequence);
+		if (pinned == _readSequences.end())
+			return;
+		_readSequences.erase(pinned);
+	}
+	_readers.fetch_sub(1);
+}
+
+/// <summary>
+/// Function to Retrieve the DBElement of a Key as a Reader Pinned to a Sequence
+/// Number sees it.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="sequence">Sequence Number Pinned by beginRead</param>
+/// <returns>DBElement in a Nicely Formatted Manner, Invalid Key if it did not Exist at the Sequence Number</returns>
+std::string DBEngine::getDataAt(std::string_view key, uint64_t sequence) {
+	EpochGuard guard;
+	DBElement * value = lookupAt(shardFor(key), key, sequence);
+	if (value == nullptr || value->isExpired(TimingWheel::now()))
+		return "Invalid Key";
+	std::string aggregator;
+	formatElement(aggregator, key, value);
+	return aggregator;
+}
+
+/// <summary>
+/// Function to drop the old Versions and Removed DBElements which the oldest Pinned
+/// Reader can not see. Every Shard is Trimmed under it's Writer Lock, and the dropped
+/// Versions are Retired once it is Released. Run by the Version Thread.
+/// </summary>
+/// <returns>Number of Versions dropped</returns>
+size_t DBEngine::collectVersions() {
+	uint64_t oldest = oldestRead();
+	size_t collected = 0;
+	std::vector<DBElement*> retired;
+	for (Shard * shard : _shards) {
+		{
+			std::unique_lock<std::shared_mutex> lock(shard->lock);
+			size_t kept = 0;
+			for (size_t index = 0; index < shard->versioned.size(); index++) {
+				DBElement * value = shard->table.find(shard->versioned[index]);
+				if (value == nullptr || !trimVersions(value, oldest, retired))
+					continue;
+				if (kept != index)
+					shard->versioned[kept] = std::move(shard->versioned[index]);
+				kept++;
+			}
+			shard->versioned.resize(kept);
+			for (auto entry = shard->removed.begin(); entry != shard->removed.end();) {
+				if (entry->second.second > oldest) {
+					trimVersions(entry->second.first, oldest, retired);
+					++entry;
+					continue;
+				}
+				for (DBElement * value = entry->second.first; value != nullptr; value = value->getOlder())
+					retired.push_back(value);
+				entry = shard->removed.erase(entry);
+			}
+		}
+		collected += retired.size();
+		for (DBElement * value : retired)
+			retireElement(value);
+		retired.clear();
+	}
+	return collected;
+}
+
+/// <summary>
+/// Function to Count the old Versions and Removed DBElements kept for Pinned Readers.
+/// </summary>
+/// <returns>Number of kept Versions</returns>
+size_t DBEngine::versionCount() {
+	size_t count = 0;
+	EpochGuard guard;
+	for (Shard * shard : _shards) {
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		std::unordered_set<std::string> listed(shard->versioned.begin(), shard->versioned.end());
+		for (const std::string& key : listed) {
+			DBElement * value = shard->table.find(key);
+			for (value = value != nullptr ? value->getOlder() : nullptr; value != nullptr; value = value->getOlder())
+				count++;
+		}
+		for (const auto& entry : shard->removed) {
+			for (DBElement * value = entry.second.first; value != nullptr; value = value->getOlder())
+				count++;
+		}
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to Start the Thread which drops old Versions, unless it runs already.
+/// </summary>
+void DBEngine::startVersions() {
+	std::lock_guard<std::mutex> lock(_versionLock);
+	if (!_versionStop && !_versionThread.joinable())
+		_versionThread = std::thread(&DBEngine::versionLoop, this);
+}
+
+/// <summary>
+/// Function run by the Version Thread. Drops the Versions no Pinned Reader can see
+/// every DBEngineConfig::versionMillis until the DBEngine is Destroyed.
+/// </summary>
+void DBEngine::versionLoop() {
+	std::chrono::milliseconds period(_versionMillis);
+	std::unique_lock<std::mutex> lock(_versionLock);
+	while (!_versionWake.wait_for(lock, period, [this]() { return _versionStop; })) {
+		lock.unlock();
+		collectVersions();
+		lock.lock();
+	}
+}
+
+/// <summary>
+/// Function to Remove a Key if it's DBElement has Expired. Called by Readers which
+/// found it Expired and by Writers before they take the Shard's Lock, so the Key is
+/// gone before it is Modified. Returns at once while no Key has a Deadline. The
+/// REMOVE Record is not Waited for, Replaying the Deadline Removes the Key anyway.
+/// Caller must not hold the Shard's Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+void DBEngine::expireKey(Shard * shard, std::string_view key) {
+	if (_expiring.load(std::memory_order_relaxed) == 0)
+		return;
+	{
+		EpochGuard guard;
+		DBElement * value = shard->table.find(key);
+		if (value == nullptr || value->getExpiry() == 0 || !value->isExpired(TimingWheel::now()))
+			return;
+	}
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	DBElement * current = shard->table.find(key);
+	if (current == nullptr || !current->isExpired(TimingWheel::now()))
+		return;
+	uint64_t lsn = 0;
+	DBElement * retired = nullptr;
+	eraseElement(shard, key, lsn, retired);
+	lock.unlock();
+	if (retired != nullptr)
+		retireElement(retired);
+	memtableWrite(footprint(key, nullptr));
+}
+
+/// <summary>
+/// Function to add a Timer for a Key's Deadline to the Shard's TimingWheel and Log
+/// the Deadline as an EXPIRE Record. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="deadline">Milliseconds since the Unix Epoch, 0 if the Key no longer Expires</param>
+/// <returns>LSN of the EXPIRE Record</returns>
+uint64_t DBEngine::scheduleExpiry(Shard * shard, std::string_view key, long long int deadline) {
+	if (deadline != 0) {
+		shard->wheel.schedule(key, deadline);
+		_expiring++;
+	}
+	return _wal.append(WriteAheadLog::EXPIRE, key, std::string_view(), deadline);
+}
+
+/// <summary>
+/// Function to Log the Deadline of every Key again, called right after the Write
+/// Ahead Log was Rotated since neither Snapshots nor SSTables store Deadlines.
+/// Caller must hold the Writer Locks of all Shards.
+/// </summary>
+/// <returns>LSN of the last EXPIRE Record, 0 if none was Logged</returns>
+uint64_t DBEngine::relogExpiry() {
+	uint64_t lsn = 0;
+	if (_expiring == 0)
+		return lsn;
+	for (Shard * shard : _shards) {
+		shard->wheel.forEach([this, shard, &lsn](const TimingWheel::Timer& timer) {
+			DBElement * current = shard->table.find(timer.key);
+			if (current != nullptr && current->getExpiry() == timer.deadline)
+				lsn = _wal.append(WriteAheadLog::EXPIRE, timer.key, std::string_view(), timer.deadline);
+		});
+	}
+	return lsn;
+}
+
+/// <summary>
+/// Function to Start the Expiry Thread unless it is running, Construction is not
+/// done yet or the DBEngine is being Destroyed.
+/// </summary>
+void DBEngine::startExpiry() {
+	std::lock_guard<std::mutex> lock(_expiryLock);
+	if (_ready && !_expiryStop && !_expiryThread.joinable())
+		_expiryThread = std::thread(&DBEngine::expiryLoop, this);
+}
+
+/// <summary>
+/// Function run by the Expiry Thread. Calls removeExpired() every Tick till the
+/// DBEngine is Destroyed.
+/// </summary>
+void DBEngine::expiryLoop() {
+	std::chrono::milliseconds tick(_shards.front()->wheel.tickMillis());
+	std::unique_lock<std::mutex> lock(_expiryLock);
+	while (!_expiryWake.wait_for(lock, tick, [this]() { return _expiryStop; })) {
+		lock.unlock();
+		removeExpired();
+		lock.lock();
+	}
+}
+
+/// <summary>
+/// Function to Remove the Keys whose Deadline has passed. Every Shard's TimingWheel
+/// is advanced under it's Writer Lock, at most DBEngineConfig::expiryBatch Timers
+/// at a time, and the Lock is Released between batches so Readers of the Tag Index
+/// and Writers of the Shard are never held up for long. Timers of Keys which were
+/// Removed or given another Deadline meanwhile are dropped.
+/// </summary>
+/// <returns>Number of Keys Removed</returns>
+size_t DBEngine::removeExpired() {
+	long long int now = TimingWheel::now();
+	size_t removed = 0;
+	std::vector<DBElement*> expired;
+	for (Shard * shard : _shards) {
+		for (size_t handed = _expiryBatch; handed == _expiryBatch;) {
+			uint64_t lsn = 0;
+			size_t bytes = 0;
+			std::unique_lock<std::shared_mutex> lock(shard->lock);
+			handed = shard->wheel.advance(now, _expiryBatch, [&](const TimingWheel::Timer& timer) {
+				DBElement * current = shard->table.find(timer.key);
+				if (current == nullptr || current->getExpiry() != timer.deadline)
+					return;
+				DBElement * retired = nullptr;
+				eraseElement(shard, timer.key, lsn, retired);
+				if (retired != nullptr)
+					expired.push_back(retired);
+				bytes += footprint(timer.key, nullptr);
+				removed++;
+			});
+			_expiring -= handed;
+			lock.unlock();
+			for (DBElement * value : expired)
+				retireElement(value);
+			expired.clear();
+			memtableWrite(bytes);
+			_wal.commit(lsn);
+		}
+	}
+	return removed;
+}
+
+/// <summary>
+/// Function to set the Deadline at which a Key Expires, or to keep it forever. The
+/// Last Modified Timestamp is not changed.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="deadline">Milliseconds since the Unix Epoch, 0 to never Expire</param>
+/// <returns>True if the Key Exists and the Deadline is Durable, False if otherwise</returns>
+bool DBEngine::setExpiry(std::string_view key, long long int deadline) {
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	DBElement * replaced = nullptr;
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	bool found = expireElement(shard, key, deadline, lsn, bytes, replaced);
+	lock.unlock();
+	if (replaced != nullptr)
+		retireElement(replaced);
+	if (found && deadline != 0)
+		startExpiry();
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn) && found;
+}
+
+/// <summary>
+/// Function to set the Deadline of the DBElement of a Key and Log it. Leaves the
+/// DBElement as it is if it has the Deadline already. Caller must hold the Shard's
+/// Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="deadline">Milliseconds since the Unix Epoch, 0 to never Expire</param>
+/// <param name="lsn">Set to the LSN of the EXPIRE Record, if one was Logged</param>
+/// <param name="bytes">Increased by the Footprint of the Key and new DBElement</param>
+/// <param name="replaced">Set to the DBElement to Retire, NULL if there is none or Readers keep it</param>
+/// <returns>True if the Key Exists</returns>
+bool DBEngine::expireElement(Shard * shard, std::string_view key, long long int deadline, uint64_t& lsn, size_t& bytes, DBElement *& replaced) {
+	replaced = nullptr;
+	return shard->table.modify(key, [&](DBElement * current, uint32_t document) {
+		if (current->getExpiry() == deadline)
+			return current;
+		DBElement * object = createElement(shard, *current);
+		object->setExpiry(deadline);
+		lsn = scheduleExpiry(shard, key, deadline);
+		bytes += footprint(key, object);
+		account(key, object, current);
+		replaced = supersede(shard, document, key, object, current);
+		return object;
+	});
+}
+
+/// <summary>
+/// Function to Apply a Record of the Write Ahead Log while the Database is being
+/// Rebuilt. Mutations are not Logged again since the Log is not open yet, and as
+/// no Reader can see the Database yet the Timestamp of the Mutated DBElement is
+/// Restored in place. A BATCH Record is Applied as the Records it holds.
+/// </summary>
+/// <param name="record">Record Replayed from the Write Ahead Log</param>
+void DBEngine::replayRecord(const WriteAheadLog::Record& record) {
+	if (record.operation == WriteAheadLog::BATCH) {
+		for (const WriteAheadLog::Record& write : record.batch)
+			replayRecord(write);
+		return;
+	}
+	if (record.operation == WriteAheadLog::INSERT || record.operation == WriteAheadLog::UPDATE) {
+		DBElement element(record.value);
+		element.addTags(record.tags);
+		element.setlastModified(record.timestamp);
+		if (record.operation == WriteAheadLog::INSERT)
+			insert(record.key, std::move(element));
+		else
+			update(record.key, std::move(element));
+		return;
+	}
+	if (record.operation == WriteAheadLog::REMOVE) {
+		remove(record.key);
+		return;
+	}
+	if (record.operation == WriteAheadLog::EXPIRE) {
+		setExpiry(record.key, record.timestamp);
+		return;
+	}
+	if (record.operation == WriteAheadLog::ADD_TAG)
+		addTag(record.key, record.value);
+	else if (record.operation == WriteAheadLog::REMOVE_TAG)
+		removeTag(record.key, record.value);
+	else
+		updateData(record.key, record.value);
+	EpochGuard guard;
+	Shard * shard = shardFor(record.key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	uint32_t document;
+	DBElement * value = shard->table.find(record.key, document);
+	if (value != nullptr) {
+		value->setlastModified(record.timestamp);
+		stampDocument(shard, document, record.timestamp);
+	}
+}
+
+/// <summary>
+/// Function to Check whether Mutations are being Recorded in a Write Ahead Log.
+/// </summary>
+/// <returns>True if a Write Ahead Log is open and Writing it has not failed</returns>
+bool DBEngine::isDurable() {
+	return _wal.isOpen() && !_wal.failed();
+}
+
+/// <summary>
+/// Function to Retrieve the Counters of the Write Ahead Log.
+/// </summary>
+/// <returns>Records, Bytes, Writes and fsyncs of the Write Ahead Log</returns>
+WriteAheadLog::Stats DBEngine::logStats() {
+	return _wal.stats();
+}
+
+/// <summary>
+/// Function to Check whether DBElements are kept in an LSM Tier.
+/// </summary>
+/// <returns>True if the LSM Tier is open</returns>
+bool DBEngine::isTiered() {
+	return _lsm.isOpen();
+}
+
+/// <summary>
+/// Function to Wait till the LSM Tier has no Compaction left to do and Retrieve it's
+/// Shape and Counters.
+/// </summary>
+/// <returns>SSTables and Bytes per Level, Read and Write Counters of the LSM Tier</returns>
+LSMTree::Stats DBEngine::tierStats() {
+	if (!_lsm.isOpen())
+		return LSMTree::Stats();
+	_lsm.waitIdle();
+	return _lsm.stats();
+}
+
+/// <summary>
+/// Function to Retrieve the Counters of the Codec. They are kept for the whole
+/// Process, so they include every DBEngine and every DBElement Compressed directly.
+/// </summary>
+/// <returns>Bytes Compressed, Compression Ratio and Time spent in the Codec</returns>
+Codec::Stats DBEngine::compressionStats() {
+	return Codec::stats();
+}
+
+/// <summary>
+/// Function to Retrieve the Counters of the Eviction Policy.
+/// </summary>
+/// <returns>Bytes held, Memory Limit, Evicted and Rejected Keys</returns>
+Eviction::Stats DBEngine::evictionStats() {
+	Eviction::Stats stats = _eviction.stats();
+	stats.memoryBytes = _residentBytes.load(std::memory_order_relaxed);
+	return stats;
+}
+
+/// <summary>
+/// Function to Write the whole Database to a Snapshot and Wait till it is Durable.
+/// Mutations are only Blocked while the Snapshot point is Captured, see startSnapshot.
+/// </summary>
+/// <param name="path">Path of the Snapshot File</param>
+/// <returns>True if the Snapshot was Written</returns>
+bool DBEngine::saveSnapshot(std::string_view path) {
+	waitSnapshot();
+	return startSnapshot(path) && waitSnapshot();
+}
+
+/// <summary>
+/// Function to Capture the Database and Write it to a Snapshot File from a background
+/// Thread. Returns once the Snapshot point is Captured : the Snapshot holds every
+/// Mutation made before the call and none made after it returns. Mutations made
+/// meanwhile are Logged to a new Write Ahead Log, the Records before the Snapshot
+/// point are Discarded once the Snapshot is Durable. If the Process stops before
+/// that, the old Snapshot and both Logs are Replayed on the next start. On Windows
+/// the Attached Snapshot cannot be Replaced while it is Mapped, so path must differ from it.
+/// </summary>
+/// <param name="path">Path of the Snapshot File</param>
+/// <returns>True if the Snapshot was Started, False if one is already running</returns>
+bool DBEngine::startSnapshot(std::string_view path) {
+	{
+		std::lock_guard<std::mutex> lock(_snapshotLock);
+		if (_snapshotStats.running)
+			return false;
+		_snapshotStats = SnapshotStats();
+		_snapshotStats.running = true;
+	}
+	if (_snapshotThread.joinable())
+		_snapshotThread.join();
+	std::promise<void> captured;
+	std::future<void> ready = captured.get_future();
+	_snapshotThread = std::thread(&DBEngine::writeSnapshot, this, std::string(path), &captured);
+	ready.wait();
+	return true;
+}
+
+/// <summary>
+/// Function to Wait for the background Snapshot to finish.
+/// </summary>
+/// <returns>True if the last Snapshot was Written, False if it failed or none was Started</returns>
+bool DBEngine::waitSnapshot() {
+	if (_snapshotThread.joinable())
+		_snapshotThread.join();
+	std::lock_guard<std::mutex> lock(_snapshotLock);
+	return _snapshotStats.succeeded;
+}
+
+/// <summary>
+/// Function to Retrieve the Statistics of the running or last Snapshot.
+/// </summary>
+/// <returns>Pause, Duration, Bytes and Records of the Snapshot</returns>
+SnapshotStats DBEngine::snapshotStats() {
+	std::lock_guard<std::mutex> lock(_snapshotLock);
+	return _snapshotStats;
+}
+
+/// <summary>
+/// Function to keep the current Version of a DBElement for the running background
+/// Snapshot before a Writer Replaces or Removes it. Only Documents which are part of
+/// the Snapshot point and have not been Written yet are kept, and only their first
+/// Replaced Version. The DBElement stays alive since the Snapshot Thread is Pinned.
+/// Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="document">Document ID of the Key</param>
+/// <param name="key">Key</param>
+/// <param name="current">DBElement being Replaced or Removed</param>
+void DBEngine::preserve(Shard * shard, uint32_t document, std::string_view key, DBElement * current) {
+	Capture * capture = shard->capture;
+	if (capture == nullptr || document < capture->written || !capture->liveDocs.contains(document))
+		return;
+	if (capture->preserved.find(document) == capture->preserved.end())
+		capture->preserved.emplace(document, std::make_pair(std::string(key), current));
+}
+
+/// <summary>
+/// Function run by the background Snapshot Thread. Captures every Shard at once
+/// under their Writer Locks, then Writes the Documents of each Shard in batches
+/// under a Shared Lock so Writers only wait for one batch at a time. Deadlines are
+/// Logged again into the new Log since the Snapshot does not keep them.
+/// </summary>
+/// <param name="path">Path of the Snapshot File</param>
+/// <param name="captured">Promise fulfilled once the Snapshot point is Captured</param>
+void DBEngine::writeSnapshot(std::string path, std::promise<void> * captured) {
+	typedef std::chrono::steady_clock Clock;
+	EpochGuard guard;
+	Clock::time_point start = Clock::now();
+	std::vector<std::string> names;
+	uint64_t lsn = 0;
+	{
+		std::vector<std::unique_lock<std::shared_mutex>> locks;
+		for (Shard * shard : _shards)
+			locks.emplace_back(shard->lock);
+		for (Shard * shard : _shards) {
+			shard->capture = new Capture();
+			shard->capture->liveDocs = shard->liveDocs;
+			shard->capture->baseLive = shard->baseLive;
+			shard->capture->tagMap = shard->tagMap;
+			shard->capture->documents = shard->baseDocs + (uint32_t)shard->docKeys.size();
+		}
+		for (uint32_t id = 0; id < (uint32_t)_dictionary.size(); id++)
+			names.push_back(_dictionary.name(id));
+		/* With an LSM Tier the Log is Rotated by Flushes instead */
+		if (!_lsm.isOpen() && _wal.rotate())
+			lsn = relogExpiry();
+	}
+	double pause = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	captured->set_value();
+	_wal.commit(lsn);
+
+	Snapshot::Writer writer;
+	bool written = writer.open(path);
+	uint64_t records = 0, preserved = 0;
+	for (Shard * shard : _shards) {
+		Capture * capture = shard->capture;
+		std::vector<uint32_t> documents;
+		documents.reserve(capture->liveDocs.cardinality());
+		capture->liveDocs.forEach([&documents](uint32_t document) { documents.push_back(document); });
+		/* Snapshot Records which could not be Loaded are left out */
+		std::vector<uint32_t> remap(written ? capture->documents : 0, UINT32_MAX);
+		for (size_t batch = 0; written && batch < documents.size(); batch += 1024) {
+			std::shared_lock<std::shared_mutex> lock(shard->lock);
+			for (size_t index = batch; index < documents.size() && index < batch + 1024; index++) {
+				uint32_t document = documents[index];
+				auto old = capture->preserved.find(document);
+				if (old != capture->preserved.end()) {
+					remap[document] = writer.add(old->second.first, *old->second.second);
+				} else if (document < shard->baseDocs && capture->baseLive.contains(document)) {
+					std::string_view record = _snapshot.rawRecord(shard->number, document);
+					if (!record.empty())
+						remap[document] = writer.addRaw(documentKey(shard, document), record);
+				} else {
+					std::string_view key = documentKey(shard, document);
+					DBElement * value = shard->table.find(key);
+					LSMTree::Value version;
+					if (value != nullptr) {
+						remap[document] = writer.add(key, *value);
+					} else if (_lsm.isOpen() && _lsm.get(shard->number, key, version) && !version.removed) {
+						value = restoreElement(nullptr, version);
+						remap[document] = writer.add(key, *value);
+						destroyElement(value);
+					}
+				}
+				records += remap[document] != UINT32_MAX;
+				capture->written = document + 1;
+			}
+		}
+		if (written) {
+			std::unordered_map<uint32_t, PostingList> tags;
+			for (const auto& tag : capture->tagMap) {
+				PostingList& postings = tags[tag.first];
+				tag.second.forEach([&remap, &postings](uint32_t document) {
+					if (remap[document] != UINT32_MAX)
+						postings.add(remap[document]);
+				});
+			}
+			writer.endShard(tags);
+		}
+		std::unique_lock<std::shared_mutex> lock(shard->lock);
+		preserved += capture->preserved.size();
+		shard->capture = nullptr;
+		lock.unlock();
+		delete capture;
+	}
+	written = written && writer.finish(names);
+	if (written && !_lsm.isOpen())
+		_wal.dropRotated();
+	std::lock_guard<std::mutex> lock(_snapshotLock);
+	_snapshotStats.running = false;
+	_snapshotStats.succeeded = written;
+	_snapshotStats.pauseMillis = pause;
+	_snapshotStats.durationMillis = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	_snapshotStats.bytes = written ? writer.size() : 0;
+	_snapshotStats.records = records;
+	_snapshotStats.preserved = preserved;
+}
+
+/// <summary>
+/// Function to get the approximate Bytes a Write adds to the Memtable.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement Written, NULL for a Tombstone</param>
+/// <returns>Bytes of the Key, Data, Tag IDs and DBElement</returns>
+size_t DBEngine::footprint(std::string_view key, const DBElement * value) {
+	if (value == nullptr)
+		return key.size() + sizeof(std::string) + sizeof(uint64_t);
+	return key.size() + value->getDataView().size() + value->getTagCount() * sizeof(uint32_t) + sizeof(DBElement);
+}
+
+/// <summary>
+/// Function to Account for a Write to the Memtables. Starts the Flush Thread once
+/// the Memtables hold memtableBytes, and Blocks the Writer while they hold twice
+/// as much and a Flush is still running. Caller must not hold a Shard's Lock.
+/// </summary>
+/// <param name="bytes">Bytes the Write added, see footprint</param>
+void DBEngine::memtableWrite(size_t bytes) {
+	if (!_lsm.isOpen())
+		return;
+	size_t total = _memtableBytes.fetch_add(bytes) + bytes;
+	if (!_ready || total < _memtableLimit)
+		return;
+	std::unique_lock<std::mutex> lock(_flushLock);
+	if (!_flushing) {
+		if (_flushThread.joinable())
+			_flushThread.join();
+		_flushing = true;
+		_flushThread = std::thread(&DBEngine::flushMemtable, this);
+	} else if (total >= 2 * _memtableLimit) {
+		_flushDone.wait(lock, [this]() { return !_flushing; });
+	}
+}
+
+/// <summary>
+/// Function to Count the Bytes of a DBElement being Published into or Unpublished
+/// from a DB Table against the Memory Limit. Uses footprint, so Keys, Data, Tag IDs
+/// and DBElements are Counted but the Hash Tables and the Tag Index are not, and
+/// those in the TinyLFU Admission Window once more on their own. Caller must hold
+/// the Shard's Writer Lock, which keeps the WINDOW bit of Published DBElements.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="added">DBElement Published, NULL if none</param>
+/// <param name="removed">DBElement Unpublished, NULL if none</param>
+void DBEngine::account(std::string_view key, const DBElement * added, const DBElement * removed) {
+	if (added != nullptr) {
+		size_t bytes = footprint(key, added);
+		_residentBytes.fetch_add(bytes, std::memory_order_relaxed);
+		if (_eviction.inWindow(added->getAccess()))
+			_windowBytes.fetch_add(bytes, std::memory_order_relaxed);
+	}
+	if (removed != nullptr) {
+		size_t bytes = footprint(key, removed);
+		_residentBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		if (_eviction.inWindow(removed->getAccess()))
+			_windowBytes.fetch_sub(bytes, std::memory_order_relaxed);
+	}
+}
+
+/// <summary>
+/// Function to Sample Keys of a Shard from a random Slot onwards. The Victim is the
+/// Key outside the TinyLFU Admission Window the Eviction Policy Ranks highest, Keys
+/// which Expired are picked before any other, and the Candidate the Key of the
+/// Window Read longest ago. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard to Sample</param>
+/// <param name="sample">Set to the picked Keys</param>
+/// <returns>True if a Key was picked, False if the DB Table is empty</returns>
+bool DBEngine::sampleVictim(Shard * shard, Sample& sample) {
+	long long int now = _expiring.load(std::memory_order_relaxed) != 0 ? TimingWheel::now() : 0;
+	uint64_t best = 0, oldest = 0;
+	shard->table.sample((size_t)Eviction::random(), _eviction.options().samples, [&](const std::string& key, DBElement * value) {
+		uint32_t access = value->getAccess();
+		bool expired = now != 0 && value->isExpired(now);
+		if (!expired && _eviction.inWindow(access)) {
+			uint64_t idle = _eviction.idle(access);
+			if (!sample.hasCandidate || idle > oldest) {
+				oldest = idle;
+				sample.candidate = key;
+				sample.admitted = value;
+				sample.hasCandidate = true;
+			}
+			return;
+		}
+		uint64_t rank = expired ? UINT64_MAX : _eviction.rank(key, access);
+		if (!sample.hasVictim || rank > best) {
+			best = rank;
+			sample.victim = key;
+			sample.hasVictim = true;
+		}
+	});
+	return sample.hasVictim || sample.hasCandidate;
+}
+
+/// <summary>
+/// Function to Evict Keys while the Database holds more than the Memory Limit, and
+/// to advance the Access Clock. Every Eviction Samples the next Shard in turn under
+/// it's Writer Lock and Removes the picked Key with eraseElement, so it's Tag Index
+/// entries and Document ID go with it and the Removal is Logged like remove(). The
+/// REMOVE Records are not Waited for. With TinyLFU, while the Admission Window holds
+/// more than it's share the Candidate of the Sample either takes the place of the
+/// Victim or is Evicted itself, see Eviction::admit. Called by Writers once they
+/// Released the Shard's Lock, Caller must not hold a Shard's Lock.
+/// </summary>
+void DBEngine::evict() {
+	if (!_eviction.enabled() || !_ready)
+		return;
+	_eviction.tick();
+	size_t limit = _eviction.options().memoryLimit;
+	size_t window = _eviction.windowLimit();
+	size_t empty = 0;
+	while (_residentBytes.load(std::memory_order_relaxed) > limit && empty < _shards.size()) {
+		Shard * shard = _shards[_evictCursor.fetch_add(1, std::memory_order_relaxed) % _shards.size()];
+		std::unique_lock<std::shared_mutex> lock(shard->lock);
+		Sample sample;
+		if (!sampleVictim(shard, sample)) {
+			empty++;
+			continue;
+		}
+		empty = 0;
+		bool full = _windowBytes.load(std::memory_order_relaxed) > window;
+		std::string * doomed = &sample.victim;
+		if (sample.hasCandidate && (full || !sample.hasVictim)) {
+			if (sample.hasVictim ? _eviction.admit(sample.candidate, sample.victim) : full) {
+				sample.admitted->setAccess(sample.admitted->getAccess() & ~Eviction::WINDOW);
+				_windowBytes.fetch_sub(footprint(sample.candidate, sample.admitted), std::memory_order_relaxed);
+				if (!sample.hasVictim)
+					continue;
+			}
+			else
+				doomed = &sample.candidate;
+		}
+		uint64_t lsn = 0;
+		DBElement * retired = nullptr;
+		eraseElement(shard, *doomed, lsn, retired);
+		lock.unlock();
+		if (retired != nullptr)
+			retireElement(retired);
+		_eviction.evicted();
+	}
+}
+
+/// <summary>
+/// Function run by the Flush Thread. Captures the Memtables and Tombstones of every
+/// Shard at once under their Writer Locks and Rotates the Write Ahead Log, then
+/// Writes them to the LSM Tier without Blocking Writers. Once the SSTables are
+/// Durable, the DBElements and Tombstones which were not Replaced meanwhile are
+/// Removed from the Shards and the Rotated Log is Discarded. DBElements which have
+/// a Deadline stay in the DB Tables since SSTables do not keep it, their Deadlines
+/// are Logged again into the new Log. The Thread stays Pinned so Captured
+/// DBElements Replaced meanwhile stay valid.
+/// </summary>
+void DBEngine::flushMemtable() {
+	EpochGuard guard;
+	std::vector<std::vector<LSMTree::FlushEntry>> memtables(_shards.size());
+	std::vector<std::vector<std::pair<std::string, uint64_t>>> removed(_shards.size());
+	std::vector<std::string> names;
+	uint64_t lsn = 0;
+	{
+		std::vector<std::unique_lock<std::shared_mutex>> locks;
+		for (Shard * shard : _shards)
+			locks.emplace_back(shard->lock);
+		for (Shard * shard : _shards) {
+			std::vector<LSMTree::FlushEntry>& memtable = memtables[shard->number];
+			memtable.reserve(shard->table.size() + shard->tombstones.size());
+			shard->table.forEach([shard, &memtable](const std::string& key, DBElement * value) {
+				uint32_t document = 0;
+				shard->table.find(key, document);
+				memtable.push_back({ key, document, value });
+			});
+			for (const auto& tombstone : shard->tombstones) {
+				memtable.push_back({ tombstone.first, 0, nullptr });
+				removed[shard->number].push_back(tombstone);
+			}
+		}
+		for (uint32_t id = 0; id < (uint32_t)_dictionary.size(); id++)
+			names.push_back(_dictionary.name(id));
+		if (_wal.rotate())
+			lsn = relogExpiry();
+		_memtableBytes = 0;
+	}
+	_wal.commit(lsn);
+	/* flush() sorts the Memtables, so the Entries to Remove are Collected first */
+	std::vector<std::vector<std::pair<std::string, DBElement*>>> flushed(_shards.size());
+	for (size_t number = 0; number < memtables.size(); number++) {
+		for (const LSMTree::FlushEntry& entry : memtables[number]) {
+			if (entry.element != nullptr && entry.element->getExpiry() == 0)
+				flushed[number].emplace_back(entry.key, const_cast<DBElement*>(entry.element));
+		}
+	}
+	if (_lsm.flush(memtables, names)) {
+		memtables.clear();
+		for (Shard * shard : _shards) {
+			std::vector<DBElement*> retired;
+			std::unique_lock<std::shared_mutex> lock(shard->lock);
+			/* Versions a Pinned Reader may still need stay in the Memtable, the SSTable only has the newest */
+			uint64_t oldest = oldestRead();
+			for (const auto& entry : flushed[shard->number]) {
+				if (entry.second->getOlder() != nullptr || entry.second->getVersion() > oldest)
+					continue;
+				if (shard->table.find(entry.first) == entry.second && shard->table.erase(entry.first) != nullptr) {
+					account(entry.first, nullptr, entry.second);
+					retired.push_back(entry.second);
+				}
+			}
+			for (const auto& tombstone : removed[shard->number]) {
+				auto current = shard->tombstones.find(tombstone.first);
+				if (current != shard->tombstones.end() && current->second == tombstone.second)
+					shard->tombstones.erase(current);
+			}
+			lock.unlock();
+			for (DBElement * value : retired)
+				retireElement(value);
+		}
+		_wal.dropRotated();
+	}
+	std::lock_guard<std::mutex> lock(_flushLock);
+	_flushing = false;
+	_flushDone.notify_all();
+}
+
+/// <summary>
+/// Function to Append a DBElement and it's Key in nicely Formatted Manner to a String.
+/// </summary>
+/// <param name="aggregator">String to which the Key and DBElement are Appended</param>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement associated with the Key</param>
+void DBEngine::formatElement(std::string& aggregator, std::string_view key, const DBElement * value) {
+	aggregator.append(" Key : ").append(key).append("\n");
+	aggregator.append(" -----\n");
+	value->show(aggregator);
+}
+
+/// <summary>
+/// Function to Get Object Associated with given Key from Database in nicely Formatted Manner.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>If Key Exists then returns Object Associated with given Key from Database in nicely Formatted Manner, Else return Invalid</returns>
+std::string DBEngine::getData(std::string_view key) {
+	EpochGuard guard;
+	DBElement * value = lookup(shardFor(key), key);
+	if (value == nullptr)
+		return "Invalid Key";
+	std::string aggregator;
+	formatElement(aggregator, key, value);
+	return aggregator;
+}
+
+/// <summary>
+/// Function to Get Object Associated with given Key from Database in Raw Format (as DBEngine).
+/// Copies the DBElement, use getView to Read it without Copying.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>If given Key Exists in the Database then Return the DBElement associated with it, Else return DBElement with Invalid Key as Data</returns>
+DBElement DBEngine::getDataRaw(std::string_view key) {
+	EpochGuard guard;
+	DBElement * value = lookup(shardFor(key), key);
+	if (value == nullptr)
+		return DBElement("> invalid key");
+	DBElement copy(*value);
+	copy.decompress();
+	return copy;
+}
+
+/// <summary>
+/// Function to Get a Read Only View of the Object Associated with given Key without
+/// Copying it. The View keeps the DBElement alive even if the Key is Updated or
+/// Removed meanwhile, and must be Destroyed on the Calling Thread.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>ElementView of the DBElement associated with the Key, empty ElementView if the Key does not Exist</returns>
+ElementView DBEngine::getView(std::string_view key) {
+	EpochGuard guard;
+	Shard * shard = shardFor(key);
+	return ElementView(lookup(shard, key));
+}
+
+/// <summary>
+/// Function to Get Read Only Views of the Objects Associated with many Keys without
+/// Copying them, Looking the Keys up together so their Cache Misses overlap. Every
+/// Key is Read as by getView, the Views are not of one point in time, use show for
+/// that. The Views must be Destroyed on the Calling Thread.
+/// </summary>
+/// <param name="keys">Keys</param>
+/// <returns>ElementView of the DBElement of each Key in the order of the Keys, empty ElementView if the Key does not Exist</returns>
+std::vector<ElementView> DBEngine::getViews(const std::vector<std::string>& keys) {
+	EpochGuard guard;
+	std::vector<DBElement*> values(keys.size());
+	lookup(keys.data(), keys.size(), values.data());
+	std::vector<ElementView> views;
+	views.reserve(keys.size());
+	for (DBElement * value : values)
+		views.emplace_back(value);
+	return views;
+}
+
+/// <summary>
+/// Function to Get Objects Associated with many Keys from Database in nicely
+/// Formatted Manner, Looking the Keys up together so their Cache Misses overlap.
+/// Every Key is Read as by getData.
+/// </summary>
+/// <param name="keys">Keys</param>
+/// <returns>Object of each Key in the order of the Keys in nicely Formatted Manner, Invalid Key for Keys which do not Exist</returns>
+std::string DBEngine::getData(const std::vector<std::string>& keys) {
+	EpochGuard guard;
+	std::vector<DBElement*> values(keys.size());
+	lookup(keys.data(), keys.size(), values.data());
+	std::string aggregator;
+	for (size_t index = 0; index < keys.size(); index++) {
+		if (values[index] == nullptr)
+			aggregator.append(" Key : ").append(keys[index]).append("\n -----\n Invalid Key\n");
+		else
+			formatElement(aggregator, keys[index], values[index]);
+		aggregator.push_back('\n');
+	}
+	return aggregator;
+}
+
+/// <summary>
+/// Function to Update Data of the DBElement Associated with given Key in the Database.
+/// The new Data is Compressed under the Shard's Writer Lock, since the rest of the
+/// DBElement is only known there.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="data">New Value of Data</param>
+/// <returns></returns>
+bool DBEngine::updateData(std::string_view key, std::string_view data)
+{
+	Shard * shard = shardFor(key);
+	expireKey(shard, key);
+	std::unique_lock<std::shared_mutex> lock(shard->lock);
+	faultElement(shard, key);
+	DBElement * replaced = nullptr;
+	uint64_t lsn = 0;
+	size_t bytes = 0;
+	bool found = updateDataElement(shard, key, data, lsn, bytes, replaced);
+	lock.unlock();
+	if (replaced != nullptr)
+		retireElement(replaced);
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn) && found;
+}
+
+/// <summary>
+/// Function to Replace the Data of the DBElement of a Key, keeping it's Tags, and
+/// Log it. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="key">Key</param>
+/// <param name="data">New Data</param>
+/// <param name="lsn">Set to the LSN of the Record Logged</param>
+/// <param name="bytes">Increased by the Footprint of the Key and new DBElement</param>
+/// <param name="replaced">Set to the DBElement to Retire, NULL if there is none or Readers keep it</param>
+/// <returns>True if the Key Exists</returns>
+bool DBEngine::updateDataElement(Shard * shard, std::string_view key, std::string_view data, uint64_t& lsn, size_t& bytes, DBElement *& replaced) {
+	replaced = nullptr;
+	return shard->table.modify(key, [&](DBElement * current, uint32_t document) {
+		DBElement * object = createElement(shard, *current);
+		object->setData(data);
+		compressElement(*object);
+		stampDocument(shard, document, object->getlastModified());
+		lsn = _wal.append(WriteAheadLog::UPDATE_DATA, key, data, object->getlastModified());
+		bytes += footprint(key, object);
+		account(key, object, current);
+		replaced = supersede(shard, document, key, object, current);
+		return object;
+	});
+}
+
+/// <summary>
+/// Function to Apply the Writes of a WriteBatch in order, all of them or none. The
+/// Writer Locks of every Shard the Batch touches are taken once, in Shard order so
+/// concurrent Batches can not Deadlock, and the Batch is Checked against the Keys
+/// before anything is changed : an Insert needs a Key which does not Exist, every
+/// other Write but a put one which does, counting the Writes before it. A put is
+/// Applied as an Insert or an Update depending on the Key. The Slots of the Keys
+/// are Prefetched before the Locks are taken, so the Checks, which run under the
+/// Locks, rarely wait for memory. All Writes are Logged
+/// as one BATCH Record and Stamped with one Sequence Number, so Readers which Pin a
+/// Sequence Number see all of them or none. Point Reads may see part of the Batch
+/// while it is Applied.
+/// </summary>
+/// <param name="batch">Writes to Apply, the Batch is Cleared</param>
+/// <returns>True if every Write was Applied and is Durable, False if none was Applied or the Log failed</returns>
+bool DBEngine::write(WriteBatch& batch) {
+	std::vector<WriteBatch::Write>& writes = batch.writes();
+	if (writes.empty())
+		return true;
+	/* Scratch Space kept per Thread, so small Batches do not Allocate it every time */
+	thread_local std::vector<Shard*> targets, shards;
+	thread_local std::vector<uint32_t> ids;
+	thread_local std::vector<size_t> hashes;
+	thread_local std::vector<DBElement*> retired;
+	thread_local std::vector<std::unique_lock<std::shared_mutex>> locks;
+	thread_local std::unordered_map<std::string_view, bool> exists;
+	targets.clear();
+	hashes.clear();
+	ids.assign(writes.size(), (uint32_t)TagDictionary::INVALID);
+	for (size_t index = 0; index < writes.size(); index++) {
+		WriteBatch::Write& write = writes[index];
+		if (write.operation == WriteAheadLog::INSERT || write.operation == WriteAheadLog::UPDATE)
+			compressElement(*write.element);
+		else if (write.operation == WriteAheadLog::ADD_TAG)
+			ids[index] = _dictionary.intern(write.value);
+		else if (write.operation == WriteAheadLog::REMOVE_TAG)
+			_dictionary.find(write.value, ids[index]);
+		Shard * shard = shardFor(write.key);
+		expireKey(shard, write.key);
+		targets.push_back(shard);
+		hashes.push_back(shard->table.prefetch(write.key));
+	}
+	for (size_t index = 0; index < writes.size(); index++)
+		targets[index]->table.prefetchSlot(hashes[index]);
+	shards.assign(targets.begin(), targets.end());
+	std::sort(shards.begin(), shards.end(), [](Shard * left, Shard * right) { return left->number < right->number; });
+	shards.erase(std::unique(shards.begin(), shards.end()), shards.end());
+	for (Shard * shard : shards)
+		locks.emplace_back(shard->lock);
+	/* Whether each Key Exists after the Writes Checked so far */
+	exists.clear();
+	for (size_t index = 0; index < writes.size(); index++) {
+		WriteBatch::Write& write = writes[index];
+		auto state = exists.find(write.key);
+		if (state == exists.end()) {
+			faultElement(targets[index], write.key);
+			state = exists.emplace(write.key, targets[index]->table.find(write.key, hashes[index]) != nullptr).first;
+		}
+		if (write.put)
+			write.operation = state->second ? WriteAheadLog::UPDATE : WriteAheadLog::INSERT;
+		else if (state->second == (write.operation == WriteAheadLog::INSERT)) {
+			locks.clear();
+			batch.clear();
+			return false;
+		}
+		state->second = write.operation != WriteAheadLog::REMOVE;
+	}
+	retired.clear();
+	size_t bytes = 0;
+	uint64_t lsn = 0;
+	bool expiring = false;
+	batchVersion = nextVersion();
+	_wal.beginBatch();
+	for (size_t index = 0; index < writes.size(); index++) {
+		WriteBatch::Write& write = writes[index];
+		Shard * shard = targets[index];
+		DBElement * replaced = nullptr;
+		switch (write.operation) {
+		case WriteAheadLog::INSERT:
+		case WriteAheadLog::UPDATE: {
+			DBElement * object = createElement(shard, std::move(*write.element));
+			storeElement(shard, write.operation, write.key, object, lsn, bytes);
+			expiring = expiring || object->getExpiry() != 0;
+			break;
+		}
+		case WriteAheadLog::REMOVE:
+			eraseElement(shard, write.key, lsn, replaced);
+			bytes += footprint(write.key, nullptr);
+			break;
+		case WriteAheadLog::ADD_TAG:
+		case WriteAheadLog::REMOVE_TAG:
+			tagElement(shard, write.key, write.value, ids[index], write.operation == WriteAheadLog::ADD_TAG, lsn, bytes, replaced);
+			break;
+		case WriteAheadLog::EXPIRE:
+			expireElement(shard, write.key, write.deadline, lsn, bytes, replaced);
+			expiring = expiring || write.deadline != 0;
+			break;
+		default:
+			updateDataElement(shard, write.key, write.value, lsn, bytes, replaced);
+			break;
+		}
+		if (replaced != nullptr)
+			retired.push_back(replaced);
+	}
+	lsn = _wal.endBatch();
+	batchVersion = 0;
+	locks.clear();
+	batch.clear();
+	for (DBElement * value : retired)
+		retireElement(value);
+	if (expiring)
+		startExpiry();
+	memtableWrite(bytes);
+	evict();
+	return _wal.commit(lsn);
+}
+
+/// <summary>
+/// Function to Show Entire Database as of one Sequence Number, Writers go on while
+/// it runs. The Live Keys of every Shard and the Versioned and Removed Keys are
+/// gathered once, so no Key is Shown twice, and each is Looked up as of the
+/// Sequence Number. Without an LSM Tier the Attached Snapshot is Loaded first, so
+/// the Lookups do not Load it a Key at a time.
+/// </summary>
+/// <returns>Entire Database in Nicely Formatted Manner</returns>
+std::string DBEngine::show() {
+	if (!_lsm.isOpen()) {
+		for (Shard * shard : _shards) {
+			if (shard->baseDocs != 0) {
+				std::unique_lock<std::shared_mutex> lock(shard->lock);
+				faultShard(shard);
+			}
+		}
+	}
+	uint64_t sequence = beginRead();
+	std::unordered_set<std::string> keys;
+	for (Shard * shard : _shards) {
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		keys.reserve(keys.size() + shard->liveDocs.cardinality());
+		shard->liveDocs.forEach([this, shard, &keys](uint32_t document) { keys.emplace(documentKey(shard, document)); });
+	}
+	versionedKeys(keys);
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	return shown;
+}
+
+/// <summary>
+/// Function to Show all the Objects associated with Keys in the Arguments which 
+/// are Present in the Datbaase, all of them as of one Sequence Number.
+/// </summary>
+/// <param name="keys">List of Keys who's associated Objects are to be retrieved</param>
+/// <returns>Objects associated with Keys in the Arguments which are Present in the Datbaase, in Nicely Formatter Manner</returns>
+std::string DBEngine::show(const std::unordered_set<std::string>& keys) {
+	uint64_t sequence = beginRead();
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	return shown;
+}
+
+/// <summary>
+/// Function to Retrieve All the Keys of DBElements who have a Tag which is Exactly same 
+/// as Argument. Walks the Posting List of the Tag in every Shard and resolves the
+/// Document IDs to Keys.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <returns>All the Keys of DBElements who have a Tag which is Exactly same as Argument</returns>
+std::unordered_set<std::string> DBEngine::getKeysWithTag(std::string_view tag) {
+	std::unordered_set<std::string> keys;
+	uint32_t id;
+	if (!_dictionary.find(tag, id))
+		return keys;
+	for (Shard * shard : _shards) {
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		auto index = shard->tagMap.find(id);
+		if (index == shard->tagMap.end())
+			continue;
+		keys.reserve(keys.size() + index->second.cardinality());
+		index->second.forEach([this, shard, &keys](uint32_t document) { keys.emplace(documentKey(shard, document)); });
+	}
+	return keys;
+}
+
+
+/// <summary>
+/// Function to Show all DBElements who have a Tag which is Exactly same 
+/// as Argument, as of one Sequence Number. Keys Written or Removed since are
+/// Checked too, their Version at the Sequence Number may have had the Tag.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <returns>All DBElements who have a Tag which is Exactly same as Argument, in a Nicely Formatted Manner. Returns N/A if no such Tag Exists in Database</returns>
+std::string DBEngine::showUsingTag(std::string_view tag) {
+	uint32_t id;
+	if (!_dictionary.find(tag, id))
+		return "N/A";
+	uint64_t sequence = beginRead();
+	std::unordered_set<std::string> keys = getKeysWithTag(tag);
+	versionedKeys(keys);
+	std::string shown = showAt(keys, sequence, [id](const DBElement * value) { return value->tagIdExist(id); });
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Retrieve All the Keys of DBElements which match a Boolean Tag Expression
+/// such as "Machine & AI & !Westworld". The Expression is evaluated on the PostingLists
+/// of every Shard and only the matching Document IDs are resolved to Keys.
+/// </summary>
+/// <param name="expression">Tag Expression using & (AND), | (OR), ! (NOT) and parentheses</param>
+/// <returns>All the Keys of DBElements matching the Expression, empty if the Expression is Invalid</returns>
+std::unordered_set<std::string> DBEngine::getKeysWithTags(std::string_view expression) {
+	std::unordered_set<std::string> keys;
+	TagExpression parsed;
+	if (!parsed.parse(std::string(expression)))
+		return keys;
+	parsed.resolve(_dictionary);
+	for (Shard * shard : _shards) {
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		PostingList documents = parsed.evaluate(shard->tagMap, shard->liveDocs);
+		keys.reserve(keys.size() + documents.cardinality());
+		documents.forEach([this, shard, &keys](uint32_t document) { keys.emplace(documentKey(shard, document)); });
+	}
+	return keys;
+}
+
+/// <summary>
+/// Function to Show all DBElements which match a Boolean Tag Expression.
+/// </summary>
+/// <param name="expression">Tag Expression using & (AND), | (OR), ! (NOT) and parentheses</param>
+/// <returns>All DBElements matching the Expression, in a Nicely Formatted Manner. Returns N/A if no DBElement matches</returns>
+std::string DBEngine::showUsingTags(std::string_view expression) {
+	TagExpression parsed;
+	if (!parsed.parse(std::string(expression)))
+		return "Invalid Tag Expression.";
+	parsed.resolve(_dictionary);
+	uint64_t sequence = beginRead();
+	std::unordered_set<std::string> keys = getKeysWithTags(expression);
+	versionedKeys(keys);
+	std::string shown = showAt(keys, sequence, [&parsed](const DBElement * value) { return parsed.matches(value->tagIds(), value->getTagCount()); });
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Retrieve the Keys of DBElements which have any of the given Tags. In
+/// every Shard the PostingLists of the Tags are United pairwise, so each Round
+/// halves their Number, and only the United Document IDs are resolved to Keys.
+/// </summary>
+/// <param name="ids">Tag IDs</param>
+/// <returns>Keys of DBElements having any of the Tags</returns>
+std::unordered_set<std::string> DBEngine::getKeysWithTagIds(const std::vector<uint32_t>& ids) {
+	std::unordered_set<std::string> keys;
+	if (ids.empty())
+		return keys;
+	for (Shard * shard : _shards) {
+		std::shared_lock<std::shared_mutex> lock(shard->lock);
+		std::vector<const PostingList*> postings;
+		for (uint32_t id : ids) {
+			auto index = shard->tagMap.find(id);
+			if (index != shard->tagMap.end() && !index->second.empty())
+				postings.push_back(&index->second);
+		}
+		auto resolve = [this, shard, &keys](const PostingList& documents) {
+			keys.reserve(keys.size() + documents.cardinality());
+			documents.forEach([this, shard, &keys](uint32_t document) { keys.emplace(documentKey(shard, document)); });
+		};
+		if (postings.size() <= 1) {
+			if (!postings.empty())
+				resolve(*postings.front());
+			continue;
+		}
+		std::vector<PostingList> united;
+		for (size_t index = 0; index + 1 < postings.size(); index += 2)
+			united.push_back(PostingList::unite(*postings[index], *postings[index + 1]));
+		if (postings.size() % 2 != 0)
+			united.push_back(*postings.back());
+		while (united.size() > 1) {
+			size_t kept = 0;
+			for (size_t index = 0; index + 1 < united.size(); index += 2)
+				united[kept++] = PostingList::unite(united[index], united[index + 1]);
+			if (united.size() % 2 != 0)
+				united[kept++] = std::move(united.back());
+			united.resize(kept);
+		}
+		resolve(united.front());
+	}
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve All the Keys of DBElements which have a Tag starting with a
+/// Prefix, such as "region/us/" for "region/us/east" and "region/us/west".
+/// </summary>
+/// <param name="prefix">Prefix of the Tags</param>
+/// <returns>All the Keys of DBElements with a Tag starting with the Prefix</returns>
+std::unordered_set<std::string> DBEngine::getKeysWithTagPrefix(std::string_view prefix) {
+	return getKeysWithTagIds(_dictionary.matchPrefix(prefix));
+}
+
+/// <summary>
+/// Function to Retrieve All the Keys of DBElements which have a Tag matching a Glob
+/// Pattern. ? matches a character and * a run of characters within a '/' Separated
+/// Segment, ** matches across Segments.
+/// </summary>
+/// <param name="pattern">Glob Pattern of the Tags</param>
+/// <returns>All the Keys of DBElements with a Tag matching the Pattern</returns>
+std::unordered_set<std::string> DBEngine::getKeysWithTagGlob(std::string_view pattern) {
+	return getKeysWithTagIds(_dictionary.matchGlob(pattern));
+}
+
+/// <summary>
+/// Function to Show all DBElements which have a Tag starting with a Prefix.
+/// </summary>
+/// <param name="prefix">Prefix of the Tags</param>
+/// <returns>All DBElements with a Tag starting with the Prefix, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showUsingTagPrefix(std::string_view prefix) {
+	return showUsingTagIds(_dictionary.matchPrefix(prefix));
+}
+
+/// <summary>
+/// Function to Show all DBElements which have a Tag matching a Glob Pattern.
+/// </summary>
+/// <param name="pattern">Glob Pattern of the Tags</param>
+/// <returns>All DBElements with a Tag matching the Pattern, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showUsingTagGlob(std::string_view pattern) {
+	return showUsingTagIds(_dictionary.matchGlob(pattern));
+}
+
+/// <summary>
+/// Function to Show all DBElements which have any of the given Tag IDs, as of one
+/// Sequence Number. Keys Written or Removed since are Checked too.
+/// </summary>
+/// <param name="ids">Tag IDs</param>
+/// <returns>All DBElements with any of the Tag IDs, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showUsingTagIds(std::vector<uint32_t> ids) {
+	if (ids.empty())
+		return "N/A";
+	std::sort(ids.begin(), ids.end());
+	uint64_t sequence = beginRead();
+	std::unordered_set<std::string> keys = getKeysWithTagIds(ids);
+	versionedKeys(keys);
+	std::string shown = showAt(keys, sequence, [&ids](const DBElement * value) {
+		const uint32_t * tagIds = value->tagIds();
+		return std::any_of(tagIds, tagIds + value->getTagCount(), [&ids](uint32_t id) { return std::binary_search(ids.begin(), ids.end(), id); });
+	});
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Merge the Parts of a Result gathered from every Shard, each of them
+/// sorted already. A Heap of the Parts by their next Item picks every Item in
+/// O(log Parts).
+/// </summary>
+/// <param name="parts">Sorted Parts, their Items are Moved out</param>
+/// <param name="before">Returns True if the first Item goes before the second</param>
+/// <param name="limit">Largest Number of Items to Merge</param>
+/// <returns>Merged Items</returns>
+template <typename Item, typename Before>
+static std::vector<Item> mergeParts(std::vector<std::vector<Item>>& parts, Before before, size_t limit) {
+	size_t total = 0;
+	for (const std::vector<Item>& part : parts)
+		total += part.size();
+	std::vector<Item> items;
+	items.reserve(std::min(total, limit));
+	/* A Part leaves the Heap before it's next Item changes */
+	std::vector<size_t> positions(parts.size(), 0);
+	auto later = [&parts, &positions, &before](size_t left, size_t right) { return before(parts[right][positions[right]], parts[left][positions[left]]); };
+	std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heads(later);
+	for (size_t index = 0; index < parts.size(); index++) {
+		if (!parts[index].empty())
+			heads.push(index);
+	}
+	while (!heads.empty() && items.size() < limit) {
+		size_t index = heads.top();
+		heads.pop();
+		items.push_back(std::move(parts[index][positions[index]]));
+		if (++positions[index] < parts[index].size())
+			heads.push(index);
+	}
+	return items;
+}
+
+/// <summary>
+/// Function to Lock a Shard Shared for Reading it's KeyIndex or Time Index. If the
+/// Keys or Timestamps of the Attached Snapshot are not Indexed yet, the Shard is
+/// Locked for Writing to Index them first.
+/// </summary>
+/// <param name="shard">Shard</param>
+/// <param name="keys">The KeyIndex will be Read</param>
+/// <param name="times">The Time Index will be Read</param>
+/// <returns>Shared Lock of the Shard</returns>
+std::shared_lock<std::shared_mutex> DBEngine::lockIndexes(Shard * shard, bool keys, bool times) {
+	std::shared_lock<std::shared_mutex> lock(shard->lock);
+	if ((keys && !shard->baseIndexed) || (times && !shard->baseTimed)) {
+		lock.unlock();
+		{
+			std::unique_lock<std::shared_mutex> writer(shard->lock);
+			if (keys)
+				indexBase(shard);
+			if (times)
+				timeBase(shard);
+		}
+		lock.lock();
+	}
+	return lock;
+}
+
+/// <summary>
+/// Function to Encode a Timestamp and a Document ID as a Key of the Time Index. Both
+/// are Big Endian, so Keys sort by Timestamp and then by Document ID.
+/// </summary>
+/// <param name="timestamp">Last Modified Timestamp</param>
+/// <param name="document">Document ID</param>
+/// <returns>12 Byte Key</returns>
+std::string DBEngine::timeKey(long long int timestamp, uint32_t document) {
+	std::string key(12, '\0');
+	uint64_t time = (uint64_t)timestamp;
+	for (int index = 0; index < 8; index++)
+		key[index] = (char)(time >> (56 - 8 * index));
+	for (int index = 0; index < 4; index++)
+		key[8 + index] = (char)(document >> (24 - 8 * index));
+	return key;
+}
+
+/// <summary>
+/// Function to Move a Document ID to a new Last Modified Timestamp in the Time Index.
+/// Called by every Writer which Publishes a new Version of a DBElement. Caller must
+/// hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard which holds the Key</param>
+/// <param name="document">Live Document ID</param>
+/// <param name="timestamp">Last Modified Timestamp of the new Version</param>
+void DBEngine::stampDocument(Shard * shard, uint32_t document, long long int timestamp) {
+	if (shard->docTimes.size() <= document)
+		shard->docTimes.resize(document + 1, 0);
+	long long int& stamped = shard->docTimes[document];
+	if (stamped == timestamp)
+		return;
+	if (stamped != 0)
+		shard->times.erase(timeKey(stamped, document));
+	stamped = timestamp;
+	shard->times.insert(timeKey(timestamp, document), document);
+}
+
+/// <summary>
+/// Function to add the Live Keys of the Attached Snapshot to a Shard's Time Index,
+/// unless that was done already. Keys Modified since the Snapshot was Attached are
+/// in the Time Index already and keep their Timestamp. Caller must hold the Shard's
+/// Writer Lock.
+/// </summary>
+/// <param name="shard">Shard to Index</param>
+void DBEngine::timeBase(Shard * shard) {
+	if (shard->baseTimed)
+		return;
+	Snapshot::Record record;
+	shard->liveDocs.forEach([this, shard, &record](uint32_t document) {
+		if (document < shard->baseDocs && (document >= shard->docTimes.size() || shard->docTimes[document] == 0) &&
+			_snapshot.record(shard->number, document, record))
+			stampDocument(shard, document, record.timestamp);
+	});
+	shard->baseTimed = true;
+}
+
+/// <summary>
+/// Function to get the Keys of every Shard Modified between two Timestamps as a
+/// Reader Pinned to a Sequence Number sees them. Every Shard Seeks to the first
+/// Timestamp in it's Time Index and walks it until the second, and the Keys of the
+/// Shards are Merged by Timestamp. The Time Index only holds the newest Version, so
+/// the Versioned and Removed Keys are added and every Key is Ranked by the
+/// Timestamp of the Version the Reader sees.
+/// </summary>
+/// <param name="from">First Timestamp</param>
+/// <param name="to">Last Timestamp</param>
+/// <param name="sequence">Pinned Sequence Number</param>
+/// <returns>Keys Modified between the Timestamps, oldest first</returns>
+std::vector<std::string> DBEngine::scanTimes(long long int from, long long int to, uint64_t sequence) {
+	std::vector<std::vector<std::pair<long long int, std::string>>> parts(_shards.size());
+	for (size_t index = 0; index < _shards.size(); index++) {
+		Shard * shard = _shards[index];
+		std::vector<std::pair<long long int, std::string>>& part = parts[index];
+		std::shared_lock<std::shared_mutex> lock = lockIndexes(shard, false, true);
+		shard->times.scan(timeKey(from, 0), [this, shard, to, &part](const std::string&, uint32_t document) {
+			long long int timestamp = shard->docTimes[document];
+			if (timestamp > to)
+				return false;
+			part.emplace_back(timestamp, documentKey(shard, document));
+			return true;
+		});
+	}
+	std::vector<std::pair<long long int, std::string>> merged = mergeParts(parts, [](const std::pair<long long int, std::string>& left,
+		const std::pair<long long int, std::string>& right) { return left.first < right.first; }, SIZE_MAX);
+	std::unordered_set<std::string> versioned;
+	versionedKeys(versioned);
+	for (const std::pair<long long int, std::string>& entry : merged)
+		versioned.erase(entry.second);
+	for (const std::string& key : versioned)
+		merged.emplace_back(0, key);
+	size_t kept = 0;
+	{
+		EpochGuard guard;
+		for (size_t index = 0; index < merged.size(); index++) {
+			DBElement * value = lookupAt(shardFor(merged[index].second), merged[index].second, sequence);
+			if (value == nullptr || value->getlastModified() < from || value->getlastModified() > to)
+				continue;
+			merged[index].first = value->getlastModified();
+			if (kept != index)
+				merged[kept] = std::move(merged[index]);
+			kept++;
+		}
+	}
+	merged.resize(kept);
+	std::stable_sort(merged.begin(), merged.end(), [](const std::pair<long long int, std::string>& left,
+		const std::pair<long long int, std::string>& right) { return left.first < right.first; });
+	std::vector<std::string> keys;
+	keys.reserve(merged.size());
+	for (std::pair<long long int, std::string>& entry : merged)
+		keys.push_back(std::move(entry.second));
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve the Keys of DBElements Modified at or after a Timestamp, so an
+/// Incremental Sync only fetches what changed since it last ran. The Keys are those
+/// of one Sequence Number.
+/// </summary>
+/// <param name="since">Timestamp in YYYYmmDDHHMMSS Format</param>
+/// <returns>Keys Modified since the Timestamp, oldest first</returns>
+std::vector<std::string> DBEngine::getKeysModifiedSince(long long int since) {
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = scanTimes(since, LLONG_MAX, sequence);
+	endRead(sequence);
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve the Keys of DBElements Modified between two Timestamps, both
+/// included. The Keys are those of one Sequence Number.
+/// </summary>
+/// <param name="from">First Timestamp in YYYYmmDDHHMMSS Format</param>
+/// <param name="to">Last Timestamp in YYYYmmDDHHMMSS Format</param>
+/// <returns>Keys Modified between the Timestamps, oldest first</returns>
+std::vector<std::string> DBEngine::getKeysModifiedBetween(long long int from, long long int to) {
+	if (to < from)
+		return std::vector<std::string>();
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = scanTimes(from, to, sequence);
+	endRead(sequence);
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve the Keys of the most recently Modified DBElements, optionally
+/// only those with a Tag. Every Shard walks it's Time Index backward from the newest
+/// Timestamp, Checking the Tag's PostingList, until it has count Keys. When the Tag
+/// is rare that walk would visit about count * Keys / Tagged Keys Entries, so if
+/// that is more than the Tagged Keys their Timestamps are Ranked instead. The newest
+/// count Keys of the Shards are Merged.
+/// </summary>
+/// <param name="count">Number of Keys</param>
+/// <param name="tag">Tag the DBElements must have, empty for any DBElement</param>
+/// <returns>Keys of the count most recently Modified DBElements, newest first</returns>
+std::vector<std::string> DBEngine::getKeysRecentlyModified(size_t count, std::string_view tag) {
+	std::vector<std::string> keys;
+	uint32_t id = TagDictionary::INVALID;
+	if (count == 0 || (!tag.empty() && !_dictionary.find(tag, id)))
+		return keys;
+	typedef std::pair<long long int, std::string> Entry;
+	std::vector<std::vector<Entry>> parts(_shards.size());
+	std::string newest = timeKey(LLONG_MAX, UINT32_MAX);
+	for (size_t index = 0; index < _shards.size(); index++) {
+		Shard * shard = _shards[index];
+		std::vector<Entry>& part = parts[index];
+		std::shared_lock<std::shared_mutex> lock = lockIndexes(shard, false, true);
+		const PostingList * tagged = nullptr;
+		if (!tag.empty()) {
+			auto found = shard->tagMap.find(id);
+			if (found == shard->tagMap.end())
+				continue;
+			tagged = &found->second;
+		}
+		size_t taggedCount = tagged == nullptr ? 0 : tagged->cardinality();
+		if (tagged != nullptr && (double)count * shard->times.size() > (double)taggedCount * taggedCount) {
+			std::vector<std::pair<long long int, uint32_t>> ranked;
+			ranked.reserve(taggedCount);
+			tagged->forEach([shard, &ranked](uint32_t document) {
+				ranked.emplace_back(document < shard->docTimes.size() ? shard->docTimes[document] : 0, document);
+			});
+			size_t kept = std::min(count, ranked.size());
+			std::partial_sort(ranked.begin(), ranked.begin() + kept, ranked.end(), std::greater<std::pair<long long int, uint32_t>>());
+			for (size_t rank = 0; rank < kept; rank++)
+				part.emplace_back(ranked[rank].first, documentKey(shard, ranked[rank].second));
+			continue;
+		}
+		shard->times.scanReverse(newest, [this, shard, count, tagged, &part](const std::string&, uint32_t document) {
+			if (tagged == nullptr || tagged->contains(document))
+				part.emplace_back(shard->docTimes[document], documentKey(shard, document));
+			return part.size() < count;
+		});
+	}
+	std::vector<Entry> merged = mergeParts(parts, [](const Entry& left, const Entry& right) { return left.first > right.first; }, count);
+	keys.reserve(merged.size());
+	for (Entry& entry : merged)
+		keys.push_back(std::move(entry.second));
+	return keys;
+}
+
+/// <summary>
+/// Function to Show all DBElements Modified at or after a Timestamp, as of one Sequence Number.
+/// </summary>
+/// <param name="since">Timestamp in YYYYmmDDHHMMSS Format</param>
+/// <returns>DBElements Modified since the Timestamp, oldest first, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showModifiedSince(long long int since) {
+	uint64_t sequence = beginRead();
+	std::string shown = showAt(scanTimes(since, LLONG_MAX, sequence), sequence, nullptr);
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Show all DBElements Modified between two Timestamps, both included, as
+/// of one Sequence Number.
+/// </summary>
+/// <param name="from">First Timestamp in YYYYmmDDHHMMSS Format</param>
+/// <param name="to">Last Timestamp in YYYYmmDDHHMMSS Format</param>
+/// <returns>DBElements Modified between the Timestamps, oldest first, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showModifiedBetween(long long int from, long long int to) {
+	if (to < from)
+		return "N/A";
+	uint64_t sequence = beginRead();
+	std::string shown = showAt(scanTimes(from, to, sequence), sequence, nullptr);
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Show the most recently Modified DBElements, optionally only those with a Tag.
+/// </summary>
+/// <param name="count">Number of DBElements</param>
+/// <param name="tag">Tag the DBElements must have, empty for any DBElement</param>
+/// <returns>The count most recently Modified DBElements, newest first, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showRecentlyModified(size_t count, std::string_view tag) {
+	std::string shown = show(getKeysRecentlyModified(count, tag));
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to add the Live Keys of the Attached Snapshot to a Shard's KeyIndex,
+/// unless that was done already. Keys Removed since the Snapshot was Attached are
+/// no longer Live and are left out. Caller must hold the Shard's Writer Lock.
+/// </summary>
+/// <param name="shard">Shard to Index</param>
+void DBEngine::indexBase(Shard * shard) {
+	if (shard->baseIndexed)
+		return;
+	shard->liveDocs.forEach([this, shard](uint32_t document) {
+		if (document < shard->baseDocs)
+			shard->keys.insert(documentKey(shard, document), document);
+	});
+	shard->baseIndexed = true;
+}
+
+/// <summary>
+/// Function to get the Keys of every Shard from a Key on, in order, for as long as
+/// they are within a Range, as a Reader Pinned to a Sequence Number sees them. Every
+/// Shard Seeks to the Key in it's KeyIndex and walks it until a Key falls outside
+/// the Range, under the Shard's Shared Lock, and the sorted Keys of the Shards are
+/// Merged. Without a KeyIndex every Live Key is Checked and the Keys of each Shard
+/// are Sorted instead. The Versioned and Removed Keys within the Range are added and
+/// only the Keys which Existed at the Sequence Number are kept.
+/// </summary>
+/// <param name="from">Smallest Key to return</param>
+/// <param name="within">Returns False for the first Key, in order, past the end of the Range</param>
+/// <param name="sequence">Pinned Sequence Number</param>
+/// <returns>Keys from the given Key on which are within the Range, in order</returns>
+std::vector<std::string> DBEngine::scanKeys(std::string_view from, const std::function<bool(std::string_view)>& within, uint64_t sequence) {
+	std::vector<std::vector<std::string>> parts(_shards.size());
+	for (size_t index = 0; index < _shards.size(); index++) {
+		Shard * shard = _shards[index];
+		std::vector<std::string>& part = parts[index];
+		std::shared_lock<std::shared_mutex> lock = lockIndexes(shard, true, false);
+		if (_keyIndex) {
+			shard->keys.scan(from, [&part, &within](const std::string& key, uint32_t) {
+				if (!within(key))
+					return false;
+				part.push_back(key);
+				return true;
+			});
+			continue;
+		}
+		shard->liveDocs.forEach([this, shard, from, &part, &within](uint32_t document) {
+			std::string_view key = documentKey(shard, document);
+			if (key >= from && within(key))
+				part.emplace_back(key);
+		});
+		std::sort(part.begin(), part.end());
+	}
+	std::vector<std::string> keys = parts.size() == 1 ? std::move(parts.front()) : mergeParts(parts, std::less<std::string>(), SIZE_MAX);
+	std::vector<std::string> versioned = versionedKeys(from, within);
+	if (!versioned.empty()) {
+		std::vector<std::string> united;
+		united.reserve(keys.size() + versioned.size());
+		std::set_union(std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end()),
+			versioned.begin(), versioned.end(), std::back_inserter(united));
+		keys.swap(united);
+	}
+	visibleKeys(keys, sequence, nullptr);
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve the Keys present in the Database which start with a Prefix,
+/// as of one Sequence Number. Costs O(log n) per Shard plus the Keys returned.
+/// </summary>
+/// <param name="prefix">Prefix, empty for every Key</param>
+/// <returns>Keys starting with the Prefix, in order</returns>
+std::vector<std::string> DBEngine::getKeysByPrefix(std::string_view prefix) {
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = scanKeys(prefix, [prefix](std::string_view key) { return key.compare(0, prefix.size(), prefix) == 0; }, sequence);
+	endRead(sequence);
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve the Keys present in the Database from one Key to another,
+/// both included, as of one Sequence Number. Costs O(log n) per Shard plus the Keys
+/// returned.
+/// </summary>
+/// <param name="from">First Key of the Range</param>
+/// <param name="to">Last Key of the Range, empty for no end</param>
+/// <returns>Keys within the Range, in order</returns>
+std::vector<std::string> DBEngine::getKeysByRange(std::string_view from, std::string_view to) {
+	if (!to.empty() && to < from)
+		return std::vector<std::string>();
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = scanKeys(from, [to](std::string_view key) { return to.empty() || key <= to; }, sequence);
+	endRead(sequence);
+	return keys;
+}
+
+/// <summary>
+/// Function to Show all the Objects associated with Keys in the Arguments which
+/// are Present in the Database, in the order of the Keys and all of them as of one
+/// Sequence Number.
+/// </summary>
+/// <param name="keys">List of Keys who's associated Objects are to be retrieved</param>
+/// <returns>Objects associated with Keys in the Arguments which are Present in the Database, in Nicely Formatted Manner</returns>
+std::string DBEngine::show(const std::vector<std::string>& keys) {
+	uint64_t sequence = beginRead();
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	return shown;
+}
+
+/// <summary>
+/// Function to Show all DBElements whose Key starts with a Prefix, ordered by Key, as of
+/// one Sequence Number.
+/// </summary>
+/// <param name="prefix">Prefix</param>
+/// <returns>All DBElements whose Key starts with the Prefix, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showByPrefix(std::string_view prefix) {
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = scanKeys(prefix, [prefix](std::string_view key) { return key.compare(0, prefix.size(), prefix) == 0; }, sequence);
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Show all DBElements whose Key is within a Range, ordered by Key, as of one
+/// Sequence Number.
+/// </summary>
+/// <param name="from">First Key of the Range</param>
+/// <param name="to">Last Key of the Range, empty for no end</param>
+/// <returns>All DBElements whose Key is within the Range, in a Nicely Formatted Manner. Returns N/A if there are none</returns>
+std::string DBEngine::showByRange(std::string_view from, std::string_view to) {
+	if (!to.empty() && to < from)
+		return "N/A";
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = scanKeys(from, [to](std::string_view key) { return to.empty() || key <= to; }, sequence);
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	if (shown.empty())
+		return "N/A";
+	return shown;
+}
+
+/// <summary>
+/// Function to Retrieve the first Live Keys after a Cursor, in order. Every Shard gives
+/// at most limit Keys : with the KeyIndex they are Scanned from the Cursor on, without
+/// it (or for a Tag) the Shard's Keys are walked keeping the limit smallest after the
+/// Cursor in a Heap. The Parts are then Merged, so a Page takes O(limit) Memory per
+/// Shard however large the Database is.
+/// </summary>
+/// <param name="cursor">Last Key of the previous Page, empty to start from the first Key</param>
+/// <param name="limit">Largest Number of Keys to return</param>
+/// <param name="prefix">Prefix of the Keys, empty for every Key</param>
+/// <param name="tag">Tag ID the DBElements must have, nullptr for every Key</param>
+/// <returns>Up to limit Live Keys after the Cursor, in order</returns>
+std::vector<std::string> DBEngine::pageShards(std::string_view cursor, size_t limit, std::string_view prefix, const uint32_t * tag) {
+	bool indexed = _keyIndex && tag == nullptr;
+	std::string_view from = std::max(cursor, prefix);
+	std::vector<std::vector<std::string>> parts(_shards.size());
+	for (size_t index = 0; index < _shards.size(); index++) {
+		Shard * shard = _shards[index];
+		std::vector<std::string>& part = parts[index];
+		std::shared_lock<std::shared_mutex> lock = lockIndexes(shard, indexed, false);
+		if (indexed) {
+			shard->keys.scan(from, [&part, cursor, prefix, limit](const std::string& key, uint32_t) {
+				if (key.compare(0, prefix.size(), prefix) != 0)
+					return false;
+				if (!cursor.empty() && key == cursor)
+					return true;
+				part.push_back(key);
+				return part.size() < limit;
+			});
+			continue;
+		}
+		/* Largest of the limit smallest Keys seen so far on top */
+		std::priority_queue<std::string> smallest;
+		auto offer = [this, shard, cursor, prefix, limit, &smallest](uint32_t document) {
+			std::string_view key = documentKey(shard, document);
+			if ((!cursor.empty() && key <= cursor) || key.compare(0, prefix.size(), prefix) != 0)
+				return;
+			if (smallest.size() == limit && key >= smallest.top())
+				return;
+			smallest.emplace(key);
+			if (smallest.size() > limit)
+				smallest.pop();
+		};
+		if (tag == nullptr) {
+			shard->liveDocs.forEach(offer);
+		} else {
+			auto documents = shard->tagMap.find(*tag);
+			if (documents != shard->tagMap.end())
+				documents->second.forEach(offer);
+		}
+		part.resize(smallest.size());
+		for (size_t position = part.size(); position > 0; position--) {
+			part[position - 1] = smallest.top();
+			smallest.pop();
+		}
+	}
+	if (parts.size() == 1)
+		return std::move(parts.front());
+	return mergeParts(parts, std::less<std::string>(), limit);
+}
+
+/// <summary>
+/// Function to Retrieve the first Keys after a Cursor, in order, as a Reader Pinned to
+/// a Sequence Number sees them. The Live Keys of the Shards and the Versioned and
+/// Removed Keys are United and only those the Reader sees are kept, so when Keys
+/// Written since the Sequence Number take up room the Shards are asked for more from
+/// their last Key on, until the Page is full or they have no more.
+/// </summary>
+/// <param name="cursor">Last Key of the previous Page, empty to start from the first Key</param>
+/// <param name="limit">Largest Number of Keys to return</param>
+/// <param name="prefix">Prefix of the Keys, empty for every Key</param>
+/// <param name="tag">Tag ID the DBElements must have, nullptr for every Key</param>
+/// <param name="sequence">Pinned Sequence Number</param>
+/// <returns>Up to limit Keys after the Cursor, in order</returns>
+std::vector<std::string> DBEngine::pageKeys(std::string_view cursor, size_t limit, std::string_view prefix, const uint32_t * tag, uint64_t sequence) {
+	std::vector<std::string> versioned = versionedKeys(std::max(cursor, prefix), [cursor, prefix](std::string_view key) {
+		return key != cursor && key.compare(0, prefix.size(), prefix) == 0;
+	});
+	std::function<bool(const DBElement*)> matches;
+	if (tag != nullptr)
+		matches = [tag](const DBElement * value) { return value->tagIdExist(*tag); };
+	std::vector<std::string> page;
+	std::string last(cursor);
+	size_t next = 0;
+	while (page.size() < limit) {
+		size_t wanted = limit - page.size();
+		std::vector<std::string> live = pageShards(last, wanted, prefix, tag);
+		bool exhausted = live.size() < wanted;
+		/* Versioned Keys up to the last Live Key, every one left once the Shards have no more */
+		size_t end = next;
+		while (end < versioned.size() && (exhausted || versioned[end] <= live.back()))
+			end++;
+		if (!exhausted)
+			last = live.back();
+		std::vector<std::string> candidates;
+		candidates.reserve(live.size() + end - next);
+		std::set_union(std::make_move_iterator(live.begin()), std::make_move_iterator(live.end()),
+			versioned.begin() + next, versioned.begin() + end, std::back_inserter(candidates));
+		next = end;
+		visibleKeys(candidates, sequence, matches);
+		for (size_t index = 0; index < candidates.size() && page.size() < limit; index++)
+			page.push_back(std::move(candidates[index]));
+		if (exhausted)
+			break;
+	}
+	return page;
+}
+
+/// <summary>
+/// Function to Retrieve a Page of the Keys present in the Database, ordered by Key.
+/// </summary>
+/// <param name="cursor">Last Key of the previous Page, empty for the first Page</param>
+/// <param name="limit">Largest Number of Keys in the Page (Minimum 1)</param>
+/// <param name="prefix">Prefix of the Keys, empty for every Key</param>
+/// <returns>Up to limit Keys after the Cursor, in order</returns>
+std::vector<std::string> DBEngine::getKeysPage(std::string_view cursor, size_t limit, std::string_view prefix) {
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = pageKeys(cursor, std::max<size_t>(limit, 1), prefix, nullptr, sequence);
+	endRead(sequence);
+	return keys;
+}
+
+/// <summary>
+/// Function to Retrieve a Page of the Keys of DBElements which have a Tag, ordered by
+/// Key. Walks the Posting List of the Tag in every Shard.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <param name="cursor">Last Key of the previous Page, empty for the first Page</param>
+/// <param name="limit">Largest Number of Keys in the Page (Minimum 1)</param>
+/// <returns>Up to limit Keys after the Cursor, in order</returns>
+std::vector<std::string> DBEngine::getKeysWithTagPage(std::string_view tag, std::string_view cursor, size_t limit) {
+	uint32_t id;
+	if (!_dictionary.find(tag, id))
+		return std::vector<std::string>();
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = pageKeys(cursor, std::max<size_t>(limit, 1), "", &id, sequence);
+	endRead(sequence);
+	return keys;
+}
+
+/// <summary>
+/// Function to Show a Page of the DBElements present in the Database, ordered by Key,
+/// as of one Sequence Number. Keys of the Page which Expired are left out, so a Page
+/// may hold less than limit DBElements even if more follow.
+/// </summary>
+/// <param name="cursor">Cursor returned with the previous Page, empty for the first Page</param>
+/// <param name="limit">Largest Number of DBElements in the Page (Minimum 1)</param>
+/// <param name="next">Set to the Cursor of the next Page, empty if there is none</param>
+/// <param name="prefix">Prefix of the Keys, empty for every Key</param>
+/// <returns>DBElements of the Page in a Nicely Formatted Manner</returns>
+std::string DBEngine::showPage(std::string_view cursor, size_t limit, std::string& next, std::string_view prefix) {
+	limit = std::max<size_t>(limit, 1);
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = pageKeys(cursor, limit, prefix, nullptr, sequence);
+	next = keys.size() == limit ? keys.back() : std::string();
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	return shown;
+}
+
+/// <summary>
+/// Function to Show a Page of the DBElements which have a Tag, ordered by Key, as of
+/// one Sequence Number.
+/// </summary>
+/// <param name="tag">Tag</param>
+/// <param name="cursor">Cursor returned with the previous Page, empty for the first Page</param>
+/// <param name="limit">Largest Number of DBElements in the Page (Minimum 1)</param>
+/// <param name="next">Set to the Cursor of the next Page, empty if there is none</param>
+/// <returns>DBElements of the Page in a Nicely Formatted Manner</returns>
+std::string DBEngine::showUsingTagPage(std::string_view tag, std::string_view cursor, size_t limit, std::string& next) {
+	next.clear();
+	uint32_t id;
+	if (!_dictionary.find(tag, id))
+		return std::string();
+	limit = std::max<size_t>(limit, 1);
+	uint64_t sequence = beginRead();
+	std::vector<std::string> keys = pageKeys(cursor, limit, "", &id, sequence);
+	next = keys.size() == limit ? keys.back() : std::string();
+	std::string shown = showAt(keys, sequence, nullptr);
+	endRead(sequence);
+	return shown;
+}
+
+#ifdef TEST_CREATE_DBENGINE
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Test Function to Create DBElements to be Inserted into DBEngine.
+/// </summary>
+/// <returns>Vector of DBElements which are to be Inserted into DBEngine</returns>
 std::vector<std::pair<std::string, DBElement>> createDBObjects() {
 	std::vector<std::pair<std::string, DBElement>> objects;
 	DBElement * obj0 = new DBElement("Anakin Skywalker", std::unordered_set<std::string>({ "Siths", "Data", "Empire", "Star Wars" }));
@@ -320,110 +3181,1207 @@ std::vector<std::pair<std::string, DBElement>> createDBObjects() {
 }
 
 /// <summary>
-/// Function to insert DBElements into the DBEngine
+/// Function to insert DBElements into the DBEngine
+/// </summary>
+/// <param name="db">DBEngine</param>
+void insertIntoDBEngine(DBEngine * db) {
+	StringHelper::Title("Insert Objects into DBEngine");
+	for (std::pair<std::string, DBElement> pr : createDBObjects()) {
+		db->insert(pr.first, pr.second);
+	}
+	std::cout << "\n > Inserted 4 objects into Database" << std::endl;
+	putline();
+}
+#endif // TEST_CREATE_DBENGINE
+
+#ifdef TEST_DBENGINE
+
+#include <set>
+#include <cstdio>
+#include <filesystem>
+#include <atomic>
+#include <algorithm>
+#include <thread>
+#include <cstdlib>
+
+/* Number of Allocations made through operator new by the current Thread */
+static thread_local long long allocationCount = 0;
+
+/// <summary>
+/// Global operator new which counts the Allocations of every Thread.
+/// </summary>
+void * operator new(size_t size) {
+	allocationCount++;
+	void * block = std::malloc(size == 0 ? 1 : size);
+	if (block == nullptr)
+		throw std::bad_alloc();
+	return block;
+}
+
+/// <summary>
+/// Global nothrow operator new, counted like operator new.
+/// </summary>
+void * operator new(size_t size, const std::nothrow_t&) noexcept {
+	allocationCount++;
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+/// <summary>
+/// Global operator delete matching the counting operator new.
+/// </summary>
+void operator delete(void * pointer) noexcept {
+	std::free(pointer);
+}
+
+/// <summary>
+/// Global sized operator delete matching the counting operator new.
+/// </summary>
+void operator delete(void * pointer, size_t) noexcept {
+	std::free(pointer);
+}
+
+/// <summary>
+/// Function to Test Methods which have perform Show Type Operations.
+/// </summary>
+/// <param name="db">DBEngine</param>
+void testShow(DBEngine * db) {
+	StringHelper::Title("Test Show Functions");
+	StringHelper::Title("Test Show Object Function", '~');
+	std::cout << "\n > Show Object with \"key3\"\n\n" << db->getData("key3");
+	putline();
+
+	StringHelper::Title("Test Show whole database", '~');
+	std::cout << "\n" << db->show();
+	
+	StringHelper::Title("Test Show database objects with keys : { 'key0', 'key3', 'key4' }", '~');
+	std::cout << "\n" << db->show(std::unordered_set<std::string>({ "key0", "key3", "key4" }));
+	putline();
+
+	StringHelper::Title("Test Show database objects with keys from 'key1' to 'key2'", '~');
+	std::cout << "\n" << db->showByRange("key1", "key2");
+	putline();
+
+	StringHelper::Title("Test Show Database Using Matching Tag Function", '~');
+	std::cout << "\n Show Objects with Tag \"Machine\"\n";
+	std::cout << "\n" << db->showUsingTag("Machine");
+	putline();
+
+	StringHelper::Title("Test Show Database Using Tag Expression Function", '~');
+	std::cout << "\n Show Objects matching \"Data & !(Star Wars | Westworld)\"\n";
+	std::cout << "\n" << db->showUsingTags("Data & !(Star Wars | Westworld)");
+	std::cout << "\n Show Objects matching \"Machine & AI & !Westworld\"\n";
+	std::cout << "\n" << db->showUsingTags("Machine & AI & !Westworld");
+	std::cout << "\n\n Show Objects matching \"Machine & (AI\"\n";
+	std::cout << "\n" << db->showUsingTags("Machine & (AI");
+	putline();
+
+}
+
+/// <summary>
+/// Function to Test Methods which perform Operations on Tags.
+/// </summary>
+/// <param name="db">DBENgine</param>
+void testTagOperations(DBEngine * db) {
+	StringHelper::Title("Test Show Functions");
+	StringHelper::Title("Test Add Tag Function", '~');
+	std::cout << "\n Before Adding Tag\n\n" << db->getData("key3") << std::endl;
+	std::cout << "\n > Add tag \"Wayatt\" to \"Key3\"";
+	db->addTag("key3", "Wayatt");
+	std::cout << "\n After Adding Tag\n\n" << db->getData("key3");
+	putline();
+
+	StringHelper::Title("Test Remove Tag Function", '~');
+	std::cout << "\n Before removing Tag\n\n" << db->getData("key3") << std::endl;
+	std::cout << "\n > Remove tag \"Wayatt\" to \"Key3\"";
+	db->removeTag("key3", "Wayatt");
+	std::cout << "\n After Removing Tag\n\n" << db->getData("key3");
+	putline();
+
+	StringHelper::Title("Test Get Keys with Tag Function", '~');
+	std::cout << "\n Get all keys with Tag : \"Star Wars\"";
+	{
+		std::cout << "\n > Keys : ";
+		bool first = true;
+		for (std::string key : db->getKeysWithTag("Star Wars")) {
+			if (first) {
+				first = false;
+				std::cout << "\"" << key << "\"";
+			}
+			else {
+				std::cout << ", \"" << key << "\"";
+			}
+		}
+		std::cout << "\n\n";
+	}
+}
+
+/// <summary>
+/// Function to Test Methods which perform Update and Delete Operations.
+/// </summary>
+/// <param name="db">DBEngine</param>
+void testUpdateDelete(DBEngine * db) {
+	StringHelper::Title("Test Update and Delete Functions");
+	StringHelper::Title("Test Update Function", '-');
+	std::cout << "\n > Before Updating Object with Key : \"key2\"\n" << db->getData("key2") << std::endl;
+	std::cout << "\n Update \"key2\"'s Object in the Database";
+	db->update("key2", DBElement("Deckard", std::unordered_set<std::string>({ "Replicant", "Blade Runner", "Data", "AI", "Machine" })));
+	std::cout << "\n > After Updating Object with Key : \"key2\"\n" << db->getData("key2") << std::endl;
+	putline();
+
+	StringHelper::Title("Test Delete Function", '-');
+	std::cout << "\n > Object with \"key2\" Exists in Database ? " << db->exists("key2") << std::endl;
+	std::cout << "\n Removing Oject with \"key2\" from Database";
+	db->remove("key2");
+	std::cout << "\n > Object with \"key2\" Exists in Database ? " << db->exists("key2") << std::endl;
+	putline();
+}
+
+/// <summary>
+/// Function to Test Sharded DBEngine being used by multiple Threads at once.
+/// </summary>
+void testShards() {
+	StringHelper::Title("Test Sharded DBEngine");
+	std::cout << "\n Creating DBEngine with 8 Shards";
+	DBEngine * db = new DBEngine("anonymous", 8);
+	std::vector<std::thread> writers;
+	for (int id = 0; id < 4; id++) {
+		writers.push_back(std::thread([db, id]() {
+			for (int index = 0; index < 1000; index++)
+				db->insert("thread" + std::to_string(id) + "_" + std::to_string(index),
+					DBElement("Droid", std::unordered_set<std::string>({ "Droid", "Thread" + std::to_string(id) })));
+		}));
+	}
+	for (std::thread& writer : writers)
+		writer.join();
+	std::cout << "\n > 4 Threads Inserted 1000 Objects each";
+	std::cout << "\n > Shards : " << db->shardCount() << ", Objects : " << db->size();
+	std::cout << "\n > Keys with Tag \"Droid\"   : " << db->getKeysWithTag("Droid").size();
+	std::cout << "\n > Keys with Tag \"Thread2\" : " << db->getKeysWithTag("Thread2").size() << std::endl;
+	delete db;
+	putline();
+}
+
+/// <summary>
+/// Function to Test Lock-Free Reads running while Writers Update the same Keys.
+/// </summary>
+void testLockFreeReads() {
+	StringHelper::Title("Test Lock-Free Reads during Writes");
+	DBEngine * db = new DBEngine("anonymous", 4);
+	for (int index = 0; index < 100; index++)
+		db->insert("key" + std::to_string(index), DBElement("Clone", { "Clone" }));
+	std::atomic<bool> stop(false);
+	std::atomic<int> invalid(0);
+	std::vector<std::thread> readers;
+	for (int id = 0; id < 4; id++) {
+		readers.push_back(std::thread([db, &stop, &invalid]() {
+			int index = 0;
+			while (!stop) {
+				std::string key = "key" + std::to_string(index++ % 100);
+				DBElement value = db->getDataRaw(key);
+				if (value.getData().find("Clone") != 0 || !db->exists(key))
+					invalid++;
+				ElementView view = db->getView(key);
+				if (!view.valid() || view.data().find("Clone") != 0)
+					invalid++;
+			}
+		}));
+	}
+	for (int round = 0; round < 200; round++) {
+		for (int index = 0; index < 100; index++) {
+			std::string key = "key" + std::to_string(index);
+			db->updateData(key, "Clone " + std::to_string(round));
+			db->addTag(key, "Round");
+			db->removeTag(key, "Round");
+			db->update(key, DBElement("Clone Trooper", { "Clone" }));
+		}
+	}
+	stop = true;
+	for (std::thread& reader : readers)
+		reader.join();
+	std::cout << "\n > Writer performed 80000 Updates while 4 Readers were running";
+	std::cout << "\n > Invalid Reads : " << invalid;
+	std::cout << "\n > Keys with Tag \"Clone\" : " << db->getKeysWithTag("Clone").size() << std::endl;
+	delete db;
+	putline();
+}
+
+/// <summary>
+/// Function to Test DBElement Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+/// <summary>
+/// Function to Test DBElements are Allocated from Slabs and Released in bulk.
+/// </summary>
+void testAllocator() {
+	StringHelper::Title("Test Slab Allocation of DBElements");
+	DBEngine * db = new DBEngine("anonymous", 4);
+	for (int index = 0; index < 100000; index++)
+		db->insert("key" + std::to_string(index), DBElement("Clone Trooper " + std::to_string(index), { "Clone", "Trooper" }));
+	for (int index = 0; index < 100000; index += 2)
+		db->remove("key" + std::to_string(index));
+	EpochManager::instance().synchronize();
+	std::cout << "\n > 100000 Inserts and 50000 Removes\n" << SlabAllocator::format(db->allocatorStats());
+	std::cout << " Distinct Tags  : " << db->tagCount() << "\n";
+	Timer timer;
+	timer.StartClock();
+	delete db;
+	std::cout << "\n > Destroyed DBEngine with 50000 DBElements in " << timer.StopClock() << " ms" << std::endl;
+	putline();
+}
+
+/// <summary>
+/// Function to Test that Point Reads using std::string_view do not Allocate.
+/// </summary>
+void testAllocationFreeReads() {
+	StringHelper::Title("Test Point Reads do not Allocate");
+	DBEngine * db = new DBEngine("anonymous", 4);
+	/* Keys longer than the Small String Buffer so copying one would Allocate */
+	for (int index = 0; index < 1000; index++)
+		db->insert("galactic-republic-clone-" + std::to_string(index), DBElement("Clone Trooper " + std::to_string(index), { "Clone", "Trooper" }));
+	DBElement element("Dolores", { "Westworld", "Artificial Intelligence" });
+	std::string key = "galactic-republic-clone-500";
+	/* First Read registers the Thread with the EpochManager */
+	db->exists(key);
+	long long before = allocationCount;
+	size_t hits = 0;
+	for (int round = 0; round < 10000; round++) {
+		hits += db->exists(key);
+		hits += db->exists("galactic-republic-clone-42");
+		hits += db->exists("galactic-republic-clone-missing");
+		hits += element.tagExist("Artificial Intelligence");
+		hits += element.getDataView().size();
+		hits += db->getView(key).data().size();
+	}
+	long long allocations = allocationCount - before;
+	std::cout << "\n > 60000 Point Reads (exists, tagExist, getDataView, getView), " << hits << " hits";
+	std::cout << "\n > Allocations made : " << allocations << std::endl;
+	delete db;
+	putline();
+}
+
+/// <summary>
+/// Function to Test ElementViews keep showing the DBElement they were created for
+/// while the Key is Updated and Removed.
+/// </summary>
+void testElementView() {
+	StringHelper::Title("Test Zero-Copy ElementView");
+	DBEngine * db = new DBEngine("anonymous", 4);
+	db->insert("clone", DBElement("CT-7567 Rex", { "Clone", "Captain" }));
+	ElementView view = db->getView("clone");
+	std::cout << "\n > View of \"clone\" : " << view.data() << ", Tags :";
+	for (uint32_t id : view.tagIds())
+		std::cout << " \"" << view.tagName(id) << "\"";
+	for (int round = 0; round < 1000; round++)
+		db->update("clone", DBElement("CT-7567 Rex " + std::to_string(round), { "Clone" }));
+	db->remove("clone");
+	std::cout << "\n > After 1000 Updates and Remove, View : " << view.data() << ", Tag Count : " << view.tagCount();
+	std::cout << "\n > View of missing Key is Valid : " << db->getView("clone").valid();
+	view.reset();
+	EpochManager::instance().synchronize();
+	std::cout << "\n > Retired DBElements after reset : " << EpochManager::instance().pending() << std::endl;
+	delete db;
+	putline();
+}
+
+/// <summary>
+/// Function to Test the Database is Rebuilt from it's Write Ahead Log.
+/// </summary>
+void testWriteAheadLog() {
+	StringHelper::Title("Test Write Ahead Log Replay");
+	const char * path = "DBEngine.test.wal";
+	std::remove(path);
+	DBEngineConfig config(4);
+	config.wal.path = path;
+	DBEngine * db = new DBEngine("anonymous", config);
+	std::vector<std::thread> writers;
+	for (int id = 0; id < 4; id++) {
+		writers.push_back(std::thread([db, id]() {
+			for (int index = 0; index < 250; index++) {
+				std::string key = "droid" + std::to_string(id * 250 + index);
+				db->insert(key, DBElement("Droid", { "Droid" }));
+				if (index % 2 == 0)
+					db->addTag(key, "Astromech");
+				if (index % 5 == 0)
+					db->updateData(key, "R2-D" + std::to_string(index));
+				if (index % 7 == 0)
+					db->removeTag(key, "Droid");
+				if (index % 11 == 0)
+					db->update(key, DBElement("Protocol Droid", { "Droid", "Protocol" }));
+				if (index % 13 == 0)
+					db->remove(key);
+			}
+		}));
+	}
+	for (std::thread& writer : writers)
+		writer.join();
+	WriteAheadLog::Stats stats = db->logStats();
+	std::string before;
+	for (int index = 0; index < 1000; index++)
+		before.append(db->getData("droid" + std::to_string(index)));
+	size_t size = db->size(), astromechs = db->getKeysWithTags("Astromech & !Protocol").size();
+	std::cout << "\n > Durable : " << db->isDurable() << ", Records Logged : " << stats.records << ", fsyncs : " << (stats.syncs < stats.records ? "fewer than Records" : "one per Record");
+	delete db;
+
+	db = new DBEngine("anonymous", config);
+	std::string after;
+	for (int index = 0; index < 1000; index++)
+		after.append(db->getData("droid" + std::to_string(index)));
+	std::cout << "\n > Objects before Restart : " << size << ", after Replay : " << db->size();
+	std::cout << "\n > Keys matching \"Astromech & !Protocol\" before : " << astromechs << ", after : " << db->getKeysWithTags("Astromech & !Protocol").size();
+	std::cout << "\n > Data and Timestamps identical after Replay : " << (before == after) << std::endl;
+	delete db;
+	std::remove(path);
+	putline();
+}
+
+/// <summary>
+/// Function to get the Data of Keys "droid0" to "droid<count - 1>" and the Keys
+/// matching a Tag Expression, used to compare a DBEngine before and after a Restart.
+/// </summary>
+/// <param name="db">DBEngine</param>
+/// <param name="count">Number of Keys</param>
+/// <returns>Formatted Data of every Key followed by the sorted matching Keys</returns>
+std::string droidContents(DBEngine * db, int count) {
+	std::string contents;
+	for (int index = 0; index < count; index++)
+		contents.append(db->getData("droid" + std::to_string(index)));
+	std::unordered_set<std::string> keys = db->getKeysWithTags("Astromech & !Protocol");
+	std::vector<std::string> sorted(keys.begin(), keys.end());
+	std::sort(sorted.begin(), sorted.end());
+	for (const std::string& key : sorted)
+		contents.append(key).push_back(',');
+	return contents;
+}
+
+/// <summary>
+/// Function to Test Writing a Snapshot and starting from it, Attached or Loaded, with
+/// the Mutations made after the Snapshot Replayed from the Write Ahead Log.
+/// </summary>
+void testSnapshot() {
+	StringHelper::Title("Test Snapshot Save, Attach and Load");
+	const char * wal = "DBEngine.test.wal";
+	const char * path = "DBEngine.test.snapshot";
+	const char * copy = "DBEngine.test.snapshot2";
+	std::remove(wal);
+	std::remove(path);
+	std::remove(copy);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	DBEngine * db = new DBEngine("anonymous", config);
+	for (int index = 0; index < 1000; index++) {
+		std::string key = "droid" + std::to_string(index);
+		db->insert(key, DBElement("Droid " + std::to_string(index), { "Droid" }));
+		if (index % 2 == 0)
+			db->addTag(key, "Astromech");
+		if (index % 13 == 0)
+			db->remove(key);
+	}
+	std::cout << "\n > Snapshot Saved : " << db->saveSnapshot(path);
+	for (int index = 0; index < 1100; index += 3) {
+		std::string key = "droid" + std::to_string(index);
+		if (!db->insert(key, DBElement("Late Droid", { "Astromech" })))
+			db->update(key, DBElement("Protocol Droid", { "Astromech", "Protocol" }));
+	}
+	db->remove("droid1");
+	size_t size = db->size();
+	std::string before = droidContents(db, 1100);
+	delete db;
+
+	config.snapshot = path;
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Attached Shards : " << db->shardCount() << ", Objects before any Read : " << db->size() << " of " << size;
+	std::cout << "\n > Snapshot of Attached Database Saved : " << db->saveSnapshot(copy);
+	std::cout << "\n > Attached Data, Tags and Timestamps identical : " << (droidContents(db, 1100) == before);
+	delete db;
+
+	/* The Log was Emptied by the second Snapshot, which holds everything */
+	config.snapshot = copy;
+	config.mapSnapshot = false;
+	config.shards = 3;
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Loaded into " << db->shardCount() << " Shards, Objects : " << db->size()
+		<< ", identical : " << (droidContents(db, 1100) == before);
+	delete db;
+
+	config.mapSnapshot = true;
+	db = new DBEngine("anonymous", config);
+	std::atomic<size_t> found(0);
+	std::vector<std::thread> readers;
+	for (int id = 0; id < 4; id++) {
+		readers.push_back(std::thread([db, &found]() {
+			for (int index = 0; index < 1100; index++) {
+				ElementView view = db->getView("droid" + std::to_string(index));
+				found += view.valid();
+			}
+		}));
+	}
+	for (std::thread& reader : readers)
+		reader.join();
+	std::cout << "\n > Keys found by 4 Concurrent Readers Loading from the Snapshot : " << found / 4;
+	std::cout << "\n > Snapshot of Attached Database identical : " << (droidContents(db, 1100) == before);
+	size_t shown = db->show().size();
+	std::cout << "\n > show() Loads every Key, Objects : " << db->size() << (shown == 0 ? ", nothing shown" : "") << std::endl;
+	delete db;
+	std::remove(wal);
+	std::remove(path);
+	std::remove(copy);
+	putline();
+}
+
+/// <summary>
+/// Function to Test that a background Snapshot holds the Database as it was when
+/// the Snapshot was Started while Writers keep Mutating it, and that the Snapshot
+/// plus the new Write Ahead Log Rebuild the Database as it is afterwards.
 /// </summary>
-/// <param name="db">DBEngine</param>
-void insertIntoDBEngine(DBEngine * db) {
-	StringHelper::Title("Insert Objects into DBEngine");
-	for (std::pair<std::string, DBElement> pr : createDBObjects()) {
-		db->insert(pr.first, pr.second);
+void testBackgroundSnapshot() {
+	StringHelper::Title("Test Background Snapshot while Writing");
+	const char * wal = "DBEngine.test.wal";
+	const char * path = "DBEngine.test.snapshot";
+	std::remove(wal);
+	std::remove(path);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	DBEngine * db = new DBEngine("anonymous", config);
+	for (int index = 0; index < 2000; index++)
+		db->insert("droid" + std::to_string(index), DBElement("Droid", { "Droid", index % 2 == 0 ? "Astromech" : "Protocol" }));
+	size_t size = db->size();
+	std::string image = droidContents(db, 3000);
+	std::cout << "\n > Snapshot Started : " << db->startSnapshot(path);
+	std::vector<std::thread> writers;
+	for (int id = 0; id < 4; id++) {
+		writers.push_back(std::thread([db, id]() {
+			for (int index = id; index < 2000; index += 4) {
+				std::string key = "droid" + std::to_string(index);
+				db->updateData(key, "Rebuilt Droid");
+				if (index % 3 == 0)
+					db->addTag(key, "Rebel");
+				if (index % 5 == 0)
+					db->remove(key);
+				db->insert("droid" + std::to_string(2000 + index / 2), DBElement("New Droid", { "Astromech" }));
+			}
+		}));
 	}
-	std::cout << "\n > Inserted 4 objects into Database" << std::endl;
+	for (std::thread& writer : writers)
+		writer.join();
+	std::cout << "\n > Snapshot Written : " << db->waitSnapshot();
+	SnapshotStats stats = db->snapshotStats();
+	std::cout << "\n > Records : " << stats.records << " of " << size << " at the Snapshot point, Bytes Written : " << (stats.bytes > 0 ? "yes" : "no");
+	std::string after = droidContents(db, 3000);
+	delete db;
+
+	DBEngineConfig imageConfig(4);
+	imageConfig.snapshot = path;
+	db = new DBEngine("anonymous", imageConfig);
+	std::cout << "\n > Snapshot holds the Database at the Snapshot point : " << (droidContents(db, 3000) == image);
+	delete db;
+	config.snapshot = path;
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Snapshot and new Log Rebuild the Database : " << (droidContents(db, 3000) == after) << std::endl;
+	delete db;
+	std::remove(wal);
+	std::remove(path);
 	putline();
 }
-#endif // TEST_CREATE_DBENGINE
 
-#ifdef TEST_DBENGINE
+/// <summary>
+/// Function to Test the LSM Tier : Writers and Readers run while the Memtables are
+/// Flushed and Compacted, and the Database is Rebuilt from the SSTables and the
+/// Write Ahead Log, or from the SSTables alone once the Memtables were Flushed.
+/// With a valueThreshold the Data is Separated into the Value Log, whose Segments
+/// are Garbage Collected as Keys are Updated and Removed.
+/// </summary>
+/// <param name="valueThreshold">Data at least this large is Flushed to the Value Log, 0 for none</param>
+void testLSMTree(size_t valueThreshold) {
+	StringHelper::Title(valueThreshold == 0 ? "Test LSM Tier Flush, Compaction and Restart" : "Test LSM Tier with Value Log Flush, Garbage Collection and Restart");
+	const char * wal = "DBEngine.test.wal";
+	const char * rotated = "DBEngine.test.wal.old";
+	std::remove(wal);
+	std::remove(rotated);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	config.lsm.directory = "DBEngine.test.lsm";
+	config.lsm.memtableBytes = 32 << 10;
+	config.lsm.tableBytes = 8 << 10;
+	config.lsm.levelBytes = 32 << 10;
+	config.lsm.level0Tables = 2;
+	config.lsm.valueThreshold = valueThreshold;
+	config.lsm.garbageRatio = 0.2;
+	auto clear = [&config]() {
+		std::error_code error;
+		std::filesystem::remove_all(config.lsm.directory, error);
+	};
+	clear();
+	DBEngine * db = new DBEngine("anonymous", config);
+	for (int index = 0; index < 100; index++)
+		db->insert("droid" + std::to_string(index), DBElement("Droid", { "Droid" }));
+	std::atomic<bool> writing(true);
+	std::atomic<size_t> missing(0);
+	std::thread reader([db, &writing, &missing]() {
+		/* Keys below 100 are never Removed or Replaced, they must stay Readable while being Flushed */
+		while (writing) {
+			for (int index = 1; index < 100; index += 13)
+				missing += db->exists("droid" + std::to_string(index)) ? 0 : 1;
+		}
+	});
+	std::vector<std::thread> writers;
+	for (int id = 0; id < 4; id++) {
+		writers.push_back(std::thread([db, id]() {
+			for (int index = 100 + id * 1000; index < 100 + (id + 1) * 1000; index++) {
+				std::string key = "droid" + std::to_string(index);
+				db->insert(key, DBElement("Droid " + std::to_string(index), { "Droid" }));
+				if (index % 2 == 0)
+					db->addTag(key, "Astromech");
+				if (index % 11 == 0)
+					db->update(key, DBElement("Protocol Droid", { "Droid", "Protocol" }));
+				if (index % 13 == 0)
+					db->remove(key);
+			}
+			/* Mutate Keys which have been Flushed by now */
+			for (int index = 100 + id * 1000; index < 100 + (id + 1) * 1000; index += 7) {
+				std::string key = "droid" + std::to_string(index);
+				db->updateData(key, "Rebuilt Droid");
+				if (index % 3 == 0)
+					db->removeTag(key, "Droid");
+				if (index % 17 == 0)
+					db->remove(key);
+			}
+		}));
+	}
+	for (std::thread& writer : writers)
+		writer.join();
+	if (valueThreshold != 0) {
+		/* Rewrite most Flushed Keys so their Segments fill with Garbage */
+		for (int index = 100; index < 4100; index++) {
+			if (index % 4 != 0)
+				db->updateData("droid" + std::to_string(index), "Refitted Droid " + std::to_string(index));
+		}
+	}
+	writing = false;
+	reader.join();
+	size_t size = db->size();
+	std::string before = droidContents(db, 4100);
+	std::vector<std::string> prefixed = db->getKeysByPrefix("droid1");
+	LSMTree::Stats stats = db->tierStats();
+	size_t tables = 0;
+	for (size_t level = 1; level < LSMTree::LEVELS; level++)
+		tables += stats.levelTables[level];
+	std::cout << "\n > Tiered : " << db->isTiered() << ", Flushed : " << (stats.flushes > 1) << ", Compacted : " << (stats.compactions > 0)
+		<< ", SSTables below Level 0 : " << (tables > 0);
+	if (valueThreshold != 0)
+		std::cout << "\n > Values Separated : " << (stats.valueLogBytesWritten > 0) << ", Segments Collected : " << (stats.collections > 0);
+	std::cout << "\n > Stable Keys missed by the Reader while Flushing : " << missing;
+	std::cout << "\n > Keys matching \"Droid & Protocol\" : " << db->getKeysWithTags("Droid & Protocol").size()
+		<< ", Objects shown : " << (db->show().size() > 0);
+	delete db;
+
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Objects before Restart : " << size << ", after : " << db->size();
+	std::cout << "\n > Data, Tags and Timestamps identical after Restart : " << (droidContents(db, 4100) == before);
+	delete db;
+	std::remove(wal);
+	std::remove(rotated);
+	config.wal.path.clear();
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Rebuilt from SSTables alone, identical : " << (droidContents(db, 4100) == before)
+		<< ", Prefix Scan identical : " << (db->getKeysByPrefix("droid1") == prefixed) << std::endl;
+	delete db;
+	clear();
+	putline();
+}
 
 /// <summary>
-/// Function to Test Methods which have perform Show Type Operations.
+/// Function to Test DBElements stored Compressed against a trained Dictionary read
+/// back the same through getData, getDataRaw and getView, and are Restored the same
+/// from a Snapshot and the Write Ahead Log, which hold the Data Decompressed.
 /// </summary>
-/// <param name="db">DBEngine</param>
-void testShow(DBEngine * db) {
-	StringHelper::Title("Test Show Functions");
-	StringHelper::Title("Test Show Object Function", '~');
-	std::cout << "\n > Show Object with \"key3\"\n\n" << db->getData("key3");
+void testCompression() {
+	StringHelper::Title("Test Compressed Data");
+	const char * wal = "DBEngine.test.wal";
+	const char * path = "DBEngine.test.snapshot";
+	std::remove(wal);
+	std::remove(path);
+	auto droid = [](int index) {
+		return "{\"model\":\"R" + std::to_string(index % 9) + "-D" + std::to_string(index % 7) + "\",\"maker\":\"Industrial Automaton\","
+			"\"class\":\"Astromech\",\"owner\":\"Rebel Alliance\",\"serial\":" + std::to_string(index * 7919) + "}";
+	};
+	std::vector<std::string> samples;
+	for (int index = 0; index < 50; index++)
+		samples.push_back(droid(index * 31));
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	config.compression.threshold = 32;
+	config.compression.dictionary = Codec::Dictionary::train(std::vector<std::string_view>(samples.begin(), samples.end()));
+	DBEngine * db = new DBEngine("anonymous", config);
+	Codec::Stats start = db->compressionStats();
+	for (int index = 0; index < 1000; index++) {
+		std::string key = "droid" + std::to_string(index);
+		db->insert(key, DBElement(index % 10 == 0 ? "R2" : droid(index), { "Droid" }));
+		if (index % 3 == 0)
+			db->addTag(key, "Astromech");
+		if (index % 7 == 0)
+			db->updateData(key, droid(index + 1));
+	}
+	size_t compressed = 0, identical = 0, stored = 0, data = 0;
+	for (int index = 0; index < 1000; index++) {
+		std::string key = "droid" + std::to_string(index);
+		std::string expected = index % 7 == 0 ? droid(index + 1) : index % 10 == 0 ? "R2" : droid(index);
+		ElementView view = db->getView(key);
+		compressed += view.isCompressed();
+		stored += view.storedData().size();
+		data += view.data().size();
+		identical += view.data() == expected && db->getDataRaw(key).getDataView() == expected;
+	}
+	Codec::Stats stats = db->compressionStats();
+	std::cout << "\n > Compressed : " << compressed << " of 1000, Data read back identical : " << identical;
+	std::cout << "\n > Stored Bytes smaller than Data : " << (stored < data) << ", Ratio above 2 : " << ((double)(stats.dataBytes - start.dataBytes) / (stats.frameBytes - start.frameBytes) > 2);
+	std::cout << "\n > Decompressions counted : " << (stats.decompressions > start.decompressions) << ", Time counted : " << (stats.compressNanos > start.compressNanos);
+	db->saveSnapshot(path);
+	for (int index = 1; index < 1000; index += 5)
+		db->update("droid" + std::to_string(index), DBElement(droid(index + 2), { "Droid", "Protocol" }));
+	std::string before = droidContents(db, 1000);
+	delete db;
+
+	config.snapshot = path;
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Restored from Snapshot and Write Ahead Log, identical : " << (droidContents(db, 1000) == before);
+	std::cout << "\n > Restored DBElements Compressed : " << db->getView("droid1").isCompressed() << ", Short Data Compressed : " << db->getView("droid10").isCompressed() << std::endl;
+	delete db;
+	std::remove(wal);
+	std::remove(path);
 	putline();
+}
 
-	StringHelper::Title("Test Show whole database", '~');
-	std::cout << "\n" << db->show();
-	
-	StringHelper::Title("Test Show database objects with keys : { 'key0', 'key3', 'key4' }", '~');
-	std::cout << "\n" << db->show(std::unordered_set<std::string>({ "key0", "key3", "key4" }));
+/// <summary>
+/// Function to Test Keys which Expire : Deadlines kept by Mutations and Restarts,
+/// Expired Keys missing on access, Removed by the background Thread and Inserted
+/// again.
+/// </summary>
+void testExpiry() {
+	StringHelper::Title("Test Key Expiry");
+	const char * wal = "DBEngine.test.wal";
+	const char * path = "DBEngine.test.snapshot";
+	std::remove(wal);
+	std::remove(path);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	config.expiryTickMillis = 10;
+	DBEngine * db = new DBEngine("anonymous", config);
+	long long int deadline = TimingWheel::now() + 500;
+	for (int index = 0; index < 100; index++) {
+		DBElement element("Droid", { "Droid" });
+		if (index % 2 == 0)
+			element.setExpiry(deadline);
+		db->insert("droid" + std::to_string(index), std::move(element));
+	}
+	db->insert("luke", DBElement("Jedi"));
+	db->setExpiry("luke", deadline);
+	db->insert("leia", DBElement("Princess"));
+	db->setExpiry("leia", deadline);
+	db->setExpiry("leia", 0);
+	db->addTag("droid0", "Astromech");
+	std::cout << "\n > Objects : " << db->size() << ", droid0 Exists before Deadline : " << db->exists("droid0");
+	std::cout << "\n > Deadline kept by addTag : " << (db->getDataRaw("droid0").getExpiry() == deadline);
+	db->saveSnapshot(path);
+	db->updateData("droid2", "R2-D2");
+	delete db;
+
+	config.snapshot = path;
+	db = new DBEngine("anonymous", config);
+	bool kept = db->getDataRaw("droid0").getExpiry() == deadline && db->getDataRaw("droid2").getExpiry() == deadline && db->getDataRaw("luke").getExpiry() == deadline;
+	std::cout << "\n > Deadlines kept by Snapshot and Replay : " << kept << ", Cleared Deadline kept : " << (db->getDataRaw("leia").getExpiry() == 0);
+	long long int wait = deadline + 1 - TimingWheel::now();
+	if (wait > 0)
+		std::this_thread::sleep_for(std::chrono::milliseconds(wait));
+	std::cout << "\n > After Deadline droid0 Exists : " << db->exists("droid0") << ", droid4 Data : " << db->getDataRaw("droid4").getData() << ", droid1 Exists : " << db->exists("droid1");
+	std::cout << "\n > Insert over Expired Key : " << db->insert("droid6", DBElement("Protocol Droid")) << ", Update of Expired Key : " << db->update("droid8", DBElement("Protocol Droid"));
+	for (int retry = 0; retry < 200 && db->size() != 52; retry++)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	std::cout << "\n > Objects after background Removal : " << db->size() << ", Keys with Tag Astromech : " << db->getKeysWithTag("Astromech").size();
+	delete db;
+
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Expired Key Exists after Restart : " << db->exists("droid10") << ", Inserted Key Exists : " << db->exists("droid6") << std::endl;
+	delete db;
+	std::remove(wal);
+	std::remove(path);
 	putline();
+}
 
-	StringHelper::Title("Test Show Database Using Matching Tag Function", '~');
-	std::cout << "\n Show Objects with Tag \"Machine\"\n";
-	std::cout << "\n" << db->showUsingTag("Machine");
+/// <summary>
+/// Function to Test the Memory Limit with every Eviction Policy : a Cache which Reads
+/// a Key before Inserting it is fed a stream of new Keys while a set of hot Keys is
+/// Read often. The Limit must hold, the hot Keys must survive, the Tag Index must
+/// match the Keys left and Evictions must survive a Restart. TinyLFU Rejects most
+/// new Keys instead of Evicting.
+/// </summary>
+void testEviction() {
+	StringHelper::Title("Test Memory Limit and Eviction");
+	const char * wal = "DBEngine.test.wal";
+	const char * names[] = { "LRU", "LFU", "TinyLFU" };
+	std::string data(100, 'x');
+	for (Eviction::Policy policy : { Eviction::LRU, Eviction::LFU, Eviction::TINYLFU }) {
+		std::remove(wal);
+		DBEngineConfig config(4);
+		config.wal.path = wal;
+		config.eviction.memoryLimit = 64 << 10;
+		config.eviction.policy = policy;
+		config.eviction.samples = 16;
+		config.eviction.clockMillis = 1;
+		DBEngine * db = new DBEngine("anonymous", config);
+		for (int index = 0; index < 100; index++)
+			db->insert("hot" + std::to_string(index), DBElement(data, { "Hot" }));
+		for (int round = 0; round < 40; round++) {
+			for (int index = 0; index < 50; index++) {
+				std::string key = "cold" + std::to_string(round * 50 + index);
+				if (!db->exists(key))
+					db->insert(key, DBElement(data, { "Cold" }));
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			for (int read = 0; read < 4; read++) {
+				for (int index = 0; index < 100; index++)
+					db->exists("hot" + std::to_string(index));
+			}
+		}
+		Eviction::Stats stats = db->evictionStats();
+		std::unordered_set<std::string> cold = db->getKeysWithTag("Cold");
+		size_t hot = db->getKeysWithTag("Hot").size(), size = db->size();
+		bool consistent = hot + cold.size() == size;
+		for (const std::string& key : cold)
+			consistent = consistent && db->exists(key);
+		std::cout << "\n > " << names[policy] << " : Within Limit : " << (stats.memoryBytes <= stats.memoryLimit) << ", Hot Keys kept : " << (hot >= 95)
+			<< ", Keys Evicted or Rejected : " << (policy == Eviction::TINYLFU ? stats.rejected > 0 : stats.evictions > 0) << ", Tag Index consistent : " << consistent;
+		delete db;
+		db = new DBEngine("anonymous", config);
+		std::cout << ", Objects kept by Restart : " << (db->size() == size);
+		delete db;
+	}
+	std::cout << std::endl;
+	std::remove(wal);
 	putline();
+}
+
+/// <summary>
+/// Function to Check the Keys of a Prefix or Range Scan against the Keys expected,
+/// in order.
+/// </summary>
+/// <param name="found">Keys returned by the Scan</param>
+/// <param name="expected">Keys expected, in order</param>
+/// <returns>True if they are the same Keys in the same order</returns>
+bool sameKeys(const std::vector<std::string>& found, const std::set<std::string>& expected) {
+	return found.size() == expected.size() && std::equal(found.begin(), found.end(), expected.begin());
+}
+
+/// <summary>
+/// Function to Test Prefix and Range Scans of the KeyIndex while Keys are Inserted
+/// and Removed, after a Restart, from an Attached Snapshot and without a KeyIndex.
+/// </summary>
+void testKeyIndex() {
+	StringHelper::Title("Test Ordered Prefix and Range Scans");
+	const char * wal = "DBEngine.test.wal";
+	const char * path = "DBEngine.test.snapshot";
+	std::remove(wal);
+	std::remove(path);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	DBEngine * db = new DBEngine("anonymous", config);
+	std::set<std::string> keys;
+	for (int index = 0; index < 2000; index++) {
+		std::string user = "user:" + std::to_string(index);
+		for (const std::string& key : { user + ":name", user + ":email", "order:" + std::to_string(index) }) {
+			db->insert(key, DBElement(key));
+			keys.insert(key);
+		}
+		if (index % 3 == 0) {
+			db->remove(user + ":email");
+			keys.erase(user + ":email");
+		}
+	}
+	/* Expected Keys of a Prefix or Range, from the ordered set */
+	auto prefixed = [&keys](const std::string& prefix) {
+		std::set<std::string> expected;
+		for (auto key = keys.lower_bound(prefix); key != keys.end() && key->compare(0, prefix.size(), prefix) == 0; ++key)
+			expected.insert(*key);
+		return expected;
+	};
+	auto ranged = [&keys](const std::string& from, const std::string& to) {
+		return std::set<std::string>(keys.lower_bound(from), keys.upper_bound(to));
+	};
+	std::vector<std::string> user12 = db->getKeysByPrefix("user:12");
+	std::cout << "\n > Prefix \"user:12\" : " << user12.size() << " Keys, first : " << user12.front() << ", in order : " << sameKeys(user12, prefixed("user:12"));
+	std::cout << "\n > Range \"order:10\"..\"order:19\" : " << db->getKeysByRange("order:10", "order:19").size() << " Keys, in order : "
+		<< sameKeys(db->getKeysByRange("order:10", "order:19"), ranged("order:10", "order:19"));
+	std::cout << "\n > Empty Range : " << db->getKeysByRange("user", "order").empty() << ", Unknown Prefix : " << db->showByPrefix("droid");
+	std::vector<std::string> open = db->getKeysByRange("user:1999", "");
+	std::cout << "\n > Range from \"user:1999\" without end : " << open.size() << " Keys";
+	std::cout << "\n > Every Key by the empty Prefix : " << sameKeys(db->getKeysByPrefix(""), keys);
+	bool duplicate = db->insert("order:5", DBElement("again"));
+	std::cout << "\n > Duplicate Insert Rejected : " << !duplicate << ", Key still Indexed : " << sameKeys(db->getKeysByPrefix("order:5"), prefixed("order:5"))
+		<< ", every Key in order : " << sameKeys(db->getKeysByPrefix(""), keys);
+	size_t shown = db->showByPrefix("user:7:").size(), expected = db->getData("user:7:email").size() + db->getData("user:7:name").size() + 2;
+	std::cout << "\n > showByPrefix Shows the Keys in order : " << (shown == expected && db->showByPrefix("user:7:").find("user:7:email") < db->showByPrefix("user:7:").find("user:7:name"));
+	delete db;
 
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > After Replay, Prefix \"user:1\" in order : " << sameKeys(db->getKeysByPrefix("user:1"), prefixed("user:1"));
+	std::cout << "\n > Snapshot Saved : " << db->saveSnapshot(path);
+	delete db;
+
+	config.snapshot = path;
+	db = new DBEngine("anonymous", config);
+	db->remove("user:10:name");
+	keys.erase("user:10:name");
+	db->insert("user:10:nickname", DBElement("Ten"));
+	keys.insert("user:10:nickname");
+	std::cout << "\n > Attached Snapshot, Prefix \"user:10\" in order : " << sameKeys(db->getKeysByPrefix("user:10"), prefixed("user:10"))
+		<< ", every Key in order : " << sameKeys(db->getKeysByPrefix(""), keys);
+	delete db;
+
+	config.keyIndex = false;
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > Without KeyIndex, Range \"user:5\"..\"user:6\" in order : " << sameKeys(db->getKeysByRange("user:5", "user:6"), ranged("user:5", "user:6")) << std::endl;
+	delete db;
+	std::remove(wal);
+	std::remove(path);
+	putline();
 }
 
 /// <summary>
-/// Function to Test Methods which perform Operations on Tags.
+/// Function to Test looking up Keys by Prefixes and Glob Patterns of Hierarchical
+/// Tags across Shards.
 /// </summary>
-/// <param name="db">DBENgine</param>
-void testTagOperations(DBEngine * db) {
-	StringHelper::Title("Test Show Functions");
-	StringHelper::Title("Test Add Tag Function", '~');
-	std::cout << "\n Before Adding Tag\n\n" << db->getData("key3") << std::endl;
-	std::cout << "\n > Add tag \"Wayatt\" to \"Key3\"";
-	db->addTag("key3", "Wayatt");
-	std::cout << "\n After Adding Tag\n\n" << db->getData("key3");
+void testTagPatterns() {
+	StringHelper::Title("Test Tag Prefix and Glob Lookups");
+	DBEngine * db = new DBEngine("anonymous", 4);
+	const char * regions[] = { "region/us/east", "region/us/west", "region/eu/east", "region/eu/west", "region/apac" };
+	for (int index = 0; index < 500; index++)
+		db->insert("server" + std::to_string(index), DBElement("Server", { regions[index % 5], index % 2 == 0 ? "tier/web" : "tier/db" }));
+	db->removeTag("server0", "region/us/east");
+	db->remove("server5");
+	std::cout << "\n > Tag Prefix \"region/us/\" : " << db->getKeysWithTagPrefix("region/us/").size() << " Keys"
+		<< ", \"region/\" : " << db->getKeysWithTagPrefix("region/").size() << " Keys";
+	std::cout << "\n > Tag Glob \"region/*/east\" : " << db->getKeysWithTagGlob("region/*/east").size() << " Keys"
+		<< ", \"region/*\" : " << db->getKeysWithTagGlob("region/*").size() << " Keys"
+		<< ", \"**/web\" : " << db->getKeysWithTagGlob("**/web").size() << " Keys";
+	std::unordered_set<std::string> east = db->getKeysWithTagGlob("region/?\?/east");
+	bool exact = east.size() == db->getKeysWithTag("region/us/east").size() + db->getKeysWithTag("region/eu/east").size();
+	std::cout << "\n > Glob equals the Union of the matching Tags : " << exact << ", Unknown Prefix : " << db->showUsingTagPrefix("zone/") << std::endl;
+	delete db;
 	putline();
+}
 
-	StringHelper::Title("Test Remove Tag Function", '~');
-	std::cout << "\n Before removing Tag\n\n" << db->getData("key3") << std::endl;
-	std::cout << "\n > Remove tag \"Wayatt\" to \"Key3\"";
-	db->removeTag("key3", "Wayatt");
-	std::cout << "\n After Removing Tag\n\n" << db->getData("key3");
+/// <summary>
+/// Function to Test the Time Index : Keys Modified since or between Timestamps and the
+/// most recently Modified Keys, with and without a Tag, while Keys are Updated and
+/// Removed, after a Restart and from an Attached Snapshot.
+/// </summary>
+void testTimeIndex() {
+	StringHelper::Title("Test Time Index Queries");
+	const char * wal = "DBEngine.test.wal";
+	const char * path = "DBEngine.test.snapshot";
+	std::remove(wal);
+	std::remove(path);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	DBEngine * db = new DBEngine("anonymous", config);
+	/* One Key per second from 01/01/2000 00:00:00, so Timestamps and Keys sort alike */
+	auto stampOf = [](int index) { return 20000101000000LL + (index / 60) * 100 + index % 60; };
+	auto events = [](std::initializer_list<int> indexes) {
+		std::vector<std::string> keys;
+		for (int index : indexes)
+			keys.push_back("event" + std::to_string(index));
+		return keys;
+	};
+	for (int index = 0; index < 300; index++) {
+		std::unordered_set<std::string> tags = { index % 2 == 0 ? "even" : "odd" };
+		if (index % 50 == 0)
+			tags.insert("rare");
+		DBElement element("Event", tags);
+		element.setlastModified(stampOf(index));
+		db->insert("event" + std::to_string(index), element);
+	}
+	std::vector<std::string> since = db->getKeysModifiedSince(stampOf(295));
+	std::cout << "\n > Modified since " << stampOf(295) << " : " << since.size() << " Keys, oldest first : " << (since == events({ 295, 296, 297, 298, 299 }));
+	std::vector<std::string> between = db->getKeysModifiedBetween(stampOf(100), stampOf(109));
+	std::cout << "\n > Modified between " << stampOf(100) << " and " << stampOf(109) << " : " << between.size() << " Keys, first : " << between.front()
+		<< ", Reversed Range empty : " << db->getKeysModifiedBetween(stampOf(109), stampOf(100)).empty();
+	std::cout << "\n > 5 most Recent : " << (db->getKeysRecentlyModified(5) == events({ 299, 298, 297, 296, 295 }))
+		<< ", 3 most Recent with Tag \"odd\" : " << (db->getKeysRecentlyModified(3, "odd") == events({ 299, 297, 295 }))
+		<< ", 10 most Recent with Tag \"rare\" : " << (db->getKeysRecentlyModified(10, "rare") == events({ 250, 200, 150, 100, 50, 0 }));
+	std::cout << "\n > Unknown Tag : " << db->showRecentlyModified(3, "droid");
+	db->updateData("event0", "Updated");
+	db->remove("event299");
+	std::vector<std::string> recent = db->getKeysRecentlyModified(3);
+	std::cout << "\n > After Updating event0 and Removing event299, 3 most Recent : " << (recent == events({ 0, 298, 297 }))
+		<< ", Modified since " << stampOf(295) << " : " << db->getKeysModifiedSince(stampOf(295)).size() << " Keys";
+	delete db;
+
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > After Replay, 3 most Recent : " << (db->getKeysRecentlyModified(3) == recent)
+		<< ", Modified between : " << (db->getKeysModifiedBetween(stampOf(100), stampOf(109)) == between);
+	std::cout << "\n > Snapshot Saved : " << db->saveSnapshot(path);
+	delete db;
+
+	config.snapshot = path;
+	db = new DBEngine("anonymous", config);
+	DBElement late("Late", { "odd" });
+	late.setlastModified(stampOf(299));
+	db->insert("event999", late);
+	std::cout << "\n > Attached Snapshot, 3 most Recent : " << (db->getKeysRecentlyModified(3) == events({ 0, 999, 298 }))
+		<< ", 2 most Recent with Tag \"odd\" : " << (db->getKeysRecentlyModified(2, "odd") == events({ 999, 297 }))
+		<< ", Modified between : " << (db->getKeysModifiedBetween(stampOf(100), stampOf(109)) == between) << std::endl;
+	delete db;
+	std::remove(wal);
+	std::remove(path);
 	putline();
+}
 
-	StringHelper::Title("Test Get Keys with Tag Function", '~');
-	std::cout << "\n Get all keys with Tag : \"Star Wars\"";
-	{
-		std::cout << "\n > Keys : ";
-		bool first = true;
-		for (std::string key : db->getKeysWithTag("Star Wars")) {
-			if (first) {
-				first = false;
-				std::cout << "\"" << key << "\"";
-			}
-			else {
-				std::cout << ", \"" << key << "\"";
-			}
+/// <summary>
+/// Function to Test Reads Pinned at a Sequence Number while Writers Update,
+/// Remove and Insert Keys.
+/// </summary>
+void testMultiVersion() {
+	StringHelper::Title("Test Multi-Version Reads");
+	DBEngineConfig config(4);
+	config.versionMillis = 10;
+	DBEngine * db = new DBEngine("anonymous", config);
+	auto countKeys = [](const std::string& shown) {
+		size_t count = 0;
+		for (size_t at = shown.find(" Key : "); at != std::string::npos; at = shown.find(" Key : ", at + 1))
+			count++;
+		return count;
+	};
+	for (int index = 0; index < 100; index++)
+		db->insert("version" + std::to_string(index), DBElement("Old", { "old" }));
+	uint64_t sequence = db->beginRead();
+	db->updateData("version0", "New");
+	db->removeTag("version1", "old");
+	db->addTag("version1", "new");
+	db->remove("version2");
+	db->insert("version100", DBElement("New", { "new" }));
+	std::cout << "\n > Pinned Read of Updated Key sees Old Data : " << (db->getDataAt("version0", sequence).find("Old") != std::string::npos)
+		<< ", of Removed Key finds it : " << (db->getDataAt("version2", sequence) != "Invalid Key")
+		<< ", of Inserted Key misses it : " << (db->getDataAt("version100", sequence) == "Invalid Key");
+	std::cout << "\n > Current Read of Updated Key sees New Data : " << (db->getData("version0").find("New") != std::string::npos)
+		<< ", Versions kept : " << (db->versionCount() > 0);
+	/* version1 lost the Tag and version2 was Removed, their old Versions must not Match */
+	std::string tagged = db->showUsingTag("old");
+	std::string expression = db->showUsingTags("new & !old");
+	std::cout << "\n > Keys with Tag \"old\" : " << countKeys(tagged)
+		<< ", matching \"new & !old\" : " << countKeys(expression);
+	std::atomic<bool> stop(false);
+	std::thread writer([db, &stop]() {
+		for (int round = 0; !stop.load(); round++) {
+			std::string key = "version" + std::to_string(3 + round % 97);
+			db->updateData(key, "Churn");
+			/* Removed and Inserted again by one Batch, so every Sequence Number sees 100 Keys */
+			WriteBatch batch;
+			batch.remove(key);
+			batch.insert(key, DBElement("Churn", { "new" }));
+			db->write(batch);
 		}
-		std::cout << "\n\n";
+	});
+	/* Scans Pin their own Sequence Number, so they can not see half of the Writer's Rounds */
+	size_t consistent = 0, scans = 0, duplicated = 0;
+	for (int round = 0; round < 20; round++) {
+		size_t keys = countKeys(db->show());
+		if (keys == 100)
+			consistent++;
+		std::string next;
+		size_t counts[] = { db->getKeysByPrefix("version").size(), countKeys(db->showByRange("version", "versioo")),
+			db->getKeysModifiedSince(0).size(), countKeys(db->showPage("", 200, next, "version")) };
+		if (std::all_of(std::begin(counts), std::end(counts), [](size_t count) { return count == 100; }))
+			scans++;
+		duplicated += (keys > 100) + std::count_if(std::begin(counts), std::end(counts), [](size_t count) { return count > 100; });
 	}
+	stop.store(true);
+	writer.join();
+	std::cout << "\n > Full Scans with exactly 100 Keys during Writes : " << consistent << " of 20"
+		<< ", Key, Time and Paged Scans : " << scans << " of 20, Scans with more than 100 Keys (must be 0) : " << duplicated;
+	db->endRead(sequence);
+	db->collectVersions();
+	std::cout << "\n > After End of Read, Versions kept : " << db->versionCount();
+	/* Versions kept for a Reader which Ended must still be Freed by later Updates and Removes */
+	EpochManager::instance().synchronize();
+	size_t blocks = db->allocatorStats().liveBlocks;
+	for (int round = 0; round < 1000; round++) {
+		uint64_t pinned = db->beginRead();
+		db->updateData("version0", "Pinned");
+		db->updateData("version1", "Pinned");
+		db->endRead(pinned);
+		db->updateData("version0", "Unpinned");
+		db->remove("version1");
+		db->insert("version1", DBElement("Unpinned"));
+	}
+	db->collectVersions();
+	EpochManager::instance().synchronize();
+	std::cout << "\n > After 1000 Pinned and Unpinned Updates, Versions kept : " << db->versionCount()
+		<< ", Blocks leaked : " << (db->allocatorStats().liveBlocks > blocks) << std::endl;
+	delete db;
+	putline();
 }
 
 /// <summary>
-/// Function to Test Methods which perform Update and Delete Operations.
+/// Function to Test WriteBatches : Applied All-or-Nothing, Logged as one Record and
+/// seen whole by Pinned Readers.
 /// </summary>
-/// <param name="db">DBEngine</param>
-void testUpdateDelete(DBEngine * db) {
-	StringHelper::Title("Test Update and Delete Functions");
-	StringHelper::Title("Test Update Function", '-');
-	std::cout << "\n > Before Updating Object with Key : \"key2\"\n" << db->getData("key2") << std::endl;
-	std::cout << "\n Update \"key2\"'s Object in the Database";
-	db->update("key2", DBElement("Deckard", std::unordered_set<std::string>({ "Replicant", "Blade Runner", "Data", "AI", "Machine" })));
-	std::cout << "\n > After Updating Object with Key : \"key2\"\n" << db->getData("key2") << std::endl;
+void testWriteBatch() {
+	StringHelper::Title("Test WriteBatch");
+	const char * wal = "DBEngine.test.wal";
+	std::remove(wal);
+	DBEngineConfig config(4);
+	config.wal.path = wal;
+	DBEngine * db = new DBEngine("anonymous", config);
+	db->insert("sibling", DBElement("Old Sibling", { "Family" }));
+	db->insert("stale", DBElement("Stale"));
+	uint64_t records = db->logStats().records;
+	WriteBatch batch;
+	batch.insert("host", DBElement("Dolores", { "Host" }));
+	batch.addTag("host", "Westworld");
+	batch.updateData("sibling", "New Sibling");
+	batch.remove("stale");
+	batch.insert("stale", DBElement("Fresh"));
+	std::cout << "\n > Batch of 5 Writes Applied : " << db->write(batch) << ", Batch Cleared : " << batch.empty()
+		<< ", Log Records : " << db->logStats().records - records;
+	std::cout << "\n > host Tagged : " << db->getDataRaw("host").tagExist("Westworld") << ", sibling Updated : " << (db->getDataRaw("sibling").getData() == "New Sibling")
+		<< ", stale Replaced : " << (db->getDataRaw("stale").getData() == "Fresh");
+	batch.insert("droid", DBElement("R2-D2"));
+	batch.updateData("missing", "Nothing");
+	std::cout << "\n > Batch Updating a missing Key Applied : " << db->write(batch) << ", it's Insert left out : " << !db->exists("droid");
+	batch.remove("host");
+	batch.addTag("host", "Again");
+	std::cout << "\n > Batch Tagging a Key it Removed Applied : " << db->write(batch) << ", host kept : " << db->exists("host");
+	delete db;
+
+	db = new DBEngine("anonymous", config);
+	std::cout << "\n > After Replay, host Tagged : " << db->getDataRaw("host").tagExist("Westworld") << ", stale : " << db->getDataRaw("stale").getData()
+		<< ", droid : " << db->exists("droid");
+	/* Every Batch sets all Keys to the same Data, a Pinned Reader must never see the first and last differ */
+	for (int index = 0; index < 64; index++)
+		db->insert("batched" + std::to_string(index), DBElement("0"));
+	std::atomic<int> batches(0);
+	std::thread writer([db, &batches]() {
+		WriteBatch batch;
+		for (int round = 1; round <= 500; round++) {
+			for (int index = 0; index < 64; index++)
+				batch.updateData("batched" + std::to_string(index), std::to_string(round));
+			db->write(batch);
+			batches.store(round);
+		}
+	});
+	auto dataOf = [](const std::string& shown) {
+		size_t start = shown.find("Data      : ");
+		return shown.substr(start, shown.find('\n', start) - start);
+	};
+	size_t torn = 0, reads = 0;
+	while (batches.load() < 500) {
+		/* Sleep a little so the Reads do not fall into step with the Batches */
+		std::this_thread::sleep_for(std::chrono::microseconds(reads++ % 7 * 10));
+		uint64_t sequence = db->beginRead();
+		if (dataOf(db->getDataAt("batched0", sequence)) != dataOf(db->getDataAt("batched63", sequence)))
+			torn++;
+		db->endRead(sequence);
+	}
+	writer.join();
+	std::cout << "\n > Pinned Reads during 500 Batches which saw part of one : " << torn << ", Reads done : " << (reads > 0) << std::endl;
+	delete db;
+	std::remove(wal);
 	putline();
+}
 
-	StringHelper::Title("Test Delete Function", '-');
-	std::cout << "\n > Object with \"key2\" Exists in Database ? " << db->exists("key2") << std::endl;
-	std::cout << "\n Removing Oject with \"key2\" from Database";
-	db->remove("key2");
-	std::cout << "\n > Object with \"key2\" Exists in Database ? " << db->exists("key2") << std::endl;
+/// <summary>
+/// Function to Test Pipelined Lookups of many Keys and WriteBatch puts.
+/// </summary>
+void testMultiGet() {
+	StringHelper::Title("Test Lookups of many Keys");
+	DBEngine * db = new DBEngine("anonymous", 4);
+	for (int index = 0; index < 1000; index++)
+		db->insert("key" + std::to_string(index), DBElement("value" + std::to_string(index)));
+	/* Every third Key is missing, more Keys than one Lookup window */
+	std::vector<std::string> keys;
+	for (int index = 0; index < 300; index++)
+		keys.push_back(index % 3 == 2 ? "missing" + std::to_string(index) : "key" + std::to_string(index * 7 % 1000));
+	size_t mismatches = 0, found = 0;
+	{
+		std::vector<ElementView> views = db->getViews(keys);
+		for (size_t index = 0; index < keys.size(); index++) {
+			ElementView view = db->getView(keys[index]);
+			if (views[index].valid() != view.valid() || (view.valid() && views[index].data() != view.data()))
+				mismatches++;
+			found += views[index].valid() ? 1 : 0;
+		}
+	}
+	std::cout << "\n > getViews of " << keys.size() << " Keys, found : " << found << ", different from getView : " << mismatches;
+	std::cout << "\n > getData({ key5, missing, key6 }) :\n\n" << db->getData(std::vector<std::string>{ "key5", "missing", "key6" });
+	WriteBatch batch;
+	batch.put("key1", DBElement("Replaced"));
+	batch.put("key1000", DBElement("Added"));
+	std::cout << " > Batch putting an existing and a new Key Applied : " << db->write(batch) << ", key1 : " << db->getDataRaw("key1").getData()
+		<< ", key1000 : " << db->getDataRaw("key1000").getData() << std::endl;
+	delete db;
 	putline();
 }
 
 /// <summary>
-/// Function to Test DBElement Package.
+/// Function to Test Paged Reads with a Cursor, with and without the KeyIndex, while
+/// a Writer Inserts and Removes other Keys.
 /// </summary>
-/// <param name="argc">Argument Count</param>
-/// <param name="argv">Arguments</param>
-/// <returns></returns>
+void testPagedShow() {
+	StringHelper::Title("Test Paged Show with a Cursor");
+	for (bool indexed : { true, false }) {
+		DBEngineConfig config(4);
+		config.keyIndex = indexed;
+		DBEngine * db = new DBEngine("anonymous", config);
+		for (int index = 0; index < 500; index++)
+			db->insert("page" + std::to_string(index), DBElement("value", { index % 5 == 0 ? "Fifth" : "Other" }));
+		std::atomic<bool> stop(false);
+		std::thread writer([db, &stop]() {
+			for (int round = 0; !stop.load(); round++) {
+				std::string key = "churn" + std::to_string(round % 50);
+				db->insert(key, DBElement("Churn"));
+				db->remove(key);
+			}
+		});
+		/* Keys present during the whole walk must be Shown once each and in order */
+		std::string cursor, next, last;
+		size_t pages = 0, shown = 0, largest = 0;
+		bool ordered = true;
+		do {
+			std::string page = db->showPage(cursor, 64, next, "page");
+			largest = std::max(largest, page.size());
+			for (size_t at = page.find(" Key : "); at != std::string::npos; at = page.find(" Key : ", at + 1)) {
+				std::string key = page.substr(at + 7, page.find('\n', at) - at - 7);
+				ordered = ordered && key > last;
+				last = key;
+				shown++;
+			}
+			cursor = next;
+			pages++;
+		} while (!cursor.empty());
+		stop.store(true);
+		writer.join();
+		size_t tagged = 0, tagPages = 0;
+		cursor.clear();
+		do {
+			tagged += db->getKeysWithTagPage("Fifth", cursor, 30).size();
+			db->showUsingTagPage("Fifth", cursor, 30, next);
+			cursor = next;
+			tagPages++;
+		} while (!cursor.empty());
+		std::cout << "\n > " << (indexed ? "With KeyIndex    " : "Without KeyIndex") << " : Pages : " << pages << ", Keys Shown : " << shown
+			<< ", in order : " << ordered << ", Largest Page under 8 KB : " << (largest < 8192)
+			<< ", Keys with Tag \"Fifth\" in Pages of 30 : " << tagged << " in " << tagPages << " Pages";
+		std::cout << "\n > Page after the last Key is empty : " << db->getKeysPage("page99", 10, "page").empty()
+			<< ", first Page of 3 : ";
+		for (const std::string& key : db->getKeysPage("", 3))
+			std::cout << key << " ";
+		delete db;
+	}
+	std::cout << std::endl;
+	putline();
+}
+
 int main(int argc, char* argv[]) {
 	Timer time;
 	time.StartClock();
@@ -438,6 +4396,26 @@ int main(int argc, char* argv[]) {
 	testShow(db);
 	testTagOperations(db);
 	testUpdateDelete(db);
+	testShards();
+	testLockFreeReads();
+	testAllocator();
+	testAllocationFreeReads();
+	testElementView();
+	testWriteAheadLog();
+	testSnapshot();
+	testBackgroundSnapshot();
+	testLSMTree(0);
+	testLSMTree(8);
+	testCompression();
+	testExpiry();
+	testEviction();
+	testKeyIndex();
+	testTagPatterns();
+	testTimeIndex();
+	testMultiVersion();
+	testWriteBatch();
+	testMultiGet();
+	testPagedShow();
 	
 	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
 	std::cout << "\n ";
@@ -445,3 +4423,580 @@ int main(int argc, char* argv[]) {
 }
 
 #endif // TEST_DBENGINE
+
+#ifdef BENCH_DBENGINE
+
+#include <list>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <algorithm>
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Measure Read Throughput of a DBEngine using given Number of Threads.
+/// Every Thread performs Point Lookups (getDataRaw) on random Keys for the given Duration.
+/// </summary>
+/// <param name="db">Populated DBEngine</param>
+/// <param name="keys">Number of Keys present in the DBEngine</param>
+/// <param name="threads">Number of Reader Threads</param>
+/// <param name="duration">Duration of the Run in milliseconds</param>
+/// <returns>Reads performed per second</returns>
+double benchReads(DBEngine * db, size_t keys, size_t threads, int duration) {
+	std::atomic<bool> stop(false);
+	std::atomic<size_t> total(0);
+	std::vector<std::thread> readers;
+	for (size_t id = 0; id < threads; id++) {
+		readers.push_back(std::thread([db, keys, id, &stop, &total]() {
+			std::mt19937_64 random(id + 1);
+			size_t reads = 0, found = 0;
+			while (!stop.load(std::memory_order_relaxed)) {
+				for (int batch = 0; batch < 256; batch++) {
+					if (db->exists("key" + std::to_string(random() % keys)))
+						found++;
+				}
+				reads += 256;
+			}
+			total += reads;
+			if (found == 0)
+				std::cout << "\n No Keys Found";
+		}));
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(duration));
+	stop = true;
+	for (std::thread& reader : readers)
+		reader.join();
+	return total * 1000.0 / duration;
+}
+
+/// <summary>
+/// Function to Measure Read Latency Percentiles while a Writer continuously Updates
+/// the Keys being Read.
+/// </summary>
+/// <param name="db">Populated DBEngine</param>
+/// <param name="keys">Number of Keys present in the DBEngine</param>
+/// <param name="threads">Number of Reader Threads</param>
+/// <param name="duration">Duration of the Run in milliseconds</param>
+void benchReadLatency(DBEngine * db, size_t keys, size_t threads, int duration) {
+	std::atomic<bool> stop(false);
+	std::mutex samplesLock;
+	std::vector<long long> samples;
+	std::vector<std::thread> readers;
+	for (size_t id = 0; id < threads; id++) {
+		readers.push_back(std::thread([db, keys, id, &stop, &samplesLock, &samples]() {
+			std::mt19937_64 random(id + 1);
+			std::vector<long long> local;
+			while (!stop.load(std::memory_order_relaxed)) {
+				std::string key = "key" + std::to_string(random() % keys);
+				auto start = std::chrono::steady_clock::now();
+				DBElement value = db->getDataRaw(key);
+				local.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+			}
+			std::lock_guard<std::mutex> lock(samplesLock);
+			samples.insert(samples.end(), local.begin(), local.end());
+		}));
+	}
+	std::thread writer([db, keys, &stop]() {
+		std::mt19937_64 random(99);
+		while (!stop.load(std::memory_order_relaxed))
+			db->updateData("key" + std::to_string(random() % keys), "updated");
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(duration));
+	stop = true;
+	writer.join();
+	for (std::thread& reader : readers)
+		reader.join();
+	std::sort(samples.begin(), samples.end());
+	std::cout << "\n Reads : " << samples.size() << "\t p50 : " << samples[samples.size() / 2]
+		<< " ns\t p99 : " << samples[samples.size() * 99 / 100] << " ns\t p99.9 : "
+		<< samples[samples.size() * 999 / 1000] << " ns";
+}
+
+/// <summary>
+/// Function to Compare the Cost of Reading large Values by Copying them out using
+/// getDataRaw against Reading them in place using getView.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="size">Size of every Value in Bytes</param>
+/// <param name="reads">Number of Reads using each Method</param>
+void benchCopyVsView(size_t keys, size_t size, size_t reads) {
+	DBEngine * db = new DBEngine("benchmark", 16);
+	for (size_t index = 0; index < keys; index++)
+		db->insert("key" + std::to_string(index), DBElement(std::string(size, 'a' + index % 26), { "Data", "Large" }));
+	std::vector<std::string> names;
+	for (size_t index = 0; index < reads; index++)
+		names.push_back("key" + std::to_string((index * 7919) % keys));
+	size_t checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (const std::string& key : names) {
+		DBElement value = db->getDataRaw(key);
+		checksum += value.getDataView()[size / 2];
+	}
+	double copy = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	start = std::chrono::steady_clock::now();
+	for (const std::string& key : names) {
+		ElementView view = db->getView(key);
+		checksum += view.data()[size / 2];
+	}
+	double view = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "\n Value Size : " << size << " B\t getDataRaw : " << copy << " ms\t getView : " << view
+		<< " ms\t Speedup : " << copy / view << (checksum == 0 ? " " : "");
+	delete db;
+}
+
+/// <summary>
+/// Function to Measure Write Latency of Threads Updating random Keys until stop is set.
+/// </summary>
+/// <param name="db">Populated DBEngine</param>
+/// <param name="keys">Number of Keys present in the DBEngine</param>
+/// <param name="threads">Number of Writer Threads</param>
+/// <param name="stop">Flag which ends the Run</param>
+/// <param name="samplesLock">Lock guarding the Samples</param>
+/// <param name="samples">Filled with the Latency of every Write in nanoseconds</param>
+/// <returns>Threads which are Writing, to be joined once stop is set</returns>
+std::vector<std::thread> startWriters(DBEngine * db, size_t keys, size_t threads, std::atomic<bool>& stop, std::mutex& samplesLock, std::vector<long long>& samples) {
+	std::vector<std::thread> writers;
+	for (size_t id = 0; id < threads; id++) {
+		writers.push_back(std::thread([db, keys, id, &stop, &samplesLock, &samples]() {
+			std::mt19937_64 random(id + 7);
+			std::vector<long long> local;
+			while (!stop.load(std::memory_order_relaxed)) {
+				std::string key = "key" + std::to_string(random() % keys);
+				auto start = std::chrono::steady_clock::now();
+				db->updateData(key, "updated while snapshotting");
+				local.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+			}
+			std::lock_guard<std::mutex> lock(samplesLock);
+			samples.insert(samples.end(), local.begin(), local.end());
+		}));
+	}
+	return writers;
+}
+
+/// <summary>
+/// Function to Measure the Write Latency added by a background Snapshot. Writers
+/// Update random Keys while the Snapshot is Written, then for the same Duration
+/// without a Snapshot.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="threads">Number of Writer Threads</param>
+void benchBackgroundSnapshot(size_t keys, size_t threads) {
+	const char * path = "DBEngine.bench.snapshot";
+	DBEngine * db = new DBEngine("benchmark", 16);
+	for (size_t index = 0; index < keys; index++)
+		db->insert("key" + std::to_string(index), DBElement(std::string(100, 'a' + index % 26), { "Data" }));
+	double duration = 0;
+	for (bool snapshot : { true, false }) {
+		std::atomic<bool> stop(false);
+		std::mutex samplesLock;
+		std::vector<long long> samples;
+		std::vector<std::thread> writers = startWriters(db, keys, threads, stop, samplesLock, samples);
+		if (snapshot) {
+			db->startSnapshot(path);
+			db->waitSnapshot();
+			duration = db->snapshotStats().durationMillis;
+		} else {
+			std::this_thread::sleep_for(std::chrono::microseconds((long long)(duration * 1000)));
+		}
+		stop = true;
+		for (std::thread& writer : writers)
+			writer.join();
+		std::sort(samples.begin(), samples.end());
+		std::cout << "\n " << (snapshot ? "During Snapshot " : "Without Snapshot") << "\t Writes : " << samples.size()
+			<< "\t p50 : " << samples[samples.size() / 2] << " ns\t p99 : " << samples[samples.size() * 99 / 100]
+			<< " ns\t Max : " << samples.back() << " ns";
+	}
+	SnapshotStats stats = db->snapshotStats();
+	std::cout << "\n Snapshot : " << (stats.succeeded ? "Written" : "Failed") << "\t Duration : " << stats.durationMillis
+		<< " ms\t Writers Paused : " << stats.pauseMillis << " ms\t Bytes : " << stats.bytes
+		<< "\t Records : " << stats.records << "\t Old Versions Preserved : " << stats.preserved;
+	delete db;
+	std::remove(path);
+}
+
+/// <summary>
+/// Function to Generate a Trace of Key Ranks following a Zipfian Distribution, rank
+/// r being Requested with Probability proportional to 1 / (r + 1)^skew.
+/// </summary>
+/// <param name="keys">Number of distinct Keys</param>
+/// <param name="requests">Length of the Trace</param>
+/// <param name="skew">Zipf Exponent</param>
+/// <returns>Ranks of the Requested Keys</returns>
+std::vector<uint32_t> zipfTrace(size_t keys, size_t requests, double skew) {
+	std::vector<double> cdf(keys);
+	double sum = 0;
+	for (size_t rank = 0; rank < keys; rank++)
+		cdf[rank] = sum += 1.0 / std::pow((double)(rank + 1), skew);
+	std::mt19937_64 random(7);
+	std::uniform_real_distribution<double> uniform(0, sum);
+	std::vector<uint32_t> trace(requests);
+	for (uint32_t& rank : trace)
+		rank = (uint32_t)(std::lower_bound(cdf.begin(), cdf.end(), uniform(random)) - cdf.begin());
+	return trace;
+}
+
+/// <summary>
+/// Function to Measure the Hit Ratio of every Eviction Policy on a Zipfian Trace. The
+/// DBEngine is used as a Cache which Inserts every Key it misses, and an exact LRU
+/// holding as many Keys as the Sampled LRU ended up with is Simulated for reference.
+/// </summary>
+/// <param name="keys">Number of distinct Keys</param>
+/// <param name="requests">Length of the Trace</param>
+/// <param name="skew">Zipf Exponent</param>
+/// <param name="share">Share of the Keys the Memory Limit holds</param>
+void benchEvictionHitRatio(size_t keys, size_t requests, double skew, double share) {
+	std::vector<uint32_t> trace = zipfTrace(keys, requests, skew);
+	std::vector<std::string> names(keys);
+	for (size_t rank = 0; rank < keys; rank++)
+		names[rank] = "key" + std::to_string(rank);
+	std::string data(64, 'x');
+	DBEngine * sizer = new DBEngine("benchmark");
+	sizer->insert(names[keys / 2], DBElement(data));
+	size_t perKey = sizer->evictionStats().memoryBytes;
+	delete sizer;
+	size_t capacity = 0;
+	std::cout << "\n Skew : " << skew << "\t Cache holds " << share * 100 << "% of Keys\t";
+	const char * labels[] = { "Sampled LRU", "LFU", "TinyLFU" };
+	for (Eviction::Policy policy : { Eviction::LRU, Eviction::LFU, Eviction::TINYLFU }) {
+		DBEngineConfig config(4);
+		config.eviction.memoryLimit = (size_t)(keys * share) * perKey;
+		config.eviction.policy = policy;
+		DBEngine * db = new DBEngine("benchmark", config);
+		size_t hits = 0;
+		for (uint32_t rank : trace) {
+			if (db->exists(names[rank]))
+				hits++;
+			else
+				db->insert(names[rank], DBElement(data));
+		}
+		if (policy == Eviction::LRU)
+			capacity = db->size();
+		std::cout << " " << labels[policy] << " : " << hits * 100.0 / requests << "%\t";
+		delete db;
+	}
+	std::list<uint32_t> order;
+	std::unordered_map<uint32_t, std::list<uint32_t>::iterator> cache;
+	size_t hits = 0;
+	for (uint32_t rank : trace) {
+		auto entry = cache.find(rank);
+		if (entry != cache.end()) {
+			hits++;
+			order.splice(order.begin(), order, entry->second);
+			continue;
+		}
+		order.push_front(rank);
+		cache[rank] = order.begin();
+		if (cache.size() > capacity) {
+			cache.erase(order.back());
+			order.pop_back();
+		}
+	}
+	std::cout << " Exact LRU : " << hits * 100.0 / requests << "%";
+}
+
+/// <summary>
+/// Function to Measure what recording Reads for the Eviction Policy adds to a Point
+/// Read, the best of 3 passes. The Memory Limit is about twice what the Keys take,
+/// so nothing is Evicted and the TinyLFU Sketch is sized as for a Cache of that size.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="reads">Number of Reads per Policy</param>
+void benchEvictionOverhead(size_t keys, size_t reads) {
+	std::vector<std::string> names;
+	std::mt19937_64 random(3);
+	for (size_t index = 0; index < reads; index++)
+		names.push_back("key" + std::to_string(random() % keys));
+	double baseline = 0;
+	const char * labels[] = { "No Limit", "Sampled LRU", "LFU", "TinyLFU" };
+	for (int policy = -1; policy <= Eviction::TINYLFU; policy++) {
+		DBEngineConfig config(4);
+		if (policy >= 0) {
+			config.eviction.memoryLimit = keys * 512;
+			config.eviction.policy = (Eviction::Policy)policy;
+		}
+		DBEngine * db = new DBEngine("benchmark", config);
+		for (size_t index = 0; index < keys; index++)
+			db->insert("key" + std::to_string(index), DBElement("value" + std::to_string(index)));
+		size_t found = 0;
+		double nanos = 0;
+		for (int pass = 0; pass < 3; pass++) {
+			found = 0;
+			auto start = std::chrono::steady_clock::now();
+			for (const std::string& key : names)
+				found += db->exists(key);
+			double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / reads;
+			if (pass == 0 || elapsed < nanos)
+				nanos = elapsed;
+		}
+		if (policy < 0)
+			baseline = nanos;
+		std::cout << "\n " << labels[policy + 1] << "\t Read : " << nanos << " ns\t Overhead : " << nanos - baseline << " ns"
+			<< (found == reads ? "" : "\t Keys Missing");
+		delete db;
+	}
+}
+
+/// <summary>
+/// Function to Measure Prefix Scans of about 100 Keys each with and without the
+/// KeyIndex, which has to walk and sort every Live Key of every Shard, and what
+/// keeping the KeyIndex adds to an Insert.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="scans">Number of Prefix Scans with the KeyIndex</param>
+void benchKeyIndex(size_t keys, size_t scans) {
+	std::vector<std::string> names;
+	for (size_t index = 0; index < keys; index++)
+		names.push_back("user:" + std::to_string(index) + ":name");
+	std::mt19937_64 random(5);
+	std::shuffle(names.begin(), names.end(), random);
+	double insertBaseline = 0;
+	for (bool indexed : { false, true }) {
+		DBEngineConfig config(4);
+		config.keyIndex = indexed;
+		DBEngine * db = new DBEngine("benchmark", config);
+		auto start = std::chrono::steady_clock::now();
+		for (const std::string& name : names)
+			db->insert(name, DBElement("value"));
+		double insert = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / keys;
+		if (!indexed)
+			insertBaseline = insert;
+		/* Prefixes "user:<n>" with n up to keys / 100 match about 100 Keys each */
+		size_t count = indexed ? scans : std::max<size_t>(1, scans / 1000), found = 0, prefixes = std::max<size_t>(1, keys / 100);
+		start = std::chrono::steady_clock::now();
+		for (size_t scan = 0; scan < count; scan++)
+			found += db->getKeysByPrefix("user:" + std::to_string(random() % prefixes)).size();
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "\n " << (indexed ? "KeyIndex" : "Full Walk") << "\t Insert : " << insert << " ns\t Overhead : " << insert - insertBaseline
+			<< " ns\t Scans/s : " << (size_t)(count / seconds) << "\t Keys/s : " << (size_t)(found / seconds);
+		delete db;
+	}
+}
+
+/// <summary>
+/// Function to Measure the Throughput of Writes Applied one at a time against the
+/// same Writes Applied as WriteBatches. Every Group Inserts an Object, Tags it and
+/// Updates a Sibling, like a Client which would otherwise send three Queries.
+/// </summary>
+/// <param name="groups">Number of Groups of three Writes</param>
+/// <param name="sync">SyncMode of the Write Ahead Log</param>
+/// <param name="logged">Whether the Writes are Logged at all</param>
+void benchWriteBatch(size_t groups, WriteAheadLog::SyncMode sync, bool logged) {
+	const char * wal = "DBEngine.bench.wal";
+	double single = 0;
+	for (bool batched : { false, true }) {
+		std::remove(wal);
+		DBEngineConfig config(4);
+		if (logged) {
+			config.wal.path = wal;
+			config.wal.sync = sync;
+		}
+		DBEngine * db = new DBEngine("benchmark", config);
+		for (size_t index = 0; index < groups; index++)
+			db->insert("sibling" + std::to_string(index), DBElement("sibling", { "Family" }));
+		WriteBatch batch;
+		uint64_t records = db->logStats().records, syncs = db->logStats().syncs;
+		auto start = std::chrono::steady_clock::now();
+		for (size_t index = 0; index < groups; index++) {
+			std::string key = "object" + std::to_string(index), sibling = "sibling" + std::to_string(index);
+			if (batched) {
+				batch.insert(key, DBElement("object"));
+				batch.addTag(key, "Child");
+				batch.updateData(sibling, key);
+				db->write(batch);
+			}
+			else {
+				db->insert(key, DBElement("object"));
+				db->addTag(key, "Child");
+				db->updateData(sibling, key);
+			}
+		}
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		double rate = groups * 3 / seconds;
+		if (!batched)
+			single = rate;
+		WriteAheadLog::Stats stats = db->logStats();
+		std::cout << "\n " << (batched ? "Batched   " : "One by One") << "\t Writes/s : " << (size_t)rate << "\t Speedup : " << rate / single
+			<< "\t Log Records : " << stats.records - records << "\t fsyncs : " << stats.syncs - syncs;
+		delete db;
+	}
+	std::remove(wal);
+}
+
+/// <summary>
+/// Function to Benchmark Reads of random Keys one by one (getView) against Reads of
+/// Batches of Keys (getViews), whose Lookups are Pipelined.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="batches">Keys per Batch to Benchmark</param>
+void benchMultiGet(size_t keys, std::vector<size_t> batches) {
+	DBEngine * db = new DBEngine("benchmark", 4);
+	for (size_t index = 0; index < keys; index++)
+		db->insert("key" + std::to_string(index), DBElement("value" + std::to_string(index)));
+	std::mt19937_64 random(11);
+	std::vector<std::string> requests;
+	for (size_t index = 0; index < 1000000; index++)
+		requests.push_back("key" + std::to_string(random() % keys));
+	size_t checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (const std::string& key : requests)
+		checksum += db->getView(key).data().size();
+	double single = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / requests.size();
+	std::cout << "\n Keys : " << keys << "\t getView : " << single << " ns/Key";
+	for (size_t batch : batches) {
+		std::vector<std::string> keysOfBatch(batch);
+		start = std::chrono::steady_clock::now();
+		for (size_t first = 0; first + batch <= requests.size(); first += batch) {
+			std::copy(requests.begin() + first, requests.begin() + first + batch, keysOfBatch.begin());
+			for (const ElementView& view : db->getViews(keysOfBatch))
+				checksum -= view.data().size();
+		}
+		double batched = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (requests.size() / batch * batch);
+		std::cout << "\t getViews of " << batch << " : " << batched << " ns/Key (" << single / batched << "x)";
+	}
+	std::cout << (checksum == 0 ? " " : "");
+	delete db;
+}
+
+/// <summary>
+/// Function to Measure the Latency of every Insert into a DBEngine which grows from
+/// empty, with the Shard Tables Rehashed Incrementally or at once.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="rehashSlots">DBEngineConfig::rehashSlots, 0 to Rehash at once</param>
+void benchInsertLatency(size_t keys, size_t rehashSlots) {
+	DBEngineConfig config(1);
+	config.keyIndex = false;
+	config.rehashSlots = rehashSlots;
+	DBEngine * db = new DBEngine("benchmark", config);
+	std::vector<std::string> names;
+	for (size_t index = 0; index < keys; index++)
+		names.push_back("key" + std::to_string(index));
+	std::vector<long long> samples(keys);
+	for (size_t index = 0; index < keys; index++) {
+		auto start = std::chrono::steady_clock::now();
+		db->insert(names[index], DBElement("value"));
+		samples[index] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+	}
+	delete db;
+	size_t stalls = std::count_if(samples.begin(), samples.end(), [](long long sample) { return sample > 1000000; });
+	std::sort(samples.begin(), samples.end());
+	std::cout << "\n Rehash Slots : " << (rehashSlots == 0 ? std::string("all") : std::to_string(rehashSlots))
+		<< "\t p50 : " << samples[keys / 2] << " ns\t p99 : " << samples[keys * 99 / 100] << " ns\t p99.99 : "
+		<< samples[keys / 10000 * 9999] << " ns\t Max : " << samples.back() / 1000 << " us\t Inserts over 1 ms : " << stalls;
+}
+
+/// <summary>
+/// Function to Benchmark Showing the whole Database at once against Showing it a
+/// Page at a time with a Cursor, with the size of the largest String built.
+/// </summary>
+/// <param name="keys">Number of Keys to Insert</param>
+/// <param name="limits">DBElements per Page to Benchmark</param>
+void benchPagedShow(size_t keys, std::vector<size_t> limits) {
+	DBEngine * db = new DBEngine("benchmark", 4);
+	for (size_t index = 0; index < keys; index++)
+		db->insert("key" + std::to_string(index), DBElement(std::string(100, 'a' + index % 26), { "Data" }));
+	auto start = std::chrono::steady_clock::now();
+	size_t whole = db->show().size();
+	double millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "\n Keys : " << keys << "\t show() : " << millis << " ms\t String : " << whole / 1024 << " KB";
+	for (size_t limit : limits) {
+		std::string cursor, next;
+		size_t largest = 0, pages = 0;
+		start = std::chrono::steady_clock::now();
+		do {
+			largest = std::max(largest, db->showPage(cursor, limit, next).size());
+			cursor = next;
+			pages++;
+		} while (!cursor.empty());
+		millis = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "\n Page : " << limit << "\t " << pages << " Pages : " << millis << " ms\t Largest Page : " << largest / 1024 << " KB";
+	}
+	delete db;
+}
+
+/// <summary>
+/// Function to Benchmark Read Scaling of DBEngine with the Number of Threads for
+/// an Unsharded and a Sharded Database.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [keys] [duration in ms]</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	size_t keys = argc > 1 ? std::stoul(argv[1]) : 200000;
+	int duration = argc > 2 ? std::stoi(argv[2]) : 1000;
+	size_t cores = std::thread::hardware_concurrency();
+	if (cores == 0)
+		cores = 4;
+
+	StringHelper::Title("BENCHMARKING DBENGINE READ THROUGHPUT", '=');
+	std::cout << "\n Keys : " << keys << ", Cores : " << cores << ", Duration : " << duration << " ms\n";
+	for (size_t shards : { (size_t)1, cores * 4 }) {
+		DBEngine * db = new DBEngine("benchmark", shards);
+		for (size_t index = 0; index < keys; index++)
+			db->insert("key" + std::to_string(index), DBElement("value" + std::to_string(index), { "Data" }));
+		StringHelper::Title("Shards : " + std::to_string(shards), '~');
+		double single = 0;
+		for (size_t threads = 1; threads <= cores; threads *= 2) {
+			double rate = benchReads(db, keys, threads, duration);
+			if (threads == 1)
+				single = rate;
+			std::cout << "\n Threads : " << threads << "\t Reads/s : " << (size_t)rate
+				<< "\t Speedup : " << rate / single;
+			if (threads < cores && threads * 2 > cores)
+				threads = cores / 2;
+		}
+		putline();
+		StringHelper::Title("Read Latency with a Concurrent Writer", '~');
+		benchReadLatency(db, keys, cores, duration);
+		putline();
+		delete db;
+	}
+	StringHelper::Title("Copying Reads against Zero-Copy Views", '~');
+	for (size_t size : { (size_t)64, (size_t)1024, (size_t)8192 })
+		benchCopyVsView(10000, size, 1000000);
+	putline();
+	StringHelper::Title("Write Latency during a Background Snapshot", '~');
+	benchBackgroundSnapshot(keys * 5, cores > 2 ? cores - 1 : 2);
+	putline();
+	StringHelper::Title("Eviction Hit Ratio on Zipfian Traces", '~');
+	for (double skew : { 0.8, 1.0 }) {
+		for (double share : { 0.01, 0.1 })
+			benchEvictionHitRatio(keys / 2, keys * 10, skew, share);
+	}
+	putline();
+	StringHelper::Title("Cost of Recording Reads for Eviction", '~');
+	benchEvictionOverhead(keys, 2000000);
+	putline();
+	StringHelper::Title("Prefix Scans and Insert Overhead of the KeyIndex", '~');
+	benchKeyIndex(keys, 100000);
+	putline();
+	StringHelper::Title("Pipelined Lookups of many Keys against Lookups one by one", '~');
+	for (size_t count : { keys, keys * 10 })
+		benchMultiGet(count, { 32, 256 });
+	putline();
+	StringHelper::Title("WriteBatches against Writes one by one", '~');
+	std::cout << "\n Without Write Ahead Log :";
+	benchWriteBatch(keys / 2, WriteAheadLog::SYNC_OS, false);
+	std::cout << "\n\n Write Ahead Log, fsync after every Commit :";
+	benchWriteBatch(std::min<size_t>(keys / 2, 5000), WriteAheadLog::SYNC_EACH, true);
+	std::cout << "\n\n Write Ahead Log, Group Commit :";
+	benchWriteBatch(std::min<size_t>(keys / 2, 5000), WriteAheadLog::SYNC_GROUP, true);
+	putline();
+	StringHelper::Title("Paged Show against show() of the whole Database", '~');
+	benchPagedShow(keys * 5, { 100, 1000, 10000 });
+	putline();
+	StringHelper::Title("Insert Latency of a growing Database", '~');
+	for (size_t rehashSlots : { (size_t)0, (size_t)ElementTable::REHASH_SLOTS })
+		benchInsertLatency(keys * 10, rehashSlots);
+	putline();
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_DBENGINE
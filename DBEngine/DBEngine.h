@@ -2,8 +2,8 @@
 // DBEngine.h       - Defines DBEngine Class to hold DBElement  //
 //                    Objects in an unordered_map and Perform   //
 //                    various operations on them.               //
-// Version          - 1.1                                       //
-// Last Modified    - 08/06/2017                                //
+// Version          - 3.5                                       //
+// Last Modified    - 10/17/2026                                //
 // Language         - Visual C++, Visual Studio 2017            //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
 // Author           - Venkata Bharani Krishna Chekuri           //
@@ -22,76 +22,579 @@
  * and the keys of DBElements which have those tags present in them. This allows 
  * usres to directly get all the Objects which have the specified tag.
  *
+ * The Database can be Partitioned into multiple Shards. Every Key is hashed to
+ * exactly one Shard, and each Shard has it's own unordered_maps for DBElements and
+ * Tags guarded by a Reader/Writer Lock. This allows multiple Server Threads to use
+ * the same DBEngine at once: Readers of a Shard run in parallel and Writers only
+ * block the Shard which holds the Key they are modifying.
+ *
+ * Point Reads (exists, getData, getDataRaw, getView) and show() take no Locks. Writers
+ * never modify a DBElement which Readers can see, instead they Publish a New Version
+ * of the DBElement and Retire the Old one to the EpochManager which Deletes it once
+ * every Reader which could have seen it is done. Readers therefore never block on
+ * Writers.
+ *
+ * Large Results can be Read a Page at a time (showPage, showUsingTagPage) much like
+ * Redis SCAN : every Page holds up to limit DBElements in Key order and returns a
+ * Cursor, the last Key of the Page, from which the next Page goes on. Building a
+ * Page Reads at most limit Keys per Shard, so the Memory it takes does not grow
+ * with the Database. Every Page is it's own point in time, a Key present during the
+ * whole walk is Shown exactly once and Keys Written meanwhile may or may not be.
+ *
+ * The ElementTable of a Shard grows Incrementally : when it Rebuilds, every later
+ * Write to the Shard moves DBEngineConfig::rehashSlots Slots of the old Array into
+ * the new one, so no single Write pays for Rehashing the whole Shard while holding
+ * it's Lock. Setting rehashSlots to 0 moves every Slot at once.
+ *
+ * Every Shard Allocates it's DBElements, along with their Data and Tags, from it's
+ * own SlabAllocator. This avoids a heap Allocation per String and Tag and lets the
+ * Destructor free the Database by Releasing Slabs instead of Deleting every DBElement.
+ *
+ * Tags are Interned in a TagDictionary owned by the DBEngine. DBElements and the Tag
+ * Index of every Shard refer to Tags by their Tag ID, so a Tag String is stored once
+ * no matter how many DBElements carry it.
+ *
+ * Every Key is assigned a dense Document ID within it's Shard. The Tag Index maps
+ * each Tag ID to a compressed PostingList of Document IDs instead of a set of Key
+ * Strings, and Document IDs are turned back into Keys only when they are returned.
+ *
+ * Boolean Tag Expressions ("Machine & AI & !Westworld") are evaluated in every Shard
+ * by Intersecting, Uniting and Subtracting PostingLists, so only the Keys which
+ * match the whole Expression are ever resolved.
+ *
+ * Hierarchical Tags ("region/us/east") can be looked up by Prefix or by Glob Pattern
+ * ("region/??/east", ? and * stay within a '/' Separated Segment, ** does not). The
+ * TagDictionary finds the matching Tag IDs in it's TagTrie without testing every
+ * Tag, and every Shard Unites their PostingLists pairwise before resolving Keys.
+ *
+ * Keys, Tags and Data are passed as std::string_view. Point Reads hash and compare
+ * the view directly, so they do not Allocate, and every Write looks it's Key up
+ * exactly once. insert and update have rvalue Overloads which Move the DBElement
+ * into the Shard instead of Copying it first.
+ *
+ * getView returns an ElementView which refers to the stored DBElement instead of a
+ * Copy of it. The ElementView Pins the Epoch so the DBElement stays valid while it
+ * is alive, and exposes the Data as a std::string_view and the Tag IDs as a span,
+ * so Readers can serialize a DBElement without Copying it first.
+ *
+ * getViews and getData take many Keys at once and Pipeline their Lookups : every
+ * Key of a window of LOOKUP_WINDOW Keys is Hashed and it's Control Group Prefetched,
+ * then every Slot, then every DBElement found, before the first one is Read. The
+ * Cache Misses of the Keys overlap instead of being waited for one after the other.
+ * write Prefetches the Slots of the Keys of a WriteBatch the same way before it
+ * takes the Shard Locks.
+ *
+ * When a Write Ahead Log is Configured through DBEngineConfig, every Mutation is
+ * Appended to the Log while the Shard's Writer Lock is held and Committed after it
+ * is Released, so concurrent Writers can share one fsync (see WriteAheadLog). The
+ * DBEngine replays the Log when it is Constructed to Rebuild the DB Table and the
+ * Tag Index. Mutations return False if the Log could not be Written, in which case
+ * the Mutation is Applied in memory but is not Durable.
+ *
+ * saveSnapshot() Writes the whole Database to a versioned, checksummed Snapshot File
+ * (see Snapshot) and Empties the Log. When a Snapshot is Configured, the DBEngine
+ * starts from it before Replaying the Log. By default the Snapshot is Attached : it
+ * is Memory Mapped, only the Tag Index is Loaded, and a DBElement is Loaded from the
+ * Mapping the first time it's Key is used, so startup does not depend on how much
+ * Data the Snapshot holds. Shards then keep the Snapshot's Document IDs, and Keys
+ * of Document IDs which were never Loaded are Read from the Mapping.
+ *
+ * startSnapshot() Writes the Snapshot from a background Thread while Mutations
+ * continue. Every Shard is Locked only long enough to Capture the Snapshot point :
+ * a Copy of the Live Document IDs and Tag Index, and a Rotation of the Write Ahead
+ * Log. The background Thread stays Pinned by an EpochGuard so no DBElement which
+ * was current at that point is Deleted, and Writers which Replace or Remove a
+ * DBElement the Snapshot has not Written yet Preserve the Old Version for it.
+ * The Snapshot therefore holds exactly the Database at the Snapshot point.
+ *
+ * When DBEngineConfig::lsm names a Directory the Database may grow past memory :
+ * the DB Tables become Memtables of an LSM Tier (see LSMTree). Once the Memtables
+ * hold about LSMTree::Options::memtableBytes a background Thread Flushes them into
+ * SSTables and Removes the Flushed DBElements from the DB Tables, Writers only
+ * Block if the Memtables reach twice that size before the Flush is done. Removed
+ * Keys are kept as Tombstones till they are Flushed. Keys, Document IDs and the Tag
+ * Index stay in memory and are Rebuilt from the SSTables' Key Blocks when the
+ * DBEngine is Constructed, Readers which miss the DB Table Read the DBElement from
+ * the SSTables and Writers Load it back into the DB Table first. The Write Ahead
+ * Log is Rotated by every Flush and the Rotated Log is Discarded once the SSTables
+ * are Durable. With LSMTree::Options::valueThreshold large Values are Flushed into
+ * a Value Log apart from the SSTables, which is Garbage Collected in the background.
+ *
+ * DBEngineConfig::compression makes the DBEngine store the Data of DBElements at
+ * least Codec::Options::threshold Bytes large Compressed (see Codec), against a
+ * trained Codec::Dictionary if one is given so small Values Compress as well.
+ * DBElements are Compressed before the Shard's Writer Lock is taken, getData and
+ * show Decompress them, and ElementView::data() Decompresses into the ElementView
+ * while storedData() hands out the Frame. The Write Ahead Log, Snapshots and the
+ * LSM Tier keep the Data Decompressed, so their Formats do not change and Frames,
+ * whose Dictionary IDs only mean something to this process, never reach the disk.
+ *
+ * Keys may Expire. A DBElement inserted with an Expiry Deadline (DBElement::setExpiry)
+ * or given one by setExpiry() is Removed once the Deadline passes. Every Shard keeps
+ * a TimingWheel of it's Deadlines, so scheduling and expiring a Key costs O(1)
+ * amortized. Readers which find an Expired DBElement Remove it right away and
+ * report the Key as missing, Writers do the same before they Modify the Key, and a
+ * background Thread started with the first Deadline calls removeExpired() every
+ * DBEngineConfig::expiryTickMillis to Remove Expired Keys nobody Reads. It Removes
+ * at most DBEngineConfig::expiryBatch Keys per Writer Lock, so a large batch of Keys
+ * Expiring together never Blocks a Shard for long. Deadlines are Logged as EXPIRE
+ * Records, and Logged again whenever the Write Ahead Log is Rotated, so they survive
+ * Restarts without changing the Snapshot or SSTable Formats. With an LSM Tier
+ * DBElements which have a Deadline therefore stay in the DB Tables after a Flush.
+ *
+ * DBEngineConfig::eviction bounds the Database by a Memory Limit so it can be used as
+ * a Cache (see Eviction). The Bytes of the Keys and DBElements held are Counted as
+ * DBElements are Published and Unpublished, and a Writer which leaves the Database
+ * over the Limit Evicts Keys before it returns : it Samples a few Keys of the next
+ * Shard in turn and Removes the one the Policy (Sampled LRU, LFU with Decay or
+ * TinyLFU) Ranks highest the same way remove() does, so the Tag Index stays
+ * consistent and the Removal is Logged. Readers only record the Read in the
+ * DBElement's Access Word, a Load and at most once per Access Clock period a Store.
+ * With TinyLFU, a Sample also yields the Key of the Admission Window Read longest
+ * ago, which is either Admitted in place of the Victim or Evicted itself once the
+ * Window is full. The Limit is ignored with an LSM Tier, whose Memtables are
+ * bounded already.
+ *
+ * Every Shard also keeps it's Keys in order in a KeyIndex (a B+ Tree, see KeyIndex)
+ * which is maintained along with the Document IDs, so getKeysByPrefix() and
+ * getKeysByRange() cost O(log n + results) : every Shard seeks to the first Key of
+ * the Range and walks it's Leaves till the Range ends, and the sorted Keys of all
+ * Shards are Merged. The KeyIndex is Read under the Shard's Shared Lock like the Tag
+ * Index. Keys of an Attached Snapshot are Indexed the first time a Shard is Scanned,
+ * so Attaching stays independent of the Number of Keys. With DBEngineConfig::keyIndex
+ * False no KeyIndex is kept and Scans walk and sort every Live Key instead.
+ *
+ * Every Shard also keeps a Time Index of it's Live Keys ordered by Last Modified
+ * Timestamp, a second KeyIndex keyed on the Timestamp and Document ID, which every
+ * Writer that Publishes a new Version of a DBElement updates under the Writer Lock.
+ * getKeysModifiedSince() and getKeysModifiedBetween() seek to the first Timestamp
+ * and walk forward, getKeysRecentlyModified() walks backward from the newest
+ * Timestamp. With a Tag it either walks backward and Checks the Tag's PostingList,
+ * or ranks the PostingList's Document IDs by Timestamp when the Tag is so rare that
+ * the walk would visit more Keys than the PostingList holds. Timestamps of an
+ * Attached Snapshot's Keys are Read from it the first time a Shard is Queried by
+ * Time, those of Keys in the LSM Tier come from the SSTables' Key Blocks.
+ *
+ * Readers which Show many Keys see all of them as of one point in time (Multi
+ * Version Concurrency Control). Every Write stamps the DBElement it Publishes with
+ * the next Sequence Number of the DBEngine, and a Reader Pins the current Sequence
+ * Number (beginRead). While any Reader is Pinned, the Version a Write Replaces stays
+ * Linked behind the new one and the DBElement of a Removed Key is kept along with
+ * the Sequence Number of the Removal, so the Reader walks back to the newest Version
+ * not after it's Sequence Number without Locks and Writers never wait for it.
+ * Without Pinned Readers Writers Retire old Versions right away. A background
+ * Thread drops the Versions the oldest Pinned Reader can not see anymore every
+ * DBEngineConfig::versionMillis. show() and the Tag Queries Pin a Sequence Number
+ * themselves, and the Tag Queries also look at the Keys Written or Removed since so
+ * they match the Tags of the Versions they Show. Scans by Key and by Timestamp take
+ * their Keys from the Indexes and Show every one of them as of one Sequence Number.
+ * Point Reads see the newest Version.
+ *
+ * Writes which belong together are Applied with write(WriteBatch&), all of them or
+ * none. The Batch takes the Writer Locks of the Shards it touches once, in Shard
+ * order, Checks every Write against the Keys before changing anything, and is
+ * Logged as one BATCH Record of the Write Ahead Log and Committed once. It's
+ * Writes share one Sequence Number, so Readers which Pin one see the whole Batch
+ * or nothing of it.
+ *
  *
  * PACKAGE OPERATIONS
  * ------------------
- * - void insertIndexTags(std::string key)
+ * - Shard * shardFor(std::string_view key)
+ * Helper Method to get the Shard which holds the Specified Key.
+ *
+ * - uint32_t assignDocument(Shard * shard, std::string_view key)
+ * Helper Method to Assign a Document ID to a new Key.
+ *
+ * - void releaseDocument(Shard * shard, uint32_t document)
+ * Helper Method to Release the Document ID of a Removed Key for reuse.
+ *
+ * - void insertIndexTags(Shard * shard, uint32_t document, DBElement * value)
  * Helper Method To Index Database based on Tags when a New DBElement is inserted.
  *
- * - void deleteIndexTags(std::string key);
+ * - void deleteIndexTags(Shard * shard, uint32_t document, DBElement * value);
  * Helper Method to Index Database based on Tags when a DBElement is removed.
  *
- * - DBEngine(std::string owner);
- * Constructor with Owner as Argument.
+ * - bool insertElement(Shard * shard, std::string_view key, DBElement * object)
+ * Helper Method to Insert a DBElement created by createElement with one Lookup.
+ *
+ * - bool updateElement(Shard * shard, std::string_view key, DBElement * object)
+ * Helper Method to Replace the DBElement associated with a Key with one Lookup and Retire the Old one.
+ *
+ * - bool storeElement(Shard * shard, WriteAheadLog::Operation operation, std::string_view key, DBElement * object, uint64_t& lsn, size_t& bytes)
+ * Helper Method to Insert or Update a Key and Log it, along with it's Deadline.
+ *
+ * - bool tagElement(Shard * shard, std::string_view key, std::string_view tag, uint32_t id, bool add, uint64_t& lsn, size_t& bytes, DBElement *& replaced)
+ * Helper Method to Add a Tag to or Remove it from the DBElement of a Key and Log it.
+ *
+ * - bool updateDataElement(Shard * shard, std::string_view key, std::string_view data, uint64_t& lsn, size_t& bytes, DBElement *& replaced)
+ * Helper Method to Replace the Data of the DBElement of a Key and Log it.
+ *
+ * - bool expireElement(Shard * shard, std::string_view key, long long int deadline, uint64_t& lsn, size_t& bytes, DBElement *& replaced)
+ * Helper Method to set the Deadline of the DBElement of a Key and Log it.
+ *
+ * - DBElement * createElement(Shard * shard, const DBElement& value)
+ * Helper Method to Copy a DBElement into the Shard's SlabAllocator.
+ *
+ * - DBElement * createElement(Shard * shard, DBElement&& value)
+ * Helper Method to Move a DBElement into the Shard's SlabAllocator.
+ *
+ * - void retireElement(DBElement * value)
+ * Helper Method to Retire a DBElement created using createElement.
+ *
+ * - void replayRecord(const WriteAheadLog::Record& record)
+ * Helper Method to Apply a Record of the Write Ahead Log while the Database is Rebuilt.
+ *
+ * - DBElement * restoreElement(Shard * shard, const Snapshot::Record& record)
+ * Helper Method to Create a DBElement in the Shard's SlabAllocator from a Snapshot Record.
+ *
+ * - void attachSnapshot() / void loadSnapshot()
+ * Helper Methods to start from the opened Snapshot by Mapping it or by Loading every DBElement.
+ *
+ * - void faultElement(Shard * shard, std::string_view key) / void faultShard(Shard * shard)
+ * Helper Methods to Load a Key or every remaining Key of a Shard from the Attached Snapshot.
+ *
+ * - DBElement * lookup(Shard * shard, std::string_view key)
+ * Helper Method for Readers to Find a DBElement, Loading it from the Attached Snapshot if needed.
+ *
+ * - DBElement * resolve(Shard * shard, std::string_view key, DBElement * value)
+ * Helper Method for Readers to finish a Lookup given what the DB Table holds for the Key.
+ *
+ * - void lookup(const std::string * keys, size_t count, DBElement ** values)
+ * Helper Method for Readers to Find the DBElements of many Keys with Pipelined Lookups.
+ *
+ * - std::string_view documentKey(Shard * shard, uint32_t document)
+ * Helper Method to get the Key of a Document ID.
+ *
+ * - void preserve(Shard * shard, uint32_t document, std::string_view key, DBElement * current)
+ * Helper Method to keep the Version of a DBElement which the running background Snapshot still has to Write.
+ *
+ * - void writeSnapshot(std::string path, std::promise<void> * captured)
+ * Helper Method run by the background Snapshot Thread.
+ *
+ * - DBElement * restoreElement(Shard * shard, const LSMTree::Value& value)
+ * Helper Method to Create a DBElement from a Version Read from the LSM Tier.
+ *
+ * - bool compressElement(DBElement& value)
+ * Helper Method to Compress a DBElement's Data as DBEngineConfig::compression asks.
+ *
+ * - bool eraseElement(Shard * shard, std::string_view key, uint64_t& lsn, DBElement *& retired)
+ * Helper Method to Remove a Key from a Shard and Log it, the Caller Retires the DBElement unless Readers keep it.
+ *
+ * - uint64_t nextVersion()
+ * Helper Method to get the Sequence Number of a Write.
+ *
+ * - DBElement * supersede(Shard * shard, uint32_t document, std::string_view key, DBElement * object, DBElement * current)
+ * Helper Method to Stamp a Version which Replaces another, returns the Version to Retire unless Readers keep it.
+ *
+ * - DBElement * bury(Shard * shard, std::string_view key, DBElement * current)
+ * Helper Method to keep the DBElement of a Removed Key for Pinned Readers, returns it if no Reader is Pinned.
+ *
+ * - uint64_t oldestRead()
+ * Helper Method to get the Sequence Number of the oldest Pinned Reader.
+ *
+ * - static DBElement * visibleVersion(DBElement * value, uint64_t sequence)
+ * Helper Method to walk back to the newest Version not after a Sequence Number.
+ *
+ * - static bool trimVersions(DBElement * value, uint64_t oldest, std::vector<DBElement*>& retired)
+ * Helper Method to Unlink the Versions no Reader can see anymore.
+ *
+ * - DBElement * lookupAt(Shard * shard, std::string_view key, uint64_t sequence)
+ * Helper Method for Readers to Find the Version of a Key as of a Sequence Number.
+ *
+ * - void versionedKeys(std::unordered_set<std::string>& keys)
+ * Helper Method to add the Keys which are kept in older Versions or Removed for Pinned Readers.
+ *
+ * - std::vector<std::string> versionedKeys(std::string_view from, const std::function<bool(std::string_view)>& within)
+ * Helper Method to get the Keys within a Range which are kept in older Versions or Removed for Pinned Readers, in order.
+ *
+ * - void visibleKeys(std::vector<std::string>& keys, uint64_t sequence, const std::function<bool(const DBElement*)>& matches)
+ * Helper Method to keep the Keys whose Version as of a Sequence Number Exists and matches a Filter.
+ *
+ * - template <typename Keys> std::string showAt(const Keys& keys, uint64_t sequence, const std::function<bool(const DBElement*)>& matches)
+ * Helper Method to Show the Versions of Keys as of a Sequence Number which match a Filter, in the order of the Keys.
+ *
+ * - std::string showUsingTagIds(std::vector<uint32_t> ids)
+ * Helper Method to Show the DBElements which have any of the given Tag IDs as of one Sequence Number.
+ *
+ * - void startVersions() / void versionLoop()
+ * Helper Methods to Start and run the Thread which drops old Versions in the background.
+ *
+ * - void expireKey(Shard * shard, std::string_view key)
+ * Helper Method to Remove a Key whose DBElement has Expired.
+ *
+ * - uint64_t scheduleExpiry(Shard * shard, std::string_view key, long long int deadline)
+ * Helper Method to add a Key's Deadline to the Shard's TimingWheel and Log it.
+ *
+ * - uint64_t relogExpiry()
+ * Helper Method to Log the Deadline of every Key again after the Write Ahead Log was Rotated.
+ *
+ * - void startExpiry() / void expiryLoop()
+ * Helper Methods to Start and run the Thread which Removes Expired Keys in the background.
+ *
+ * - size_t footprint(std::string_view key, const DBElement * value)
+ * Helper Method to get the approximate Bytes a Write adds to the Memtable.
+ *
+ * - void memtableWrite(size_t bytes)
+ * Helper Method to Account for a Write to the Memtables and Start or Wait for a Flush.
+ *
+ * - void flushMemtable()
+ * Helper Method run by the Flush Thread to Write the Memtables to the LSM Tier.
+ *
+ * - void account(std::string_view key, const DBElement * added, const DBElement * removed)
+ * Helper Method to Count the Bytes of a DBElement being Published or Unpublished against the Memory Limit.
+ *
+ * - bool sampleVictim(Shard * shard, Sample& sample)
+ * Helper Method to Sample Keys of a Shard and pick the Victim and the TinyLFU Admission Candidate.
+ *
+ * - void evict()
+ * Helper Method to Evict Keys while the Database holds more than the Memory Limit.
+ *
+ * - void formatElement(std::string& aggregator, std::string_view key, const DBElement * value)
+ * Helper Method to Append a DBElement and it's Key in a Nicely Formatted Manner to a String.
+ *
+ * - std::unordered_set<std::string> getKeysWithTagIds(const std::vector<uint32_t>& ids)
+ * Helper Method to return the Keys of DBElements which have any of the given Tag IDs.
+ *
+ * - std::shared_lock<std::shared_mutex> lockIndexes(Shard * shard, bool keys, bool times)
+ * Helper Method to Lock a Shard Shared once the Keys or Timestamps of the Attached Snapshot are Indexed.
+ *
+ * - static std::string timeKey(long long int timestamp, uint32_t document)
+ * Helper Method to Encode a Timestamp and Document ID as a Key of the Time Index which sorts by Timestamp.
+ *
+ * - void stampDocument(Shard * shard, uint32_t document, long long int timestamp)
+ * Helper Method to Move a Document ID to a new Timestamp in the Time Index.
+ *
+ * - void timeBase(Shard * shard)
+ * Helper Method to add the Live Keys of the Attached Snapshot to a Shard's Time Index once.
+ *
+ * - std::vector<std::string> scanTimes(long long int from, long long int to, uint64_t sequence)
+ * Helper Method to get the Keys Modified between two Timestamps from every Shard as of a Sequence Number, oldest first.
+ *
+ * - void indexBase(Shard * shard)
+ * Helper Method to add the Live Keys of the Attached Snapshot to a Shard's KeyIndex once.
+ *
+ * - std::vector<std::string> pageShards(std::string_view cursor, size_t limit, std::string_view prefix, const uint32_t * tag)
+ * Helper Method to return the first limit Live Keys of the Shards after a Cursor, with a Prefix or a Tag ID, in order.
+ *
+ * - std::vector<std::string> pageKeys(std::string_view cursor, size_t limit, std::string_view prefix, const uint32_t * tag, uint64_t sequence)
+ * Helper Method to return the first limit Keys after a Cursor as of a Sequence Number, with a Prefix or a Tag ID, in order.
+ *
+ * - std::vector<std::string> scanKeys(std::string_view from, const std::function<bool(std::string_view)>& within, uint64_t sequence)
+ * Helper Method to get the Keys from a Key on while they are within a Range as of a Sequence Number, in order, from every Shard.
+ *
+ * - DBEngine(std::string owner, size_t shards = 1);
+ * Constructor with Owner and Number of Shards as Arguments.
+ *
+ * - DBEngine(std::string owner, const DBEngineConfig& config);
+ * Constructor with Owner and Configuration as Arguments. Starts from the Snapshot and Replays the Write Ahead Log if they are Configured.
+ *
+ * - bool saveSnapshot(std::string_view path);
+ * Method to Write the whole Database to a Snapshot File and Wait till it is Durable.
+ *
+ * - bool startSnapshot(std::string_view path);
+ * Method to Capture the Database and Write it to a Snapshot File in the background.
+ *
+ * - bool waitSnapshot();
+ * Method to Wait for the background Snapshot to finish.
+ *
+ * - SnapshotStats snapshotStats();
+ * Method to return the Duration, Bytes and Pause of the last Snapshot.
+ *
+ * - bool isDurable();
+ * Method to Check whether Mutations are being Recorded in a Write Ahead Log.
+ *
+ * - WriteAheadLog::Stats logStats();
+ * Method to return the Counters of the Write Ahead Log.
+ *
+ * - bool isTiered();
+ * Method to Check whether DBElements are kept in an LSM Tier.
+ *
+ * - LSMTree::Stats tierStats();
+ * Method to Wait for running Compactions and return the Shape and Counters of the LSM Tier.
+ *
+ * - Codec::Stats compressionStats();
+ * Method to return the Compression Ratio and the Time spent Compressing and Decompressing.
+ *
+ * - Eviction::Stats evictionStats();
+ * Method to return the Bytes held against the Memory Limit and the Number of Evicted and Rejected Keys.
+ *
+ * - size_t shardCount();
+ * Method to return the Number of Shards the Database is Partitioned into.
  *
  * - size_t size();
  * Method to return the Number of Objects in the Database.
  *
+ * - SlabAllocator::Stats allocatorStats();
+ * Method to return the Statistics of the SlabAllocators of all Shards.
+ *
+ * - size_t tagCount();
+ * Method to return the Number of distinct Tags Interned by the Database.
+ *
  * - std::string getOwner()
  * Method to get the Owner.
  *
- * - std::string setOwner(std::string newOwner)
+ * - std::string setOwner(std::string_view newOwner)
  * Method to set the Owner.
  *
- * - bool insert(std::string key, DBElement value)
- * Method to Insert DBElement into Database.
+ * - bool insert(std::string_view key, const DBElement& value)
+ * Method to Insert a Copy of a DBElement into Database.
+ *
+ * - bool insert(std::string_view key, DBElement&& value)
+ * Method to Insert DBElement into Database by Moving it.
  *
- * - bool insert(std::string key, DBElement* value)
+ * - bool insert(std::string_view key, DBElement* value)
  * Method to Insert DBElement into Database.
  *
- * - bool update(std::string key, DBElement value)
+ * - bool update(std::string_view key, const DBElement& value)
  * Method to Update the DBElement Object associated with Specified Key in the Database.
  *
- * - bool update(std::string key, DBElement* value)
+ * - bool update(std::string_view key, DBElement&& value)
+ * Method to Update the DBElement Object associated with Specified Key in the Database by Moving it.
+ *
+ * - bool update(std::string_view key, DBElement* value)
  * Method to Update the DBElement Object associated with Specified Key in the Database.
  *
- * - bool remove(std::string key)
+ * - bool remove(std::string_view key)
  * Method to Remove DBElement Object associated with Specified Key in the Database. 
  *
- * - bool exists(std::string key)
+ * - bool exists(std::string_view key)
  * Method to Check if Specified Key Exists in the Database.
  *
- * - bool addTag(std::string key, std::string tag)
+ * - bool setExpiry(std::string_view key, long long int deadline)
+ * Method to set the Deadline (Milliseconds since the Unix Epoch) at which a Key Expires, 0 to never Expire.
+ *
+ * - size_t removeExpired()
+ * Method to Remove the Keys whose Deadline has passed, a batch per Shard Lock at a time.
+ *
+ * - uint64_t beginRead() / void endRead(uint64_t sequence)
+ * Methods to Pin the current Sequence Number for Reads as of it and to Unpin it again.
+ *
+ * - std::string getDataAt(std::string_view key, uint64_t sequence)
+ * Method to get the DBElement of a Key as of a Pinned Sequence Number in a Nicely Formatted Manner.
+ *
+ * - size_t collectVersions()
+ * Method to drop the old Versions which no Pinned Reader can see, done by a background Thread.
+ *
+ * - size_t versionCount()
+ * Method to Count the old Versions and Removed DBElements kept for Pinned Readers.
+ *
+ * - bool addTag(std::string_view key, std::string_view tag)
  * Method to Add Tag to DBElement Object with Specified Key present in the Database.
  *
- * - bool removeTag(std::string key, std::string tag)
+ * - bool removeTag(std::string_view key, std::string_view tag)
  * Method to Remove Tag to DBElement Object with Specified Key present in the Database.
  *
- * - std::string getData(std::string key)
+ * - std::string getData(std::string_view key)
  * Method to Get DBElement Object present in Database in a Nicely Formatted Manner using it's Key.
  *
- * - DBElement getDataRaw(std::string key)
- * Method to Get DBElement Object present in Database using it's Key.
+ * - DBElement getDataRaw(std::string_view key)
+ * Method to Get a Decompressed Copy of DBElement Object present in Database using it's Key.
  *
- * - bool updateData(std::string key, std::string data)
+ * - ElementView getView(std::string_view key)
+ * Method to Get a Read Only View of DBElement Object present in Database without Copying it.
+ *
+ * - std::vector<ElementView> getViews(const std::vector<std::string>& keys)
+ * Method to Get Read Only Views of the DBElement Objects of many Keys, in the order of the Keys.
+ *
+ * - std::string getData(const std::vector<std::string>& keys)
+ * Method to Get the DBElement Objects of many Keys in a Nicely Formatted Manner, in the order of the Keys.
+ *
+ * - bool updateData(std::string_view key, std::string_view data)
  * Method to Update the Data of DBElement Present in Database.
  *
- * - std::unordered_set<std::string> getKeysWithTag(std::string tag)
+ * - bool write(WriteBatch& batch)
+ * Method to Apply the Writes of a WriteBatch in order, all of them or none, with one Log Record.
+ *
+ * - std::unordered_set<std::string> getKeysWithTag(std::string_view tag)
  * Method to return Key of DBElements present in Database which have a Specified Tag.
  *
+ * - std::unordered_set<std::string> getKeysWithTags(std::string_view expression)
+ * Method to return Key of DBElements present in Database which match a Boolean Tag Expression.
+ *
  * - std::string show()
  * Method to Show all the DBElement Objects Present in the Database.
  *
- * - std::string show(std::unordered_set<std::string> keys)
+ * - std::string show(const std::unordered_set<std::string>& keys)
  * Method to Show DBElements Objects present in the Database using Keys.
  *
- * - std::string showUsingTag(std::string tag)
+ * - std::string showUsingTag(std::string_view tag)
  * Method to Show All DBElement Objects present in Database with Specified Tag.
  *
+ * - std::string showUsingTags(std::string_view expression)
+ * Method to Show All DBElement Objects present in Database matching a Boolean Tag Expression.
+ *
+ * - std::unordered_set<std::string> getKeysWithTagPrefix(std::string_view prefix)
+ * Method to return Key of DBElements present in Database which have a Tag starting with a Prefix.
+ *
+ * - std::unordered_set<std::string> getKeysWithTagGlob(std::string_view pattern)
+ * Method to return Key of DBElements present in Database which have a Tag matching a Glob Pattern.
+ *
+ * - std::string showUsingTagPrefix(std::string_view prefix)
+ * Method to Show All DBElement Objects present in Database with a Tag starting with a Prefix.
+ *
+ * - std::string showUsingTagGlob(std::string_view pattern)
+ * Method to Show All DBElement Objects present in Database with a Tag matching a Glob Pattern.
+ *
+ * - std::vector<std::string> getKeysModifiedSince(long long int since)
+ * Method to return the Keys of DBElements Modified at or after a Timestamp, oldest first.
+ *
+ * - std::vector<std::string> getKeysModifiedBetween(long long int from, long long int to)
+ * Method to return the Keys of DBElements Modified between two Timestamps (both included), oldest first.
+ *
+ * - std::vector<std::string> getKeysRecentlyModified(size_t count, std::string_view tag = "")
+ * Method to return the Keys of the count most recently Modified DBElements, with a Tag if one is given, newest first.
+ *
+ * - std::string showModifiedSince(long long int since)
+ * Method to Show All DBElement Objects Modified at or after a Timestamp, oldest first.
+ *
+ * - std::string showModifiedBetween(long long int from, long long int to)
+ * Method to Show All DBElement Objects Modified between two Timestamps, oldest first.
+ *
+ * - std::string showRecentlyModified(size_t count, std::string_view tag = "")
+ * Method to Show the count most recently Modified DBElement Objects, with a Tag if one is given, newest first.
+ *
+ * - std::vector<std::string> getKeysByPrefix(std::string_view prefix)
+ * Method to return the Keys present in Database which start with a Prefix, in order.
+ *
+ * - std::vector<std::string> getKeysByRange(std::string_view from, std::string_view to)
+ * Method to return the Keys present in Database from one Key to another (both included, empty for no end), in order.
+ *
+ * - std::string show(const std::vector<std::string>& keys)
+ * Method to Show DBElements Objects present in the Database using Keys, in the order of the Keys.
+ *
+ * - std::string showByPrefix(std::string_view prefix)
+ * Method to Show All DBElement Objects present in Database whose Key starts with a Prefix, ordered by Key.
+ *
+ * - std::string showByRange(std::string_view from, std::string_view to)
+ * Method to Show All DBElement Objects present in Database whose Key is within a Range, ordered by Key.
+ *
+ * - std::vector<std::string> getKeysPage(std::string_view cursor, size_t limit, std::string_view prefix = "")
+ * Method to return the first limit Keys after a Cursor (empty to start), with a Prefix if one is given, in order.
+ *
+ * - std::vector<std::string> getKeysWithTagPage(std::string_view tag, std::string_view cursor, size_t limit)
+ * Method to return the first limit Keys after a Cursor (empty to start) of DBElements with a Tag, in order.
+ *
+ * - std::string showPage(std::string_view cursor, size_t limit, std::string& next, std::string_view prefix = "")
+ * Method to Show a Page of up to limit DBElement Objects after a Cursor ordered by Key, next is set to the
+ * Cursor of the next Page, empty once every Key was Shown.
+ *
+ * - std::string showUsingTagPage(std::string_view tag, std::string_view cursor, size_t limit, std::string& next)
+ * Method to Show a Page of up to limit DBElement Objects with a Tag after a Cursor ordered by Key, next is set
+ * to the Cursor of the next Page, empty once every Key was Shown.
+ *
  *
  * REQUIRED FILES
  * --------------
- * DBElement.h, DBEElement.cpp, Utilities.h, Utilities.cpp
+ * DBElement.h, DBEElement.cpp, TagDictionary.h, TagDictionary.cpp, TagTrie.h,
+ * TagTrie.cpp, ElementTable.h, ElementTable.cpp, EpochManager.h, EpochManager.cpp,
+ * SlabAllocator.h, SlabAllocator.cpp, PostingList.h, PostingList.cpp,
+ * TagExpression.h, TagExpression.cpp, ElementView.h, ElementView.cpp,
+ * WriteAheadLog.h, WriteAheadLog.cpp, Snapshot.h, Snapshot.cpp, FileSystem.h,
+ * FileSystem.cpp, SSTable.h, SSTable.cpp, ValueLog.h, ValueLog.cpp, LSMTree.h,
+ * LSMTree.cpp, Codec.h, Codec.cpp, TimingWheel.h, TimingWheel.cpp, Eviction.h,
+ * Eviction.cpp, KeyIndex.h, KeyIndex.cpp, WriteBatch.h, WriteBatch.cpp, Utilities.h,
+ * Utilities.cpp
  *
  *
  * OTHER DEPENDENCIES
@@ -107,13 +610,185 @@
  * ver 1.1 : 08/06/2017
  * - Added Auto-Indexing and retrieval using Tags.
  *
+ * ver 1.2 : 10/17/2026
+ * - Partitioned Database into Shards guarded by Reader/Writer Locks so the
+ *   DBEngine can be used by multiple threads at once.
+ * - Added Multi-Threaded Read Throughput Benchmark (BENCH_DBENGINE).
+ *
+ * ver 1.3 : 10/17/2026
+ * - Shards store DBElements in an ElementTable which is Read without Locks.
+ * - Writers Publish New Versions of DBElements and Retire Old Versions using
+ *   Epoch Based Reclamation instead of Modifying or Deleting them in place.
+ *
+ * ver 1.4 : 10/17/2026
+ * - DBElements are Allocated from a SlabAllocator owned by each Shard and are
+ *   freed in bulk when the DBEngine is Destroyed.
+ * - Added allocatorStats().
+ *
+ * ver 1.5 : 10/17/2026
+ * - Tags are Interned in a TagDictionary owned by the DBEngine, the Tag Index is
+ *   keyed on Tag IDs.
+ * - Added tagCount().
+ *
+ * ver 1.6 : 10/17/2026
+ * - Keys are assigned dense Document IDs and the Tag Index stores a PostingList
+ *   of Document IDs per Tag.
+ *
+ * ver 1.7 : 10/17/2026
+ * - Added getKeysWithTags() and showUsingTags() for Boolean Tag Expressions.
+ * - Shards keep a PostingList of their live Document IDs.
+ *
+ * ver 1.8 : 10/17/2026
+ * - Keys, Tags and Data are taken as std::string_view and Point Reads do not Allocate.
+ * - Added rvalue Overloads of insert and update which Move the DBElement in.
+ * - Every Write looks it's Key up once using ElementTable::modify.
+ *
+ * ver 1.9 : 10/17/2026
+ * - Added getView() which returns an Epoch Pinned ElementView instead of a Copy.
+ * - getData() and show() Append DBElements to the result without Temporary Copies.
+ *
+ * ver 2.0 : 10/17/2026
+ * - Added DBEngineConfig and a Write Ahead Log with Group Commit which is
+ *   Replayed on Construction.
+ * - Added isDurable() and logStats().
+ *
+ * ver 2.1 : 10/17/2026
+ * - Added saveSnapshot() and starting from a Memory Mapped Snapshot which is
+ *   Loaded lazily, or fully when DBEngineConfig::mapSnapshot is False.
+ * - Keys are assigned to Shards using the stable Hash of Snapshot.
+ *
+ * ver 2.2 : 10/17/2026
+ * - Added startSnapshot(), waitSnapshot() and snapshotStats(). Snapshots are
+ *   Written by a background Thread from a Captured point in time while
+ *   Mutations continue, saveSnapshot() uses it and Waits.
+ *
+ * ver 2.3 : 10/17/2026
+ * - Added an optional LSM Tier (DBEngineConfig::lsm) which Flushes the DB Tables
+ *   into SSTables so the Database can grow larger than memory.
+ * - Added isTiered() and tierStats().
+ *
+ * ver 2.4 : 10/17/2026
+ * - The LSM Tier may Separate large Values into a Garbage Collected Value Log
+ *   (LSMTree::Options::valueThreshold).
+ *
+ * ver 2.5 : 10/17/2026
+ * - Added DBEngineConfig::compression to store Data Compressed in memory, and
+ *   compressionStats().
+ *
+ * ver 2.6 : 10/17/2026
+ * - Keys may Expire, added setExpiry() and removeExpired(). Deadlines are kept in
+ *   a TimingWheel per Shard and Expired Keys are Removed on access and by a
+ *   background Thread.
+ *
+ * ver 2.7 : 10/17/2026
+ * - Added DBEngineConfig::eviction to bound the Database by a Memory Limit with
+ *   Sampled LRU, LFU or W-TinyLFU Eviction, and evictionStats().
+ * - Added Eviction Hit Ratio Benchmark on Zipfian Traces (BENCH_DBENGINE).
+ *
+ * ver 2.8 : 10/17/2026
+ * - Shards keep their Keys in an ordered KeyIndex. Added getKeysByPrefix(),
+ *   getKeysByRange(), showByPrefix(), showByRange(), an ordered show() and
+ *   DBEngineConfig::keyIndex.
+ * - Added Scan Throughput and Insert Overhead Benchmarks of the KeyIndex (BENCH_DBENGINE).
+ *
+ * ver 2.9 : 10/17/2026
+ * - Added getKeysWithTagPrefix(), getKeysWithTagGlob(), showUsingTagPrefix() and
+ *   showUsingTagGlob() for Prefix and Glob lookups of Hierarchical Tags.
+ *
+ * ver 3.0 : 10/17/2026
+ * - Shards keep a Time Index of their Keys by Last Modified Timestamp. Added
+ *   getKeysModifiedSince(), getKeysModifiedBetween(), getKeysRecentlyModified()
+ *   and their show Methods.
+ *
+ * ver 3.1 : 10/17/2026
+ * - Multi Version DBElements : Writes are stamped with a Sequence Number, Readers
+ *   Pin one with beginRead() and see older Versions which a background Thread
+ *   drops once no Reader can see them. show() and the Tag Queries see one point in
+ *   time. Added beginRead(), endRead(), getDataAt(), collectVersions() and
+ *   versionCount().
+ *
+ * ver 3.2 : 10/17/2026
+ * - Added write(WriteBatch&) to Apply several Writes All-or-Nothing under one
+ *   Lock acquisition per Shard and one BATCH Record of the Write Ahead Log.
+ *
+ * ver 3.3 : 10/17/2026
+ * - Added getViews() and getData() for many Keys, which Prefetch the Lookups of
+ *   the Keys in Stages. write() Prefetches the Slots of it's Keys, and Applies
+ *   WriteBatch::put.
+ *
+ * ver 3.4 : 10/17/2026
+ * - Shard ElementTables Rehash Incrementally as they grow. Added
+ *   DBEngineConfig::rehashSlots.
+ * - Added Insert Latency Benchmark of Incremental against one go Rehashing (BENCH_DBENGINE).
+ *
+ * ver 3.5 : 10/17/2026
+ * - Added getKeysPage(), getKeysWithTagPage(), showPage() and showUsingTagPage()
+ *   to Read the Database a bounded Page at a time with a Cursor.
+ * - Added Paged Show against show() Benchmark (BENCH_DBENGINE).
+ *
  */
 #ifndef DBENGINE_H
 #define DBENGINE_H
 
+#include "ElementView.h"
+#include "EpochManager.h"
+#include "Eviction.h"
+#include "ElementTable.h"
+#include "KeyIndex.h"
+#include "LSMTree.h"
+#include "PostingList.h"
+#include "Snapshot.h"
+#include "SlabAllocator.h"
+#include "TagExpression.h"
+#include "TimingWheel.h"
+#include "WriteAheadLog.h"
+#include "WriteBatch.h"
 #include "../DBElement/DBElement.h"
 
+#include <set>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <string_view>
+#include <shared_mutex>
 #include <unordered_map>
+#include <condition_variable>
+
+/// <summary>
+/// Configuration of a DBEngine.
+/// </summary>
+struct DBEngineConfig {
+	size_t shards;																	// Number of Shards the Database is Partitioned into
+	WriteAheadLog::Options wal;														// Write Ahead Log, empty path to keep the Database in memory only
+	std::string snapshot;															// Snapshot to start from, empty to start empty
+	bool mapSnapshot = true;														// Attach the Snapshot instead of Loading every DBElement
+	LSMTree::Options lsm;															// LSM Tier, empty directory to keep every DBElement in memory
+	Codec::Options compression;														// Data Compression, threshold 0 to store Data as it is
+	long long int expiryTickMillis = 100;											// Precision of Key Expiry and period of the background Removal
+	size_t expiryBatch = 64;														// Expired Keys Removed per Shard Lock by the background Removal
+	Eviction::Options eviction;														// Memory Limit and Eviction Policy, memoryLimit 0 to never Evict
+	bool keyIndex = true;															// Keep the Keys of every Shard in order for Prefix and Range Scans
+	long long int versionMillis = 100;												// Period of the background Collection of old Versions
+	size_t rehashSlots = ElementTable::REHASH_SLOTS;								// Slots moved per Write while a Shard's Table grows, 0 to Rehash at once
+
+	explicit DBEngineConfig(size_t shardCount = 1) : shards(shardCount) {}
+};
+
+/// <summary>
+/// Statistics of the last Snapshot Written by a DBEngine.
+/// </summary>
+struct SnapshotStats {
+	bool running = false;															// Snapshot is being Written
+	bool succeeded = false;															// Snapshot File was Replaced
+	double pauseMillis = 0;															// Time Writers were Blocked while the Snapshot point was Captured
+	double durationMillis = 0;														// Time from the Capture till the Snapshot File was Durable
+	uint64_t bytes = 0;																// Size of the Snapshot File
+	uint64_t records = 0;															// DBElements Written
+	uint64_t preserved = 0;															// Old Versions kept because Writers Replaced them during the Snapshot
+};
 
 /// <summary>
 /// noSQL Database Class which holds Data an unordered_map. 
@@ -121,42 +796,252 @@
 /// 
 /// DBEngine also Auto-Indexes the Database objects using Tags
 /// associated with each DBElement.
+///
+/// The Database is Partitioned into Shards, each guarded by it's
+/// own Reader/Writer Lock, so DBEngine is safe to use from multiple
+/// threads. Point Reads do not take Locks.
 /// </summary>
 class DBEngine {
 private:
+	static const size_t LOOKUP_WINDOW = 32;											// Keys whose Lookups are Pipelined together
+	/// <summary>
+	/// Image of a Shard at the point a background Snapshot was Captured. Guarded by
+	/// the Shard's Lock.
+	/// </summary>
+	struct Capture {
+		PostingList liveDocs;														// Document IDs at the Snapshot point
+		PostingList baseLive;														// Document IDs only in the Attached Snapshot at the Snapshot point
+		std::unordered_map<uint32_t, PostingList> tagMap;							// Tag Index at the Snapshot point
+		std::unordered_map<uint32_t, std::pair<std::string, DBElement*>> preserved;	// Key and DBElement at the Snapshot point of Documents changed since
+		uint32_t documents = 0;														// Document IDs are below this
+		uint32_t written = 0;														// Document IDs below this have been Written
+	};
+
+	/// <summary>
+	/// Partition of the Database. Holds the DBElements whose Keys hash
+	/// to this Shard and the slice of the Tag Index for those Keys. Writers
+	/// hold the Lock exclusively, the Tag Index is Read under a Shared Lock
+	/// and the DB Table is Read without Locks.
+	/// </summary>
+	struct Shard {
+		SlabAllocator allocator;													// Allocator for DBElements, their Data and Tags
+		std::shared_mutex lock;														// Reader/Writer Lock for this Shard
+		ElementTable table;															// Hash Table to hold DBElements
+		std::vector<std::string> docKeys;											// Key of every Document ID, empty for Released Document IDs
+		std::vector<uint32_t> freeDocs;												// Released Document IDs available for reuse
+		PostingList liveDocs;														// Document IDs currently assigned to Keys
+		std::unordered_map<uint32_t, PostingList> tagMap;							// unordered_map used to Auto-Indexing Database using Tag IDs
+		size_t number = 0;															// Position of the Shard, also it's Shard in the Attached Snapshot
+		uint32_t baseDocs = 0;														// Document IDs below this belong to the Attached Snapshot
+		PostingList baseLive;														// Snapshot Document IDs neither Loaded nor Removed yet
+		Capture * capture = nullptr;												// Image for the running background Snapshot, NULL if none
+		std::unordered_map<std::string, uint64_t> tombstones;						// Removed Keys not Flushed to the LSM Tier yet, and their Removal Number
+		uint64_t removals = 0;														// Removal Number of the last Tombstone
+		TimingWheel wheel;															// Expiry Deadlines of Keys, stale Timers are ignored when they fire
+		KeyIndex keys;																// Live Keys in order and their Document IDs
+		bool baseIndexed = true;													// Live Keys of the Attached Snapshot are in the KeyIndex
+		KeyIndex times;																// Live Document IDs by Last Modified Timestamp, see timeKey
+		std::vector<long long int> docTimes;										// Timestamp of every Document ID in the Time Index, 0 if it is not
+		bool baseTimed = true;														// Live Keys of the Attached Snapshot are in the Time Index
+		std::vector<std::string> versioned;											// Keys whose DBElement Links older Versions, may repeat
+		std::unordered_multimap<std::string, std::pair<DBElement*, uint64_t>> removed;	// DBElements Removed while Readers were Pinned and the Removal's Sequence Number
+	};
+
+	/// <summary>
+	/// Keys picked from a Sample of a Shard for Eviction.
+	/// </summary>
+	struct Sample {
+		std::string victim;															// Key the Eviction Policy Ranks highest outside the Admission Window
+		std::string candidate;														// TinyLFU : Key of the Admission Window Read longest ago
+		const DBElement * admitted = nullptr;										// DBElement of the Candidate
+		bool hasVictim = false;
+		bool hasCandidate = false;
+	};
+
 	std::string _dbOwner;															// Database Owner
-	std::unordered_map<std::string, DBElement*> _dbMap;								// unordered_map to hold DBElements
-	std::unordered_map<std::string, std::unordered_set<std::string>> _tagMap;		// unordered_map used to Auto-Indexing Database using Tags
+	std::mutex _ownerLock;															// Lock guarding Database Owner
+	TagDictionary _dictionary;														// Dictionary in which Tags of all Shards are Interned
+	std::vector<Shard*> _shards;													// Partitions of the Database
+	WriteAheadLog _wal;																// Log of Mutations, not open if the Database is in memory only
+	Snapshot _snapshot;																// Attached Snapshot, not open if every DBElement is in memory
+	std::thread _snapshotThread;													// Thread Writing the background Snapshot
+	std::mutex _snapshotLock;														// Lock guarding the Snapshot Stats
+	SnapshotStats _snapshotStats;													// Statistics of the running or last Snapshot
+	LSMTree _lsm;																	// LSM Tier, not open if every DBElement is in memory
+	size_t _memtableLimit = 0;														// Bytes of the Memtables which Start a Flush
+	std::atomic<size_t> _memtableBytes;												// Approximate Bytes Written to the Memtables since the last Flush
+	std::thread _flushThread;														// Thread Flushing the Memtables
+	std::mutex _flushLock;															// Lock guarding _flushing and _flushThread
+	std::condition_variable _flushDone;												// Signals Writers Waiting for a Flush
+	bool _flushing = false;															// A Flush is running
+	bool _ready = false;															// Construction is done, Flushes may Start
+	Codec::Options _compression;													// Data at least this large is stored Compressed
+	std::atomic<size_t> _expiring;													// Timers in the TimingWheels of all Shards
+	size_t _expiryBatch = 64;														// Expired Keys Removed per Shard Lock
+	std::thread _expiryThread;														// Thread Removing Expired Keys
+	std::mutex _expiryLock;															// Lock guarding _expiryThread and _expiryStop
+	std::condition_variable _expiryWake;											// Wakes the Expiry Thread to Stop
+	bool _expiryStop = false;														// The Expiry Thread must Stop
+	Eviction _eviction;																// Eviction Policy, disabled without a Memory Limit
+	std::atomic<size_t> _residentBytes;												// Approximate Bytes of the Keys and DBElements in the DB Tables
+	std::atomic<size_t> _windowBytes;												// Approximate Bytes of the Keys in the TinyLFU Admission Window
+	std::atomic<size_t> _evictCursor;												// Shard the next Eviction Samples
+	bool _keyIndex = true;															// Shards keep a KeyIndex
+	std::atomic<uint64_t> _sequence;												// Sequence Number of the last Write
+	std::atomic<size_t> _readers;													// Readers Pinned to a Sequence Number
+	std::mutex _readLock;															// Lock guarding _readSequences
+	std::multiset<uint64_t> _readSequences;											// Sequence Numbers of the Pinned Readers
+	long long int _versionMillis = 100;												// Period of the background Collection of old Versions
+	std::thread _versionThread;														// Thread dropping old Versions
+	std::mutex _versionLock;														// Lock guarding _versionThread and _versionStop
+	std::condition_variable _versionWake;											// Wakes the Version Thread to Stop
+	bool _versionStop = false;														// The Version Thread must Stop
+
+	/* Helper Functions */
+	Shard * shardFor(std::string_view key);
+	bool insertElement(Shard * shard, std::string_view key, DBElement * object);
+	bool updateElement(Shard * shard, std::string_view key, DBElement * object);
+	bool storeElement(Shard * shard, WriteAheadLog::Operation operation, std::string_view key, DBElement * object, uint64_t& lsn, size_t& bytes);
+	bool tagElement(Shard * shard, std::string_view key, std::string_view tag, uint32_t id, bool add, uint64_t& lsn, size_t& bytes, DBElement *& replaced);
+	bool updateDataElement(Shard * shard, std::string_view key, std::string_view data, uint64_t& lsn, size_t& bytes, DBElement *& replaced);
+	bool expireElement(Shard * shard, std::string_view key, long long int deadline, uint64_t& lsn, size_t& bytes, DBElement *& replaced);
+	DBElement * createElement(Shard * shard, const DBElement& value);
+	DBElement * createElement(Shard * shard, DBElement&& value);
+	void retireElement(DBElement * value);
+	static void destroyElement(void * value);
+	void replayRecord(const WriteAheadLog::Record& record);
+	DBElement * restoreElement(Shard * shard, const Snapshot::Record& record);
+	void attachSnapshot();
+	void loadSnapshot();
+	void faultElement(Shard * shard, std::string_view key);
+	void faultShard(Shard * shard);
+	DBElement * lookup(Shard * shard, std::string_view key);
+	DBElement * resolve(Shard * shard, std::string_view key, DBElement * value);
+	void lookup(const std::string * keys, size_t count, DBElement ** values);
+	std::string_view documentKey(Shard * shard, uint32_t document);
+	void preserve(Shard * shard, uint32_t document, std::string_view key, DBElement * current);
+	void writeSnapshot(std::string path, std::promise<void> * captured);
+	DBElement * restoreElement(Shard * shard, const LSMTree::Value& value);
+	bool compressElement(DBElement& value);
+	bool eraseElement(Shard * shard, std::string_view key, uint64_t& lsn, DBElement *& retired);
+	uint64_t nextVersion();
+	DBElement * supersede(Shard * shard, uint32_t document, std::string_view key, DBElement * object, DBElement * current);
+	DBElement * bury(Shard * shard, std::string_view key, DBElement * current);
+	uint64_t oldestRead();
+	static DBElement * visibleVersion(DBElement * value, uint64_t sequence);
+	static bool trimVersions(DBElement * value, uint64_t oldest, std::vector<DBElement*>& retired);
+	DBElement * lookupAt(Shard * shard, std::string_view key, uint64_t sequence);
+	void versionedKeys(std::unordered_set<std::string>& keys);
+	std::vector<std::string> versionedKeys(std::string_view from, const std::function<bool(std::string_view)>& within);
+	void visibleKeys(std::vector<std::string>& keys, uint64_t sequence, const std::function<bool(const DBElement*)>& matches);
+	template <typename Keys> std::string showAt(const Keys& keys, uint64_t sequence, const std::function<bool(const DBElement*)>& matches);
+	std::string showUsingTagIds(std::vector<uint32_t> ids);
+	void startVersions();
+	void versionLoop();
+	void expireKey(Shard * shard, std::string_view key);
+	uint64_t scheduleExpiry(Shard * shard, std::string_view key, long long int deadline);
+	uint64_t relogExpiry();
+	void startExpiry();
+	void expiryLoop();
+	static size_t footprint(std::string_view key, const DBElement * value);
+	void memtableWrite(size_t bytes);
+	void flushMemtable();
+	void account(std::string_view key, const DBElement * added, const DBElement * removed);
+	bool sampleVictim(Shard * shard, Sample& sample);
+	void evict();
+	void formatElement(std::string& aggregator, std::string_view key, const DBElement * value);
+	void indexBase(Shard * shard);
+	std::unordered_set<std::string> getKeysWithTagIds(const std::vector<uint32_t>& ids);
+	std::shared_lock<std::shared_mutex> lockIndexes(Shard * shard, bool keys, bool times);
+	static std::string timeKey(long long int timestamp, uint32_t document);
+	void stampDocument(Shard * shard, uint32_t document, long long int timestamp);
+	void timeBase(Shard * shard);
+	std::vector<std::string> scanTimes(long long int from, long long int to, uint64_t sequence);
+	std::vector<std::string> scanKeys(std::string_view from, const std::function<bool(std::string_view)>& within, uint64_t sequence);
+	std::vector<std::string> pageShards(std::string_view cursor, size_t limit, std::string_view prefix, const uint32_t * tag);
+	std::vector<std::string> pageKeys(std::string_view cursor, size_t limit, std::string_view prefix, const uint32_t * tag, uint64_t sequence);
 
 	/* Helper Functions For Indexing Using Tags */
-	void insertIndexTags(std::string key);
-	void deleteIndexTags(std::string key);
+	uint32_t assignDocument(Shard * shard, std::string_view key);
+	void releaseDocument(Shard * shard, uint32_t document);
+	void insertIndexTags(Shard * shard, uint32_t document, DBElement * value);
+	void deleteIndexTags(Shard * shard, uint32_t document, DBElement * value);
 public:
 	/* Constructor */
-	DBEngine(std::string owner);
+	DBEngine(std::string owner, size_t shards = 1);
+	DBEngine(std::string owner, const DBEngineConfig& config);
+	DBEngine(const DBEngine&) = delete;
+	DBEngine& operator=(const DBEngine&) = delete;
 	
 	/* Destructor */
 	~DBEngine();
 
 	/* Member Functions */
 	size_t size();
+	size_t shardCount();
+	SlabAllocator::Stats allocatorStats();
+	size_t tagCount();
+	bool isDurable();
+	WriteAheadLog::Stats logStats();
+	bool isTiered();
+	LSMTree::Stats tierStats();
+	Codec::Stats compressionStats();
+	Eviction::Stats evictionStats();
+	bool saveSnapshot(std::string_view path);
+	bool startSnapshot(std::string_view path);
+	bool waitSnapshot();
+	SnapshotStats snapshotStats();
 	std::string getOwner();
-	std::string setOwner(std::string newOwner);
-	bool insert(std::string key, DBElement value);
-	bool insert(std::string key, DBElement* value);
-	bool update(std::string key, DBElement value);
-	bool update(std::string key, DBElement* value);
-	bool remove(std::string key);
-	bool exists(std::string key);
-	bool addTag(std::string key, std::string tag);
-	bool removeTag(std::string key, std::string tag);
-	std::string getData(std::string key);
-	DBElement getDataRaw(std::string key);
-	bool updateData(std::string key, std::string data);
-	std::unordered_set<std::string> getKeysWithTag(std::string tag);
+	std::string setOwner(std::string_view newOwner);
+	bool insert(std::string_view key, const DBElement& value);
+	bool insert(std::string_view key, DBElement&& value);
+	bool insert(std::string_view key, DBElement* value);
+	bool update(std::string_view key, const DBElement& value);
+	bool update(std::string_view key, DBElement&& value);
+	bool update(std::string_view key, DBElement* value);
+	bool remove(std::string_view key);
+	bool exists(std::string_view key);
+	bool setExpiry(std::string_view key, long long int deadline);
+	size_t removeExpired();
+	uint64_t beginRead();
+	void endRead(uint64_t sequence);
+	std::string getDataAt(std::string_view key, uint64_t sequence);
+	size_t collectVersions();
+	size_t versionCount();
+	bool addTag(std::string_view key, std::string_view tag);
+	bool removeTag(std::string_view key, std::string_view tag);
+	std::string getData(std::string_view key);
+	DBElement getDataRaw(std::string_view key);
+	ElementView getView(std::string_view key);
+	std::vector<ElementView> getViews(const std::vector<std::string>& keys);
+	std::string getData(const std::vector<std::string>& keys);
+	bool updateData(std::string_view key, std::string_view data);
+	bool write(WriteBatch& batch);
+	std::unordered_set<std::string> getKeysWithTag(std::string_view tag);
+	std::unordered_set<std::string> getKeysWithTags(std::string_view expression);
 	std::string show();
-	std::string show(std::unordered_set<std::string> keys); 
-	std::string showUsingTag(std::string tag);
+	std::string show(const std::unordered_set<std::string>& keys); 
+	std::string showUsingTag(std::string_view tag);
+	std::string showUsingTags(std::string_view expression);
+	std::unordered_set<std::string> getKeysWithTagPrefix(std::string_view prefix);
+	std::unordered_set<std::string> getKeysWithTagGlob(std::string_view pattern);
+	std::string showUsingTagPrefix(std::string_view prefix);
+	std::string showUsingTagGlob(std::string_view pattern);
+	std::vector<std::string> getKeysModifiedSince(long long int since);
+	std::vector<std::string> getKeysModifiedBetween(long long int from, long long int to);
+	std::vector<std::string> getKeysRecentlyModified(size_t count, std::string_view tag = "");
+	std::string showModifiedSince(long long int since);
+	std::string showModifiedBetween(long long int from, long long int to);
+	std::string showRecentlyModified(size_t count, std::string_view tag = "");
+	std::vector<std::string> getKeysByPrefix(std::string_view prefix);
+	std::vector<std::string> getKeysByRange(std::string_view from, std::string_view to);
+	std::string show(const std::vector<std::string>& keys);
+	std::string showByPrefix(std::string_view prefix);
+	std::string showByRange(std::string_view from, std::string_view to);
+	std::vector<std::string> getKeysPage(std::string_view cursor, size_t limit, std::string_view prefix = "");
+	std::vector<std::string> getKeysWithTagPage(std::string_view tag, std::string_view cursor, size_t limit);
+	std::string showPage(std::string_view cursor, size_t limit, std::string& next, std::string_view prefix = "");
+	std::string showUsingTagPage(std::string_view tag, std::string_view cursor, size_t limit, std::string& next);
 };
 
 #ifdef TEST_CREATE_DBENGINE
@@ -0,0 +1,847 @@
+//////////////////////////////////////////////////////////////////
+// ElementTable.cpp - Hash Table mapping Keys to DBElements     //
+//                    with Lock-Free Lookups.                   //
+// Version          - 1.6                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "ElementTable.h"
+
+#include <new>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ELEMENTTABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+static_assert(sizeof(std::atomic<int8_t>) == 1, "Control Words must be one byte each");
+
+namespace {
+	/// <summary>
+	/// Function to get a Bit Mask of the Control Words in a Group which are equal to
+	/// the given Value. Control Words may be written by a Writer during the scan, a
+	/// match is always confirmed with an acquire load before the Slot is Read.
+	/// </summary>
+	/// <param name="group">First Control Word of the Group</param>
+	/// <param name="value">Value to Match</param>
+	/// <returns>Bit Mask with bit i set if Control Word i of the Group Matches</returns>
+	inline uint32_t matchGroup(const std::atomic<int8_t> * group, int8_t value) {
+#ifdef ELEMENTTABLE_SSE2
+		__m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value)));
+#else
+		uint32_t mask = 0;
+		for (size_t index = 0; index < ElementTable::GROUP_SIZE; index++) {
+			if (group[index].load(std::memory_order_relaxed) == value)
+				mask |= 1u << index;
+		}
+		return mask;
+#endif
+	}
+
+	/// <summary>
+	/// Function to get the Index of the Lowest Set Bit.
+	/// </summary>
+	/// <param name="mask">Non Zero Bit Mask</param>
+	/// <returns>Index of the Lowest Set Bit</returns>
+	inline size_t lowestBit(uint32_t mask) {
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return index;
+#else
+		return (size_t)__builtin_ctz(mask);
+#endif
+	}
+}
+
+/// <summary>
+/// Constructor for ElementTable with Initial Number of Slots as Argument.
+/// </summary>
+/// <param name="capacity">Initial Number of Slots (rounded up to a Power of 2, Minimum 16)</param>
+ElementTable::ElementTable(size_t capacity) : _old(nullptr), _moved(0), _rebuilds(0), _size(0), _rehashSlots(REHASH_SLOTS) {
+	size_t count = GROUP_SIZE;
+	while (count < capacity)
+		count <<= 1;
+	_array.store(allocate(count));
+}
+
+/// <summary>
+/// Default Destructor for ElementTable. Frees the Slots, the DBElements are owned
+/// by the caller. No reader may be using the table.
+/// </summary>
+ElementTable::~ElementTable() {
+	release(_array.load());
+	if (_old.load() != nullptr)
+		release(_old.load());
+}
+
+/// <summary>
+/// Function to set the Number of Slots of the old Array moved by every Write while
+/// the table is rebuilt. Caller must hold the Writer Lock.
+/// </summary>
+/// <param name="slots">Slots moved per Write, 0 to move all of them in the Write which Starts the rebuild</param>
+void ElementTable::setRehashSlots(size_t slots) {
+	_rehashSlots = slots;
+}
+
+/// <summary>
+/// Function to Check whether the table is being rebuilt, that is Keys are still
+/// being moved out of an old Array.
+/// </summary>
+/// <returns>True if an old Array is still being drained</returns>
+bool ElementTable::rehashing() const {
+	return _old.load(std::memory_order_acquire) != nullptr;
+}
+
+/// <summary>
+/// Function to Hash a Key. Mixes the bits of std::hash so both the Group Index
+/// (high bits) and the Fingerprint (low 7 bits) are well distributed.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>Hash of the Key</returns>
+size_t ElementTable::hashOf(std::string_view key) {
+	uint64_t hash = std::hash<std::string_view>()(key);
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	return (size_t)hash;
+}
+
+/// <summary>
+/// Function to Allocate an Array with all Slots EMPTY.
+/// </summary>
+/// <param name="capacity">Number of Slots (Power of 2, Minimum 16)</param>
+/// <returns>Empty Array</returns>
+ElementTable::Array * ElementTable::allocate(size_t capacity) {
+	Array * array = new Array();
+	array->mask = capacity - 1;
+	array->used = 0;
+	array->control = new std::atomic<int8_t>[capacity];
+	for (size_t index = 0; index < capacity; index++)
+		array->control[index].store(EMPTY, std::memory_order_relaxed);
+	array->slots = static_cast<Slot*>(::operator new(sizeof(Slot) * capacity));
+	return array;
+}
+
+/// <summary>
+/// Function to Free an Array along with the Keys of it's used Slots. Used as
+/// Deleter for Arrays Retired when the table is rebuilt.
+/// </summary>
+/// <param name="pointer">Array</param>
+void ElementTable::release(void * pointer) {
+	Array * array = static_cast<Array*>(pointer);
+	for (size_t index = 0; index <= array->mask; index++) {
+		if (array->control[index].load(std::memory_order_relaxed) != EMPTY)
+			array->slots[index].~Slot();
+	}
+	::operator delete(array->slots);
+	delete[] array->control;
+	delete array;
+}
+
+/// <summary>
+/// Function to Find the Slot holding the Key. Probes Groups of Control Words
+/// (triangular probing over Groups) till the Key or an EMPTY Control Word is found.
+/// </summary>
+/// <param name="array">Array to search</param>
+/// <param name="key">Key</param>
+/// <param name="hash">Hash of the Key</param>
+/// <returns>Slot holding the Key, nullptr if Key does not Exist</returns>
+ElementTable::Slot * ElementTable::locate(const Array * array, std::string_view key, size_t hash) {
+	int8_t fingerprint = (int8_t)(hash & 0x7F);
+	size_t groupMask = array->mask / GROUP_SIZE;
+	size_t group = (hash >> 7) & groupMask;
+	for (size_t step = 1; step <= groupMask + 1; step++) {
+		const std::atomic<int8_t> * control = array->control + group * GROUP_SIZE;
+		for (uint32_t matches = matchGroup(control, fingerprint); matches != 0; matches &= matches - 1) {
+			size_t offset = lowestBit(matches);
+			Slot * slot = array->slots + group * GROUP_SIZE + offset;
+			if (control[offset].load(std::memory_order_acquire) == fingerprint && slot->key == key)
+				return slot;
+		}
+		if (matchGroup(control, EMPTY) != 0)
+			return nullptr;
+		group = (group + step) & groupMask;
+	}
+	return nullptr;
+}
+
+/// <summary>
+/// Function to Find the Slot holding the Key in the current Array or, if the Key was
+/// not moved yet, in the old Array of a rebuild. The current Array is searched first
+/// since Writers Update Keys which were moved there. A rebuild may finish between
+/// the two searches, after moving the Key into the part of the current Array which
+/// was already searched, so a miss is retried if a rebuild finished meanwhile.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="hash">Hash of the Key</param>
+/// <returns>Slot holding the Key, nullptr if Key does not Exist</returns>
+ElementTable::Slot * ElementTable::locate(std::string_view key, size_t hash) const {
+	for (;;) {
+		size_t rebuilds = _rebuilds.load(std::memory_order_acquire);
+		Array * array = _array.load(std::memory_order_acquire);
+		Slot * slot = locate(array, key, hash);
+		if (slot != nullptr)
+			return slot;
+		Array * old = _old.load(std::memory_order_acquire);
+		if (old != nullptr && old != array && (slot = locate(old, key, hash)) != nullptr)
+			return slot;
+		if (_rebuilds.load(std::memory_order_acquire) == rebuilds)
+			return nullptr;
+	}
+}
+
+/// <summary>
+/// Function to Place a Key into the first EMPTY Slot of it's Probe Sequence. Caller
+/// must hold the Writer Lock and make sure the Key does not Exist and an EMPTY Slot
+/// is available.
+/// </summary>
+/// <param name="array">Array to place the Key in</param>
+/// <param name="key">Key</param>
+/// <param name="hash">Hash of the Key</param>
+/// <param name="value">DBElement to be associated with the Key</param>
+/// <param name="document">Document ID to be associated with the Key</param>
+void ElementTable::place(Array * array, std::string_view key, size_t hash, DBElement * value, uint32_t document) {
+	size_t groupMask = array->mask / GROUP_SIZE;
+	size_t group = (hash >> 7) & groupMask;
+	for (size_t step = 1; ; step++) {
+		std::atomic<int8_t> * control = array->control + group * GROUP_SIZE;
+		uint32_t empty = matchGroup(control, EMPTY);
+		if (empty != 0) {
+			size_t offset = lowestBit(empty);
+			Slot * slot = new (array->slots + group * GROUP_SIZE + offset) Slot();
+			slot->key.assign(key.data(), key.size());
+			slot->value.store(value, std::memory_order_relaxed);
+			slot->document = document;
+			/* Publishes the Slot to Readers */
+			control[offset].store((int8_t)(hash & 0x7F), std::memory_order_release);
+			array->used++;
+			return;
+		}
+		group = (group + step) & groupMask;
+	}
+}
+
+/// <summary>
+/// Function to Start Rebuilding the table into a new Array, which drops DELETED
+/// Slots and doubles the Number of Slots if the table is more than half full. A
+/// rebuild still running is finished first. The new Array is Published at once and
+/// empty, the Keys are moved into it by rehash, all of them right away if
+/// rehashSlots is 0. Since the new Array holds at most half of it's Slots after
+/// the move, the move is over long before the new Array is full.
+/// </summary>
+void ElementTable::rebuild() {
+	if (_old.load(std::memory_order_relaxed) != nullptr)
+		rehash(SIZE_MAX);
+	Array * current = _array.load(std::memory_order_relaxed);
+	size_t live = _size.load(std::memory_order_relaxed) + 1;
+	size_t capacity = current->mask + 1;
+	while (live * 2 > capacity)
+		capacity <<= 1;
+	Array * array = allocate(capacity);
+	/* Readers which see the new Array must see the old one and where the move starts */
+	_moved.store(0, std::memory_order_relaxed);
+	_old.store(current, std::memory_order_release);
+	_array.store(array, std::memory_order_release);
+	rehash(_rehashSlots == 0 ? SIZE_MAX : _rehashSlots);
+}
+
+/// <summary>
+/// Function to move the next Slots of the old Array into the current Array. The
+/// moved Slots keep their Keys and DBElements, so Readers which look in the old
+/// Array before a Key shows up in the current one still find it. Once every Slot
+/// was moved the old Array is Retired, Readers may still be using it. Caller must
+/// hold the Writer Lock and make sure a rebuild is running.
+/// </summary>
+/// <param name="slots">Number of Slots to move, SIZE_MAX to finish the rebuild</param>
+void ElementTable::rehash(size_t slots) {
+	Array * old = _old.load(std::memory_order_relaxed);
+	Array * array = _array.load(std::memory_order_relaxed);
+	size_t index = _moved.load(std::memory_order_relaxed);
+	size_t end = std::min(old->mask + 1 - index, slots) + index;
+	for (; index < end; index++) {
+		if (old->control[index].load(std::memory_order_relaxed) < 0)
+			continue;
+		Slot& slot = old->slots[index];
+		place(array, slot.key, hashOf(slot.key), slot.value.load(std::memory_order_relaxed), slot.document);
+	}
+	_moved.store(end, std::memory_order_release);
+	if (end > old->mask) {
+		/* Counted before the old Array is Unpublished, so a Reader which misses it retries */
+		_rebuilds.fetch_add(1, std::memory_order_release);
+		_old.store(nullptr, std::memory_order_release);
+		EpochManager::instance().retire(old, &ElementTable::release);
+	}
+}
+
+/// <summary>
+/// Function to get the DBElement associated with the Key. Caller must be Pinned.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>DBElement associated with the Key, nullptr if Key does not Exist</returns>
+DBElement * ElementTable::find(std::string_view key) const {
+	Slot * slot = locate(key, hashOf(key));
+	if (slot == nullptr)
+		return nullptr;
+	return slot->value.load(std::memory_order_acquire);
+}
+
+/// <summary>
+/// Function to get the DBElement and Document ID associated with the Key. Caller
+/// must hold the Writer Lock.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="document">Set to the Document ID associated with the Key if it Exists</param>
+/// <returns>DBElement associated with the Key, nullptr if Key does not Exist</returns>
+DBElement * ElementTable::find(std::string_view key, uint32_t& document) const {
+	Slot * slot = locate(key, hashOf(key));
+	if (slot == nullptr)
+		return nullptr;
+	document = slot->document;
+	return slot->value.load(std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Function to Hash a Key and Prefetch it's Control Group, the first stage of a
+/// Pipelined Lookup. Caller must be Pinned till the Lookup is finished.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>Hash of the Key, to be passed to prefetchSlot and find</returns>
+size_t ElementTable::prefetch(std::string_view key) const {
+	size_t hash = hashOf(key);
+	const Array * array = _array.load(std::memory_order_acquire);
+	prefetchAddress(array->control + ((hash >> 7) & (array->mask / GROUP_SIZE)) * GROUP_SIZE);
+	return hash;
+}
+
+/// <summary>
+/// Function to Prefetch the Slot of a Key whose Control Group was Prefetched, the
+/// second stage of a Pipelined Lookup. Prefetches the first Slot of the Group whose
+/// Fingerprint Matches, which is almost always the Key's Slot. Keys which are not in
+/// their first Group are left to find.
+/// </summary>
+/// <param name="hash">Hash returned by prefetch</param>
+void ElementTable::prefetchSlot(size_t hash) const {
+	const Array * array = _array.load(std::memory_order_acquire);
+	size_t group = (hash >> 7) & (array->mask / GROUP_SIZE);
+	uint32_t matches = matchGroup(array->control + group * GROUP_SIZE, (int8_t)(hash & 0x7F));
+	if (matches == 0)
+		return;
+	const Slot * slot = array->slots + group * GROUP_SIZE + lowestBit(matches);
+	prefetchAddress(slot);
+	prefetchAddress(reinterpret_cast<const char*>(slot + 1) - 1);
+}
+
+/// <summary>
+/// Function to get the DBElement associated with the Key using the Hash returned by
+/// prefetch, the last stage of a Pipelined Lookup. The table may have been rebuilt
+/// since, the Hash stays valid. Caller must be Pinned.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="hash">Hash returned by prefetch</param>
+/// <returns>DBElement associated with the Key, nullptr if Key does not Exist</returns>
+DBElement * ElementTable::find(std::string_view key, size_t hash) const {
+	Slot * slot = locate(key, hash);
+	if (slot == nullptr)
+		return nullptr;
+	return slot->value.load(std::memory_order_acquire);
+}
+
+/// <summary>
+/// Function to associate a DBElement and a Document ID with a new Key. Caller must
+/// hold the Writer Lock.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement to be associated with the Key</param>
+/// <param name="document">Document ID to be associated with the Key</param>
+/// <returns>True if Key was Inserted, False if Key already Exists</returns>
+bool ElementTable::insert(std::string_view key, DBElement * value, uint32_t document) {
+	size_t hash = hashOf(key);
+	if (_old.load(std::memory_order_relaxed) != nullptr)
+		rehash(_rehashSlots);
+	if (locate(key, hash) != nullptr)
+		return false;
+	Array * array = _array.load(std::memory_order_relaxed);
+	/* Keep at least one Slot in eight EMPTY so probes terminate quickly */
+	if ((array->used + 1) * 8 > (array->mask + 1) * 7) {
+		rebuild();
+		array = _array.load(std::memory_order_relaxed);
+	}
+	place(array, key, hash, value, document);
+	_size.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+/// <summary>
+/// Function to associate a new DBElement with an existing Key. Caller must hold the
+/// Writer Lock and Retire the returned DBElement.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">New DBElement to be associated with the Key</param>
+/// <returns>Previous DBElement associated with the Key, nullptr if Key does not Exist</returns>
+DBElement * ElementTable::replace(std::string_view key, DBElement * value) {
+	if (_old.load(std::memory_order_relaxed) != nullptr)
+		rehash(_rehashSlots);
+	Slot * slot = locate(key, hashOf(key));
+	if (slot == nullptr)
+		return nullptr;
+	return slot->value.exchange(value, std::memory_order_acq_rel);
+}
+
+/// <summary>
+/// Function to Remove a Key. The Slot is marked DELETED and keeps it's Key till the
+/// table is rebuilt. While the table is rebuilt the Key is Removed from the old Array
+/// too, where a moved Key still has a Slot. Caller must hold the Writer Lock and
+/// Retire the returned DBElement.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="document">If not nullptr, set to the Document ID which was associated with the Key</param>
+/// <returns>DBElement which was associated with the Key, nullptr if Key does not Exist</returns>
+DBElement * ElementTable::erase(std::string_view key, uint32_t * document) {
+	size_t hash = hashOf(key);
+	Array * old = _old.load(std::memory_order_relaxed);
+	if (old != nullptr) {
+		rehash(_rehashSlots);
+		old = _old.load(std::memory_order_relaxed);
+	}
+	Array * array = _array.load(std::memory_order_relaxed);
+	Slot * slot = locate(array, key, hash);
+	Slot * stale = old == nullptr ? nullptr : locate(old, key, hash);
+	if (slot == nullptr && stale == nullptr)
+		return nullptr;
+	DBElement * value = nullptr;
+	if (stale != nullptr) {
+		/* Only the DBElement of a Key which was not moved yet is current */
+		value = stale->value.exchange(nullptr, std::memory_order_acq_rel);
+		old->control[stale - old->slots].store(DELETED, std::memory_order_release);
+		if (document != nullptr)
+			*document = stale->document;
+	}
+	if (slot != nullptr) {
+		value = slot->value.exchange(nullptr, std::memory_order_acq_rel);
+		array->control[slot - array->slots].store(DELETED, std::memory_order_release);
+		if (document != nullptr)
+			*document = slot->document;
+	}
+	_size.fetch_sub(1, std::memory_order_relaxed);
+	return value;
+}
+
+/// <summary>
+/// Function to get the Number of Keys in the table.
+/// </summary>
+/// <returns>Number of Keys</returns>
+size_t ElementTable::size() const {
+	return _size.load(std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Function to get the Number of Slots in the table.
+/// </summary>
+/// <returns>Number of Slots</returns>
+size_t ElementTable::capacity() const {
+	return _array.load(std::memory_order_acquire)->mask + 1;
+}
+
+/// <summary>
+/// Function to get the Bytes used by the table. Includes the Control Words, the
+/// Slots and Keys too long to be stored inline, but not the DBElements.
+/// </summary>
+/// <returns>Bytes used by the table</returns>
+size_t ElementTable::memoryUsage() const {
+	Array * array = _array.load(std::memory_order_acquire);
+	Array * old = _old.load(std::memory_order_acquire);
+	size_t bytes = sizeof(ElementTable) + arrayBytes(array);
+	if (old != nullptr && old != array)
+		bytes += arrayBytes(old);
+	return bytes;
+}
+
+/// <summary>
+/// Function to get the Bytes used by an Array, it's Control Words, Slots and Keys
+/// too long to be stored inline.
+/// </summary>
+/// <param name="array">Array</param>
+/// <returns>Bytes used by the Array</returns>
+size_t ElementTable::arrayBytes(const Array * array) {
+	size_t bytes = sizeof(Array) + (array->mask + 1) * (1 + sizeof(Slot));
+	for (size_t index = 0; index <= array->mask; index++) {
+		if (array->control[index].load(std::memory_order_acquire) == EMPTY)
+			continue;
+		const Slot& slot = array->slots[index];
+		const char * data = slot.key.data();
+		if (data < reinterpret_cast<const char*>(&slot) || data >= reinterpret_cast<const char*>(&slot + 1))
+			bytes += slot.key.capacity() + 1;
+	}
+	return bytes;
+}
+
+#ifdef TEST_ELEMENTTABLE
+
+#include <thread>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test ElementTable Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	ElementTable * table = new ElementTable();
+
+	StringHelper::Title("TESTING ELEMENTTABLE PACKAGE", '=');
+	StringHelper::Title("Test insert and find Methods");
+	for (int index = 0; index < 1000; index++)
+		table->insert("key" + std::to_string(index), new DBElement("value" + std::to_string(index)));
+	{
+		EpochGuard guard;
+		std::cout << "\n > Size : " << table->size();
+		std::cout << "\n > find(\"key500\") : " << table->find("key500")->getData();
+		std::cout << "\n > find(\"key5000\") : " << (table->find("key5000") == nullptr ? "nullptr" : "found");
+		size_t hash = table->prefetch("key500");
+		table->prefetchSlot(hash);
+		std::cout << "\n > find(\"key500\", prefetch(\"key500\")) : " << table->find("key500", hash)->getData();
+		std::cout << "\n > insert(\"key1\") again : " << table->insert("key1", nullptr) << std::endl;
+	}
+	putline();
+
+	StringHelper::Title("Test sample Method");
+	{
+		EpochGuard guard;
+		std::string keys;
+		size_t visited = table->sample(table->capacity() - 3, 5, [&keys](const std::string& key, DBElement * value) { keys += " " + key; });
+		std::cout << "\n > Sampled " << visited << " Keys from the last Slots onwards :" << keys;
+		std::cout << "\n > Sample larger than the table : " << table->sample(12345, 5000, [](const std::string&, DBElement*) {}) << std::endl;
+	}
+	putline();
+
+	StringHelper::Title("Test replace and erase Methods while Readers are running");
+	std::atomic<bool> stop(false);
+	std::atomic<int> missing(0);
+	std::thread reader([&]() {
+		while (!stop) {
+			EpochGuard guard;
+			DBElement * value = table->find("key7");
+			if (value == nullptr || value->getData().empty())
+				missing++;
+		}
+	});
+	for (int index = 0; index < 20000; index++) {
+		EpochManager::instance().retire(table->replace("key7", new DBElement("value" + std::to_string(index))));
+		std::string key = "temp" + std::to_string(index);
+		table->insert(key, new DBElement(key));
+		if (index % 2 == 0)
+			EpochManager::instance().retire(table->erase(key));
+	}
+	stop = true;
+	reader.join();
+	std::cout << "\n > Lookups which missed \"key7\" : " << missing;
+	std::cout << "\n > Size : " << table->size() << ", Capacity : " << table->capacity();
+	std::cout << "\n > Bytes per Key : " << table->memoryUsage() / table->size() << std::endl;
+	putline();
+
+	table->forEach([](const std::string& key, DBElement * value) { delete value; });
+	delete table;
+	EpochManager::instance().synchronize();
+
+	StringHelper::Title("Test incremental rebuild while Readers are running");
+	table = new ElementTable();
+	DBElement * element = new DBElement("grown");
+	std::atomic<int> inserted(0);
+	std::atomic<int> lost(0);
+	stop = false;
+	std::thread checker([&]() {
+		for (int round = 0; !stop; round++) {
+			EpochGuard guard;
+			int count = inserted.load();
+			int key = count > 0 ? (int)((round * 7919LL) % count) : 2;
+			/* Every Key inserted so far and never erased must be found, even while it is being moved */
+			if (key % 3 != 2 && table->find("grow" + std::to_string(key)) == nullptr)
+				lost++;
+		}
+	});
+	size_t rebuilds = 0, visited = 0, size = 0;
+	bool wasRehashing = false;
+	for (int index = 0; index < 300000; index++) {
+		table->insert("grow" + std::to_string(index), element);
+		inserted.store(index + 1);
+		if (index % 3 == 0 && index > 0)
+			table->erase("grow" + std::to_string(index - 1));
+		if (table->rehashing() && !wasRehashing) {
+			rebuilds++;
+			if (rebuilds == 12) {
+				EpochGuard guard;
+				table->forEach([&visited](const std::string&, DBElement*) { visited++; });
+				size = table->size();
+			}
+		}
+		wasRehashing = table->rehashing();
+	}
+	stop = true;
+	checker.join();
+	std::cout << "\n > Rebuilds : " << rebuilds << ", Lookups which missed an inserted Key : " << lost;
+	std::cout << "\n > forEach during a rebuild visited every Key once : " << (visited == size);
+	table->setRehashSlots(0);
+	table->insert("one more", element);
+	std::cout << "\n > With rehashSlots 0, Rebuilding after the next Write : " << table->rehashing() << std::endl;
+	delete table;
+	delete element;
+	EpochManager::instance().synchronize();
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_ELEMENTTABLE
+
+#ifdef BENCH_ELEMENTTABLE
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/* Bytes and Blocks currently allocated through operator new */
+static std::atomic<long long> allocatedBytes(0);
+static std::atomic<long long> allocatedBlocks(0);
+
+/// <summary>
+/// Global operator new which keeps count of the allocated Bytes.
+/// </summary>
+void * operator new(size_t size) {
+	size_t * block = static_cast<size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+	if (block == nullptr)
+		throw std::bad_alloc();
+	*block = size;
+	allocatedBytes += size;
+	allocatedBlocks++;
+	return reinterpret_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+/// <summary>
+/// Global operator delete matching the counting operator new.
+/// </summary>
+void operator delete(void * pointer) noexcept {
+	if (pointer == nullptr)
+		return;
+	size_t * block = reinterpret_cast<size_t*>(static_cast<char*>(pointer) - sizeof(std::max_align_t));
+	allocatedBytes -= *block;
+	allocatedBlocks--;
+	std::free(block);
+}
+
+/// <summary>
+/// Global sized operator delete matching the counting operator new.
+/// </summary>
+void operator delete(void * pointer, size_t) noexcept {
+	operator delete(pointer);
+}
+
+/// <summary>
+/// Function to get Nanoseconds elapsed since a Start Time.
+/// </summary>
+/// <param name="start">Start Time</param>
+/// <returns>Nanoseconds elapsed</returns>
+double elapsed(std::chrono::steady_clock::time_point start) {
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// <summary>
+/// Function to Benchmark Insert and Lookup Latency and Memory of a Map.
+/// </summary>
+/// <param name="name">Name of the Map being Benchmarked</param>
+/// <param name="keys">Keys to Insert</param>
+/// <param name="order">Shuffled Indexes of the Keys used for Lookups</param>
+/// <param name="insert">Function to Insert a Key</param>
+/// <param name="find">Function to Lookup a Key</param>
+/// <param name="clear">Function to Destroy the Map</param>
+template <typename Insert, typename Find, typename Clear>
+void benchMap(const std::string& name, std::vector<std::string>& keys, std::vector<size_t>& order,
+	Insert insert, Find find, Clear clear) {
+	long long before = allocatedBytes, beforeBlocks = allocatedBlocks;
+	auto start = std::chrono::steady_clock::now();
+	for (std::string& key : keys)
+		insert(key);
+	double insertTime = elapsed(start) / keys.size();
+	/* Free Arrays Retired while growing before counting Bytes */
+	EpochManager::instance().synchronize();
+	long long bytes = allocatedBytes - before, blocks = allocatedBlocks - beforeBlocks;
+
+	size_t found = 0;
+	start = std::chrono::steady_clock::now();
+	for (size_t index : order)
+		found += find(keys[index]) ? 1 : 0;
+	double hitTime = elapsed(start) / order.size();
+
+	std::string missing = "missing";
+	start = std::chrono::steady_clock::now();
+	for (size_t index : order) {
+		missing.back() = (char)index;
+		found += find(missing) ? 1 : 0;
+	}
+	double missTime = elapsed(start) / order.size();
+	clear();
+
+	std::cout << "\n " << name << "\t Insert : " << insertTime << " ns\t Hit : " << hitTime
+		<< " ns\t Miss : " << missTime << " ns\t Bytes/Key : " << (double)bytes / keys.size()
+		<< "\t Allocations/Key : " << (double)blocks / keys.size()
+		<< (found != order.size() ? "\t (lookup mismatch)" : "");
+}
+
+/// <summary>
+/// Function to Benchmark Lookups of Keys one by one against Pipelined Lookups of
+/// Batches of Keys, which run each stage over the whole Batch before the next one.
+/// </summary>
+/// <param name="table">Populated ElementTable</param>
+/// <param name="requests">Keys in the table to Lookup, in random order</param>
+/// <param name="batch">Keys per Batch</param>
+void benchBatchedFind(ElementTable * table, std::vector<std::string>& requests, size_t batch) {
+	EpochGuard guard;
+	size_t found = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (const std::string& key : requests)
+		found += table->find(key)->getData().size();
+	double serial = elapsed(start) / requests.size();
+
+	std::vector<size_t> hashes(batch);
+	std::vector<DBElement*> values(batch);
+	start = std::chrono::steady_clock::now();
+	for (size_t first = 0; first < requests.size(); first += batch) {
+		size_t count = std::min(batch, requests.size() - first);
+		for (size_t index = 0; index < count; index++)
+			hashes[index] = table->prefetch(requests[first + index]);
+		for (size_t index = 0; index < count; index++)
+			table->prefetchSlot(hashes[index]);
+		for (size_t index = 0; index < count; index++) {
+			values[index] = table->find(requests[first + index], hashes[index]);
+			ElementTable::prefetchAddress(values[index]);
+		}
+		for (size_t index = 0; index < count; index++)
+			found -= values[index]->getData().size();
+	}
+	double pipelined = elapsed(start) / requests.size();
+	std::cout << "\n Batch : " << batch << "\t One by One : " << serial << " ns/Key\t Pipelined : " << pipelined
+		<< " ns/Key\t Speedup : " << serial / pipelined << (found != 0 ? "\t (lookup mismatch)" : "");
+}
+
+/// <summary>
+/// Function to Benchmark the Latency of every Insert into a growing ElementTable,
+/// printing Percentiles, the slowest Insert and the Inserts slower than 1 ms.
+/// </summary>
+/// <param name="keys">Keys to Insert</param>
+/// <param name="value">DBElement to Insert for every Key</param>
+/// <param name="slots">Slots moved per Write while Rebuilding, 0 to Rebuild at once</param>
+void benchInsertLatency(std::vector<std::string>& keys, DBElement * value, size_t slots) {
+	ElementTable * table = new ElementTable();
+	table->setRehashSlots(slots);
+	std::vector<double> samples(keys.size());
+	auto total = std::chrono::steady_clock::now();
+	for (size_t index = 0; index < keys.size(); index++) {
+		auto start = std::chrono::steady_clock::now();
+		table->insert(keys[index], value);
+		samples[index] = elapsed(start);
+	}
+	double seconds = elapsed(total) / 1e9;
+	delete table;
+	EpochManager::instance().synchronize();
+	size_t stalls = std::count_if(samples.begin(), samples.end(), [](double sample) { return sample > 1e6; });
+	std::sort(samples.begin(), samples.end());
+	auto percentile = [&samples](double share) { return samples[(size_t)(share * (samples.size() - 1))]; };
+	std::cout << "\n Rehash Slots : " << (slots == 0 ? std::string("all") : std::to_string(slots))
+		<< "\t p50 : " << percentile(0.5) << " ns\t p99 : " << percentile(0.99) << " ns\t p99.9 : " << percentile(0.999)
+		<< " ns\t p99.99 : " << percentile(0.9999) << " ns\t Max : " << samples.back() / 1e6 << " ms\t Inserts over 1 ms : "
+		<< stalls << "\t Total : " << seconds << " s";
+}
+
+/// <summary>
+/// Function to Benchmark ElementTable against std::unordered_map.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [key counts...] (default 1000000 10000000)</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	std::vector<size_t> counts;
+	for (int index = 1; index < argc; index++)
+		counts.push_back(std::stoul(argv[index]));
+	if (counts.empty())
+		counts = { 1000000, 10000000 };
+	DBElement * value = new DBElement("value");
+
+	StringHelper::Title("BENCHMARKING ELEMENTTABLE", '=');
+	for (size_t count : counts) {
+		std::vector<std::string> keys;
+		std::vector<size_t> order;
+		for (size_t index = 0; index < count; index++) {
+			keys.push_back("key" + std::to_string(index));
+			order.push_back(index);
+		}
+		std::shuffle(order.begin(), order.end(), std::mt19937_64(7));
+		StringHelper::Title("Keys : " + std::to_string(count), '~');
+
+		std::unordered_map<std::string, DBElement*> * map = new std::unordered_map<std::string, DBElement*>();
+		benchMap("unordered_map", keys, order,
+			[&](const std::string& key) { (*map)[key] = value; },
+			[&](const std::string& key) { return map->find(key) != map->end(); },
+			[&]() { delete map; });
+
+		ElementTable * table = new ElementTable();
+		benchMap("ElementTable ", keys, order,
+			[&](const std::string& key) { table->insert(key, value); },
+			[&](const std::string& key) { return table->find(key) != nullptr; },
+			[&]() { delete table; });
+		putline();
+
+		table = new ElementTable();
+		std::vector<DBElement*> values;
+		for (size_t index = 0; index < count; index++) {
+			values.push_back(new DBElement("value"));
+			table->insert(keys[index], values.back());
+		}
+		std::vector<std::string> requests;
+		for (size_t index : order)
+			requests.push_back(keys[index]);
+		for (size_t batch : { (size_t)32, (size_t)256 })
+			benchBatchedFind(table, requests, batch);
+		delete table;
+		for (DBElement * element : values)
+			delete element;
+		EpochManager::instance().synchronize();
+		putline();
+
+		for (size_t slots : { (size_t)0, (size_t)ElementTable::REHASH_SLOTS })
+			benchInsertLatency(keys, value, slots);
+		putline();
+	}
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_ELEMENTTABLE
@@ -0,0 +1,345 @@
+//////////////////////////////////////////////////////////////////
+// ElementTable.h   - Hash Table mapping Keys to DBElements     //
+//                    with Lock-Free Lookups.                   //
+// Version          - 1.6                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides ElementTable class which is the storage used by DBEngine
+ * Shards to map Keys to DBElements.
+ *
+ * ElementTable is an Open Addressing Hash Table. Keys are stored inline in a flat
+ * array of Slots and every Slot has a one byte Control Word which is either EMPTY,
+ * DELETED or holds 7 bits of the Key's Hash (the Fingerprint). Lookups scan Groups of
+ * 16 Control Words at once (using SSE2 when available) and only compare Keys whose
+ * Fingerprint matches, so a lookup usually touches one Control Group and one Slot.
+ * Keys are passed as std::string_view, a Key String is only built when a new Key is
+ * placed in a Slot.
+ *
+ * Lookups (find and forEach) take no locks and can run concurrently with a Writer.
+ * Writers (insert, replace and erase) must be serialized by the caller, DBEngine
+ * uses the Shard's Writer Lock for this. A Slot is never reused for another Key while
+ * it's array is published, erased Slots are only reclaimed when the array is rebuilt,
+ * which lets Readers compare Keys without locks. Readers must be Pinned using
+ * EpochGuard for as long as they use the Pointers returned by the table. Slot arrays
+ * which are replaced by Writers are Retired to the EpochManager, the DBElements
+ * returned by replace and erase must be Retired by the caller.
+ *
+ * When the table is seven eighths full (counting erased Slots) it is rebuilt into a
+ * new Array, twice as large if more than half the Slots hold Keys. The new Array is
+ * Published right away and the Keys are moved into it a few Slots at a time : every
+ * Write first moves the next rehashSlots Slots of the old Array, so no single Write
+ * pays for moving the whole table. While the old Array is being drained Lookups try
+ * the new Array first and then the old one, and Writers Update a Key in whichever
+ * Array holds it. Erasing a Key Removes it from both. Once every Slot was moved the
+ * old Array is Retired. With rehashSlots 0 the whole table is moved by the Write
+ * which fills it, as before.
+ *
+ * Every Slot also carries a Document ID chosen by the Writer when the Key is
+ * inserted. DBEngine uses it to refer to Keys from it's Tag Index. Document IDs are
+ * only meant for the Writer, Readers do not see them.
+ *
+ * A Lookup in a large table waits for up to three Cache Misses in turn : the Control
+ * Group, the Slot and then the DBElement. Callers looking up many Keys at once split
+ * the Lookup into stages and run every stage over all the Keys before the next one :
+ * prefetch(key) Hashes the Key and Prefetches it's Control Group, prefetchSlot(hash)
+ * Prefetches the Slot whose Fingerprint Matches and find(key, hash) finishes the
+ * Lookup, so the Misses of different Keys overlap instead of adding up.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - ElementTable(size_t capacity = 16)
+ * Constructor with Initial Number of Slots as Argument.
+ *
+ * - void setRehashSlots(size_t slots)
+ * Method to set the Slots moved per Write while the table is rebuilt, 0 to move all of them at once.
+ *
+ * - bool rehashing() const
+ * Method to Check whether Keys are still being moved out of an old Array.
+ *
+ * - DBElement * find(std::string_view key) const
+ * Method to get the DBElement associated with the Key, nullptr if Key does not Exist.
+ *
+ * - DBElement * find(std::string_view key, uint32_t& document) const
+ * Method to get the DBElement and Document ID associated with the Key. Writers only.
+ *
+ * - size_t prefetch(std::string_view key) const
+ * Method to Prefetch the Control Group of a Key, returns the Hash of the Key.
+ *
+ * - void prefetchSlot(size_t hash) const
+ * Method to Prefetch the Slot of a Key once it's Control Group was Prefetched.
+ *
+ * - DBElement * find(std::string_view key, size_t hash) const
+ * Method to get the DBElement associated with the Key, using the Hash returned by prefetch.
+ *
+ * - static void prefetchAddress(const void * address)
+ * Method to Prefetch the Cache Line holding an Address, for instance a DBElement found.
+ *
+ * - bool insert(std::string_view key, DBElement * value, uint32_t document = 0)
+ * Method to associate a DBElement and Document ID with a new Key. Returns False if the Key already Exists.
+ *
+ * - bool modify(std::string_view key, Function function)
+ * Method to Replace the DBElement of a Key with the one returned by function(value, document).
+ * Writers only.
+ *
+ * - DBElement * replace(std::string_view key, DBElement * value)
+ * Method to associate a new DBElement with an existing Key. Returns the previous DBElement.
+ *
+ * - DBElement * erase(std::string_view key, uint32_t * document = nullptr)
+ * Method to Remove a Key. Returns the DBElement (and Document ID) which was associated with it.
+ *
+ * - size_t size() const
+ * Method to get the Number of Keys in the table.
+ *
+ * - size_t capacity() const
+ * Method to get the Number of Slots in the table.
+ *
+ * - size_t memoryUsage() const
+ * Method to get the Bytes used by the table's arrays and out of line Key storage.
+ *
+ * - void forEach(Function function) const
+ * Method to call function(key, value) for every Key in the table.
+ *
+ * - size_t sample(size_t start, size_t count, Function function) const
+ * Method to call function(key, value) for count Keys found from the Slot start onwards.
+ * Keys still in the old Array of a rebuild are not Sampled.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * EpochManager.h, EpochManager.cpp, DBElement.h, DBElement.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Replaced Bucket Chains with Open Addressing over Control Groups and inline Slots.
+ * - Added Lookup and Insert Benchmark against std::unordered_map (BENCH_ELEMENTTABLE).
+ *
+ * ver 1.2 : 10/17/2026
+ * - Slots carry a Document ID set by the Writer.
+ *
+ * ver 1.3 : 10/17/2026
+ * - Keys are looked up using std::string_view so Lookups do not Allocate.
+ * - Added modify() so Writers can read and replace a DBElement with one Lookup.
+ *
+ * ver 1.4 : 10/17/2026
+ * - Added sample() for Sampled Eviction.
+ *
+ * ver 1.5 : 10/17/2026
+ * - Added prefetch(), prefetchSlot() and find(key, hash) to Pipeline the Lookups of
+ *   many Keys, and a Batched Lookup Benchmark.
+ *
+ * ver 1.6 : 10/17/2026
+ * - The table is rebuilt incrementally, Writes move rehashSlots Slots each, so no
+ *   Write stalls on a whole rebuild. Added an Insert Latency Histogram Benchmark.
+ *
+ */
+#ifndef ELEMENTTABLE_H
+#define ELEMENTTABLE_H
+
+#include "EpochManager.h"
+#include "../DBElement/DBElement.h"
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#endif
+
+/// <summary>
+/// Open Addressing Hash Table mapping Keys to DBElements which can be
+/// Read without Locks while a single Writer Modifies it.
+/// </summary>
+class ElementTable {
+public:
+	static const size_t GROUP_SIZE = 16;			// Number of Control Words scanned at once
+	static const size_t REHASH_SLOTS = 16;			// Slots of the old Array moved per Write while the table is rebuilt
+private:
+	static const int8_t EMPTY = -128;				// Control Word of a Slot which was never used
+	static const int8_t DELETED = -2;				// Control Word of a Slot whose Key was erased
+
+	/// <summary>
+	/// Slot holding a Key and it's DBElement. The Key never changes once the
+	/// Slot's Control Word is published.
+	/// </summary>
+	struct Slot {
+		std::string key;							// Key
+		std::atomic<DBElement*> value;				// DBElement associated with the Key
+		uint32_t document;							// Document ID associated with the Key (Writer only)
+	};
+
+	/// <summary>
+	/// Control Words and Slots of the table. Replaced as a whole when the table
+	/// is rebuilt.
+	/// </summary>
+	struct Array {
+		size_t mask;								// Number of Slots - 1
+		size_t used;								// Number of Slots which are not EMPTY
+		std::atomic<int8_t> * control;				// Control Word of every Slot
+		Slot * slots;								// Slots (Keys constructed only for used Slots)
+	};
+
+	std::atomic<Array*> _array;						// Current Array
+	std::atomic<Array*> _old;						// Array whose Keys are being moved into the current one, nullptr if none
+	std::atomic<size_t> _moved;						// Slots of the old Array already moved
+	std::atomic<size_t> _rebuilds;					// Number of rebuilds finished, Readers retry a miss if it changes
+	std::atomic<size_t> _size;						// Number of Keys
+	size_t _rehashSlots;							// Slots moved per Write, 0 to rebuild at once
+
+	static size_t hashOf(std::string_view key);
+	static Array * allocate(size_t capacity);
+	static void release(void * array);
+	static size_t arrayBytes(const Array * array);
+	static Slot * locate(const Array * array, std::string_view key, size_t hash);
+	static void place(Array * array, std::string_view key, size_t hash, DBElement * value, uint32_t document);
+	Slot * locate(std::string_view key, size_t hash) const;
+	void rebuild();
+	void rehash(size_t slots);
+public:
+	/* Constructor */
+	ElementTable(size_t capacity = 16);
+	ElementTable(const ElementTable&) = delete;
+	ElementTable& operator=(const ElementTable&) = delete;
+
+	/* Destructor */
+	~ElementTable();
+
+	/* Member Functions */
+	void setRehashSlots(size_t slots);
+	bool rehashing() const;
+	DBElement * find(std::string_view key) const;
+	DBElement * find(std::string_view key, uint32_t& document) const;
+	size_t prefetch(std::string_view key) const;
+	void prefetchSlot(size_t hash) const;
+	DBElement * find(std::string_view key, size_t hash) const;
+	static void prefetchAddress(const void * address);
+	bool insert(std::string_view key, DBElement * value, uint32_t document = 0);
+	template <typename Function> bool modify(std::string_view key, Function function);
+	DBElement * replace(std::string_view key, DBElement * value);
+	DBElement * erase(std::string_view key, uint32_t * document = nullptr);
+	size_t size() const;
+	size_t capacity() const;
+	size_t memoryUsage() const;
+	template <typename Function> void forEach(Function function) const;
+	template <typename Function> size_t sample(size_t start, size_t count, Function function) const;
+};
+
+/// <summary>
+/// Function to Replace the DBElement associated with a Key using a single Lookup.
+/// function(value, document) gets the current DBElement and Document ID of the Key
+/// and returns the DBElement to publish, returning value leaves the Key unchanged.
+/// Caller must hold the Writer Lock and Retire the replaced DBElement after this
+/// returns, function must not Modify the table.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="function">Function accepting (DBElement*, uint32_t) and returning DBElement*</param>
+/// <returns>True if Key Exists, False if otherwise</returns>
+template <typename Function>
+bool ElementTable::modify(std::string_view key, Function function) {
+	if (_old.load(std::memory_order_relaxed) != nullptr)
+		rehash(_rehashSlots);
+	Slot * slot = locate(key, hashOf(key));
+	if (slot == nullptr)
+		return false;
+	DBElement * current = slot->value.load(std::memory_order_relaxed);
+	DBElement * replacement = function(current, slot->document);
+	if (replacement != current)
+		slot->value.store(replacement, std::memory_order_release);
+	return true;
+}
+
+/// <summary>
+/// Function to Prefetch the Cache Line holding an Address into every Cache Level.
+/// Only a hint, the Address does not have to be valid.
+/// </summary>
+/// <param name="address">Address</param>
+inline void ElementTable::prefetchAddress(const void * address) {
+#if defined(_M_X64) || defined(_M_IX86)
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__)
+	__builtin_prefetch(address);
+#else
+	(void)address;
+#endif
+}
+
+/// <summary>
+/// Function to call function(key, value) for every Key in the table. Caller must be
+/// Pinned. Keys inserted or erased during the walk may or may not be visited. While
+/// the table is rebuilt, the Keys not moved yet are visited in the old Array and
+/// skipped in the current one, so every Key is visited once even if it is moved
+/// during the walk.
+/// </summary>
+/// <param name="function">Function accepting (const std::string&amp;, DBElement*)</param>
+template <typename Function>
+void ElementTable::forEach(Function function) const {
+	Array * array = _array.load(std::memory_order_acquire);
+	Array * old = _old.load(std::memory_order_acquire);
+	/* The rebuild Started after the current Array was Loaded, which still holds every Key */
+	if (old == array)
+		old = nullptr;
+	size_t moved = old == nullptr ? 0 : _moved.load(std::memory_order_acquire);
+	for (size_t index = moved; old != nullptr && index <= old->mask; index++) {
+		if (old->control[index].load(std::memory_order_acquire) < 0)
+			continue;
+		DBElement * value = old->slots[index].value.load(std::memory_order_acquire);
+		if (value != nullptr)
+			function(old->slots[index].key, value);
+	}
+	for (size_t index = 0; index <= array->mask; index++) {
+		if (array->control[index].load(std::memory_order_acquire) < 0)
+			continue;
+		const std::string& key = array->slots[index].key;
+		if (old != nullptr) {
+			Slot * slot = locate(old, key, hashOf(key));
+			if (slot != nullptr && (size_t)(slot - old->slots) >= moved)
+				continue;
+		}
+		DBElement * value = array->slots[index].value.load(std::memory_order_acquire);
+		if (value != nullptr)
+			function(key, value);
+	}
+}
+
+/// <summary>
+/// Function to call function(key, value) for the first count Keys found walking the
+/// Slots from start (modulo the Number of Slots) onwards. Since Keys are placed by
+/// their Hash, a random start gives a random Sample of Keys without visiting the
+/// whole table. Visits every Slot at most once. Caller must be Pinned.
+/// </summary>
+/// <param name="start">Slot to start from, usually random</param>
+/// <param name="count">Number of Keys to visit</param>
+/// <param name="function">Function accepting (const std::string&amp;, DBElement*)</param>
+/// <returns>Number of Keys visited, less than count only if the table holds fewer Keys</returns>
+template <typename Function>
+size_t ElementTable::sample(size_t start, size_t count, Function function) const {
+	Array * array = _array.load(std::memory_order_acquire);
+	size_t visited = 0;
+	for (size_t step = 0; step <= array->mask && visited < count; step++) {
+		size_t index = (start + step) & array->mask;
+		if (array->control[index].load(std::memory_order_acquire) < 0)
+			continue;
+		DBElement * value = array->slots[index].value.load(std::memory_order_acquire);
+		if (value != nullptr) {
+			function(array->slots[index].key, value);
+			visited++;
+		}
+	}
+	return visited;
+}
+
+#endif // !ELEMENTTABLE_H
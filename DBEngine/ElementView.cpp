@@ -0,0 +1,246 @@
+//////////////////////////////////////////////////////////////////
+// ElementView.cpp  - Pinned Zero-Copy Read Handle to a         //
+//                    DBElement stored in DBEngine.             //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "ElementView.h"
+
+/// <summary>
+/// Default Constructor. Creates an empty ElementView which does not Pin the Thread.
+/// </summary>
+ElementView::ElementView() : _element(nullptr), _decompressed(false) {}
+
+/// <summary>
+/// Constructor. Pins the Calling Thread so the DBElement is not Deleted while the
+/// ElementView is alive. Must be called while the Thread is already Pinned by the
+/// Reader which found the DBElement, so the Pin keeps that Reader's Epoch.
+/// </summary>
+/// <param name="element">DBElement to View, NULL for an empty ElementView</param>
+ElementView::ElementView(const DBElement * element) : _element(element), _decompressed(false) {
+	if (_element != nullptr)
+		EpochManager::instance().enter();
+}
+
+/// <summary>
+/// Move Constructor. The Pin is transferred along with the DBElement and the
+/// Decompressed Data.
+/// </summary>
+/// <param name="other">ElementView to Move from</param>
+ElementView::ElementView(ElementView&& other) noexcept
+	: _element(other._element), _buffer(std::move(other._buffer)), _decompressed(other._decompressed) {
+	other._element = nullptr;
+	other._decompressed = false;
+}
+
+/// <summary>
+/// Move Assignment Operator. Releases the currently viewed DBElement first.
+/// </summary>
+/// <param name="other">ElementView to Move from</param>
+/// <returns>This ElementView</returns>
+ElementView& ElementView::operator=(ElementView&& other) noexcept {
+	if (this != &other) {
+		reset();
+		_element = other._element;
+		_buffer = std::move(other._buffer);
+		_decompressed = other._decompressed;
+		other._element = nullptr;
+		other._decompressed = false;
+	}
+	return *this;
+}
+
+/// <summary>
+/// Destructor. Unpins the Thread if the ElementView is not empty.
+/// </summary>
+ElementView::~ElementView() {
+	reset();
+}
+
+/// <summary>
+/// Function to Check whether the ElementView refers to a DBElement.
+/// </summary>
+/// <returns>True if the Key was found, False if otherwise</returns>
+bool ElementView::valid() const {
+	return _element != nullptr;
+}
+
+/// <summary>
+/// Function to Check whether the ElementView refers to a DBElement.
+/// </summary>
+/// <returns>True if the Key was found, False if otherwise</returns>
+ElementView::operator bool() const {
+	return valid();
+}
+
+/// <summary>
+/// Function to get the Data of the viewed DBElement. A Compressed DBElement is
+/// Decompressed once into the ElementView's buffer. The view is valid till the
+/// ElementView is Destroyed, Moved or reset.
+/// </summary>
+/// <returns>Data, empty if the ElementView is empty</returns>
+std::string_view ElementView::data() const {
+	if (_element == nullptr)
+		return std::string_view();
+	if (!_element->isCompressed())
+		return _element->getDataView();
+	if (!_decompressed) {
+		_element->getDataView(_buffer);
+		_decompressed = true;
+	}
+	return _buffer;
+}
+
+/// <summary>
+/// Function to get the Bytes the viewed DBElement stores, a Codec Frame when it is
+/// Compressed. Never Copies or Decompresses.
+/// </summary>
+/// <returns>Stored Data, empty if the ElementView is empty</returns>
+std::string_view ElementView::storedData() const {
+	return _element != nullptr ? _element->getDataView() : std::string_view();
+}
+
+/// <summary>
+/// Function to Check whether the viewed DBElement is stored Compressed.
+/// </summary>
+/// <returns>True if storedData() is a Codec Frame</returns>
+bool ElementView::isCompressed() const {
+	return _element != nullptr && _element->isCompressed();
+}
+
+/// <summary>
+/// Function to get the sorted Tag IDs of the viewed DBElement.
+/// </summary>
+/// <returns>Span of Tag IDs, empty if the ElementView is empty</returns>
+ElementView::TagIdSpan ElementView::tagIds() const {
+	if (_element == nullptr)
+		return TagIdSpan{ nullptr, 0 };
+	return TagIdSpan{ _element->tagIds(), _element->getTagCount() };
+}
+
+/// <summary>
+/// Function to get the Number of Tags of the viewed DBElement.
+/// </summary>
+/// <returns>Number of Tags</returns>
+size_t ElementView::tagCount() const {
+	return _element != nullptr ? _element->getTagCount() : 0;
+}
+
+/// <summary>
+/// Function to get the Tag String of one of the Tag IDs of the viewed DBElement.
+/// </summary>
+/// <param name="id">Tag ID returned by tagIds()</param>
+/// <returns>Tag String</returns>
+const std::string& ElementView::tagName(uint32_t id) const {
+	return _element->dictionary()->name(id);
+}
+
+/// <summary>
+/// Function to get the Last Modified Timestamp of the viewed DBElement.
+/// </summary>
+/// <returns>Timestamp, 0 if the ElementView is empty</returns>
+long long int ElementView::lastModified() const {
+	return _element != nullptr ? _element->getlastModified() : 0;
+}
+
+/// <summary>
+/// Function to get the viewed DBElement. The pointer must not be used after the
+/// ElementView is Destroyed or reset.
+/// </summary>
+/// <returns>Viewed DBElement, NULL if the ElementView is empty</returns>
+const DBElement * ElementView::element() const {
+	return _element;
+}
+
+/// <summary>
+/// Function to Append the viewed DBElement in a Nicely Formatted Manner to a String.
+/// </summary>
+/// <param name="aggregator">String to which the DBElement is Appended</param>
+void ElementView::show(std::string& aggregator) const {
+	if (_element != nullptr)
+		_element->show(aggregator);
+}
+
+/// <summary>
+/// Function to Release the viewed DBElement and Unpin the Thread. The ElementView
+/// is empty afterwards.
+/// </summary>
+void ElementView::reset() {
+	_decompressed = false;
+	if (_element != nullptr) {
+		_element = nullptr;
+		EpochManager::instance().exit();
+	}
+}
+
+#ifdef TEST_ELEMENTVIEW
+
+#include <iostream>
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test ElementView Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	EpochManager& epochs = EpochManager::instance();
+
+	StringHelper::Title("TESTING ELEMENTVIEW PACKAGE", '=');
+	StringHelper::Title("Test Accessors");
+	DBElement * element = new DBElement("The Force is strong with this one.", { "Jedi", "Skywalker" });
+	ElementView view;
+	{
+		EpochGuard guard;
+		view = ElementView(element);
+	}
+	std::string aggregator;
+	view.show(aggregator);
+	std::cout << "\n > Valid : " << view.valid() << ", Data : " << view.data() << "\n > Tags :";
+	for (uint32_t id : view.tagIds())
+		std::cout << " " << id << " (" << view.tagName(id) << ")";
+	std::cout << "\n > show :\n" << aggregator << std::endl;
+	putline();
+
+	StringHelper::Title("Test Retired DBElement stays alive while Viewed");
+	epochs.retire(element);
+	for (int index = 0; index < 1000; index++)
+		epochs.retire(new DBElement("Clone"));
+	std::cout << "\n > Data after Retire : " << view.data();
+	std::cout << "\n > Objects Waiting to be Deleted : " << epochs.pending();
+	ElementView moved(std::move(view));
+	std::cout << "\n > Moved From is Valid : " << view.valid() << ", Moved To Data : " << moved.data();
+	moved.reset();
+	epochs.synchronize();
+	std::cout << "\n > Objects Waiting to be Deleted after reset : " << epochs.pending() << std::endl;
+	putline();
+
+	StringHelper::Title("Test Compressed DBElement");
+	element = new DBElement(std::string(100, '-') + " Help me, Obi-Wan Kenobi. " + std::string(100, '-'));
+	std::cout << "\n > Compressed : " << element->compress(64);
+	{
+		EpochGuard guard;
+		view = ElementView(element);
+	}
+	std::cout << "\n > isCompressed : " << view.isCompressed() << ", Stored Bytes : " << view.storedData().size() << ", Data Bytes : " << view.data().size();
+	std::cout << "\n > Data : " << view.data().substr(100, 26) << std::endl;
+	view.reset();
+	epochs.retire(element);
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_ELEMENTVIEW
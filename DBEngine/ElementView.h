@@ -0,0 +1,163 @@
+//////////////////////////////////////////////////////////////////
+// ElementView.h    - Pinned Zero-Copy Read Handle to a         //
+//                    DBElement stored in DBEngine.             //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides ElementView class which is returned by DBEngine::getView.
+ * An ElementView refers directly to the DBElement stored in the DBEngine instead of
+ * a Copy of it, and keeps the Calling Thread Pinned in the EpochManager for as long
+ * as it is alive. Writers which Replace or Remove the Key meanwhile Retire the old
+ * DBElement as usual, but it is not Deleted till the ElementView is Destroyed, so
+ * the Data and Tag IDs seen through the ElementView stay valid and unchanged.
+ *
+ * Data is exposed as a std::string_view and Tag IDs as a TagIdSpan over the sorted
+ * Tag ID array of the DBElement, so a reader can serialize a DBElement straight out
+ * of DBEngine memory without Allocating.
+ *
+ * DBElements which DBEngine stores Compressed are Decompressed by data() the first
+ * time it is called, into a buffer the ElementView owns, so the View stays valid
+ * just as long. Readers which can handle Codec Frames themselves, for instance to
+ * send them on as they are, use storedData() and isCompressed() and never pay for
+ * the Decompression.
+ *
+ * An ElementView can be Moved but not Copied. Since the Pin belongs to the Thread
+ * which created it, an ElementView must be Destroyed (or reset) on that Thread.
+ * While any ElementView is alive the EpochManager cannot Reclaim anything Retired
+ * after it was created, so ElementViews should be short lived (one Request) and
+ * must not outlive the DBEngine.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - ElementView(const DBElement * element)
+ * Constructor which Pins the Calling Thread if element is not NULL.
+ *
+ * - bool valid() const
+ * Method to Check whether the ElementView refers to a DBElement.
+ *
+ * - std::string_view data() const
+ * Method to get the Data of the DBElement, without Copying it unless it is Compressed.
+ *
+ * - std::string_view storedData() const
+ * Method to get the stored Bytes of the DBElement, a Codec Frame if it is Compressed.
+ *
+ * - bool isCompressed() const
+ * Method to Check whether the DBElement is stored Compressed.
+ *
+ * - TagIdSpan tagIds() const
+ * Method to get the sorted Tag IDs of the DBElement without Copying them.
+ *
+ * - size_t tagCount() const
+ * Method to get the Number of Tags of the DBElement.
+ *
+ * - const std::string& tagName(uint32_t id) const
+ * Method to get the Tag String of a Tag ID from the DBElement's TagDictionary.
+ *
+ * - void forEachTag(Function function) const
+ * Method to call function(tag) for every Tag of the DBElement.
+ *
+ * - long long int lastModified() const
+ * Method to get the Last Modified Timestamp of the DBElement.
+ *
+ * - void show(std::string& aggregator) const
+ * Method to Append the DBElement in a Nicely Formatted Manner to a String.
+ *
+ * - void reset()
+ * Method to Release the DBElement and Unpin the Thread before Destruction.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * DBElement.h, DBElement.cpp, EpochManager.h, EpochManager.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - data() Decompresses Compressed DBElements, added storedData() and isCompressed().
+ *
+ */
+#ifndef ELEMENTVIEW_H
+#define ELEMENTVIEW_H
+
+#include "EpochManager.h"
+#include "../DBElement/DBElement.h"
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+/// <summary>
+/// Epoch Pinned Read Only Handle to a DBElement stored in the DBEngine.
+/// </summary>
+class ElementView {
+public:
+	/// <summary>
+	/// Read Only Range over the sorted Tag IDs of a DBElement.
+	/// </summary>
+	struct TagIdSpan {
+		const uint32_t * first;						// First Tag ID
+		size_t count;								// Number of Tag IDs
+
+		const uint32_t * begin() const { return first; }
+		const uint32_t * end() const { return first + count; }
+		size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+		uint32_t operator[](size_t index) const { return first[index]; }
+	};
+private:
+	const DBElement * _element;						// Viewed DBElement, NULL if the View is empty
+	mutable std::string _buffer;					// Decompressed Data of a Compressed DBElement
+	mutable bool _decompressed;						// Buffer holds the Data of the viewed DBElement
+public:
+	/* Constructors */
+	ElementView();
+	explicit ElementView(const DBElement * element);
+	ElementView(const ElementView&) = delete;
+	ElementView(ElementView&& other) noexcept;
+	ElementView& operator=(const ElementView&) = delete;
+	ElementView& operator=(ElementView&& other) noexcept;
+
+	/* Destructor */
+	~ElementView();
+
+	/* Member Functions */
+	bool valid() const;
+	explicit operator bool() const;
+	std::string_view data() const;
+	std::string_view storedData() const;
+	bool isCompressed() const;
+	TagIdSpan tagIds() const;
+	size_t tagCount() const;
+	const std::string& tagName(uint32_t id) const;
+	template <typename Function> void forEachTag(Function function) const;
+	long long int lastModified() const;
+	const DBElement * element() const;
+	void show(std::string& aggregator) const;
+	void reset();
+};
+
+/// <summary>
+/// Method to call function(tag) for every Tag of the viewed DBElement in Tag ID
+/// order. The Tags are read from the TagDictionary so no Strings are copied.
+/// </summary>
+/// <param name="function">Function accepting (const std::string&amp;)</param>
+template <typename Function>
+void ElementView::forEachTag(Function function) const {
+	if (_element != nullptr)
+		_element->forEachTag(function);
+}
+
+#endif // !ELEMENTVIEW_H
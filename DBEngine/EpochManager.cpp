@@ -0,0 +1,265 @@
+//////////////////////////////////////////////////////////////////
+// EpochManager.cpp - Epoch Based Memory Reclamation for        //
+//                    Lock-Free Readers of DBEngine.            //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "EpochManager.h"
+
+#include <thread>
+
+/* Number of Retired Objects after which a Writer tries to Reclaim Memory */
+#define RECLAIM_THRESHOLD 64
+
+namespace {
+	/// <summary>
+	/// Record and Pin Nesting Depth of the Calling Thread. Gives the Record
+	/// back to the EpochManager when the Thread exits.
+	/// </summary>
+	struct ThreadState {
+		EpochManager::Record * record = nullptr;
+		unsigned int nesting = 0;
+
+		~ThreadState() {
+			if (record == nullptr)
+				return;
+			record->epoch.store(EpochManager::IDLE, std::memory_order_release);
+			record->inUse.store(false, std::memory_order_release);
+		}
+	};
+
+	thread_local ThreadState threadState;
+}
+
+/// <summary>
+/// Default Constructor for EpochManager.
+/// </summary>
+EpochManager::EpochManager() : _epoch(1), _records(nullptr), _reclaimAt(RECLAIM_THRESHOLD) {
+}
+
+/// <summary>
+/// Default Destructor for EpochManager. Deletes all Retired Objects and
+/// Thread Records.
+/// </summary>
+EpochManager::~EpochManager() {
+	reclaim(IDLE);
+	Record * record = _records.load();
+	while (record != nullptr) {
+		Record * next = record->next;
+		delete record;
+		record = next;
+	}
+}
+
+/// <summary>
+/// Function to get the Process Wide EpochManager.
+/// </summary>
+/// <returns>EpochManager used by all DBEngines</returns>
+EpochManager& EpochManager::instance() {
+	static EpochManager manager;
+	return manager;
+}
+
+/// <summary>
+/// Function to get a Record for the Calling Thread. Reuses Records released
+/// by exited Threads before allocating a new one.
+/// </summary>
+/// <returns>Record Owned by the Calling Thread</returns>
+EpochManager::Record * EpochManager::acquireRecord() {
+	for (Record * record = _records.load(); record != nullptr; record = record->next) {
+		bool expected = false;
+		if (!record->inUse.load(std::memory_order_relaxed) && record->inUse.compare_exchange_strong(expected, true))
+			return record;
+	}
+	Record * record = new Record();
+	record->epoch.store(IDLE);
+	record->inUse.store(true);
+	record->next = _records.load();
+	while (!_records.compare_exchange_weak(record->next, record));
+	return record;
+}
+
+/// <summary>
+/// Function to Pin the Current Epoch for the Calling Thread. Objects Retired
+/// after this call are not Deleted till the Thread calls exit.
+/// </summary>
+void EpochManager::enter() {
+	if (threadState.nesting++ > 0)
+		return;
+	if (threadState.record == nullptr)
+		threadState.record = acquireRecord();
+	threadState.record->epoch.store(_epoch.load(), std::memory_order_relaxed);
+	/* Either the Writer sees this Pin or this Reader sees the Writer's Unpublish */
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+/// <summary>
+/// Function to Unpin the Calling Thread.
+/// </summary>
+void EpochManager::exit() {
+	if (--threadState.nesting > 0)
+		return;
+	threadState.record->epoch.store(IDLE, std::memory_order_release);
+}
+
+/// <summary>
+/// Function to get the Oldest Epoch Pinned by any Thread.
+/// </summary>
+/// <returns>Oldest Pinned Epoch, IDLE if no Thread is Pinned</returns>
+uint64_t EpochManager::oldestPinnedEpoch() {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	uint64_t oldest = IDLE;
+	for (Record * record = _records.load(); record != nullptr; record = record->next) {
+		uint64_t epoch = record->epoch.load();
+		if (epoch < oldest)
+			oldest = epoch;
+	}
+	return oldest;
+}
+
+/// <summary>
+/// Function to Delete all Retired Objects which were Retired before the given Epoch.
+/// Objects which are still Pinned double the Threshold for the next Attempt so long
+/// lived Pins do not make every retire scan the whole list.
+/// </summary>
+/// <param name="safeEpoch">Objects Retired in an Epoch older than this are Deleted</param>
+void EpochManager::reclaim(uint64_t safeEpoch) {
+	std::vector<Retired> reclaimable;
+	{
+		std::lock_guard<std::mutex> lock(_retiredLock);
+		size_t kept = 0;
+		for (Retired& retired : _retired) {
+			if (retired.epoch < safeEpoch)
+				reclaimable.push_back(retired);
+			else
+				_retired[kept++] = retired;
+		}
+		_retired.resize(kept);
+		_reclaimAt = kept * 2 > RECLAIM_THRESHOLD ? kept * 2 : RECLAIM_THRESHOLD;
+	}
+	for (Retired& retired : reclaimable)
+		retired.deleter(retired.object);
+}
+
+/// <summary>
+/// Function to Retire an Object which has been Unpublished by a Writer. The Object is
+/// Deleted using the Deleter once every reader which could have seen it has Unpinned.
+/// </summary>
+/// <param name="object">Object which has been Unpublished by the Writer</param>
+/// <param name="deleter">Function which Deletes the Object</param>
+void EpochManager::retire(void * object, void(*deleter)(void*)) {
+	bool full = false;
+	{
+		std::lock_guard<std::mutex> lock(_retiredLock);
+		_retired.push_back({ object, deleter, _epoch.load() });
+		full = _retired.size() >= _reclaimAt;
+	}
+	if (!full)
+		return;
+	_epoch.fetch_add(1);
+	reclaim(oldestPinnedEpoch());
+}
+
+/// <summary>
+/// Function to Wait till every Thread which is Pinned has Unpinned and then Delete
+/// all the Retired Objects. Must not be called by a Pinned Thread.
+/// </summary>
+void EpochManager::synchronize() {
+	uint64_t target = _epoch.fetch_add(1) + 1;
+	while (oldestPinnedEpoch() < target)
+		std::this_thread::yield();
+	reclaim(target);
+}
+
+/// <summary>
+/// Function to get the Number of Retired Objects which have not been Deleted yet.
+/// </summary>
+/// <returns>Number of Retired Objects waiting to be Deleted</returns>
+size_t EpochManager::pending() {
+	std::lock_guard<std::mutex> lock(_retiredLock);
+	return _retired.size();
+}
+
+#ifdef TEST_EPOCHMANAGER
+
+#include <thread>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Object which Counts how many instances are Alive.
+/// </summary>
+struct Tracked {
+	static std::atomic<int> alive;
+	int value;
+	Tracked(int val) : value(val) { alive++; }
+	~Tracked() { value = -1; alive--; }
+};
+std::atomic<int> Tracked::alive(0);
+
+/// <summary>
+/// Function to Test EpochManager Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	EpochManager& epochs = EpochManager::instance();
+
+	StringHelper::Title("TESTING EPOCHMANAGER PACKAGE", '=');
+	StringHelper::Title("Test Retired Object is not Deleted while Pinned");
+	Tracked * object = new Tracked(42);
+	{
+		EpochGuard guard;
+		epochs.retire(object);
+		for (int index = 0; index < RECLAIM_THRESHOLD * 2; index++)
+			epochs.retire(new Tracked(index));
+		std::cout << "\n > Pinned Object Value : " << object->value;
+		std::cout << "\n > Objects Waiting to be Deleted : " << epochs.pending();
+	}
+	epochs.synchronize();
+	std::cout << "\n > Objects Alive after Synchronize : " << Tracked::alive << std::endl;
+	putline();
+
+	StringHelper::Title("Test Concurrent Readers and Writer");
+	std::atomic<Tracked*> shared(new Tracked(0));
+	std::atomic<bool> stop(false);
+	std::atomic<int> torn(0);
+	std::vector<std::thread> readers;
+	for (int id = 0; id < 4; id++) {
+		readers.push_back(std::thread([&]() {
+			while (!stop) {
+				EpochGuard guard;
+				if (shared.load()->value < 0)
+					torn++;
+			}
+		}));
+	}
+	for (int index = 1; index <= 100000; index++)
+		epochs.retire(shared.exchange(new Tracked(index)));
+	stop = true;
+	for (std::thread& reader : readers)
+		reader.join();
+	epochs.retire(shared.exchange(nullptr));
+	epochs.synchronize();
+	std::cout << "\n > Reads of Deleted Objects : " << torn;
+	std::cout << "\n > Objects Alive after Synchronize : " << Tracked::alive << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_EPOCHMANAGER
@@ -0,0 +1,150 @@
+//////////////////////////////////////////////////////////////////
+// EpochManager.h   - Epoch Based Memory Reclamation for        //
+//                    Lock-Free Readers of DBEngine.            //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides EpochManager and EpochGuard classes. They allow readers to
+ * access shared objects without taking any locks while writers replace or remove
+ * those objects concurrently.
+ *
+ * Readers Pin the current Epoch (using EpochGuard) for as long as they hold pointers
+ * to shared objects. Writers never delete an object which they have unpublished,
+ * instead they Retire it. A Retired object is only deleted once every reader which
+ * was Pinned when it was Retired has Unpinned, so readers never see freed memory.
+ *
+ * Readers should keep Pins short, an object can not be reclaimed while a reader which
+ * might have seen it is still Pinned.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - static EpochManager& instance()
+ * Method to get the Process Wide EpochManager.
+ *
+ * - void enter()
+ * Method to Pin the Current Epoch for the Calling Thread. Calls can be Nested.
+ *
+ * - void exit()
+ * Method to Unpin the Calling Thread.
+ *
+ * - void retire(void * object, void(*deleter)(void*))
+ * Method to Retire an Object which will be Deleted using the Deleter once no reader can see it.
+ *
+ * - void retire(T * object)
+ * Method to Retire an Object which will be Deleted using delete once no reader can see it.
+ *
+ * - void synchronize()
+ * Method to Wait till every reader which is Pinned has Unpinned and then Delete all Retired Objects.
+ * Must not be called while the calling thread is Pinned.
+ *
+ * - size_t pending()
+ * Method to get the Number of Retired Objects which have not been Deleted yet.
+ *
+ * - EpochGuard()
+ * Constructor which Pins the Calling Thread till the Guard goes out of scope.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef EPOCHMANAGER_H
+#define EPOCHMANAGER_H
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+/// <summary>
+/// Class which keeps track of the Epochs Pinned by reader threads and
+/// Deletes Retired Objects once no reader can be holding them.
+/// </summary>
+class EpochManager {
+public:
+	/// <summary>
+	/// Per Thread Record of the Epoch which is Pinned by the Thread.
+	/// </summary>
+	struct Record {
+		std::atomic<uint64_t> epoch;		// Epoch Pinned by the Thread, IDLE if Thread is not Pinned
+		std::atomic<bool> inUse;			// Whether a Thread Owns this Record
+		Record * next;						// Next Record in the Record List
+	};
+
+	static const uint64_t IDLE = UINT64_MAX;
+
+	/* Constructor */
+	EpochManager();
+	EpochManager(const EpochManager&) = delete;
+	EpochManager& operator=(const EpochManager&) = delete;
+
+	/* Destructor */
+	~EpochManager();
+
+	/* Member Functions */
+	static EpochManager& instance();
+	void enter();
+	void exit();
+	void retire(void * object, void(*deleter)(void*));
+	template <typename T> void retire(T * object);
+	void synchronize();
+	size_t pending();
+private:
+	/// <summary>
+	/// Object which has been Retired along with the Epoch it was Retired in.
+	/// </summary>
+	struct Retired {
+		void * object;
+		void(*deleter)(void*);
+		uint64_t epoch;
+	};
+
+	std::atomic<uint64_t> _epoch;			// Global Epoch
+	std::atomic<Record*> _records;			// List of Thread Records
+	std::mutex _retiredLock;				// Lock guarding Retired Objects
+	std::vector<Retired> _retired;			// Retired Objects waiting to be Deleted
+	size_t _reclaimAt;						// Number of Retired Objects at which Reclaim is Attempted
+
+	Record * acquireRecord();
+	uint64_t oldestPinnedEpoch();
+	void reclaim(uint64_t safeEpoch);
+};
+
+/// <summary>
+/// Function to Retire an Object which will be Deleted using delete once no
+/// reader can see it.
+/// </summary>
+/// <param name="object">Object which has been Unpublished by the Writer</param>
+template <typename T>
+void EpochManager::retire(T * object) {
+	retire(object, [](void * pointer) { delete static_cast<T*>(pointer); });
+}
+
+/// <summary>
+/// Class which Pins the Calling Thread for it's lifetime. Pointers read from
+/// shared structures are valid till the Guard is Destroyed.
+/// </summary>
+class EpochGuard {
+public:
+	EpochGuard() { EpochManager::instance().enter(); }
+	EpochGuard(const EpochGuard&) = delete;
+	EpochGuard& operator=(const EpochGuard&) = delete;
+	~EpochGuard() { EpochManager::instance().exit(); }
+};
+
+#endif // !EPOCHMANAGER_H
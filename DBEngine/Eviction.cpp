@@ -0,0 +1,417 @@
+//////////////////////////////////////////////////////////////////
+// Eviction.cpp     - Approximate LRU, LFU and TinyLFU          //
+//                    Eviction Policies of DBEngine.            //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "Eviction.h"
+
+#include <chrono>
+#include <functional>
+
+/* Seeds which give every Row of the Sketch it's own Hash Function */
+static const uint64_t rowSeeds[4] = { 0x97CB3127ULL, 0xC3A5C85C97CB3127ULL, 0xB492B66FBE98F273ULL, 0x9AE16A3B2F90404FULL };
+
+/// <summary>
+/// Default Constructor. Keys are not Evicted till configure() sets a Memory Limit.
+/// </summary>
+Eviction::Eviction() : _clock(0), _evictions(0), _rejected(0) {
+	configure(Options());
+}
+
+/// <summary>
+/// Function to set the Memory Limit and Policy. Sizes the TinyLFU Sketch from the
+/// Memory Limit, one Word (16 Counters) for every 256 Bytes, from 16 KB up to 8 MB.
+/// Must be called before the Eviction is used by other Threads.
+/// </summary>
+/// <param name="options">Memory Limit, Policy and Tuning</param>
+void Eviction::configure(const Options& options) {
+	_options = options;
+	if (_options.samples == 0)
+		_options.samples = 1;
+	if (_options.clockMillis < 1)
+		_options.clockMillis = 1;
+	if (_options.windowPercent > 100)
+		_options.windowPercent = 100;
+	_enabled = _options.memoryLimit != 0;
+	long long int ticks = _options.lfuDecayMillis / _options.clockMillis;
+	_decayTicks = CLOCK_MASK;
+	if (ticks < (long long int)_decayTicks)
+		_decayTicks = ticks < 1 ? 1 : (uint32_t)ticks;
+	for (uint32_t counter = 0; counter < 256; counter++) {
+		uint64_t base = counter > LFU_INIT ? counter - LFU_INIT : 0;
+		_increment[counter] = (uint32_t)(UINT32_MAX / (base * _options.lfuLogFactor + 1));
+	}
+	_increment[255] = 0;
+	std::lock_guard<std::mutex> lock(_sketchLock);
+	_sketch.clear();
+	_additions = 0;
+	if (_enabled && _options.policy == TINYLFU) {
+		size_t words = 2048;
+		while (words < ((size_t)1 << 20) && words < _options.memoryLimit / 256)
+			words <<= 1;
+		_sketch.assign(words, 0);
+		_resetAt = words * 10;
+	}
+	tick();
+}
+
+/// <summary>
+/// Function to Check whether a Memory Limit is set.
+/// </summary>
+/// <returns>True if Keys are Evicted</returns>
+bool Eviction::enabled() const {
+	return _enabled;
+}
+
+/// <summary>
+/// Function to get the Options, with the defaults applied by configure().
+/// </summary>
+/// <returns>Options</returns>
+const Eviction::Options& Eviction::options() const {
+	return _options;
+}
+
+/// <summary>
+/// Function for Writers to advance the Access Clock to the current time. The Clock
+/// is only Stored when it changes, so Writers of different Shards do not keep
+/// taking it's Cache Line from each other.
+/// </summary>
+void Eviction::tick() {
+	using namespace std::chrono;
+	long long int millis = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+	uint32_t now = (uint32_t)(millis / _options.clockMillis) & CLOCK_MASK;
+	if (_clock.load(std::memory_order_relaxed) != now)
+		_clock.store(now, std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Function to get the Access Clock.
+/// </summary>
+/// <returns>Access Clock, in periods of Options::clockMillis modulo 2^24</returns>
+uint32_t Eviction::clock() const {
+	return _clock.load(std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Function to get the Access Word of a new DBElement : Read now, LFU Counter at
+/// LFU_INIT so a new Key is not the first to go, for TinyLFU in the Admission Window.
+/// </summary>
+/// <returns>Access Word</returns>
+uint32_t Eviction::initial() const {
+	return (clock() << 8) | (_options.policy == TINYLFU ? WINDOW : LFU_INIT);
+}
+
+/// <summary>
+/// Function to get how long ago an Access Word was last stamped.
+/// </summary>
+/// <param name="access">Access Word</param>
+/// <returns>Access Clock periods since the last Read</returns>
+uint32_t Eviction::idle(uint32_t access) const {
+	return (clock() - (access >> 8)) & CLOCK_MASK;
+}
+
+/// <summary>
+/// Function to Check whether an Access Word belongs to a Key in the TinyLFU
+/// Admission Window. Always False for other Policies, which use the bit otherwise.
+/// </summary>
+/// <param name="access">Access Word</param>
+/// <returns>True if the Key waits for Admission</returns>
+bool Eviction::inWindow(uint32_t access) const {
+	return _options.policy == TINYLFU && (access & WINDOW) != 0;
+}
+
+/// <summary>
+/// Function to get the Bytes the TinyLFU Admission Window holds before it's Keys
+/// compete for Admission.
+/// </summary>
+/// <returns>windowPercent of the Memory Limit</returns>
+size_t Eviction::windowLimit() const {
+	return _options.memoryLimit / 100 * _options.windowPercent;
+}
+
+/// <summary>
+/// Function to get the LFU Counter of an Access Word after it has been Decayed for
+/// the time since it was last Read.
+/// </summary>
+/// <param name="access">Access Word</param>
+/// <param name="now">Access Clock</param>
+/// <returns>Decayed LFU Counter</returns>
+uint32_t Eviction::decayed(uint32_t access, uint32_t now) const {
+	uint32_t counter = access & 0xFF;
+	uint32_t idle = (now - (access >> 8)) & CLOCK_MASK;
+	if (idle < _decayTicks)
+		return counter;
+	uint32_t periods = idle / _decayTicks;
+	return periods > counter ? 0 : counter - periods;
+}
+
+/// <summary>
+/// Function to get the Access Word after a Read. Stamps the Access Clock and, for
+/// LFU, Decays the Counter and increments it with it's Logarithmic Probability.
+/// </summary>
+/// <param name="access">Access Word before the Read</param>
+/// <returns>Access Word after the Read</returns>
+uint32_t Eviction::touch(uint32_t access) {
+	uint32_t now = clock();
+	if (_options.policy != LFU)
+		return (now << 8) | (access & 0xFF);
+	uint32_t counter = decayed(access, now);
+	if ((uint32_t)random() < _increment[counter])
+		counter++;
+	return (now << 8) | counter;
+}
+
+/// <summary>
+/// Function to Hash a Key for the Sketch.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>64 bit Hash</returns>
+uint64_t Eviction::hashOf(std::string_view key) {
+	uint64_t hash = std::hash<std::string_view>()(key);
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDULL;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+/// <summary>
+/// Function to increment the Counters of a Hash in every Row of the Sketch, and to
+/// Halve all Counters once enough Increments were made. Counters stop at 15. The
+/// Hash picks a Block of the Sketch and every Row one of two Words in it.
+/// Caller must hold the Sketch Lock.
+/// </summary>
+/// <param name="hash">Hash of the Key</param>
+void Eviction::increment(uint64_t hash) {
+	bool added = false;
+	size_t block = (size_t)hash & (_sketch.size() - 1) & ~(size_t)(BLOCK_WORDS - 1);
+	for (uint32_t row = 0; row < 4; row++) {
+		uint64_t mixed = (hash + rowSeeds[row]) * 0x9E3779B97F4A7C15ULL;
+		uint64_t& word = _sketch[block + row * 2 + (size_t)(mixed >> 59 & 1)];
+		uint32_t shift = (uint32_t)(mixed >> 60) * 4;
+		if (((word >> shift) & 15) != 15) {
+			word += (uint64_t)1 << shift;
+			added = true;
+		}
+	}
+	if (!added || ++_additions < _resetAt)
+		return;
+	for (uint64_t& word : _sketch)
+		word = (word >> 1) & 0x7777777777777777ULL;
+	_additions /= 2;
+}
+
+/// <summary>
+/// Function to Estimate the Frequency of a Hash, the smallest of it's Counters.
+/// Caller must hold the Sketch Lock.
+/// </summary>
+/// <param name="hash">Hash of the Key</param>
+/// <returns>Estimated Frequency (0 - 15)</returns>
+uint32_t Eviction::estimate(uint64_t hash) const {
+	uint32_t frequency = 15;
+	size_t block = (size_t)hash & (_sketch.size() - 1) & ~(size_t)(BLOCK_WORDS - 1);
+	for (uint32_t row = 0; row < 4; row++) {
+		uint64_t mixed = (hash + rowSeeds[row]) * 0x9E3779B97F4A7C15ULL;
+		uint64_t word = _sketch[block + row * 2 + (size_t)(mixed >> 59 & 1)];
+		uint32_t counter = (uint32_t)(word >> ((uint32_t)(mixed >> 60) * 4)) & 15;
+		if (counter < frequency)
+			frequency = counter;
+	}
+	return frequency;
+}
+
+/// <summary>
+/// Function to Record an Access of a Key, found or not, for TinyLFU. The Key's
+/// Hash goes to a Buffer of the calling Thread, a full Buffer is Applied to the
+/// Sketch if it's Lock is free and dropped otherwise, so Readers never Wait.
+/// Does nothing for other Policies.
+/// </summary>
+/// <param name="key">Key which was Read</param>
+void Eviction::record(std::string_view key) {
+	if (_sketch.empty())
+		return;
+	struct ReadBuffer {
+		const Eviction * owner;
+		size_t count;
+		uint64_t hashes[READ_BUFFER];
+	};
+	thread_local ReadBuffer buffer = { nullptr, 0, {} };
+	if (buffer.owner != this) {
+		buffer.owner = this;
+		buffer.count = 0;
+	}
+	buffer.hashes[buffer.count++] = hashOf(key);
+	if (buffer.count < READ_BUFFER)
+		return;
+	buffer.count = 0;
+	std::unique_lock<std::mutex> lock(_sketchLock, std::try_to_lock);
+	if (!lock.owns_lock())
+		return;
+	for (size_t index = 0; index < READ_BUFFER; index++)
+		increment(buffer.hashes[index]);
+}
+
+/// <summary>
+/// Function to get the Estimated Frequency of a Key from the TinyLFU Sketch.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>Estimated Frequency (0 - 15), 0 for other Policies</returns>
+uint32_t Eviction::frequency(std::string_view key) {
+	std::lock_guard<std::mutex> lock(_sketchLock);
+	if (_sketch.empty())
+		return 0;
+	return estimate(hashOf(key));
+}
+
+/// <summary>
+/// Function to Rank a Sampled Key. The highest Ranked Key of a Sample is Evicted :
+/// LRU Ranks by Idle Time, LFU by the inverse of the Decayed Counter and TINYLFU by
+/// the inverse of the Estimated Frequency, both then by Idle Time.
+/// </summary>
+/// <param name="key">Sampled Key</param>
+/// <param name="access">Access Word of it's DBElement</param>
+/// <returns>Rank, higher is Evicted first</returns>
+uint64_t Eviction::rank(std::string_view key, uint32_t access) {
+	uint64_t period = idle(access);
+	if (_options.policy == LRU)
+		return period;
+	if (_options.policy == LFU)
+		return ((uint64_t)(255 - decayed(access, clock())) << 24) | period;
+	return ((uint64_t)(15 - frequency(key)) << 24) | period;
+}
+
+/// <summary>
+/// Function for TinyLFU Admission. The Candidate leaving the Admission Window
+/// replaces the Victim only if the Sketch has seen it more often, a Candidate which
+/// loses is Counted as Rejected.
+/// </summary>
+/// <param name="candidate">Key leaving the Admission Window</param>
+/// <param name="victim">Key the Candidate would replace</param>
+/// <returns>True if the Victim should be Evicted, False for the Candidate</returns>
+bool Eviction::admit(std::string_view candidate, std::string_view victim) {
+	bool admitted;
+	{
+		std::lock_guard<std::mutex> lock(_sketchLock);
+		admitted = _sketch.empty() || estimate(hashOf(candidate)) > estimate(hashOf(victim));
+	}
+	if (!admitted)
+		_rejected.fetch_add(1, std::memory_order_relaxed);
+	return admitted;
+}
+
+/// <summary>
+/// Function to Count an Evicted Key.
+/// </summary>
+void Eviction::evicted() {
+	_evictions.fetch_add(1, std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Function to get the Counters. The DBEngine fills in the Bytes it holds.
+/// </summary>
+/// <returns>Memory Limit, Evicted and Rejected Keys</returns>
+Eviction::Stats Eviction::stats() const {
+	Stats stats;
+	stats.memoryLimit = _options.memoryLimit;
+	stats.evictions = _evictions.load(std::memory_order_relaxed);
+	stats.rejected = _rejected.load(std::memory_order_relaxed);
+	return stats;
+}
+
+/// <summary>
+/// Function to get a Pseudo Random Number (xorshift64*) from a Generator of the
+/// calling Thread, cheap enough to draw on every Read.
+/// </summary>
+/// <returns>Pseudo Random Number</returns>
+uint64_t Eviction::random() {
+	thread_local uint64_t state = 0;
+	if (state == 0)
+		state = ((uint64_t)(uintptr_t)&state * 0x9E3779B97F4A7C15ULL) | 1;
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	return state * 0x2545F4914F6CDD1DULL;
+}
+
+#ifdef TEST_EVICTION
+
+#include <thread>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test Eviction Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+
+	StringHelper::Title("TESTING EVICTION PACKAGE", '=');
+	StringHelper::Title("Test LRU Ranks by Idle Time");
+	Eviction lru;
+	Eviction::Options options;
+	options.memoryLimit = 1 << 20;
+	options.clockMillis = 1;
+	lru.configure(options);
+	uint32_t old = lru.initial();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	lru.tick();
+	uint32_t fresh = lru.initial();
+	std::cout << "\n > Old Rank above New Rank : " << (lru.rank("old", old) > lru.rank("new", fresh));
+	std::cout << "\n > Touch Stamps the Clock : " << (lru.touch(old) == fresh) << ", Touch within the Period Stores nothing : " << (lru.touch(fresh) == fresh) << std::endl;
+	putline();
+
+	StringHelper::Title("Test LFU Counter grows Logarithmically and Decays");
+	Eviction lfu;
+	options.policy = Eviction::LFU;
+	options.lfuDecayMillis = 1000;
+	lfu.configure(options);
+	uint32_t access = lfu.initial();
+	size_t reads = 0;
+	std::cout << "\n > Counter after Reads :";
+	for (size_t target : { (size_t)100, (size_t)1000, (size_t)100000, (size_t)1000000 }) {
+		for (; reads < target; reads++)
+			access = lfu.touch(access);
+		std::cout << " " << target << " -> " << (access & 0xFF);
+	}
+	uint32_t idle = (((lfu.clock() - 3000) & Eviction::CLOCK_MASK) << 8) | 20;
+	uint32_t recent = (lfu.clock() << 8) | 20;
+	std::cout << "\n > Counter 20 idle for 3 Decay Periods after a Read : " << ((lfu.touch(idle) & 0xFF) <= 18);
+	std::cout << "\n > Idle Key Ranked above Recent Key : " << (lfu.rank("idle", idle) > lfu.rank("recent", recent)) << std::endl;
+	putline();
+
+	StringHelper::Title("Test TinyLFU Sketch");
+	Eviction tinylfu;
+	options.policy = Eviction::TINYLFU;
+	tinylfu.configure(options);
+	for (size_t index = 0; index < 1024; index++)
+		tinylfu.record(index % 2 == 0 ? "hot" : "warm" + std::to_string(index % 8));
+	std::cout << "\n > Frequency of hot : " << tinylfu.frequency("hot") << ", warm1 : " << tinylfu.frequency("warm1")
+		<< ", cold : " << tinylfu.frequency("cold");
+	std::cout << "\n > Rank of cold above Rank of hot : " << (tinylfu.rank("cold", tinylfu.initial()) > tinylfu.rank("hot", tinylfu.initial()));
+	std::cout << "\n > New Key in Window : " << tinylfu.inWindow(tinylfu.initial()) << ", Window Limit : " << tinylfu.windowLimit();
+	std::cout << "\n > Admit hot over cold : " << tinylfu.admit("hot", "cold") << ", Admit cold over hot : " << tinylfu.admit("cold", "hot")
+		<< ", Rejected : " << tinylfu.stats().rejected;
+	for (size_t index = 0; index < 200000; index++)
+		tinylfu.record("key" + std::to_string(index));
+	std::cout << "\n > Frequency of hot after Aging : " << tinylfu.frequency("hot") << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_EVICTION
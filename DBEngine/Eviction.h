@@ -0,0 +1,227 @@
+//////////////////////////////////////////////////////////////////
+// Eviction.h       - Approximate LRU, LFU and TinyLFU          //
+//                    Eviction Policies of DBEngine.            //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides Eviction class which decides which Keys a DBEngine with a
+ * Memory Limit Evicts. Eviction does not hold Keys itself : the DBEngine Samples a
+ * few Keys of a Shard and Evicts the one Eviction ranks highest, which approximates
+ * the Policy without keeping a global List or Heap the Readers would have to Lock.
+ *
+ * Every DBElement carries a 32 bit Access Word (DBElement::getAccess). The upper 24
+ * bits hold the Access Clock at the last Read, the lower 8 bits a Logarithmic Access
+ * Counter. The Access Clock counts Options::clockMillis and is advanced by Writers
+ * (tick) and by every TICK_READS-th Read of a Thread, so Reads mostly just Load it.
+ * A Read rewrites the Access Word only when it changes, so Keys Read many times
+ * within a Clock period cost no Stores.
+ *
+ * - LRU Ranks a Key by how long it has not been Read.
+ * - LFU Ranks a Key by it's Access Counter. The Counter starts at LFU_INIT and is
+ *   incremented with Probability 1 / ((counter - LFU_INIT) * lfuLogFactor + 1), so
+ *   255 stands for about a million Reads, and it is Decremented once for every
+ *   lfuDecayMillis the Key is not Read, so Keys which stopped being Read Age out.
+ *   Ties are broken by Recency.
+ * - TINYLFU (W-TinyLFU) keeps the Frequency of every Key Read, found or not, in a
+ *   Count-Min Sketch of 4 bit Counters sized from the Memory Limit. The 4 Counters
+ *   of a Key lie in one 64 Byte Block, so Recording a Key touches one Cache Line.
+ *   All Counters are Halved after 10 Increments per Word of the Sketch, so the
+ *   Frequencies Age. New Keys enter an Admission Window of windowPercent of the
+ *   Memory Limit, marked by the WINDOW bit of their Access Word. Once the Window
+ *   is full it's Key Read longest ago is the Candidate, which is Admitted to the
+ *   rest of the DBEngine only if it's Frequency is higher than that of the Victim,
+ *   otherwise the Candidate is Evicted, so one-off Keys cannot push out Keys Read
+ *   often while recent Keys still get a chance. Victims are Ranked by Estimated
+ *   Frequency. Readers Record Keys into a small per Thread Buffer which is Applied
+ *   to the Sketch when it is full and the Sketch is not Locked, otherwise it is
+ *   dropped.
+ *
+ * Eviction is Thread Safe.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - void configure(const Options& options)
+ * Method to set the Memory Limit and Policy, before the Eviction is used.
+ *
+ * - bool enabled() const
+ * Method to Check whether a Memory Limit is set.
+ *
+ * - const Options& options() const
+ * Method to get the Options.
+ *
+ * - void tick()
+ * Method for Writers to advance the Access Clock to the current time.
+ *
+ * - uint32_t clock() const
+ * Method to get the Access Clock.
+ *
+ * - uint32_t initial() const
+ * Method to get the Access Word of a new DBElement.
+ *
+ * - uint32_t idle(uint32_t access) const
+ * Method to get the Access Clock periods since an Access Word was last stamped.
+ *
+ * - bool inWindow(uint32_t access) const
+ * Method to Check whether an Access Word belongs to a Key in the TinyLFU Admission Window.
+ *
+ * - size_t windowLimit() const
+ * Method to get the Bytes of the TinyLFU Admission Window.
+ *
+ * - uint32_t touch(uint32_t access)
+ * Method to get the Access Word after a Read.
+ *
+ * - void touch(const DBElement * value)
+ * Method to Record a Read of a DBElement in it's Access Word.
+ *
+ * - void record(std::string_view key)
+ * Method to Record an Access of a Key, found or not, in the TinyLFU Sketch.
+ *
+ * - uint32_t frequency(std::string_view key)
+ * Method to get the Estimated Frequency of a Key from the TinyLFU Sketch.
+ *
+ * - uint64_t rank(std::string_view key, uint32_t access)
+ * Method to Rank a Sampled Key, the highest Ranked Key of a Sample is Evicted.
+ *
+ * - bool admit(std::string_view candidate, std::string_view victim)
+ * Method to decide whether a Candidate leaving the Admission Window replaces a Victim.
+ *
+ * - void evicted()
+ * Method to Count an Evicted Key.
+ *
+ * - Stats stats() const
+ * Method to get the Counters (the DBEngine fills in the Memory in use).
+ *
+ * - static uint64_t random()
+ * Method to get a Pseudo Random Number from a per Thread Generator.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * DBElement.h, DBElement.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef EVICTION_H
+#define EVICTION_H
+
+#include "../DBElement/DBElement.h"
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+/// <summary>
+/// Memory Limit and Eviction Policy of a DBEngine, ranks Sampled Keys
+/// and keeps the Access Clock and the TinyLFU Sketch.
+/// </summary>
+class Eviction {
+public:
+	static const uint32_t LFU_INIT = 5;												// Access Counter of a new DBElement
+	static const uint32_t CLOCK_MASK = 0xFFFFFF;									// Access Clock wraps around after 2^24 periods
+	static const uint32_t TICK_READS = 64;											// Reads of a Thread per Access Clock advance, a power of 2
+	static const uint32_t WINDOW = 1;												// TinyLFU : Access Word bit of a Key in the Admission Window
+
+	enum Policy { LRU, LFU, TINYLFU };
+
+	/// <summary>
+	/// Memory Limit and Policy. Keys are only Evicted while memoryLimit is set.
+	/// </summary>
+	struct Options {
+		size_t memoryLimit = 0;														// Bytes of Keys and DBElements above which Keys are Evicted, 0 to never Evict
+		Policy policy = LRU;
+		size_t samples = 5;															// Keys Sampled per Eviction
+		long long int clockMillis = 10;												// Resolution of the Access Clock
+		uint32_t lfuLogFactor = 10;													// Higher makes the LFU Counter grow slower
+		long long int lfuDecayMillis = 60000;										// The LFU Counter drops by one for every period a Key is not Read
+		size_t windowPercent = 1;													// TinyLFU : Share of the Memory Limit new Keys are held in before Admission
+	};
+
+	/// <summary>
+	/// Counters of a DBEngine's Eviction.
+	/// </summary>
+	struct Stats {
+		size_t memoryBytes = 0;														// Approximate Bytes of the Keys and DBElements held
+		size_t memoryLimit = 0;
+		uint64_t evictions = 0;														// Keys Evicted
+		uint64_t rejected = 0;														// Keys of the Admission Window which lost to a Victim
+	};
+private:
+	static const size_t READ_BUFFER = 64;											// Reads a Thread Records before Applying them to the Sketch
+	static const size_t BLOCK_WORDS = 8;											// Words of a Sketch Block, the Counters of a Key share one Block
+
+	Options _options;
+	bool _enabled = false;
+	uint32_t _decayTicks = 1;														// Access Clock periods per LFU Decrement
+	uint32_t _increment[256];														// Probability of incrementing each LFU Counter, scaled to 2^32
+	std::atomic<uint32_t> _clock;													// Access Clock
+	std::atomic<uint64_t> _evictions;
+	std::atomic<uint64_t> _rejected;
+	std::mutex _sketchLock;															// Lock guarding the Sketch
+	std::vector<uint64_t> _sketch;													// Count-Min Sketch, 16 Counters of 4 bits per Word
+	uint64_t _additions = 0;														// Increments since the Sketch was last Halved
+	uint64_t _resetAt = 0;															// Increments which Halve the Sketch
+
+	uint32_t decayed(uint32_t access, uint32_t now) const;
+	static uint64_t hashOf(std::string_view key);
+	void increment(uint64_t hash);
+	uint32_t estimate(uint64_t hash) const;
+public:
+	/* Constructor */
+	Eviction();
+	Eviction(const Eviction&) = delete;
+	Eviction& operator=(const Eviction&) = delete;
+
+	/* Member Functions */
+	void configure(const Options& options);
+	bool enabled() const;
+	const Options& options() const;
+	void tick();
+	uint32_t clock() const;
+	uint32_t initial() const;
+	uint32_t idle(uint32_t access) const;
+	bool inWindow(uint32_t access) const;
+	size_t windowLimit() const;
+	uint32_t touch(uint32_t access);
+	void touch(const DBElement * value);
+	void record(std::string_view key);
+	uint32_t frequency(std::string_view key);
+	uint64_t rank(std::string_view key, uint32_t access);
+	bool admit(std::string_view candidate, std::string_view victim);
+	void evicted();
+	Stats stats() const;
+	static uint64_t random();
+};
+
+/// <summary>
+/// Function to Record a Read of a DBElement. Only Stores the Access Word when the
+/// Read changes it, which is what keeps Reads of hot Keys cheap, and advances the
+/// Access Clock every TICK_READS Reads so it does not stall without Writers. The
+/// Store is dropped if a Writer changed the Access Word meanwhile.
+/// </summary>
+/// <param name="value">DBElement which was Read</param>
+inline void Eviction::touch(const DBElement * value) {
+	thread_local uint32_t reads = 0;
+	if ((++reads & (TICK_READS - 1)) == 0)
+		tick();
+	uint32_t access = value->getAccess();
+	uint32_t touched = touch(access);
+	if (touched != access)
+		value->replaceAccess(access, touched);
+}
+
+#endif // !EVICTION_H
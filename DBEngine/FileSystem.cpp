@@ -0,0 +1,321 @@
+//////////////////////////////////////////////////////////////////
+// FileSystem.cpp   - Files and Memory Mapped Files used        //
+//                    by DBEngine Persistence.                  //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "FileSystem.h"
+
+#include <cstdio>
+#include <algorithm>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <io.h>
+#include <share.h>
+#include <direct.h>
+#include <fcntl.h>
+#include <windows.h>
+#include <sys/stat.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/// <summary>
+/// Default Constructor. No File is open.
+/// </summary>
+File::File() : _file(-1) {}
+
+/// <summary>
+/// Destructor. Closes the File.
+/// </summary>
+File::~File() {
+	close();
+}
+
+/// <summary>
+/// Function to open a File for Writing. APPEND keeps the contents and Writes at the
+/// end, CREATE Empties the File. The File is Created if it does not Exist.
+/// </summary>
+/// <param name="path">Path of the File</param>
+/// <param name="mode">APPEND or CREATE</param>
+/// <returns>True if the File is open</returns>
+bool File::open(const std::string& path, Mode mode) {
+	close();
+#ifdef _WIN32
+	int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (mode == APPEND ? _O_APPEND : _O_TRUNC);
+	_sopen_s(&_file, path.c_str(), flags, _SH_DENYNO, _S_IREAD | _S_IWRITE);
+#else
+	int flags = O_WRONLY | O_CREAT | (mode == APPEND ? O_APPEND : O_TRUNC);
+	_file = ::open(path.c_str(), flags, 0644);
+#endif
+	return _file >= 0;
+}
+
+/// <summary>
+/// Function to Check whether a File is open.
+/// </summary>
+/// <returns>True if a File is open</returns>
+bool File::isOpen() const {
+	return _file >= 0;
+}
+
+/// <summary>
+/// Function to Write a Block of Bytes, retrying Partial Writes.
+/// </summary>
+/// <param name="data">Bytes</param>
+/// <param name="size">Number of Bytes</param>
+/// <returns>True if every Byte was Written</returns>
+bool File::write(const void * data, size_t size) {
+	const char * bytes = static_cast<const char*>(data);
+	while (size > 0) {
+#ifdef _WIN32
+		int written = _write(_file, bytes, (unsigned int)std::min<size_t>(size, 1u << 30));
+#else
+		ssize_t written = ::write(_file, bytes, size);
+		if (written < 0 && errno == EINTR)
+			continue;
+#endif
+		if (written <= 0)
+			return false;
+		bytes += written;
+		size -= written;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Flush the Written Bytes of the File to the Disk.
+/// </summary>
+/// <returns>True if the Bytes are on the Disk</returns>
+bool File::sync() {
+#if defined(_WIN32)
+	return _commit(_file) == 0;
+#elif defined(__linux__)
+	return ::fdatasync(_file) == 0;
+#else
+	return ::fsync(_file) == 0;
+#endif
+}
+
+/// <summary>
+/// Function to Cut the File back to the given Size.
+/// </summary>
+/// <param name="size">New Size in Bytes</param>
+/// <returns>True if the File was Truncated</returns>
+bool File::truncate(uint64_t size) {
+#ifdef _WIN32
+	return _chsize_s(_file, (long long)size) == 0;
+#else
+	return ::ftruncate(_file, (off_t)size) == 0;
+#endif
+}
+
+/// <summary>
+/// Function to Close the File.
+/// </summary>
+void File::close() {
+	if (_file < 0)
+		return;
+#ifdef _WIN32
+	_close(_file);
+#else
+	::close(_file);
+#endif
+	_file = -1;
+}
+
+/// <summary>
+/// Function to Rename a File over another one. Readers see either the old or the
+/// new File, never a partially Written one.
+/// </summary>
+/// <param name="from">File to Rename</param>
+/// <param name="to">File to Replace</param>
+/// <returns>True if the File was Replaced</returns>
+bool File::replace(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+	return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+/// <summary>
+/// Function to Delete a File.
+/// </summary>
+/// <param name="path">Path of the File</param>
+/// <returns>True if the File was Deleted</returns>
+bool File::remove(const std::string& path) {
+	return std::remove(path.c_str()) == 0;
+}
+
+/// <summary>
+/// Function to Create a Directory. Parent Directories must already Exist.
+/// </summary>
+/// <param name="path">Path of the Directory</param>
+/// <returns>True if the Directory was Created or already Exists</returns>
+bool File::makeDirectory(const std::string& path) {
+	struct stat status;
+	if (::stat(path.c_str(), &status) == 0)
+		return (status.st_mode & S_IFDIR) != 0;
+#ifdef _WIN32
+	return _mkdir(path.c_str()) == 0;
+#else
+	return ::mkdir(path.c_str(), 0755) == 0;
+#endif
+}
+
+/// <summary>
+/// Default Constructor. Nothing is Mapped.
+/// </summary>
+MappedFile::MappedFile() : _data(nullptr), _size(0), _mapping(nullptr) {}
+
+/// <summary>
+/// Destructor. Unmaps the File.
+/// </summary>
+MappedFile::~MappedFile() {
+	unmap();
+}
+
+/// <summary>
+/// Function to Map a whole File Read Only. Pages are Read from the Disk only when
+/// they are first touched.
+/// </summary>
+/// <param name="path">Path of the File</param>
+/// <returns>True if the File is Mapped, False if it does not Exist, is empty or could not be Mapped</returns>
+bool MappedFile::map(const std::string& path) {
+	unmap();
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+	_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (_mapping == nullptr)
+		return false;
+	_data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+	if (_data == nullptr) {
+		CloseHandle(_mapping);
+		_mapping = nullptr;
+		return false;
+	}
+	_size = (size_t)size.QuadPart;
+#else
+	int file = ::open(path.c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+	struct stat status;
+	if (::fstat(file, &status) != 0 || status.st_size == 0) {
+		::close(file);
+		return false;
+	}
+	void * data = ::mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, file, 0);
+	::close(file);
+	if (data == MAP_FAILED)
+		return false;
+	_data = static_cast<const char*>(data);
+	_size = (size_t)status.st_size;
+#endif
+	return true;
+}
+
+/// <summary>
+/// Function to Unmap the File. Pointers into the Mapping become invalid.
+/// </summary>
+void MappedFile::unmap() {
+	if (_data == nullptr)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(_data);
+	CloseHandle(_mapping);
+	_mapping = nullptr;
+#else
+	::munmap(const_cast<char*>(_data), _size);
+#endif
+	_data = nullptr;
+	_size = 0;
+}
+
+/// <summary>
+/// Function to get the First Mapped Byte.
+/// </summary>
+/// <returns>Mapped Bytes, NULL if nothing is Mapped</returns>
+const char * MappedFile::data() const {
+	return _data;
+}
+
+/// <summary>
+/// Function to get the Number of Mapped Bytes.
+/// </summary>
+/// <returns>Size of the Mapped File</returns>
+size_t MappedFile::size() const {
+	return _size;
+}
+
+#ifdef TEST_FILESYSTEM
+
+#include <iostream>
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test FileSystem Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	const std::string path = "FileSystem.test.file";
+	const std::string temp = "FileSystem.test.tmp";
+
+	StringHelper::Title("TESTING FILESYSTEM PACKAGE", '=');
+	StringHelper::Title("Test File");
+	{
+		File file;
+		std::cout << "\n > Created : " << file.open(path, File::CREATE);
+		std::cout << ", Written : " << file.write("Hello There", 11) << ", Synced : " << file.sync();
+		file.close();
+		std::cout << "\n > Reopened for Appending : " << file.open(path, File::APPEND);
+		std::cout << ", Written : " << file.write(" General Kenobi", 15) << ", Truncated : " << file.truncate(20);
+	}
+	MappedFile mapped;
+	std::cout << "\n > Mapped : " << mapped.map(path) << ", Contents : " << std::string(mapped.data(), mapped.size()) << std::endl;
+	mapped.unmap();
+	putline();
+
+	StringHelper::Title("Test replace");
+	{
+		File file;
+		file.open(temp, File::CREATE);
+		file.write("Replaced", 8);
+	}
+	std::cout << "\n > Replaced : " << File::replace(temp, path);
+	std::cout << ", Mapped : " << mapped.map(path) << ", Contents : " << std::string(mapped.data(), mapped.size());
+	mapped.unmap();
+	std::cout << "\n > Removed : " << File::remove(path) << ", Mapped after Remove : " << mapped.map(path) << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_FILESYSTEM
@@ -0,0 +1,130 @@
+//////////////////////////////////////////////////////////////////
+// FileSystem.h     - Files and Memory Mapped Files used        //
+//                    by DBEngine Persistence.                  //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides File and MappedFile classes which wrap the few Operating
+ * System File operations DBEngine needs to persist it's data : Appending, fsyncing
+ * and Truncating Files, Atomically Replacing a File by Renaming over it, and Mapping
+ * a File Read Only into memory so it can be Read in place and paged in lazily.
+ *
+ * The Windows (io.h, MapViewOfFile) and POSIX (unistd.h, mmap) implementations are
+ * selected at compile time. Both classes close what they own when Destroyed.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool File::open(const std::string& path, Mode mode)
+ * Method to open a File for Appending (APPEND) or to Create or Empty it (CREATE).
+ *
+ * - bool File::write(const void * data, size_t size)
+ * Method to Write a Block of Bytes, retrying Partial Writes.
+ *
+ * - bool File::sync()
+ * Method to Flush the Written Bytes to the Disk.
+ *
+ * - bool File::truncate(uint64_t size)
+ * Method to Cut the File back to the given Size.
+ *
+ * - static bool File::replace(const std::string& from, const std::string& to)
+ * Method to Atomically Rename a File over another one.
+ *
+ * - static bool File::remove(const std::string& path)
+ * Method to Delete a File.
+ *
+ * - static bool File::makeDirectory(const std::string& path)
+ * Method to Create a Directory unless it already Exists.
+ *
+ * - bool MappedFile::map(const std::string& path)
+ * Method to Map a whole File Read Only.
+ *
+ * - const char * MappedFile::data() const / size_t MappedFile::size() const
+ * Methods to get the Mapped Bytes.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added makeDirectory() used by the LSM Tier.
+ *
+ */
+#ifndef FILESYSTEM_H
+#define FILESYSTEM_H
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/// <summary>
+/// File Descriptor which is Closed when Destroyed.
+/// </summary>
+class File {
+public:
+	/// <summary>
+	/// How a File is opened for Writing.
+	/// </summary>
+	enum Mode { APPEND, CREATE };
+private:
+	int _file;										// File Descriptor, -1 if no File is open
+public:
+	/* Constructor */
+	File();
+	File(const File&) = delete;
+	File& operator=(const File&) = delete;
+
+	/* Destructor */
+	~File();
+
+	/* Member Functions */
+	bool open(const std::string& path, Mode mode);
+	bool isOpen() const;
+	bool write(const void * data, size_t size);
+	bool sync();
+	bool truncate(uint64_t size);
+	void close();
+	static bool replace(const std::string& from, const std::string& to);
+	static bool remove(const std::string& path);
+	static bool makeDirectory(const std::string& path);
+};
+
+/// <summary>
+/// Read Only Memory Mapping of a whole File which is Unmapped when Destroyed.
+/// </summary>
+class MappedFile {
+private:
+	const char * _data;								// First Mapped Byte, NULL if nothing is Mapped
+	size_t _size;									// Number of Mapped Bytes
+	void * _mapping;								// Mapping Handle (Windows only)
+public:
+	/* Constructor */
+	MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/* Destructor */
+	~MappedFile();
+
+	/* Member Functions */
+	bool map(const std::string& path);
+	void unmap();
+	const char * data() const;
+	size_t size() const;
+};
+
+#endif // !FILESYSTEM_H
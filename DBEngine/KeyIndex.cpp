@@ -0,0 +1,409 @@
+//////////////////////////////////////////////////////////////////
+// KeyIndex.cpp     - B+ Tree of the Keys of a Shard for        //
+//                    Ordered Prefix and Range Scans.           //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "KeyIndex.h"
+
+/// <summary>
+/// Destructor. Frees every Node.
+/// </summary>
+KeyIndex::~KeyIndex() {
+	clear();
+}
+
+/// <summary>
+/// Function to find the Child of an Inner Node whose Keys range over a Key.
+/// </summary>
+/// <param name="node">Inner Node</param>
+/// <param name="key">Key</param>
+/// <returns>Position of the Child</returns>
+size_t KeyIndex::childIndex(const Inner * node, std::string_view key) {
+	auto separator = std::upper_bound(node->keys.begin(), node->keys.end(), key,
+		[](std::string_view left, const std::string& right) { return left < right; });
+	return (size_t)(separator - node->keys.begin());
+}
+
+/// <summary>
+/// Function to Free a Node and every Node below it.
+/// </summary>
+/// <param name="node">Node, may be NULL</param>
+void KeyIndex::destroy(Node * node) {
+	if (node == nullptr)
+		return;
+	if (node->leaf) {
+		delete static_cast<Leaf*>(node);
+		return;
+	}
+	Inner * inner = static_cast<Inner*>(node);
+	for (Node * child : inner->children)
+		destroy(child);
+	delete inner;
+}
+
+/// <summary>
+/// Function to Insert a Key. The Tree grows by a Level when the Root is Split.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="document">Document ID of the Key</param>
+/// <returns>True if the Key was Inserted, False if it was already present</returns>
+bool KeyIndex::insert(std::string_view key, uint32_t document) {
+	if (_root == nullptr) {
+		_root = new Leaf();
+		_height = 1;
+	}
+	std::string separator;
+	Node * split = nullptr;
+	if (!insertInto(_root, key, document, separator, split))
+		return false;
+	if (split != nullptr) {
+		Inner * root = new Inner();
+		root->keys.push_back(std::move(separator));
+		root->children.push_back(_root);
+		root->children.push_back(split);
+		_root = root;
+		_height++;
+	}
+	_size++;
+	return true;
+}
+
+/// <summary>
+/// Function to Insert a Key below a Node. A Node which ends up with more than
+/// NODE_KEYS Keys is Split in half and the upper half handed back to the Caller
+/// along with the Separator which goes into the Parent.
+/// </summary>
+/// <param name="node">Node to Insert below</param>
+/// <param name="key">Key</param>
+/// <param name="document">Document ID of the Key</param>
+/// <param name="separator">Set to the smallest Key of the new Node if the Node was Split</param>
+/// <param name="split">Set to the new right Node if the Node was Split</param>
+/// <returns>True if the Key was Inserted, False if it was already present</returns>
+bool KeyIndex::insertInto(Node * node, std::string_view key, uint32_t document, std::string& separator, Node *& split) {
+	if (node->leaf) {
+		Leaf * leaf = static_cast<Leaf*>(node);
+		auto found = std::lower_bound(leaf->keys.begin(), leaf->keys.end(), key,
+			[](const std::string& left, std::string_view right) { return left < right; });
+		if (found != leaf->keys.end() && *found == key)
+			return false;
+		size_t position = (size_t)(found - leaf->keys.begin());
+		leaf->keys.emplace(found, key);
+		leaf->documents.insert(leaf->documents.begin() + position, document);
+		if (leaf->keys.size() <= NODE_KEYS)
+			return true;
+		Leaf * right = new Leaf();
+		size_t half = leaf->keys.size() / 2;
+		right->keys.assign(std::make_move_iterator(leaf->keys.begin() + half), std::make_move_iterator(leaf->keys.end()));
+		right->documents.assign(leaf->documents.begin() + half, leaf->documents.end());
+		leaf->keys.resize(half);
+		leaf->documents.resize(half);
+		right->next = leaf->next;
+		if (right->next != nullptr)
+			right->next->previous = right;
+		right->previous = leaf;
+		leaf->next = right;
+		separator = right->keys.front();
+		split = right;
+		return true;
+	}
+	Inner * inner = static_cast<Inner*>(node);
+	size_t index = childIndex(inner, key);
+	std::string childSeparator;
+	Node * childSplit = nullptr;
+	if (!insertInto(inner->children[index], key, document, childSeparator, childSplit))
+		return false;
+	if (childSplit == nullptr)
+		return true;
+	inner->keys.insert(inner->keys.begin() + index, std::move(childSeparator));
+	inner->children.insert(inner->children.begin() + index + 1, childSplit);
+	if (inner->keys.size() <= NODE_KEYS)
+		return true;
+	Inner * right = new Inner();
+	size_t middle = inner->keys.size() / 2;
+	separator = std::move(inner->keys[middle]);
+	right->keys.assign(std::make_move_iterator(inner->keys.begin() + middle + 1), std::make_move_iterator(inner->keys.end()));
+	right->children.assign(inner->children.begin() + middle + 1, inner->children.end());
+	inner->keys.resize(middle);
+	inner->children.resize(middle + 1);
+	split = right;
+	return true;
+}
+
+/// <summary>
+/// Function to Erase a Key. The Tree shrinks by a Level when the Root is left
+/// with a single Child.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>True if the Key was Erased, False if it was not present</returns>
+bool KeyIndex::erase(std::string_view key) {
+	if (_root == nullptr || !eraseFrom(_root, key))
+		return false;
+	_size--;
+	if (!_root->leaf && _root->keys.empty()) {
+		Inner * root = static_cast<Inner*>(_root);
+		_root = root->children.front();
+		delete root;
+		_height--;
+	}
+	else if (_root->leaf && _root->keys.empty()) {
+		delete static_cast<Leaf*>(_root);
+		_root = nullptr;
+		_height = 0;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Erase a Key below a Node, Rebalancing every Child left less than
+/// half full on the way back up.
+/// </summary>
+/// <param name="node">Node to Erase below</param>
+/// <param name="key">Key</param>
+/// <returns>True if the Key was Erased, False if it was not present</returns>
+bool KeyIndex::eraseFrom(Node * node, std::string_view key) {
+	if (node->leaf) {
+		Leaf * leaf = static_cast<Leaf*>(node);
+		auto found = std::lower_bound(leaf->keys.begin(), leaf->keys.end(), key,
+			[](const std::string& left, std::string_view right) { return left < right; });
+		if (found == leaf->keys.end() || *found != key)
+			return false;
+		leaf->documents.erase(leaf->documents.begin() + (found - leaf->keys.begin()));
+		leaf->keys.erase(found);
+		return true;
+	}
+	Inner * inner = static_cast<Inner*>(node);
+	size_t index = childIndex(inner, key);
+	if (!eraseFrom(inner->children[index], key))
+		return false;
+	if (inner->children[index]->keys.size() < MIN_KEYS)
+		rebalance(inner, index);
+	return true;
+}
+
+/// <summary>
+/// Function to bring a Child back to half full : it Borrows a Key from a Sibling
+/// which can spare one, otherwise it is Merged with a Sibling and the Separator
+/// between them is dropped from (or, for Inner Nodes, moved down out of) the Parent.
+/// </summary>
+/// <param name="parent">Inner Node holding the Child</param>
+/// <param name="index">Position of the Child</param>
+void KeyIndex::rebalance(Inner * parent, size_t index) {
+	Node * child = parent->children[index];
+	Node * left = index > 0 ? parent->children[index - 1] : nullptr;
+	Node * right = index + 1 < parent->children.size() ? parent->children[index + 1] : nullptr;
+	if (child->leaf) {
+		Leaf * leaf = static_cast<Leaf*>(child);
+		Leaf * before = static_cast<Leaf*>(left);
+		Leaf * after = static_cast<Leaf*>(right);
+		if (before != nullptr && before->keys.size() > MIN_KEYS) {
+			leaf->keys.insert(leaf->keys.begin(), std::move(before->keys.back()));
+			leaf->documents.insert(leaf->documents.begin(), before->documents.back());
+			before->keys.pop_back();
+			before->documents.pop_back();
+			parent->keys[index - 1] = leaf->keys.front();
+		}
+		else if (after != nullptr && after->keys.size() > MIN_KEYS) {
+			leaf->keys.push_back(std::move(after->keys.front()));
+			leaf->documents.push_back(after->documents.front());
+			after->keys.erase(after->keys.begin());
+			after->documents.erase(after->documents.begin());
+			parent->keys[index] = after->keys.front();
+		}
+		else {
+			/* Merge the right one of the pair into the left one */
+			if (before == nullptr) {
+				before = leaf;
+				leaf = after;
+				index++;
+			}
+			before->keys.insert(before->keys.end(), std::make_move_iterator(leaf->keys.begin()), std::make_move_iterator(leaf->keys.end()));
+			before->documents.insert(before->documents.end(), leaf->documents.begin(), leaf->documents.end());
+			before->next = leaf->next;
+			if (before->next != nullptr)
+				before->next->previous = before;
+			delete leaf;
+			parent->keys.erase(parent->keys.begin() + (index - 1));
+			parent->children.erase(parent->children.begin() + index);
+		}
+		return;
+	}
+	Inner * inner = static_cast<Inner*>(child);
+	Inner * before = static_cast<Inner*>(left);
+	Inner * after = static_cast<Inner*>(right);
+	if (before != nullptr && before->keys.size() > MIN_KEYS) {
+		inner->keys.insert(inner->keys.begin(), std::move(parent->keys[index - 1]));
+		inner->children.insert(inner->children.begin(), before->children.back());
+		parent->keys[index - 1] = std::move(before->keys.back());
+		before->keys.pop_back();
+		before->children.pop_back();
+	}
+	else if (after != nullptr && after->keys.size() > MIN_KEYS) {
+		inner->keys.push_back(std::move(parent->keys[index]));
+		inner->children.push_back(after->children.front());
+		parent->keys[index] = std::move(after->keys.front());
+		after->keys.erase(after->keys.begin());
+		after->children.erase(after->children.begin());
+	}
+	else {
+		if (before == nullptr) {
+			before = inner;
+			inner = after;
+			index++;
+		}
+		before->keys.push_back(std::move(parent->keys[index - 1]));
+		before->keys.insert(before->keys.end(), std::make_move_iterator(inner->keys.begin()), std::make_move_iterator(inner->keys.end()));
+		before->children.insert(before->children.end(), inner->children.begin(), inner->children.end());
+		delete inner;
+		parent->keys.erase(parent->keys.begin() + (index - 1));
+		parent->children.erase(parent->children.begin() + index);
+	}
+}
+
+/// <summary>
+/// Function to Find the Document ID of a Key.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="document">Set to the Document ID of the Key</param>
+/// <returns>True if the Key is present</returns>
+bool KeyIndex::find(std::string_view key, uint32_t& document) const {
+	size_t position;
+	const Leaf * leaf = seek(key, position);
+	if (leaf == nullptr || position == leaf->keys.size() || leaf->keys[position] != key)
+		return false;
+	document = leaf->documents[position];
+	return true;
+}
+
+/// <summary>
+/// Function to descend to the Leaf which holds the first Key not below a Key.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="position">Set to the Position of that Key in the Leaf, the Leaf's size if it is in the next Leaf</param>
+/// <returns>Leaf, NULL if the KeyIndex is empty</returns>
+const KeyIndex::Leaf * KeyIndex::seek(std::string_view key, size_t& position) const {
+	position = 0;
+	const Node * node = _root;
+	if (node == nullptr)
+		return nullptr;
+	while (!node->leaf) {
+		const Inner * inner = static_cast<const Inner*>(node);
+		node = inner->children[childIndex(inner, key)];
+	}
+	const Leaf * leaf = static_cast<const Leaf*>(node);
+	position = (size_t)(std::lower_bound(leaf->keys.begin(), leaf->keys.end(), key,
+		[](const std::string& left, std::string_view right) { return left < right; }) - leaf->keys.begin());
+	return leaf;
+}
+
+/// <summary>
+/// Function to get the Number of Keys.
+/// </summary>
+/// <returns>Number of Keys</returns>
+size_t KeyIndex::size() const {
+	return _size;
+}
+
+/// <summary>
+/// Function to get the Number of Levels of the Tree, which grows with log(size).
+/// </summary>
+/// <returns>Number of Levels, 0 if the KeyIndex is empty</returns>
+size_t KeyIndex::height() const {
+	return _height;
+}
+
+/// <summary>
+/// Function to Erase every Key.
+/// </summary>
+void KeyIndex::clear() {
+	destroy(_root);
+	_root = nullptr;
+	_size = 0;
+	_height = 0;
+}
+
+#ifdef TEST_KEYINDEX
+
+#include <map>
+#include <random>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test KeyIndex Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+
+	StringHelper::Title("TESTING KEYINDEX PACKAGE", '=');
+	StringHelper::Title("Test insert, find and Prefix Scan");
+	KeyIndex index;
+	for (const char * key : { "user:42:name", "user:7:name", "user:42:email", "order:1", "user:42:", "user:420:name" })
+		index.insert(key, (uint32_t)index.size());
+	uint32_t document = 0;
+	std::cout << "\n > Keys : " << index.size() << ", Duplicate Inserted : " << index.insert("order:1", 9)
+		<< ", find(user:42:email) : " << (index.find("user:42:email", document) ? (int)document : -1) << ", find(user) : " << index.find("user", document);
+	std::cout << "\n > Prefix user:42: :";
+	index.scan("user:42:", [](const std::string& key, uint32_t) {
+		if (key.compare(0, 8, "user:42:") != 0)
+			return false;
+		std::cout << " " << key;
+		return true;
+	});
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test against std::map with random Inserts and Erases");
+	KeyIndex random;
+	std::map<std::string, uint32_t> reference;
+	std::mt19937_64 generator(7);
+	bool agree = true;
+	for (size_t step = 0; step < 400000; step++) {
+		std::string key = "key" + std::to_string(generator() % 50000);
+		if (generator() % 3 != 0)
+			agree = agree && random.insert(key, (uint32_t)step) == reference.emplace(key, (uint32_t)step).second;
+		else
+			agree = agree && random.erase(key) == (reference.erase(key) == 1);
+	}
+	auto expected = reference.begin();
+	random.scan("", [&](const std::string& key, uint32_t value) {
+		agree = agree && expected != reference.end() && expected->first == key && expected->second == value;
+		++expected;
+		return true;
+	});
+	agree = agree && expected == reference.end() && random.size() == reference.size();
+	std::cout << "\n > Keys : " << random.size() << ", Height : " << random.height() << ", Agrees with std::map : " << agree;
+	auto lower = reference.lower_bound("key25");
+	size_t visited = random.scan("key25", [&](const std::string& key, uint32_t) { return lower != reference.end() && key == (lower++)->first && key < "key26"; });
+	std::cout << "\n > Range Scan from key25 Visited : " << visited << " Keys";
+	auto upper = std::make_reverse_iterator(reference.upper_bound("key25"));
+	bool descending = true;
+	visited = random.scanReverse("key25", [&](const std::string& key, uint32_t) {
+		descending = descending && upper != reference.rend() && key == (upper++)->first;
+		return true;
+	});
+	std::cout << "\n > Reverse Scan from key25 Visited : " << visited << " Keys, in descending order : " << (descending && upper == reference.rend());
+	for (auto& entry : reference)
+		random.erase(entry.first);
+	std::cout << "\n > Keys after Erasing all : " << random.size() << ", Height : " << random.height() << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_KEYINDEX
@@ -0,0 +1,190 @@
+//////////////////////////////////////////////////////////////////
+// KeyIndex.h       - B+ Tree of the Keys of a Shard for        //
+//                    Ordered Prefix and Range Scans.           //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides KeyIndex class, a B+ Tree which keeps the Keys of a Shard
+ * and their Document IDs in Key order, so the Keys starting with a Prefix or lying
+ * in a Range are found in O(log n + results) instead of by walking every Key.
+ *
+ * Leaves hold up to NODE_KEYS sorted Keys with their Document IDs and are Linked to
+ * their Neighbours, Inner Nodes hold up to NODE_KEYS Separators, the smallest Key
+ * below each Child but the first. A Node which overflows is Split in half, a Node
+ * which drops below half full Borrows a Key from a Sibling or is Merged with it,
+ * so every Node but the Root stays at least half full and the Tree stays balanced
+ * however Keys are Inserted and Erased. A Scan descends to the first Key not below
+ * it's start once and then walks the Leaves.
+ *
+ * KeyIndex is not Thread Safe, DBEngine guards it with the Shard's Lock.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool insert(std::string_view key, uint32_t document)
+ * Method to Insert a Key. Returns False if it was already present.
+ *
+ * - bool erase(std::string_view key)
+ * Method to Erase a Key. Returns False if it was not present.
+ *
+ * - bool find(std::string_view key, uint32_t& document) const
+ * Method to Find the Document ID of a Key.
+ *
+ * - size_t scan(std::string_view from, Function function) const
+ * Method to call function(key, document) for the Keys from the first not below from
+ * in ascending order, till function returns False.
+ *
+ * - size_t scanReverse(std::string_view to, Function function) const
+ * Method to call function(key, document) for the Keys from the last not above to
+ * in descending order, till function returns False.
+ *
+ * - size_t size() const
+ * Method to get the Number of Keys.
+ *
+ * - size_t height() const
+ * Method to get the Number of Levels of the Tree.
+ *
+ * - void clear()
+ * Method to Erase every Key.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added scanReverse() which walks the Leaves backwards.
+ *
+ */
+#ifndef KEYINDEX_H
+#define KEYINDEX_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+
+/// <summary>
+/// B+ Tree of Keys and their Document IDs in Key order.
+/// </summary>
+class KeyIndex {
+public:
+	static const size_t NODE_KEYS = 64;												// Keys of a Leaf and Separators of an Inner Node at most, even
+
+	/* Constructor */
+	KeyIndex() = default;
+	KeyIndex(const KeyIndex&) = delete;
+	KeyIndex& operator=(const KeyIndex&) = delete;
+
+	/* Destructor */
+	~KeyIndex();
+
+	/* Member Functions */
+	bool insert(std::string_view key, uint32_t document);
+	bool erase(std::string_view key);
+	bool find(std::string_view key, uint32_t& document) const;
+	template <typename Function> size_t scan(std::string_view from, Function function) const;
+	template <typename Function> size_t scanReverse(std::string_view to, Function function) const;
+	size_t size() const;
+	size_t height() const;
+	void clear();
+private:
+	static const size_t MIN_KEYS = NODE_KEYS / 2;									// Keys of a Node but the Root at least
+
+	/// <summary>
+	/// Node of the Tree. Leaves and Inner Nodes share the sorted Keys.
+	/// </summary>
+	struct Node {
+		bool leaf;
+		std::vector<std::string> keys;												// Keys of a Leaf, Separators of an Inner Node
+		explicit Node(bool isLeaf) : leaf(isLeaf) {}
+	};
+
+	struct Leaf : Node {
+		std::vector<uint32_t> documents;											// Document ID of every Key
+		Leaf * previous = nullptr;
+		Leaf * next = nullptr;
+		Leaf() : Node(true) {}
+	};
+
+	struct Inner : Node {
+		std::vector<Node*> children;												// One more than Separators, Child i holds Keys from Separator i - 1 on
+		Inner() : Node(false) {}
+	};
+
+	Node * _root = nullptr;
+	size_t _size = 0;
+	size_t _height = 0;
+
+	static size_t childIndex(const Inner * node, std::string_view key);
+	static void destroy(Node * node);
+	bool insertInto(Node * node, std::string_view key, uint32_t document, std::string& separator, Node *& split);
+	bool eraseFrom(Node * node, std::string_view key);
+	void rebalance(Inner * parent, size_t index);
+	const Leaf * seek(std::string_view key, size_t& position) const;
+};
+
+/// <summary>
+/// Function to call function(key, document) for every Key from the first Key not
+/// below from in ascending order, till function returns False. The KeyIndex must
+/// not be changed while it is Scanned.
+/// </summary>
+/// <param name="from">Key to start at, empty for the first Key</param>
+/// <param name="function">Function accepting (const std::string&amp;, uint32_t) and returning bool</param>
+/// <returns>Number of Keys handed to function</returns>
+template <typename Function>
+size_t KeyIndex::scan(std::string_view from, Function function) const {
+	size_t position = 0, visited = 0;
+	for (const Leaf * leaf = seek(from, position); leaf != nullptr; leaf = leaf->next, position = 0) {
+		for (; position < leaf->keys.size(); position++) {
+			visited++;
+			if (!function(leaf->keys[position], leaf->documents[position]))
+				return visited;
+		}
+	}
+	return visited;
+}
+
+/// <summary>
+/// Function to call function(key, document) for every Key from the last Key not
+/// above to in descending order, till function returns False. The KeyIndex must
+/// not be changed while it is Scanned.
+/// </summary>
+/// <param name="to">Key to start at</param>
+/// <param name="function">Function accepting (const std::string&amp;, uint32_t) and returning bool</param>
+/// <returns>Number of Keys handed to function</returns>
+template <typename Function>
+size_t KeyIndex::scanReverse(std::string_view to, Function function) const {
+	size_t position = 0, visited = 0;
+	const Leaf * leaf = seek(to, position);
+	if (leaf != nullptr && position < leaf->keys.size() && leaf->keys[position] == to)
+		position++;
+	while (leaf != nullptr) {
+		while (position > 0) {
+			position--;
+			visited++;
+			if (!function(leaf->keys[position], leaf->documents[position]))
+				return visited;
+		}
+		leaf = leaf->previous;
+		if (leaf != nullptr)
+			position = leaf->keys.size();
+	}
+	return visited;
+}
+
+#endif // !KEYINDEX_H
@@ -0,0 +1,1401 @@
+//////////////////////////////////////////////////////////////////
+// LSMTree.cpp      - Log-Structured Merge Tier of DBEngine     //
+//                    holding SSTables in Leveled Runs.         //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "LSMTree.h"
+#include "WriteAheadLog.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+/* Magic Bytes at the start of the Manifest */
+static const char MANIFEST_MAGIC[8] = { 'N', 'O', 'S', 'Q', 'L', 'L', 'S', 'M' };
+
+/// <summary>
+/// Function to Read a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint32_t LSMTree::getU32(const char * bytes) {
+	const unsigned char * value = reinterpret_cast<const unsigned char*>(bytes);
+	return value[0] | (value[1] << 8) | (value[2] << 16) | ((uint32_t)value[3] << 24);
+}
+
+/// <summary>
+/// Function to Read a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint64_t LSMTree::getU64(const char * bytes) {
+	return getU32(bytes) | ((uint64_t)getU32(bytes + 4) << 32);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void LSMTree::putU32(std::string& out, uint32_t value) {
+	char bytes[4] = { (char)value, (char)(value >> 8), (char)(value >> 16), (char)(value >> 24) };
+	out.append(bytes, 4);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void LSMTree::putU64(std::string& out, uint64_t value) {
+	putU32(out, (uint32_t)value);
+	putU32(out, (uint32_t)(value >> 32));
+}
+
+/// <summary>
+/// Destructor. Closes the SSTable and Deletes it's File if a Compaction replaced it.
+/// </summary>
+LSMTree::Table::~Table() {
+	file.close();
+	if (obsolete)
+		File::remove(path);
+}
+
+/// <summary>
+/// Destructor. Unmaps the Segment and Deletes it's File if Garbage Collection
+/// replaced it.
+/// </summary>
+LSMTree::Segment::~Segment() {
+	file.close();
+	if (obsolete)
+		File::remove(path);
+}
+
+/// <summary>
+/// Default Constructor. Nothing is Merged.
+/// </summary>
+LSMTree::MergeIterator::MergeIterator() : _current(0), _failed(false) {}
+
+/// <summary>
+/// Function to Add an SSTable, older than every SSTable Added before.
+/// </summary>
+/// <param name="table">Open SSTable, must outlive the MergeIterator</param>
+void LSMTree::MergeIterator::add(const SSTable * table) {
+	_tables.push_back(table);
+	_sources.emplace_back();
+}
+
+/// <summary>
+/// Function to Start Merging from the smallest Key of every SSTable.
+/// </summary>
+void LSMTree::MergeIterator::start() {
+	for (size_t index = 0; index < _sources.size(); index++) {
+		_sources[index].seek(_tables[index]);
+		_failed = _failed || _sources[index].failed();
+	}
+	select();
+}
+
+/// <summary>
+/// Function to point at the smallest current Key, taken from the newest SSTable
+/// holding it, and note the SSTables holding older Versions of it.
+/// </summary>
+void LSMTree::MergeIterator::select() {
+	_current = _sources.size();
+	for (size_t index = 0; index < _sources.size(); index++) {
+		if (_sources[index].valid() && (_current == _sources.size() || _sources[index].entry().key < _sources[_current].entry().key))
+			_current = index;
+	}
+	_shadowed.clear();
+	for (size_t index = _current + 1; index < _sources.size(); index++) {
+		if (_sources[index].valid() && _sources[index].entry().key == _sources[_current].entry().key)
+			_shadowed.push_back(index);
+	}
+}
+
+/// <summary>
+/// Function to Check whether the MergeIterator is at an Entry.
+/// </summary>
+/// <returns>True if entry() can be called</returns>
+bool LSMTree::MergeIterator::valid() const {
+	return !_failed && _current < _sources.size();
+}
+
+/// <summary>
+/// Function to Check whether one of the SSTables had a Corrupted Key Block.
+/// </summary>
+/// <returns>True if Merging stopped early</returns>
+bool LSMTree::MergeIterator::failed() const {
+	return _failed;
+}
+
+/// <summary>
+/// Function to get the newest Version of the current Key.
+/// </summary>
+/// <returns>Entry, it's Views point into the Mapping of table()</returns>
+const SSTable::Entry& LSMTree::MergeIterator::entry() const {
+	return _sources[_current].entry();
+}
+
+/// <summary>
+/// Function to get the SSTable holding the current Entry, to Read it's Value.
+/// </summary>
+/// <returns>SSTable</returns>
+const SSTable * LSMTree::MergeIterator::table() const {
+	return _tables[_current];
+}
+
+/// <summary>
+/// Function to get the Number of older Versions of the current Key, which next()
+/// skips.
+/// </summary>
+/// <returns>Number of SSTables holding an older Version</returns>
+size_t LSMTree::MergeIterator::shadowedCount() const {
+	return _shadowed.size();
+}
+
+/// <summary>
+/// Function to get an older Version of the current Key.
+/// </summary>
+/// <param name="index">Index, less than shadowedCount()</param>
+/// <returns>Entry, it's Views point into the Mapping of shadowedTable(index)</returns>
+const SSTable::Entry& LSMTree::MergeIterator::shadowed(size_t index) const {
+	return _sources[_shadowed[index]].entry();
+}
+
+/// <summary>
+/// Function to get the SSTable holding an older Version of the current Key.
+/// </summary>
+/// <param name="index">Index, less than shadowedCount()</param>
+/// <returns>SSTable</returns>
+const SSTable * LSMTree::MergeIterator::shadowedTable(size_t index) const {
+	return _tables[_shadowed[index]];
+}
+
+/// <summary>
+/// Function to move past the current Key, skipping it's older Versions.
+/// </summary>
+void LSMTree::MergeIterator::next() {
+	std::string_view key = entry().key;
+	for (SSTable::Iterator& source : _sources) {
+		if (source.valid() && source.entry().key == key) {
+			source.next();
+			_failed = _failed || source.failed();
+		}
+	}
+	select();
+}
+
+/// <summary>
+/// Default Constructor. The Tier is not open.
+/// </summary>
+LSMTree::LSMTree() : _nextFile(1), _closing(false), _open(false), _lookups(0), _tablesChecked(0), _bloomSkips(0),
+	_blocksRead(0), _falsePositives(0), _flushes(0), _flushedBytes(0), _compactions(0), _moves(0), _compactionRead(0), _compactionWritten(0),
+	_valueLogWritten(0), _collections(0), _relocated(0), _reclaimed(0) {}
+
+/// <summary>
+/// Destructor. Stops the Compaction Threads and Closes every SSTable.
+/// </summary>
+LSMTree::~LSMTree() {
+	close();
+}
+
+/// <summary>
+/// Function to get the Path of an SSTable File.
+/// </summary>
+/// <param name="number">File Number</param>
+/// <returns>"<directory>/<number>.sst"</returns>
+std::string LSMTree::tablePath(uint64_t number) const {
+	char name[32];
+	std::snprintf(name, sizeof(name), "%06llu.sst", (unsigned long long)number);
+	return _options.directory + "/" + name;
+}
+
+/// <summary>
+/// Function to get the Path of a Value Log Segment.
+/// </summary>
+/// <param name="number">File Number</param>
+/// <returns>"<directory>/<number>.vlog"</returns>
+std::string LSMTree::segmentPath(uint64_t number) const {
+	char name[32];
+	std::snprintf(name, sizeof(name), "%06llu.vlog", (unsigned long long)number);
+	return _options.directory + "/" + name;
+}
+
+/// <summary>
+/// Function to get the Path of the Manifest.
+/// </summary>
+/// <returns>"<directory>/MANIFEST"</returns>
+std::string LSMTree::manifestPath() const {
+	return _options.directory + "/MANIFEST";
+}
+
+/// <summary>
+/// Function to get the installed Version of a Shard. The Version stays valid while
+/// it is held even if a newer one is installed.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <returns>Current Version</returns>
+LSMTree::VersionPtr LSMTree::current(size_t shard) {
+	std::lock_guard<std::mutex> lock(_shards[shard]->lock);
+	return _shards[shard]->current;
+}
+
+/// <summary>
+/// Function to open an SSTable File.
+/// </summary>
+/// <param name="number">File Number</param>
+/// <returns>Open SSTable, NULL if it is missing or Corrupted</returns>
+LSMTree::TablePtr LSMTree::openTable(uint64_t number) {
+	TablePtr table = std::make_shared<Table>();
+	table->number = number;
+	table->path = tablePath(number);
+	if (!table->file.open(table->path))
+		return nullptr;
+	return table;
+}
+
+/// <summary>
+/// Function to open a Value Log Segment.
+/// </summary>
+/// <param name="number">File Number</param>
+/// <returns>Open Segment, NULL if it is missing or Corrupted</returns>
+LSMTree::SegmentPtr LSMTree::openSegment(uint64_t number) {
+	SegmentPtr segment = std::make_shared<Segment>();
+	segment->number = number;
+	segment->path = segmentPath(number);
+	if (!segment->file.open(segment->path, number))
+		return nullptr;
+	return segment;
+}
+
+/// <summary>
+/// Function to Find a Segment of a Version by it's Number.
+/// </summary>
+/// <param name="version">Version</param>
+/// <param name="number">File Number</param>
+/// <returns>Segment, NULL if the Version does not hold it</returns>
+LSMTree::SegmentPtr LSMTree::findSegment(const Version& version, uint64_t number) {
+	auto segment = std::lower_bound(version.segments.begin(), version.segments.end(), number,
+		[](const SegmentPtr& segment, uint64_t number) { return segment->number < number; });
+	return segment != version.segments.end() && (*segment)->number == number ? *segment : nullptr;
+}
+
+/// <summary>
+/// Function to Check whether an SSTable's Key Range overlaps a Key Range.
+/// </summary>
+/// <param name="table">SSTable</param>
+/// <param name="smallest">First Key of the Range</param>
+/// <param name="largest">Last Key of the Range</param>
+/// <returns>True if the SSTable may hold Keys of the Range</returns>
+bool LSMTree::overlaps(const SSTable& table, std::string_view smallest, std::string_view largest) {
+	return !(table.largest() < smallest || largest < table.smallest());
+}
+
+/// <summary>
+/// Function to open the Tier. Reads the Manifest, or Creates an empty one for the
+/// given Number of Shards if there is none, opens every SSTable it lists and Starts
+/// the Compaction Threads.
+/// </summary>
+/// <param name="options">Directory, Sizes and Threads</param>
+/// <param name="shards">Number of Shards for a new Tier, set to the Number of Shards of the Tier</param>
+/// <param name="tags">Set to the Tag Dictionary the SSTables' Tag IDs refer to</param>
+/// <returns>True if the Tier is open, False if the Directory could not be Created or the Manifest or an SSTable is Corrupted</returns>
+bool LSMTree::open(const Options& options, size_t& shards, std::vector<std::string>& tags) {
+	close();
+	if (options.directory.empty() || !File::makeDirectory(options.directory))
+		return false;
+	_options = options;
+	_options.level0Tables = std::max(1u, _options.level0Tables);
+	_options.levelMultiplier = std::max(2u, _options.levelMultiplier);
+	_closing = false;
+	if (!readManifest(shards)) {
+		for (Shard * shard : _shards)
+			delete shard;
+		_shards.clear();
+		_tags.clear();
+		return false;
+	}
+	tags = _tags;
+	_open = true;
+	for (unsigned index = 0; index < std::max(1u, _options.compactionThreads); index++)
+		_compactors.push_back(std::thread(&LSMTree::compactionLoop, this));
+	return true;
+}
+
+/// <summary>
+/// Function to Stop the Compaction Threads, Waiting for running Compactions, and
+/// Close every SSTable. The Caller must not Flush or Read meanwhile.
+/// </summary>
+void LSMTree::close() {
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_closing = true;
+	}
+	_work.notify_all();
+	for (std::thread& compactor : _compactors)
+		compactor.join();
+	_compactors.clear();
+	for (Shard * shard : _shards)
+		delete shard;
+	_shards.clear();
+	_tags.clear();
+	_open = false;
+}
+
+/// <summary>
+/// Function to Check whether the Tier is open.
+/// </summary>
+/// <returns>True if SSTables are being Read and Written</returns>
+bool LSMTree::isOpen() const {
+	return _open;
+}
+
+/// <summary>
+/// Function to Read the Manifest and open the SSTables and Segments it lists. Creates
+/// the Shards with empty Versions and Writes the Manifest if there is none. Manifests
+/// of Version 1 have no Segments.
+/// </summary>
+/// <param name="shards">Number of Shards for a new Tier, set to the Number of Shards of the Tier</param>
+/// <returns>True if every SSTable is open</returns>
+bool LSMTree::readManifest(size_t& shards) {
+	MappedFile manifest;
+	if (!manifest.map(manifestPath())) {
+		shards = std::max<size_t>(1, shards);
+		std::vector<VersionPtr> versions;
+		for (size_t index = 0; index < shards; index++) {
+			_shards.push_back(new Shard());
+			_shards.back()->current = std::make_shared<Version>();
+			versions.push_back(_shards.back()->current);
+		}
+		_nextFile = 1;
+		return writeManifest(versions);
+	}
+	const char * cursor = manifest.data();
+	const char * end = cursor + manifest.size();
+	if (manifest.size() < 36 || std::memcmp(cursor, MANIFEST_MAGIC, 8) != 0 || getU32(cursor + 8) == 0 || getU32(cursor + 8) > VERSION ||
+		WriteAheadLog::crc32c(cursor, manifest.size() - 4) != getU32(end - 4) || getU32(cursor + 12) == 0)
+		return false;
+	end -= 4;
+	uint32_t version = getU32(cursor + 8);
+	shards = getU32(cursor + 12);
+	_nextFile = getU64(cursor + 16);
+	uint32_t count = getU32(cursor + 24);
+	cursor += 28;
+	for (uint32_t index = 0; index < count; index++) {
+		if (end - cursor < 4 || (uint64_t)(end - cursor - 4) < getU32(cursor))
+			return false;
+		_tags.emplace_back(cursor + 4, getU32(cursor));
+		cursor += 4 + _tags.back().size();
+	}
+	if (end - cursor < 4)
+		return false;
+	count = getU32(cursor);
+	cursor += 4;
+	if ((uint64_t)(end - cursor) < 16 * (uint64_t)count)
+		return false;
+	std::vector<std::shared_ptr<Version>> versions;
+	for (size_t index = 0; index < shards; index++)
+		versions.push_back(std::make_shared<Version>());
+	for (uint32_t index = 0; index < count; index++, cursor += 16) {
+		uint32_t shard = getU32(cursor), level = getU32(cursor + 4);
+		if (shard >= shards || level >= LEVELS)
+			return false;
+		TablePtr table = openTable(getU64(cursor + 8));
+		if (table == nullptr)
+			return false;
+		versions[shard]->levels[level].push_back(table);
+	}
+	count = 0;
+	if (version >= 2) {
+		if (end - cursor < 4)
+			return false;
+		count = getU32(cursor);
+		cursor += 4;
+	}
+	if ((uint64_t)(end - cursor) != 20 * (uint64_t)count)
+		return false;
+	for (uint32_t index = 0; index < count; index++, cursor += 20) {
+		uint32_t shard = getU32(cursor);
+		if (shard >= shards)
+			return false;
+		SegmentPtr segment = openSegment(getU64(cursor + 4));
+		if (segment == nullptr)
+			return false;
+		segment->garbage = getU64(cursor + 12);
+		versions[shard]->segments.push_back(segment);
+	}
+	/* Level 0 keeps the order of the Manifest : Garbage Collection Installs SSTables with newer Numbers below newer Flushes */
+	for (size_t index = 0; index < shards; index++) {
+		std::vector<SegmentPtr>& segments = versions[index]->segments;
+		std::sort(segments.begin(), segments.end(), [](const SegmentPtr& left, const SegmentPtr& right) { return left->number < right->number; });
+		for (size_t level = 1; level < LEVELS; level++) {
+			std::vector<TablePtr>& tables = versions[index]->levels[level];
+			std::sort(tables.begin(), tables.end(), [](const TablePtr& left, const TablePtr& right) { return left->file.smallest() < right->file.smallest(); });
+		}
+		_shards.push_back(new Shard());
+		_shards.back()->current = versions[index];
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Write the Manifest for the given Versions to a Temporary File, fsync
+/// it and Rename it over the Manifest. Caller must hold _lock.
+/// </summary>
+/// <param name="versions">Version of every Shard</param>
+/// <returns>True if the Manifest was Replaced</returns>
+bool LSMTree::writeManifest(const std::vector<VersionPtr>& versions) {
+	std::string bytes(MANIFEST_MAGIC, 8);
+	putU32(bytes, VERSION);
+	putU32(bytes, (uint32_t)versions.size());
+	putU64(bytes, _nextFile);
+	putU32(bytes, (uint32_t)_tags.size());
+	for (const std::string& tag : _tags) {
+		putU32(bytes, (uint32_t)tag.size());
+		bytes.append(tag);
+	}
+	std::string tables;
+	uint32_t count = 0;
+	for (size_t shard = 0; shard < versions.size(); shard++) {
+		for (size_t level = 0; level < LEVELS; level++) {
+			for (const TablePtr& table : versions[shard]->levels[level]) {
+				putU32(tables, (uint32_t)shard);
+				putU32(tables, (uint32_t)level);
+				putU64(tables, table->number);
+				count++;
+			}
+		}
+	}
+	putU32(bytes, count);
+	bytes.append(tables);
+	std::string segments;
+	count = 0;
+	for (size_t shard = 0; shard < versions.size(); shard++) {
+		for (const SegmentPtr& segment : versions[shard]->segments) {
+			putU32(segments, (uint32_t)shard);
+			putU64(segments, segment->number);
+			putU64(segments, segment->garbage.load());
+			count++;
+		}
+	}
+	putU32(bytes, count);
+	bytes.append(segments);
+	putU32(bytes, WriteAheadLog::crc32c(bytes.data(), bytes.size()));
+	std::string temp = manifestPath() + ".tmp";
+	File file;
+	bool written = file.open(temp, File::CREATE) && file.write(bytes.data(), bytes.size()) && file.sync();
+	file.close();
+	if (!written || !File::replace(temp, manifestPath())) {
+		File::remove(temp);
+		return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Install new Versions. The Manifest is Written first, so the Versions
+/// are only Published once they are Durable. Caller must hold _lock.
+/// </summary>
+/// <param name="versions">New Version of every Shard, NULL to keep the current one</param>
+/// <returns>True if the Versions were Installed</returns>
+bool LSMTree::install(std::vector<VersionPtr>& versions) {
+	std::vector<bool> changed(_shards.size());
+	for (size_t shard = 0; shard < _shards.size(); shard++) {
+		changed[shard] = versions[shard] != nullptr;
+		if (!changed[shard])
+			versions[shard] = current(shard);
+	}
+	if (!writeManifest(versions))
+		return false;
+	for (size_t shard = 0; shard < _shards.size(); shard++) {
+		if (changed[shard]) {
+			std::lock_guard<std::mutex> lock(_shards[shard]->lock);
+			_shards[shard]->current = versions[shard];
+		}
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Write the Memtable of every Shard to a new Level 0 SSTable and
+/// Install them all at once. Shards whose Memtable is empty get no SSTable. With
+/// Key-Value Separation the large Values of a Shard are Written to a new Segment,
+/// which is Durable before the SSTable pointing into it.
+/// </summary>
+/// <param name="shards">Keys of every Shard's Memtable, sorted in place</param>
+/// <param name="tags">Tag Dictionary the Tag IDs of the DBElements refer to</param>
+/// <returns>True if the SSTables are Durable and Installed</returns>
+bool LSMTree::flush(std::vector<std::vector<FlushEntry>>& shards, const std::vector<std::string>& tags) {
+	/// <summary>
+	/// SSTable and Segment Written for a Shard.
+	/// </summary>
+	struct Flushed {
+		size_t shard;
+		TablePtr table;
+		SegmentPtr segment;
+	};
+	std::vector<Flushed> written;
+	uint64_t bytes = 0, values = 0;
+	bool failed = false;
+	for (size_t shard = 0; shard < shards.size() && shard < _shards.size() && !failed; shard++) {
+		std::vector<FlushEntry>& entries = shards[shard];
+		if (entries.empty())
+			continue;
+		std::stable_sort(entries.begin(), entries.end(), [](const FlushEntry& left, const FlushEntry& right) { return left.key < right.key; });
+		uint64_t number;
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			number = _nextFile++;
+		}
+		SSTable::Writer writer;
+		ValueLog::Writer log;
+		uint64_t segment = 0;
+		std::string buffer;
+		failed = !writer.open(tablePath(number), _options.bloomBitsPerKey);
+		for (size_t index = 0; index < entries.size() && !failed; index++) {
+			const FlushEntry& entry = entries[index];
+			if (index > 0 && entry.key == entries[index - 1].key)
+				continue;
+			if (entry.element == nullptr) {
+				writer.addRemoved(entry.key, entry.document);
+				continue;
+			}
+			if (_options.valueThreshold == 0 || entry.element->getDataSize() < _options.valueThreshold) {
+				writer.add(entry.key, entry.document, *entry.element);
+				continue;
+			}
+			if (segment == 0) {
+				std::lock_guard<std::mutex> lock(_lock);
+				segment = _nextFile++;
+				if (!log.open(segmentPath(segment), segment)) {
+					failed = true;
+					break;
+				}
+			}
+			writer.addSeparated(entry.key, entry.document, *entry.element, log.append(entry.key, entry.element->getDataView(buffer)).encode());
+		}
+		SegmentPtr separated = nullptr;
+		if (!failed && segment != 0) {
+			separated = log.finish() ? openSegment(segment) : nullptr;
+			failed = separated == nullptr;
+		}
+		TablePtr table = !failed && writer.finish() ? openTable(number) : nullptr;
+		failed = table == nullptr;
+		if (!failed) {
+			bytes += table->file.fileSize();
+			values += separated != nullptr ? separated->file.fileSize() : 0;
+			written.push_back({ shard, table, separated });
+		} else if (separated != nullptr) {
+			separated->obsolete = true;
+		}
+	}
+	std::lock_guard<std::mutex> lock(_lock);
+	std::vector<VersionPtr> versions(_shards.size());
+	for (const Flushed& flushed : written) {
+		std::shared_ptr<Version> version = std::make_shared<Version>(*current(flushed.shard));
+		version->levels[0].insert(version->levels[0].begin(), flushed.table);
+		if (flushed.segment != nullptr)
+			version->segments.push_back(flushed.segment);
+		std::sort(version->segments.begin(), version->segments.end(), [](const SegmentPtr& left, const SegmentPtr& right) { return left->number < right->number; });
+		versions[flushed.shard] = version;
+	}
+	std::vector<std::string> previous = _tags;
+	_tags = tags;
+	if (failed || (!written.empty() && !install(versions))) {
+		_tags = previous;
+		for (const Flushed& flushed : written) {
+			flushed.table->obsolete = true;
+			if (flushed.segment != nullptr)
+				flushed.segment->obsolete = true;
+		}
+		return false;
+	}
+	_flushes.fetch_add(1, std::memory_order_relaxed);
+	_flushedBytes.fetch_add(bytes, std::memory_order_relaxed);
+	_valueLogWritten.fetch_add(values, std::memory_order_relaxed);
+	_work.notify_all();
+	return true;
+}
+
+/// <summary>
+/// Function to Look a Key up in one SSTable. The Key Range and the Bloom Filter are
+/// Checked before the Key Block is Read.
+/// </summary>
+/// <param name="table">SSTable</param>
+/// <param name="key">Key</param>
+/// <param name="entry">Set to the Entry of the Key if the SSTable holds it</param>
+/// <returns>True if the SSTable holds a Version of the Key</returns>
+bool LSMTree::probe(const SSTable& table, std::string_view key, SSTable::Entry& entry) {
+	if (key < table.smallest() || table.largest() < key)
+		return false;
+	_tablesChecked.fetch_add(1, std::memory_order_relaxed);
+	if (!table.mayContain(key)) {
+		_bloomSkips.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	_blocksRead.fetch_add(1, std::memory_order_relaxed);
+	if (!table.find(key, entry)) {
+		_falsePositives.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Find the newest Entry of a Key in a Version. Level 0 SSTables are
+/// searched newest first, then the one SSTable of every deeper Level whose Key Range
+/// holds the Key.
+/// </summary>
+/// <param name="version">Version of the Shard</param>
+/// <param name="key">Key</param>
+/// <param name="entry">Set to the newest Entry of the Key</param>
+/// <returns>SSTable holding the Entry, NULL if no SSTable holds the Key</returns>
+const SSTable * LSMTree::locate(const Version& version, std::string_view key, SSTable::Entry& entry) {
+	for (const TablePtr& table : version.levels[0]) {
+		if (probe(table->file, key, entry))
+			return &table->file;
+	}
+	for (size_t level = 1; level < LEVELS; level++) {
+		const std::vector<TablePtr>& tables = version.levels[level];
+		auto table = std::lower_bound(tables.begin(), tables.end(), key,
+			[](const TablePtr& table, std::string_view key) { return table->file.largest() < key; });
+		if (table != tables.end() && probe((*table)->file, key, entry))
+			return &(*table)->file;
+	}
+	return nullptr;
+}
+
+/// <summary>
+/// Function to Find the newest Version of a Key. A Separated Value is Read from the
+/// Segment it's Pointer refers to.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="key">Key</param>
+/// <param name="value">Set to the newest Version of the Key</param>
+/// <returns>True if a Version was found, which may be a Tombstone (value.removed)</returns>
+bool LSMTree::get(size_t shard, std::string_view key, Value& value) {
+	_lookups.fetch_add(1, std::memory_order_relaxed);
+	VersionPtr version = current(shard);
+	SSTable::Entry entry;
+	const SSTable * table = locate(*version, key, entry);
+	if (table == nullptr)
+		return false;
+	value.document = entry.document;
+	value.timestamp = entry.timestamp;
+	value.tags.clear();
+	for (uint32_t index = 0; index < entry.tagCount; index++)
+		value.tags.push_back(entry.tagId(index));
+	std::string_view data;
+	bool intact = entry.removed || table->value(entry, data);
+	if (intact && !entry.removed && entry.separated) {
+		ValueLog::Pointer pointer;
+		SegmentPtr segment;
+		intact = pointer.decode(data) && (segment = findSegment(*version, pointer.segment)) != nullptr && segment->file.read(pointer, data);
+	}
+	/* A Corrupted Value hides the Key instead of exposing an older Version of it */
+	value.removed = entry.removed || !intact;
+	if (value.removed)
+		value.data.clear();
+	else
+		value.data.assign(data.data(), data.size());
+	return true;
+}
+
+/// <summary>
+/// Function to get the Bytes a Level of a Shard may hold before it needs Compacting.
+/// </summary>
+/// <param name="level">Level, 1 or deeper</param>
+/// <returns>Byte Limit</returns>
+uint64_t LSMTree::levelLimit(size_t level) const {
+	uint64_t limit = _options.levelBytes;
+	for (size_t deeper = 1; deeper < level; deeper++)
+		limit *= _options.levelMultiplier;
+	return limit;
+}
+
+/// <summary>
+/// Function to find the Level of a Shard which exceeds it's limit the most. Caller
+/// must hold _lock.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="level">Set to the Level to Compact</param>
+/// <returns>Score of the Level, 1 or more if it needs Compacting</returns>
+double LSMTree::score(size_t shard, size_t& level) {
+	VersionPtr version = current(shard);
+	double best = (double)version->levels[0].size() / _options.level0Tables;
+	level = 0;
+	for (size_t deeper = 1; deeper + 1 < LEVELS; deeper++) {
+		uint64_t bytes = 0;
+		for (const TablePtr& table : version->levels[deeper])
+			bytes += table->file.fileSize();
+		double score = (double)bytes / levelLimit(deeper);
+		if (score > best) {
+			best = score;
+			level = deeper;
+		}
+	}
+	return best;
+}
+
+/// <summary>
+/// Function to find the Segment of a Shard with the largest share of Garbage, if
+/// it reaches garbageRatio. Caller must hold _lock.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="ratio">Set to the share of Garbage of the Segment</param>
+/// <returns>Segment to Garbage Collect, NULL if no Segment needs it</returns>
+LSMTree::SegmentPtr LSMTree::pickSegment(size_t shard, double& ratio) {
+	VersionPtr version = current(shard);
+	SegmentPtr best = nullptr;
+	ratio = _options.garbageRatio;
+	for (const SegmentPtr& segment : version->segments) {
+		uint64_t garbage = segment->garbage.load();
+		uint64_t bytes = segment->file.fileSize() - ValueLog::HEADER_SIZE;
+		double value = garbage >= bytes ? 1 : (double)garbage / bytes;
+		if (garbage != 0 && value >= ratio) {
+			best = segment;
+			ratio = value;
+		}
+	}
+	return best;
+}
+
+/// <summary>
+/// Function to pick the next Compaction : the Level most over it's limit among the
+/// Shards no other Thread is Compacting or, when no Level needs Compacting, the
+/// Segment with the largest share of Garbage. Caller must hold _lock.
+/// </summary>
+/// <param name="job">Set to the SSTables to Merge or the Segment to Collect</param>
+/// <returns>True if a Shard needs Compacting or Collecting</returns>
+bool LSMTree::pickCompaction(Job& job) {
+	double best = 1;
+	bool found = false;
+	for (size_t shard = 0; shard < _shards.size(); shard++) {
+		size_t level;
+		double value;
+		if (_shards[shard]->compacting || (value = score(shard, level)) < best)
+			continue;
+		best = value;
+		job.shard = shard;
+		job.level = level;
+		found = true;
+	}
+	if (!found) {
+		best = 0;
+		for (size_t shard = 0; shard < _shards.size(); shard++) {
+			double ratio;
+			SegmentPtr segment;
+			if (_shards[shard]->compacting || (segment = pickSegment(shard, ratio)) == nullptr || ratio <= best)
+				continue;
+			best = ratio;
+			job.shard = shard;
+			job.segment = segment;
+		}
+		if (job.segment != nullptr)
+			job.version = current(job.shard);
+		return job.segment != nullptr;
+	}
+	job.version = current(job.shard);
+	const std::vector<TablePtr>& tables = job.version->levels[job.level];
+	if (job.level == 0) {
+		job.inputs = tables;
+	} else {
+		std::string& cursor = _shards[job.shard]->cursor[job.level];
+		auto next = std::find_if(tables.begin(), tables.end(), [&cursor](const TablePtr& table) { return table->file.smallest() > cursor; });
+		job.inputs.push_back(next == tables.end() ? tables.front() : *next);
+		cursor.assign(job.inputs[0]->file.largest());
+	}
+	std::string_view smallest = job.inputs[0]->file.smallest(), largest = job.inputs[0]->file.largest();
+	for (const TablePtr& table : job.inputs) {
+		smallest = std::min(smallest, table->file.smallest());
+		largest = std::max(largest, table->file.largest());
+	}
+	for (const TablePtr& table : job.version->levels[job.level + 1]) {
+		if (overlaps(table->file, smallest, largest))
+			job.overlaps.push_back(table);
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to run a Compaction : Merges the inputs and the overlapping SSTables of
+/// the next Level into new SSTables of at most tableBytes and Installs them in
+/// place of the Merged ones. An SSTable of Level 1 or deeper which overlaps nothing
+/// is only moved. The Records of the older Versions of Keys dropped by the Merge are
+/// added to the Garbage of their Segments.
+/// </summary>
+/// <param name="job">Compaction picked by pickCompaction</param>
+/// <returns>True if the new Version was Installed</returns>
+bool LSMTree::compact(Job& job) {
+	size_t output = job.level + 1;
+	std::vector<TablePtr> outputs;
+	std::unordered_map<uint64_t, uint64_t> garbage;			// Bytes of dropped Records per Segment Number
+	uint64_t read = 0, written = 0;
+	if (job.level == 0 || !job.overlaps.empty()) {
+		std::string_view smallest = job.inputs[0]->file.smallest(), largest = job.inputs[0]->file.largest();
+		MergeIterator merge;
+		for (const std::vector<TablePtr>* tables : { &job.inputs, &job.overlaps }) {
+			for (const TablePtr& table : *tables) {
+				merge.add(&table->file);
+				smallest = std::min(smallest, table->file.smallest());
+				largest = std::max(largest, table->file.largest());
+				read += table->file.fileSize();
+			}
+		}
+		/* Tombstones are only needed while a deeper Level may hold an older Version */
+		bool bottom = true;
+		for (size_t level = output + 1; level < LEVELS && bottom; level++) {
+			for (const TablePtr& table : job.version->levels[level])
+				bottom = bottom && !overlaps(table->file, smallest, largest);
+		}
+		SSTable::Writer writer;
+		uint64_t number = 0;
+		bool failed = false;
+		auto finish = [&]() {
+			TablePtr table = writer.finish() ? openTable(number) : nullptr;
+			if (table == nullptr)
+				return false;
+			written += table->file.fileSize();
+			outputs.push_back(table);
+			number = 0;
+			return true;
+		};
+		for (merge.start(); merge.valid() && !failed; merge.next()) {
+			const SSTable::Entry& entry = merge.entry();
+			std::string_view data;
+			for (size_t index = 0; index < merge.shadowedCount(); index++) {
+				const SSTable::Entry& older = merge.shadowed(index);
+				ValueLog::Pointer pointer;
+				if (older.separated && merge.shadowedTable(index)->value(older, data) && pointer.decode(data))
+					garbage[pointer.segment] += ValueLog::RECORD_HEADER + older.key.size() + pointer.length;
+			}
+			data = std::string_view();
+			if (entry.removed && bottom)
+				continue;
+			if (!entry.removed && !merge.table()->value(entry, data)) {
+				failed = true;
+				break;
+			}
+			if (number == 0) {
+				std::lock_guard<std::mutex> lock(_lock);
+				number = _nextFile++;
+				failed = !writer.open(tablePath(number), _options.bloomBitsPerKey);
+			}
+			writer.add(entry, data);
+			if (writer.size() >= _options.tableBytes)
+				failed = !finish();
+		}
+		failed = failed || merge.failed() || (number != 0 && !finish());
+		if (failed) {
+			writer.abandon();
+			for (const TablePtr& table : outputs)
+				table->obsolete = true;
+			return false;
+		}
+	}
+	std::lock_guard<std::mutex> lock(_lock);
+	std::shared_ptr<Version> version = std::make_shared<Version>(*current(job.shard));
+	std::vector<TablePtr>& from = version->levels[job.level];
+	std::vector<TablePtr>& to = version->levels[output];
+	for (const TablePtr& table : job.inputs)
+		from.erase(std::remove(from.begin(), from.end(), table), from.end());
+	for (const TablePtr& table : job.overlaps)
+		to.erase(std::remove(to.begin(), to.end(), table), to.end());
+	if (job.level != 0 && job.overlaps.empty())
+		outputs = job.inputs;
+	to.insert(to.end(), outputs.begin(), outputs.end());
+	std::sort(to.begin(), to.end(), [](const TablePtr& left, const TablePtr& right) { return left->file.smallest() < right->file.smallest(); });
+	/* Segments Collected meanwhile are gone along with their Garbage */
+	std::vector<std::pair<SegmentPtr, uint64_t>> dropped;
+	for (const auto& bytes : garbage) {
+		SegmentPtr segment = findSegment(*version, bytes.first);
+		if (segment != nullptr) {
+			segment->garbage.fetch_add(bytes.second);
+			dropped.emplace_back(segment, bytes.second);
+		}
+	}
+	std::vector<VersionPtr> versions(_shards.size());
+	versions[job.shard] = version;
+	if (!install(versions)) {
+		for (const auto& bytes : dropped)
+			bytes.first->garbage.fetch_sub(bytes.second);
+		if (job.level == 0 || !job.overlaps.empty()) {
+			for (const TablePtr& table : outputs)
+				table->obsolete = true;
+		}
+		return false;
+	}
+	if (job.level != 0 && job.overlaps.empty()) {
+		_moves.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+	for (const std::vector<TablePtr>* tables : { &job.inputs, &job.overlaps }) {
+		for (const TablePtr& table : *tables)
+			table->obsolete = true;
+	}
+	_compactions.fetch_add(1, std::memory_order_relaxed);
+	_compactionRead.fetch_add(read, std::memory_order_relaxed);
+	_compactionWritten.fetch_add(written, std::memory_order_relaxed);
+	return true;
+}
+
+/// <summary>
+/// Function to Garbage Collect a Segment : Copies the Records which are still the
+/// newest Version of their Key to a new Segment and Installs a Level 0 SSTable
+/// pointing those Keys at their new Records along with the new Segment in place of
+/// the old one. Keys Written by Flushes while the Records were Copied keep their
+/// newer Version, their Copied Records count as Garbage of the new Segment.
+/// </summary>
+/// <param name="job">Segment picked by pickCompaction</param>
+/// <returns>True if the new Version was Installed</returns>
+bool LSMTree::collect(Job& job) {
+	/// <summary>
+	/// Live Record Copied to the new Segment, with the Entry of it's Key.
+	/// </summary>
+	struct Relocated {
+		std::string key;
+		uint32_t document;
+		long long int timestamp;
+		std::string tags;									// Encoded Tag IDs
+		uint32_t tagCount;
+		ValueLog::Pointer pointer;
+	};
+	std::vector<Relocated> relocated;
+	ValueLog::Writer log;
+	uint64_t number = 0;
+	bool failed = false;
+	bool intact = job.segment->file.forEach([&](const ValueLog::Record& record) {
+		SSTable::Entry entry;
+		std::string_view data;
+		ValueLog::Pointer pointer;
+		const SSTable * table = failed ? nullptr : locate(*job.version, record.key, entry);
+		if (table == nullptr || entry.removed || !entry.separated || !table->value(entry, data) || !pointer.decode(data) ||
+			pointer.segment != job.segment->number || pointer.offset != record.offset)
+			return;
+		if (number == 0) {
+			std::lock_guard<std::mutex> lock(_lock);
+			number = _nextFile++;
+			if (!log.open(segmentPath(number), number)) {
+				failed = true;
+				return;
+			}
+		}
+		relocated.push_back({ std::string(record.key), entry.document, entry.timestamp, std::string(entry.tags, 4 * (size_t)entry.tagCount),
+			entry.tagCount, log.append(record.key, record.data) });
+	});
+	SegmentPtr segment = nullptr;
+	if (intact && !failed && number != 0) {
+		segment = log.finish() ? openSegment(number) : nullptr;
+		failed = segment == nullptr;
+	}
+	if (!intact || failed) {
+		log.abandon();
+		return false;
+	}
+	std::sort(relocated.begin(), relocated.end(), [](const Relocated& left, const Relocated& right) { return left.key < right.key; });
+	/* The Shard is not Compacted meanwhile, only Flushes put newer Level 0 SSTables in front */
+	std::lock_guard<std::mutex> lock(_lock);
+	std::shared_ptr<Version> version = std::make_shared<Version>(*current(job.shard));
+	std::vector<const SSTable*> newer;
+	for (const TablePtr& table : version->levels[0]) {
+		if (std::find(job.version->levels[0].begin(), job.version->levels[0].end(), table) != job.version->levels[0].end())
+			break;
+		newer.push_back(&table->file);
+	}
+	SSTable::Writer writer;
+	uint64_t tableNumber = 0, moved = 0, dead = 0;
+	for (const Relocated& record : relocated) {
+		SSTable::Entry entry;
+		uint64_t bytes = ValueLog::RECORD_HEADER + record.key.size() + record.pointer.length;
+		bool shadowed = false;
+		for (const SSTable * table : newer)
+			shadowed = shadowed || probe(*table, record.key, entry);
+		if (shadowed) {
+			dead += bytes;
+			continue;
+		}
+		if (tableNumber == 0) {
+			tableNumber = _nextFile++;
+			if (!writer.open(tablePath(tableNumber), _options.bloomBitsPerKey)) {
+				failed = true;
+				break;
+			}
+		}
+		entry.key = record.key;
+		entry.document = record.document;
+		entry.removed = false;
+		entry.separated = true;
+		entry.timestamp = record.timestamp;
+		entry.tags = record.tags.data();
+		entry.tagCount = record.tagCount;
+		writer.add(entry, record.pointer.encode());
+		moved += bytes;
+	}
+	TablePtr table = nullptr;
+	if (!failed && tableNumber != 0) {
+		table = writer.finish() ? openTable(tableNumber) : nullptr;
+		failed = table == nullptr;
+	}
+	if (segment != nullptr && moved == 0) {
+		segment->obsolete = true;
+		segment = nullptr;
+	}
+	if (table != nullptr)
+		version->levels[0].insert(version->levels[0].begin(), table);
+	std::vector<SegmentPtr>& segments = version->segments;
+	segments.erase(std::remove(segments.begin(), segments.end(), job.segment), segments.end());
+	if (segment != nullptr) {
+		segment->garbage = dead;
+		segments.insert(std::upper_bound(segments.begin(), segments.end(), segment,
+			[](const SegmentPtr& left, const SegmentPtr& right) { return left->number < right->number; }), segment);
+	}
+	std::vector<VersionPtr> versions(_shards.size());
+	versions[job.shard] = version;
+	if (failed || !install(versions)) {
+		writer.abandon();
+		if (table != nullptr)
+			table->obsolete = true;
+		if (segment != nullptr)
+			segment->obsolete = true;
+		return false;
+	}
+	job.segment->obsolete = true;
+	_collections.fetch_add(1, std::memory_order_relaxed);
+	_relocated.fetch_add(moved, std::memory_order_relaxed);
+	_reclaimed.fetch_add(job.segment->file.fileSize() - (segment != nullptr ? segment->file.fileSize() : 0), std::memory_order_relaxed);
+	_valueLogWritten.fetch_add(segment != nullptr ? segment->file.fileSize() : 0, std::memory_order_relaxed);
+	_compactionWritten.fetch_add(table != nullptr ? table->file.fileSize() : 0, std::memory_order_relaxed);
+	return true;
+}
+
+/// <summary>
+/// Function run by every Compaction Thread. Picks and runs Compactions till the Tier
+/// is Closed, Waiting for a Flush when no Shard needs Compacting or Collecting. A
+/// failed Compaction is retried after a second.
+/// </summary>
+void LSMTree::compactionLoop() {
+	std::unique_lock<std::mutex> lock(_lock);
+	while (!_closing) {
+		Job job;
+		if (!pickCompaction(job)) {
+			_idle.notify_all();
+			_work.wait(lock);
+			continue;
+		}
+		size_t shard = job.shard;
+		_shards[shard]->compacting = true;
+		lock.unlock();
+		bool compacted = job.segment != nullptr ? collect(job) : compact(job);
+		job = Job();
+		lock.lock();
+		_shards[shard]->compacting = false;
+		_idle.notify_all();
+		if (!compacted)
+			_work.wait_for(lock, std::chrono::seconds(1));
+	}
+}
+
+/// <summary>
+/// Function to Wait till no Shard needs Compacting or Collecting and no Compaction
+/// is running. Used to measure a settled Tree.
+/// </summary>
+void LSMTree::waitIdle() {
+	std::unique_lock<std::mutex> lock(_lock);
+	_work.notify_all();
+	_idle.wait(lock, [this]() {
+		for (size_t shard = 0; shard < _shards.size(); shard++) {
+			size_t level;
+			double ratio;
+			if (_shards[shard]->compacting || score(shard, level) >= 1 || pickSegment(shard, ratio) != nullptr)
+				return _closing;
+		}
+		return true;
+	});
+}
+
+/// <summary>
+/// Function to get the Shape of the Tree and it's Counters.
+/// </summary>
+/// <returns>SSTables and Bytes per Level and Segments summed over the Shards, Read and Write Counters</returns>
+LSMTree::Stats LSMTree::stats() {
+	Stats stats;
+	for (size_t shard = 0; shard < _shards.size(); shard++) {
+		VersionPtr version = current(shard);
+		for (size_t level = 0; level < LEVELS; level++) {
+			stats.levelTables[level] += version->levels[level].size();
+			for (const TablePtr& table : version->levels[level])
+				stats.levelBytes[level] += table->file.fileSize();
+		}
+		stats.segments += version->segments.size();
+		for (const SegmentPtr& segment : version->segments) {
+			stats.segmentBytes += segment->file.fileSize();
+			stats.garbageBytes += segment->garbage.load();
+		}
+	}
+	stats.lookups = _lookups.load(std::memory_order_relaxed);
+	stats.tablesChecked = _tablesChecked.load(std::memory_order_relaxed);
+	stats.bloomSkips = _bloomSkips.load(std::memory_order_relaxed);
+	stats.blocksRead = _blocksRead.load(std::memory_order_relaxed);
+	stats.falsePositives = _falsePositives.load(std::memory_order_relaxed);
+	stats.flushes = _flushes.load(std::memory_order_relaxed);
+	stats.flushedBytes = _flushedBytes.load(std::memory_order_relaxed);
+	stats.compactions = _compactions.load(std::memory_order_relaxed);
+	stats.moves = _moves.load(std::memory_order_relaxed);
+	stats.compactionReadBytes = _compactionRead.load(std::memory_order_relaxed);
+	stats.compactionWrittenBytes = _compactionWritten.load(std::memory_order_relaxed);
+	stats.valueLogBytesWritten = _valueLogWritten.load(std::memory_order_relaxed);
+	stats.collections = _collections.load(std::memory_order_relaxed);
+	stats.relocatedBytes = _relocated.load(std::memory_order_relaxed);
+	stats.reclaimedBytes = _reclaimed.load(std::memory_order_relaxed);
+	return stats;
+}
+
+#if defined(TEST_LSMTREE) || defined(BENCH_LSMTREE)
+
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Print the SSTables and Bytes of every non empty Level.
+/// </summary>
+/// <param name="stats">Stats of the Tier</param>
+void printLevels(const LSMTree::Stats& stats) {
+	for (size_t level = 0; level < LSMTree::LEVELS; level++) {
+		if (stats.levelTables[level] != 0)
+			std::cout << "\n > Level " << level << " : " << stats.levelTables[level] << " SSTables, " << stats.levelBytes[level] << " Bytes";
+	}
+}
+
+#endif // TEST_LSMTREE || BENCH_LSMTREE
+
+#ifdef TEST_LSMTREE
+
+/// <summary>
+/// Function to Test LSMTree Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	LSMTree::Options options;
+	options.directory = "LSMTree.test";
+	options.tableBytes = 4096;
+	options.levelBytes = 16384;
+	options.level0Tables = 2;
+	TagDictionary * dictionary = TagDictionary::defaultDictionary();
+	dictionary->intern("Even");
+	std::vector<std::string> names;
+	for (uint32_t id = 0; id < (uint32_t)dictionary->size(); id++)
+		names.push_back(dictionary->name(id));
+	std::vector<std::string> tags;
+	size_t shards = 2;
+	LSMTree tree;
+	auto print = [&tree](std::string_view key) {
+		LSMTree::Value value;
+		if (!tree.get(std::hash<std::string_view>()(key) % 2, key, value))
+			std::cout << "\n > " << key << " : Not Found";
+		else if (value.removed)
+			std::cout << "\n > " << key << " : Removed";
+		else
+			std::cout << "\n > " << key << " : Document " << value.document << ", Data : " << value.data << ", Tags : " << value.tags.size();
+	};
+
+	StringHelper::Title("TESTING LSMTREE PACKAGE", '=');
+	StringHelper::Title("Test Flush and get");
+	std::cout << "\n > Opened : " << tree.open(options, shards, tags) << ", Shards : " << shards;
+	std::vector<DBElement> elements;
+	for (int index = 0; index < 2000; index++)
+		elements.push_back(index % 2 ? DBElement("value " + std::to_string(index)) : DBElement("value " + std::to_string(index), { "Even" }));
+	for (int round = 0; round < 4; round++) {
+		std::vector<std::vector<LSMTree::FlushEntry>> memtables(shards);
+		for (int index = round * 500; index < (round + 1) * 500; index++) {
+			std::string key = "key" + std::to_string(index);
+			memtables[std::hash<std::string_view>()(key) % shards].push_back({ key, (uint32_t)index, &elements[index] });
+		}
+		if (round == 3) {
+			memtables[std::hash<std::string_view>()("key7") % shards].push_back({ "key7", 7, nullptr });
+			memtables[std::hash<std::string_view>()("key1200") % shards].push_back({ "key1200", 1200, nullptr });
+		}
+		std::cout << "\n > Flush " << round << " : " << tree.flush(memtables, names);
+	}
+	print("key0");
+	print("key7");
+	print("key1200");
+	print("key1999");
+	print("missing");
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Compaction");
+	tree.waitIdle();
+	LSMTree::Stats stats = tree.stats();
+	std::cout << "\n > Flushes : " << stats.flushes << ", Compactions : " << stats.compactions << ", Moves : " << stats.moves;
+	printLevels(stats);
+	print("key7");
+	print("key1200");
+	print("key1999");
+	size_t live = 0;
+	for (size_t shard = 0; shard < shards; shard++)
+		tree.scan(shard, [&live](const SSTable::Entry&) { live++; });
+	std::cout << "\n > Live Keys Scanned : " << live << std::endl;
+	putline();
+
+	StringHelper::Title("Test Reopen");
+	tree.close();
+	shards = 8;
+	std::cout << "\n > Reopened : " << tree.open(options, shards, tags) << ", Shards : " << shards << ", Tags : " << tags.size();
+	print("key7");
+	print("key42");
+	stats = tree.stats();
+	printLevels(stats);
+	std::cout << std::endl;
+	tree.close();
+	auto clean = [&options]() {
+		std::error_code error;
+		std::filesystem::remove_all(options.directory, error);
+	};
+	clean();
+	putline();
+
+	StringHelper::Title("Test Value Separation and Garbage Collection");
+	options.valueThreshold = 64;
+	options.garbageRatio = 0.3;
+	shards = 2;
+	auto printSize = [&tree](std::string_view key) {
+		LSMTree::Value value;
+		if (!tree.get(std::hash<std::string_view>()(key) % 2, key, value) || value.removed)
+			std::cout << "\n > " << key << " : Not Found";
+		else
+			std::cout << "\n > " << key << " : Document " << value.document << ", Data : " << value.data.size() << " Bytes of '" << value.data[0] << "', Tags : " << value.tags.size();
+	};
+	std::cout << "\n > Opened : " << tree.open(options, shards, tags);
+	std::vector<DBElement> large;
+	for (int index = 0; index < 1000; index++)
+		large.push_back(index % 10 == 9 ? DBElement("small") : DBElement(std::string(200, index < 500 ? 'a' : 'b'), { "Even" }));
+	for (int round = 0; round < 2; round++) {
+		/* The second Flush overwrites every other Key, leaving half of the first Segment Garbage */
+		std::vector<std::vector<LSMTree::FlushEntry>> memtables(shards);
+		for (int index = 0; index < 500; index += round + 1) {
+			std::string key = "key" + std::to_string(index);
+			memtables[std::hash<std::string_view>()(key) % shards].push_back({ key, (uint32_t)index, &large[round * 500 + index] });
+		}
+		std::cout << "\n > Flush " << round << " : " << tree.flush(memtables, names);
+	}
+	tree.waitIdle();
+	stats = tree.stats();
+	std::cout << "\n > Compactions : " << stats.compactions << ", Collections : " << stats.collections << ", Segments : " << stats.segments
+		<< ", Garbage : " << stats.garbageBytes << " Bytes";
+	std::cout << "\n > Relocated : " << stats.relocatedBytes << " Bytes, Reclaimed : " << stats.reclaimedBytes << " Bytes";
+	printSize("key0");
+	printSize("key1");
+	printSize("key9");
+	tree.close();
+	std::cout << "\n > Reopened : " << tree.open(options, shards, tags);
+	printSize("key1");
+	printSize("key2");
+	std::cout << std::endl;
+	tree.close();
+	clean();
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_LSMTREE
+
+#ifdef BENCH_LSMTREE
+
+#include <chrono>
+#include <random>
+
+#include "DBEngine.h"
+
+/// <summary>
+/// Function to Benchmark a DBEngine whose Data is many times larger than it's
+/// Memtables. Measures Insert Throughput and Write Amplification, the Shape of the
+/// Tree once Compaction settles, and how many SSTables and Key Blocks Point Reads
+/// of existing and missing Keys touch.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [keys] [value size] [memtable MB] [directory]</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	size_t keys = argc > 1 ? std::stoul(argv[1]) : 4000000;
+	size_t size = argc > 2 ? std::stoul(argv[2]) : 100;
+	size_t memtable = argc > 3 ? std::stoul(argv[3]) : 32;
+	std::string directory = argc > 4 ? argv[4] : "LSMTree.bench";
+	const uint64_t prime = 2654435761ULL;
+	const size_t reads = 200000;
+	typedef std::chrono::steady_clock Clock;
+	auto elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+
+	StringHelper::Title("BENCHMARKING LSM TIER", '=');
+	std::cout << "\n Keys : " << keys << ", Value Size : " << size << " B, Memtables : " << memtable << " MB";
+	DBEngineConfig config(4);
+	config.lsm.directory = directory;
+	config.lsm.memtableBytes = memtable << 20;
+	config.lsm.levelBytes = 2 * config.lsm.memtableBytes / config.shards;
+	DBEngine db("benchmark", config);
+	std::string tags[] = { "Red", "Green", "Blue", "Black" };
+	uint64_t userBytes = 0;
+	Clock::time_point start = Clock::now();
+	for (size_t index = 0; index < keys; index++) {
+		/* Keys are Inserted in a scattered order so Flushed SSTables overlap */
+		std::string key = "key" + std::to_string(index * prime % keys);
+		userBytes += key.size() + size;
+		db.insert(key, DBElement(std::string(size, 'a' + index % 26), { tags[index % 4] }));
+	}
+	double inserting = elapsed(start);
+	LSMTree::Stats stats = db.tierStats();
+	double settled = elapsed(start);
+	std::cout << "\n User Data : " << userBytes / (1 << 20) << " MB (" << (double)userBytes / config.lsm.memtableBytes << "x the Memtables)\n";
+	std::cout << "\n Inserts : " << (uint64_t)(keys / (inserting / 1000)) << " /s, Compaction settled after " << settled / 1000 << " s";
+	std::cout << "\n Flushes : " << stats.flushes << ", Compactions : " << stats.compactions << ", Moves : " << stats.moves;
+	std::cout << "\n Write Amplification : " << (double)(stats.flushedBytes + stats.compactionWrittenBytes) / userBytes
+		<< " (Flushed " << stats.flushedBytes / (1 << 20) << " MB, Compacted " << stats.compactionWrittenBytes / (1 << 20) << " MB)";
+	printLevels(stats);
+	std::cout << "\n";
+
+	std::mt19937_64 random(42);
+	for (bool existing : { true, false }) {
+		LSMTree::Stats before = db.tierStats();
+		size_t found = 0;
+		start = Clock::now();
+		for (size_t read = 0; read < reads; read++) {
+			/* Missing Keys fall inside the Key Ranges of the SSTables, so only the Bloom Filters rule them out */
+			std::string key = "key" + std::to_string(random() % keys + (existing ? 0 : keys));
+			found += db.getView(key).valid();
+		}
+		double reading = elapsed(start);
+		LSMTree::Stats after = db.tierStats();
+		auto perGet = [reads](uint64_t from, uint64_t to) { return (double)(to - from) / reads; };
+		std::cout << "\n " << (existing ? "Existing Keys" : "Missing Keys ") << "\t Reads : " << (uint64_t)(reads / (reading / 1000)) << " /s (" << found << " found)"
+			<< "\t per Get : SSTables Checked " << perGet(before.tablesChecked, after.tablesChecked)
+			<< ", Bloom Skips " << perGet(before.bloomSkips, after.bloomSkips)
+			<< ", Key Blocks Read " << perGet(before.blocksRead, after.blocksRead)
+			<< ", False Positives " << perGet(before.falsePositives, after.falsePositives);
+	}
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_LSMTREE
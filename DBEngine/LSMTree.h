@@ -0,0 +1,370 @@
+//////////////////////////////////////////////////////////////////
+// LSMTree.h        - Log-Structured Merge Tier of DBEngine     //
+//                    holding SSTables in Leveled Runs.         //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides LSMTree class which keeps the DBElements of a DBEngine that
+ * do not fit in memory in SSTables on Disk, organized as a Leveled Log-Structured
+ * Merge Tree. The DBEngine's DB Tables are the Memtables : once they hold
+ * Options::memtableBytes the DBEngine Flushes them through flush(), which Writes
+ * one sorted SSTable per Shard into Level 0.
+ *
+ * Every Shard has it's own Levels. Level 0 holds Flushed SSTables whose Key Ranges
+ * overlap, newest first. Every deeper Level holds SSTables with disjoint Key Ranges
+ * sorted by Key, and is allowed levelMultiplier times more Bytes than the Level
+ * above it. A Pool of Compaction Threads picks the Shard and Level which exceeds
+ * it's limit the most and Merges it into the next Level :
+ *
+ *   Level 0 : every Level 0 SSTable and the overlapping Level 1 SSTables.
+ *   Level n : the next SSTable in Key order (round robin) and the overlapping
+ *             Level n + 1 SSTables. An SSTable which overlaps nothing is moved.
+ *
+ * Merging keeps only the newest Version of every Key and drops Tombstones once no
+ * deeper Level may hold an older Version. Compactions of different Shards run in
+ * parallel, a Shard is Compacted by one Thread at a time.
+ *
+ * get() consults Level 0 newest first and then one SSTable per deeper Level, and
+ * stops at the first Version found, Tombstones included. Each SSTable's Key Range
+ * and Bloom Filter are checked before it's Key Block is Read, so a Point Read
+ * usually Reads one Key Block and one Value.
+ *
+ * The set of SSTables of every Level is a Version which Readers hold through a
+ * shared_ptr, so Flushes and Compactions install new Versions without waiting for
+ * Readers. An SSTable replaced by a Compaction is Deleted once the last Version
+ * holding it is Released. The Manifest ("<directory>/MANIFEST") lists the SSTables
+ * of every Level along with the Tag Dictionary and is Rewritten and Renamed into
+ * place whenever a Version is installed :
+ *   [Magic "NOSQLLSM"][u32 Version][u32 Shard Count][u64 Next File Number]
+ *   [u32 Tag Count]([u32 Length][Bytes])...
+ *   [u32 SSTable Count]([u32 Shard][u32 Level][u64 File Number])...
+ *   [u32 Segment Count]([u32 Shard][u64 File Number][u64 Garbage Bytes])...
+ *   [u32 CRC32C of everything before]
+ *
+ * Key-Value Separation is enabled by Options::valueThreshold. A Flush then Appends
+ * the Data of every DBElement at least that large to a new Value Log Segment of the
+ * Shard (see ValueLog) and the SSTable only holds a Pointer to it, so Compactions
+ * Rewrite Pointers instead of the large Values. Every Segment counts the Bytes of
+ * it's Records no Key refers to anymore : when a Compaction drops an older Version
+ * of a Key whose Value was Separated, the Record it pointed to becomes Garbage. A
+ * Compaction Thread with no Level to Compact Collects the Segment with the largest
+ * share of Garbage once it reaches Options::garbageRatio : the Records which are
+ * still the newest Version of their Key are Copied to a new Segment, a small Level 0
+ * SSTable pointing the Keys at their new Records is Installed and the old Segment
+ * is Deleted once no Version holds it. The Manifest lists the Segments of every
+ * Shard after the SSTables, along with their Garbage.
+ *
+ * scan() Merges every SSTable of a Shard and returns the newest Version of every
+ * Key, which DBEngine uses to Rebuild the Document IDs and the Tag Index of the
+ * Keys on Disk when it is Constructed.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool open(const Options& options, size_t& shards, std::vector<std::string>& tags)
+ * Method to Read the Manifest, open every SSTable and Start the Compaction Threads.
+ *
+ * - void close()
+ * Method to Stop the Compaction Threads and Close every SSTable.
+ *
+ * - bool isOpen() const
+ * Method to Check whether the Tier is open.
+ *
+ * - bool flush(std::vector<std::vector<FlushEntry>>& shards, const std::vector<std::string>& tags)
+ * Method to Write the Memtables of every Shard to new Level 0 SSTables.
+ *
+ * - bool get(size_t shard, std::string_view key, Value& value)
+ * Method to Find the newest Version of a Key.
+ *
+ * - bool scan(size_t shard, Function function)
+ * Method to call function(entry) for the newest Version of every Key of a Shard which is not Removed.
+ *
+ * - void waitIdle()
+ * Method to Wait till no Shard needs Compacting and no Segment needs Collecting.
+ *
+ * - Stats stats()
+ * Method to get the SSTables, Bytes per Level, the Value Log and the Read and Write Counters.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * SSTable.h, SSTable.cpp, ValueLog.h, ValueLog.cpp, DBElement.h, DBElement.cpp, FileSystem.h, FileSystem.cpp,
+ * WriteAheadLog.h, WriteAheadLog.cpp, Snapshot.h, Snapshot.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added Key-Value Separation into Value Log Segments and their Garbage Collection.
+ *
+ */
+#ifndef LSMTREE_H
+#define LSMTREE_H
+
+#include "SSTable.h"
+#include "ValueLog.h"
+#include "../DBElement/DBElement.h"
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <condition_variable>
+
+/// <summary>
+/// Leveled Log-Structured Merge Tree of SSTables, Partitioned like the DBEngine.
+/// </summary>
+class LSMTree {
+public:
+	static const uint32_t VERSION = 2;
+	static const size_t LEVELS = 7;
+
+	/// <summary>
+	/// Options used to open the Tier. Sizes of Levels and SSTables are per Shard.
+	/// </summary>
+	struct Options {
+		std::string directory;								// Directory of the SSTables and Manifest, empty to keep every DBElement in memory
+		size_t memtableBytes = 64 << 20;					// DBEngine Flushes it's Memtables once they hold about this many Bytes
+		size_t tableBytes = 4 << 20;						// Compaction starts a new SSTable once one is this large
+		size_t levelBytes = 32 << 20;						// Bytes allowed in Level 1, deeper Levels allow levelMultiplier times more each
+		unsigned levelMultiplier = 10;
+		unsigned level0Tables = 4;							// Level 0 SSTables which make a Shard need Compacting
+		unsigned compactionThreads = 2;
+		unsigned bloomBitsPerKey = 10;
+		size_t valueThreshold = 0;							// Data at least this large is Flushed to the Value Log, 0 keeps every Value in the SSTables
+		double garbageRatio = 0.5;							// Share of Garbage which makes a Segment need Collecting
+	};
+
+	/// <summary>
+	/// Key of a Memtable passed to flush().
+	/// </summary>
+	struct FlushEntry {
+		std::string key;
+		uint32_t document;
+		const DBElement * element;							// DBElement of the Key, NULL if the Key was Removed
+	};
+
+	/// <summary>
+	/// Newest Version of a Key returned by get().
+	/// </summary>
+	struct Value {
+		uint32_t document = 0;
+		bool removed = false;								// Key was Removed, nothing else is set
+		long long int timestamp = 0;
+		std::vector<uint32_t> tags;
+		std::string data;
+	};
+
+	/// <summary>
+	/// Shape of the Tree and Counters since it was opened.
+	/// </summary>
+	struct Stats {
+		size_t levelTables[LEVELS] = {};					// SSTables in every Level
+		uint64_t levelBytes[LEVELS] = {};					// Bytes in every Level
+		uint64_t lookups = 0;								// Calls to get()
+		uint64_t tablesChecked = 0;							// SSTables whose Key Range held the Key
+		uint64_t bloomSkips = 0;							// SSTables ruled out by their Bloom Filter
+		uint64_t blocksRead = 0;							// Key Blocks Read
+		uint64_t falsePositives = 0;						// Key Blocks Read which did not hold the Key
+		uint64_t flushes = 0;
+		uint64_t flushedBytes = 0;							// Bytes of SSTables Written by Flushes
+		uint64_t compactions = 0;
+		uint64_t moves = 0;									// SSTables moved to the next Level without Merging
+		uint64_t compactionReadBytes = 0;
+		uint64_t compactionWrittenBytes = 0;				// Includes the SSTables Written by Garbage Collection
+		size_t segments = 0;								// Value Log Segments
+		uint64_t segmentBytes = 0;							// Bytes of the Value Log Segments
+		uint64_t garbageBytes = 0;							// Bytes of Records no Key refers to anymore
+		uint64_t valueLogBytesWritten = 0;					// Bytes of Segments Written by Flushes and Garbage Collection
+		uint64_t collections = 0;							// Segments Garbage Collected
+		uint64_t relocatedBytes = 0;						// Bytes of Live Records Copied by Garbage Collection
+		uint64_t reclaimedBytes = 0;						// Bytes Freed by Garbage Collection
+	};
+private:
+	/// <summary>
+	/// Open SSTable File. Deleted when the last Version holding it is Released, if
+	/// a Compaction replaced it.
+	/// </summary>
+	struct Table {
+		uint64_t number;
+		std::string path;
+		SSTable file;
+		std::atomic<bool> obsolete;
+
+		Table() : number(0), obsolete(false) {}
+		~Table();
+	};
+	typedef std::shared_ptr<Table> TablePtr;
+
+	/// <summary>
+	/// Open Value Log Segment. Deleted when the last Version holding it is Released,
+	/// if Garbage Collection replaced it.
+	/// </summary>
+	struct Segment {
+		uint64_t number;
+		std::string path;
+		ValueLog file;
+		std::atomic<uint64_t> garbage;						// Bytes of Records no Key refers to anymore
+		std::atomic<bool> obsolete;
+
+		Segment() : number(0), garbage(0), obsolete(false) {}
+		~Segment();
+	};
+	typedef std::shared_ptr<Segment> SegmentPtr;
+
+	/// <summary>
+	/// SSTables of every Level of a Shard. Level 0 is newest first, deeper Levels
+	/// are sorted by Key. Never changed once installed.
+	/// </summary>
+	struct Version {
+		std::vector<TablePtr> levels[LEVELS];
+		std::vector<SegmentPtr> segments;					// Value Log Segments, sorted by Number
+	};
+	typedef std::shared_ptr<const Version> VersionPtr;
+
+	/// <summary>
+	/// Levels of one Shard.
+	/// </summary>
+	struct Shard {
+		std::mutex lock;									// Lock guarding current, Readers only hold it to copy the pointer
+		VersionPtr current;
+		bool compacting = false;							// A Compaction Thread is working on the Shard, guarded by _lock
+		std::string cursor[LEVELS];							// Largest Key of the SSTable last Compacted out of every Level
+	};
+
+	/// <summary>
+	/// Compaction picked by a Compaction Thread.
+	/// </summary>
+	struct Job {
+		size_t shard;
+		size_t level;										// Level Compacted into level + 1
+		VersionPtr version;
+		std::vector<TablePtr> inputs;						// SSTables of level, newest first
+		std::vector<TablePtr> overlaps;						// SSTables of level + 1 overlapping the inputs
+		SegmentPtr segment;									// Segment to Garbage Collect instead, if set
+	};
+
+	/// <summary>
+	/// Merges SSTables and yields the newest Version of every Key in Key order.
+	/// </summary>
+	class MergeIterator {
+	private:
+		std::vector<SSTable::Iterator> _sources;			// Newest first
+		std::vector<const SSTable*> _tables;
+		size_t _current;									// Source of the current Entry
+		std::vector<size_t> _shadowed;						// Sources holding older Versions of the current Key
+		bool _failed;
+
+		void select();
+	public:
+		/* Constructor */
+		MergeIterator();
+
+		/* Member Functions */
+		void add(const SSTable * table);
+		void start();
+		bool valid() const;
+		bool failed() const;
+		const SSTable::Entry& entry() const;
+		const SSTable * table() const;
+		size_t shadowedCount() const;
+		const SSTable::Entry& shadowed(size_t index) const;
+		const SSTable * shadowedTable(size_t index) const;
+		void next();
+	};
+
+	Options _options;
+	std::vector<Shard*> _shards;
+	std::mutex _lock;										// Lock guarding Installs, the Manifest, Tags and File Numbers
+	std::condition_variable _work;							// Signals Compaction Threads that a Version was installed
+	std::condition_variable _idle;							// Signals waitIdle that a Compaction finished
+	std::vector<std::thread> _compactors;
+	std::vector<std::string> _tags;							// Tag Dictionary of the newest Flush
+	uint64_t _nextFile;
+	bool _closing;
+	bool _open;
+	std::atomic<uint64_t> _lookups, _tablesChecked, _bloomSkips, _blocksRead, _falsePositives;
+	std::atomic<uint64_t> _flushes, _flushedBytes, _compactions, _moves, _compactionRead, _compactionWritten;
+	std::atomic<uint64_t> _valueLogWritten, _collections, _relocated, _reclaimed;
+
+	std::string tablePath(uint64_t number) const;
+	std::string segmentPath(uint64_t number) const;
+	std::string manifestPath() const;
+	VersionPtr current(size_t shard);
+	TablePtr openTable(uint64_t number);
+	SegmentPtr openSegment(uint64_t number);
+	static SegmentPtr findSegment(const Version& version, uint64_t number);
+	bool probe(const SSTable& table, std::string_view key, SSTable::Entry& entry);
+	const SSTable * locate(const Version& version, std::string_view key, SSTable::Entry& entry);
+	bool install(std::vector<VersionPtr>& versions);
+	bool writeManifest(const std::vector<VersionPtr>& versions);
+	bool readManifest(size_t& shards);
+	uint64_t levelLimit(size_t level) const;
+	double score(size_t shard, size_t& level);
+	SegmentPtr pickSegment(size_t shard, double& ratio);
+	bool pickCompaction(Job& job);
+	bool compact(Job& job);
+	bool collect(Job& job);
+	void compactionLoop();
+	static bool overlaps(const SSTable& table, std::string_view smallest, std::string_view largest);
+	static uint32_t getU32(const char * bytes);
+	static uint64_t getU64(const char * bytes);
+	static void putU32(std::string& out, uint32_t value);
+	static void putU64(std::string& out, uint64_t value);
+public:
+	/* Constructor */
+	LSMTree();
+	LSMTree(const LSMTree&) = delete;
+	LSMTree& operator=(const LSMTree&) = delete;
+
+	/* Destructor */
+	~LSMTree();
+
+	/* Member Functions */
+	bool open(const Options& options, size_t& shards, std::vector<std::string>& tags);
+	void close();
+	bool isOpen() const;
+	bool flush(std::vector<std::vector<FlushEntry>>& shards, const std::vector<std::string>& tags);
+	bool get(size_t shard, std::string_view key, Value& value);
+	template <typename Function> bool scan(size_t shard, Function function);
+	void waitIdle();
+	Stats stats();
+};
+
+/// <summary>
+/// Function to call function(entry) for the newest Version of every Key of a Shard,
+/// in Key order, leaving out Removed Keys. Only the Key Blocks are Read.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="function">Function accepting (const SSTable::Entry&amp;)</param>
+/// <returns>True if every Key Block was intact</returns>
+template <typename Function>
+bool LSMTree::scan(size_t shard, Function function) {
+	VersionPtr version = current(shard);
+	MergeIterator merge;
+	for (size_t level = 0; level < LEVELS; level++) {
+		for (const TablePtr& table : version->levels[level])
+			merge.add(&table->file);
+	}
+	for (merge.start(); merge.valid(); merge.next()) {
+		if (!merge.entry().removed)
+			function(merge.entry());
+	}
+	return !merge.failed();
+}
+
+#endif // !LSMTREE_H
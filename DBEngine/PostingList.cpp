@@ -0,0 +1,901 @@
+//////////////////////////////////////////////////////////////////
+// PostingList.cpp  - Compressed Set of Document IDs used by    //
+//                    the DBEngine Tag Index.                   //
+// Version          - 1.2                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "PostingList.h"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define POSTINGLIST_SSE2
+#include <emmintrin.h>
+#endif
+
+/// <summary>
+/// Default Constructor for PostingList.
+/// </summary>
+PostingList::PostingList() : _cardinality(0) {
+}
+
+/// <summary>
+/// Function to get the Index of the first Container whose high 16 bits are not
+/// less than the given ones.
+/// </summary>
+/// <param name="high">High 16 bits of a Document ID</param>
+/// <returns>Index of the Container, number of Containers if there is none</returns>
+size_t PostingList::lowerBound(uint16_t high) const {
+	size_t first = 0, count = _containers.size();
+	while (count > 0) {
+		size_t step = count / 2;
+		if (_containers[first + step].high < high) {
+			first += step + 1;
+			count -= step + 1;
+		} else {
+			count = step;
+		}
+	}
+	return first;
+}
+
+/// <summary>
+/// Function to turn an Array Container into a Bitmap Container.
+/// </summary>
+/// <param name="container">Array Container</param>
+void PostingList::toBitmap(Container& container) {
+	container.bitmap.assign(BITMAP_WORDS, 0);
+	for (uint16_t low : container.array)
+		container.bitmap[low >> 6] |= 1ULL << (low & 63);
+	std::vector<uint16_t>().swap(container.array);
+}
+
+/// <summary>
+/// Function to turn a Bitmap Container into an Array Container.
+/// </summary>
+/// <param name="container">Bitmap Container</param>
+void PostingList::toArray(Container& container) {
+	container.array.reserve(container.cardinality);
+	for (uint32_t index = 0; index < BITMAP_WORDS; index++) {
+		for (uint64_t word = container.bitmap[index]; word != 0; word &= word - 1)
+			container.array.push_back((uint16_t)((index << 6) | lowestBit(word)));
+	}
+	std::vector<uint64_t>().swap(container.bitmap);
+}
+
+/// <summary>
+/// Function to Add a Document ID. Array Containers which grow past ARRAY_LIMIT
+/// are turned into Bitmap Containers.
+/// </summary>
+/// <param name="id">Document ID</param>
+/// <returns>True if the Document ID was Added, False if it was already present</returns>
+bool PostingList::add(uint32_t id) {
+	uint16_t high = (uint16_t)(id >> 16), low = (uint16_t)id;
+	size_t position = lowerBound(high);
+	if (position == _containers.size() || _containers[position].high != high) {
+		Container container;
+		container.high = high;
+		container.cardinality = 0;
+		_containers.insert(_containers.begin() + position, std::move(container));
+	}
+	Container& container = _containers[position];
+	if (container.isBitmap()) {
+		uint64_t& word = container.bitmap[low >> 6];
+		uint64_t bit = 1ULL << (low & 63);
+		if (word & bit)
+			return false;
+		word |= bit;
+	} else {
+		auto slot = std::lower_bound(container.array.begin(), container.array.end(), low);
+		if (slot != container.array.end() && *slot == low)
+			return false;
+		container.array.insert(slot, low);
+		if (container.array.size() > ARRAY_LIMIT)
+			toBitmap(container);
+	}
+	container.cardinality++;
+	_cardinality++;
+	return true;
+}
+
+/// <summary>
+/// Function to Remove a Document ID. Bitmap Containers which shrink to ARRAY_LIMIT
+/// are turned back into Array Containers and empty Containers are dropped.
+/// </summary>
+/// <param name="id">Document ID</param>
+/// <returns>True if the Document ID was Removed, False if it was not present</returns>
+bool PostingList::remove(uint32_t id) {
+	uint16_t high = (uint16_t)(id >> 16), low = (uint16_t)id;
+	size_t position = lowerBound(high);
+	if (position == _containers.size() || _containers[position].high != high)
+		return false;
+	Container& container = _containers[position];
+	if (container.isBitmap()) {
+		uint64_t& word = container.bitmap[low >> 6];
+		uint64_t bit = 1ULL << (low & 63);
+		if (!(word & bit))
+			return false;
+		word &= ~bit;
+		if (--container.cardinality <= ARRAY_LIMIT)
+			toArray(container);
+	} else {
+		auto slot = std::lower_bound(container.array.begin(), container.array.end(), low);
+		if (slot == container.array.end() || *slot != low)
+			return false;
+		container.array.erase(slot);
+		container.cardinality--;
+	}
+	_cardinality--;
+	if (container.cardinality == 0)
+		_containers.erase(_containers.begin() + position);
+	return true;
+}
+
+/// <summary>
+/// Function to Check whether a Document ID is present.
+/// </summary>
+/// <param name="id">Document ID</param>
+/// <returns>True if the Document ID is present, False if otherwise</returns>
+bool PostingList::contains(uint32_t id) const {
+	uint16_t high = (uint16_t)(id >> 16), low = (uint16_t)id;
+	size_t position = lowerBound(high);
+	if (position == _containers.size() || _containers[position].high != high)
+		return false;
+	const Container& container = _containers[position];
+	if (container.isBitmap())
+		return (container.bitmap[low >> 6] >> (low & 63)) & 1;
+	return std::binary_search(container.array.begin(), container.array.end(), low);
+}
+
+/// <summary>
+/// Function to get the Number of Document IDs.
+/// </summary>
+/// <returns>Number of Document IDs</returns>
+size_t PostingList::cardinality() const {
+	return _cardinality;
+}
+
+/// <summary>
+/// Function to Check whether the PostingList has no Document IDs.
+/// </summary>
+/// <returns>True if there are no Document IDs, False if otherwise</returns>
+bool PostingList::empty() const {
+	return _cardinality == 0;
+}
+
+/// <summary>
+/// Function to get the Bytes used by the PostingList including it's Containers.
+/// </summary>
+/// <returns>Bytes used by the PostingList</returns>
+size_t PostingList::memoryUsage() const {
+	size_t bytes = sizeof(PostingList) + _containers.capacity() * sizeof(Container);
+	for (const Container& container : _containers)
+		bytes += container.array.capacity() * sizeof(uint16_t) + container.bitmap.capacity() * sizeof(uint64_t);
+	return bytes;
+}
+
+/// <summary>
+/// Function to Append the PostingList to a Buffer in it's Container layout :
+/// [u32 Container Count] then per Container [u16 High][u16 Bitmap][u32 Cardinality]
+/// followed by the sorted low 16 bits (Array) or the 1024 Words (Bitmap).
+/// </summary>
+/// <param name="out">Buffer to Append to</param>
+void PostingList::serialize(std::string& out) const {
+	uint32_t count = (uint32_t)_containers.size();
+	out.append(reinterpret_cast<const char*>(&count), sizeof(count));
+	for (const Container& container : _containers) {
+		uint16_t header[2] = { container.high, (uint16_t)container.isBitmap() };
+		out.append(reinterpret_cast<const char*>(header), sizeof(header));
+		out.append(reinterpret_cast<const char*>(&container.cardinality), sizeof(container.cardinality));
+		if (container.isBitmap())
+			out.append(reinterpret_cast<const char*>(container.bitmap.data()), BITMAP_WORDS * sizeof(uint64_t));
+		else
+			out.append(reinterpret_cast<const char*>(container.array.data()), container.array.size() * sizeof(uint16_t));
+	}
+}
+
+/// <summary>
+/// Function to Replace the PostingList with one Written by serialize.
+/// </summary>
+/// <param name="cursor">Position to Read from, Advanced past the PostingList</param>
+/// <param name="end">End of the Readable Bytes</param>
+/// <returns>False if the Bytes are not a valid PostingList</returns>
+bool PostingList::deserialize(const char *& cursor, const char * end) {
+	_containers.clear();
+	_cardinality = 0;
+	uint32_t count;
+	if ((size_t)(end - cursor) < sizeof(count))
+		return false;
+	std::memcpy(&count, cursor, sizeof(count));
+	cursor += sizeof(count);
+	for (uint32_t index = 0; index < count; index++) {
+		uint16_t header[2];
+		Container container;
+		if ((size_t)(end - cursor) < sizeof(header) + sizeof(container.cardinality))
+			return false;
+		std::memcpy(header, cursor, sizeof(header));
+		std::memcpy(&container.cardinality, cursor + sizeof(header), sizeof(container.cardinality));
+		cursor += sizeof(header) + sizeof(container.cardinality);
+		container.high = header[0];
+		size_t bytes = header[1] ? BITMAP_WORDS * sizeof(uint64_t) : container.cardinality * sizeof(uint16_t);
+		if (container.cardinality == 0 || container.cardinality > 65536 || (size_t)(end - cursor) < bytes
+			|| (!_containers.empty() && _containers.back().high >= container.high))
+			return false;
+		if (header[1]) {
+			container.bitmap.resize(BITMAP_WORDS);
+			std::memcpy(container.bitmap.data(), cursor, bytes);
+		}
+		else {
+			container.array.resize(container.cardinality);
+			std::memcpy(container.array.data(), cursor, bytes);
+		}
+		cursor += bytes;
+		_cardinality += container.cardinality;
+		_containers.push_back(std::move(container));
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Append a Container holding Document IDs above every Container
+/// already present. Empty Containers are dropped and the Container is turned into
+/// an Array or Bitmap Container depending on it's cardinality.
+/// </summary>
+/// <param name="container">Container, it's contents are moved</param>
+void PostingList::append(Container& container) {
+	if (container.cardinality == 0)
+		return;
+	if (container.isBitmap() && container.cardinality <= ARRAY_LIMIT)
+		toArray(container);
+	else if (!container.isBitmap() && container.cardinality > ARRAY_LIMIT)
+		toBitmap(container);
+	_cardinality += container.cardinality;
+	_containers.push_back(std::move(container));
+}
+
+/// <summary>
+/// Function to Intersect two sorted Arrays of low 16 bits. With SSE2 the Arrays
+/// are compared 8 by 8 : every lane of the left block is compared against all 8
+/// rotations of the right block and whichever block ends lower is advanced.
+/// </summary>
+/// <param name="left">Sorted Array</param>
+/// <param name="leftSize">Size of left</param>
+/// <param name="right">Sorted Array</param>
+/// <param name="rightSize">Size of right</param>
+/// <param name="out">Output with room for the smaller of both Sizes</param>
+/// <returns>Number of values written to out</returns>
+size_t PostingList::intersectArrays(const uint16_t * left, size_t leftSize, const uint16_t * right, size_t rightSize, uint16_t * out) {
+	size_t i = 0, j = 0, count = 0;
+#ifdef POSTINGLIST_SSE2
+	while (i + 8 <= leftSize && j + 8 <= rightSize) {
+		__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + i));
+		__m128i other = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + j));
+		__m128i match = _mm_cmpeq_epi16(block, other);
+		for (int rotation = 1; rotation < 8; rotation++) {
+			other = _mm_or_si128(_mm_srli_si128(other, 2), _mm_slli_si128(other, 14));
+			match = _mm_or_si128(match, _mm_cmpeq_epi16(block, other));
+		}
+		int mask = _mm_movemask_epi8(match);
+		for (int lane = 0; mask != 0; lane++, mask >>= 2) {
+			if (mask & 1)
+				out[count++] = left[i + lane];
+		}
+		uint16_t leftLast = left[i + 7], rightLast = right[j + 7];
+		if (leftLast <= rightLast)
+			i += 8;
+		if (rightLast <= leftLast)
+			j += 8;
+	}
+#endif
+	while (i < leftSize && j < rightSize) {
+		if (left[i] < right[j]) {
+			i++;
+		} else if (right[j] < left[i]) {
+			j++;
+		} else {
+			out[count++] = left[i];
+			i++;
+			j++;
+		}
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to Intersect a small sorted Array with a much larger one by
+/// galloping through the larger Array.
+/// </summary>
+/// <param name="small">Smaller Sorted Array</param>
+/// <param name="smallSize">Size of small</param>
+/// <param name="large">Larger Sorted Array</param>
+/// <param name="largeSize">Size of large</param>
+/// <param name="out">Output with room for smallSize values</param>
+/// <returns>Number of values written to out</returns>
+size_t PostingList::gallopArrays(const uint16_t * small, size_t smallSize, const uint16_t * large, size_t largeSize, uint16_t * out) {
+	size_t count = 0, position = 0;
+	for (size_t i = 0; i < smallSize && position < largeSize; i++) {
+		size_t step = 1, bound = position;
+		while (bound < largeSize && large[bound] < small[i]) {
+			position = bound + 1;
+			bound += step;
+			step <<= 1;
+		}
+		position = std::lower_bound(large + position, large + std::min(bound + 1, largeSize), small[i]) - large;
+		if (position < largeSize && large[position] == small[i])
+			out[count++] = small[i];
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to AND two Bitmaps.
+/// </summary>
+/// <param name="left">Bitmap of BITMAP_WORDS Words</param>
+/// <param name="right">Bitmap of BITMAP_WORDS Words</param>
+/// <param name="out">Output Bitmap of BITMAP_WORDS Words</param>
+/// <returns>Number of Set Bits in out</returns>
+uint32_t PostingList::andBitmaps(const uint64_t * left, const uint64_t * right, uint64_t * out) {
+	uint32_t count = 0;
+	for (uint32_t index = 0; index < BITMAP_WORDS; index += 2) {
+#ifdef POSTINGLIST_SSE2
+		__m128i words = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + index)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + index)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), words);
+#else
+		out[index] = left[index] & right[index];
+		out[index + 1] = left[index + 1] & right[index + 1];
+#endif
+		count += bitCount(out[index]) + bitCount(out[index + 1]);
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to OR two Bitmaps.
+/// </summary>
+/// <param name="left">Bitmap of BITMAP_WORDS Words</param>
+/// <param name="right">Bitmap of BITMAP_WORDS Words</param>
+/// <param name="out">Output Bitmap of BITMAP_WORDS Words</param>
+/// <returns>Number of Set Bits in out</returns>
+uint32_t PostingList::orBitmaps(const uint64_t * left, const uint64_t * right, uint64_t * out) {
+	uint32_t count = 0;
+	for (uint32_t index = 0; index < BITMAP_WORDS; index += 2) {
+#ifdef POSTINGLIST_SSE2
+		__m128i words = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + index)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + index)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), words);
+#else
+		out[index] = left[index] | right[index];
+		out[index + 1] = left[index + 1] | right[index + 1];
+#endif
+		count += bitCount(out[index]) + bitCount(out[index + 1]);
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to AND a Bitmap with the complement of another.
+/// </summary>
+/// <param name="left">Bitmap of BITMAP_WORDS Words</param>
+/// <param name="right">Bitmap of BITMAP_WORDS Words whose Bits are cleared from left</param>
+/// <param name="out">Output Bitmap of BITMAP_WORDS Words</param>
+/// <returns>Number of Set Bits in out</returns>
+uint32_t PostingList::andNotBitmaps(const uint64_t * left, const uint64_t * right, uint64_t * out) {
+	uint32_t count = 0;
+	for (uint32_t index = 0; index < BITMAP_WORDS; index += 2) {
+#ifdef POSTINGLIST_SSE2
+		__m128i words = _mm_andnot_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + index)),
+			_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + index)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + index), words);
+#else
+		out[index] = left[index] & ~right[index];
+		out[index + 1] = left[index + 1] & ~right[index + 1];
+#endif
+		count += bitCount(out[index]) + bitCount(out[index + 1]);
+	}
+	return count;
+}
+
+/// <summary>
+/// Function to Intersect two Containers with the same high 16 bits.
+/// </summary>
+/// <param name="left">Container</param>
+/// <param name="right">Container</param>
+/// <param name="out">Empty Container receiving the Intersection</param>
+void PostingList::intersectContainers(const Container& left, const Container& right, Container& out) {
+	if (left.isBitmap() && right.isBitmap()) {
+		out.bitmap.resize(BITMAP_WORDS);
+		out.cardinality = andBitmaps(left.bitmap.data(), right.bitmap.data(), out.bitmap.data());
+		return;
+	}
+	if (left.isBitmap() || right.isBitmap()) {
+		const Container& array = left.isBitmap() ? right : left;
+		const Container& bitmap = left.isBitmap() ? left : right;
+		for (uint16_t low : array.array) {
+			if ((bitmap.bitmap[low >> 6] >> (low & 63)) & 1)
+				out.array.push_back(low);
+		}
+		out.cardinality = (uint32_t)out.array.size();
+		return;
+	}
+	const Container& small = left.cardinality <= right.cardinality ? left : right;
+	const Container& large = left.cardinality <= right.cardinality ? right : left;
+	out.array.resize(small.cardinality);
+	size_t count = small.cardinality * 64 < large.cardinality
+		? gallopArrays(small.array.data(), small.cardinality, large.array.data(), large.cardinality, out.array.data())
+		: intersectArrays(small.array.data(), small.cardinality, large.array.data(), large.cardinality, out.array.data());
+	out.array.resize(count);
+	out.cardinality = (uint32_t)count;
+}
+
+/// <summary>
+/// Function to Unite two Containers with the same high 16 bits.
+/// </summary>
+/// <param name="left">Container</param>
+/// <param name="right">Container</param>
+/// <param name="out">Empty Container receiving the Union</param>
+void PostingList::uniteContainers(const Container& left, const Container& right, Container& out) {
+	if (left.isBitmap() && right.isBitmap()) {
+		out.bitmap.resize(BITMAP_WORDS);
+		out.cardinality = orBitmaps(left.bitmap.data(), right.bitmap.data(), out.bitmap.data());
+		return;
+	}
+	if (left.isBitmap() || right.isBitmap() || left.cardinality + right.cardinality > ARRAY_LIMIT) {
+		const Container& array = left.isBitmap() ? right : left;
+		const Container& other = left.isBitmap() ? left : right;
+		if (other.isBitmap()) {
+			out.bitmap = other.bitmap;
+		} else {
+			out.bitmap.assign(BITMAP_WORDS, 0);
+			for (uint16_t low : other.array)
+				out.bitmap[low >> 6] |= 1ULL << (low & 63);
+		}
+		out.cardinality = other.cardinality;
+		for (uint16_t low : array.array) {
+			uint64_t& word = out.bitmap[low >> 6];
+			uint64_t bit = 1ULL << (low & 63);
+			if (!(word & bit)) {
+				word |= bit;
+				out.cardinality++;
+			}
+		}
+		return;
+	}
+	out.array.resize(left.cardinality + right.cardinality);
+	auto last = std::set_union(left.array.begin(), left.array.end(), right.array.begin(), right.array.end(), out.array.begin());
+	out.array.resize(last - out.array.begin());
+	out.cardinality = (uint32_t)out.array.size();
+}
+
+/// <summary>
+/// Function to Subtract a Container from another with the same high 16 bits.
+/// </summary>
+/// <param name="left">Container</param>
+/// <param name="right">Container whose Document IDs are removed from left</param>
+/// <param name="out">Empty Container receiving the Difference</param>
+void PostingList::subtractContainers(const Container& left, const Container& right, Container& out) {
+	if (left.isBitmap() && right.isBitmap()) {
+		out.bitmap.resize(BITMAP_WORDS);
+		out.cardinality = andNotBitmaps(left.bitmap.data(), right.bitmap.data(), out.bitmap.data());
+		return;
+	}
+	if (left.isBitmap()) {
+		out.bitmap = left.bitmap;
+		out.cardinality = left.cardinality;
+		for (uint16_t low : right.array) {
+			uint64_t& word = out.bitmap[low >> 6];
+			uint64_t bit = 1ULL << (low & 63);
+			if (word & bit) {
+				word &= ~bit;
+				out.cardinality--;
+			}
+		}
+		return;
+	}
+	if (right.isBitmap()) {
+		for (uint16_t low : left.array) {
+			if (!((right.bitmap[low >> 6] >> (low & 63)) & 1))
+				out.array.push_back(low);
+		}
+	} else {
+		out.array.resize(left.cardinality);
+		auto last = std::set_difference(left.array.begin(), left.array.end(), right.array.begin(), right.array.end(), out.array.begin());
+		out.array.resize(last - out.array.begin());
+	}
+	out.cardinality = (uint32_t)out.array.size();
+}
+
+/// <summary>
+/// Function to get the Document IDs present in both PostingLists. Containers are
+/// only Intersected when both PostingLists have Document IDs in the same Chunk.
+/// </summary>
+/// <param name="left">PostingList</param>
+/// <param name="right">PostingList</param>
+/// <returns>Intersection of both PostingLists</returns>
+PostingList PostingList::intersect(const PostingList& left, const PostingList& right) {
+	PostingList result;
+	size_t i = 0, j = 0;
+	while (i < left._containers.size() && j < right._containers.size()) {
+		const Container& leftContainer = left._containers[i];
+		const Container& rightContainer = right._containers[j];
+		if (leftContainer.high < rightContainer.high) {
+			i++;
+		} else if (rightContainer.high < leftContainer.high) {
+			j++;
+		} else {
+			Container container;
+			container.high = leftContainer.high;
+			intersectContainers(leftContainer, rightContainer, container);
+			result.append(container);
+			i++;
+			j++;
+		}
+	}
+	return result;
+}
+
+/// <summary>
+/// Function to get the Document IDs present in either PostingList.
+/// </summary>
+/// <param name="left">PostingList</param>
+/// <param name="right">PostingList</param>
+/// <returns>Union of both PostingLists</returns>
+PostingList PostingList::unite(const PostingList& left, const PostingList& right) {
+	PostingList result;
+	size_t i = 0, j = 0;
+	while (i < left._containers.size() || j < right._containers.size()) {
+		if (j == right._containers.size() || (i < left._containers.size() && left._containers[i].high < right._containers[j].high)) {
+			Container container = left._containers[i++];
+			result.append(container);
+		} else if (i == left._containers.size() || right._containers[j].high < left._containers[i].high) {
+			Container container = right._containers[j++];
+			result.append(container);
+		} else {
+			Container container;
+			container.high = left._containers[i].high;
+			uniteContainers(left._containers[i], right._containers[j], container);
+			result.append(container);
+			i++;
+			j++;
+		}
+	}
+	return result;
+}
+
+/// <summary>
+/// Function to get the Document IDs present in left but not in right.
+/// </summary>
+/// <param name="left">PostingList</param>
+/// <param name="right">PostingList whose Document IDs are removed</param>
+/// <returns>Difference of both PostingLists</returns>
+PostingList PostingList::subtract(const PostingList& left, const PostingList& right) {
+	PostingList result;
+	size_t j = 0;
+	for (const Container& leftContainer : left._containers) {
+		while (j < right._containers.size() && right._containers[j].high < leftContainer.high)
+			j++;
+		Container container;
+		if (j == right._containers.size() || right._containers[j].high != leftContainer.high) {
+			container = leftContainer;
+		} else {
+			container.high = leftContainer.high;
+			subtractContainers(leftContainer, right._containers[j], container);
+		}
+		result.append(container);
+	}
+	return result;
+}
+
+#ifdef TEST_POSTINGLIST
+
+#include <set>
+#include <random>
+#include <iterator>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test PostingList Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+
+	StringHelper::Title("TESTING POSTINGLIST PACKAGE", '=');
+	StringHelper::Title("Test add, remove and contains Methods");
+	PostingList list;
+	list.add(7);
+	list.add(70000);
+	list.add(7);
+	std::cout << "\n > Cardinality after adding 7, 70000, 7 : " << list.cardinality();
+	std::cout << "\n > Contains 70000 : " << list.contains(70000) << ", Contains 8 : " << list.contains(8);
+	std::cout << "\n > Removed 7 : " << list.remove(7) << ", Removed 7 again : " << list.remove(7);
+	std::cout << "\n > Cardinality : " << list.cardinality() << std::endl;
+	putline();
+
+	StringHelper::Title("Test against std::set with Array and Bitmap Containers");
+	list.remove(70000);
+	std::set<uint32_t> expected;
+	std::mt19937 random(11);
+	for (int index = 0; index < 200000; index++) {
+		/* Dense low range turns into Bitmaps, sparse high range stays in Arrays */
+		uint32_t id = index % 3 == 0 ? random() : random() % 200000;
+		if (random() % 4 == 0) {
+			if (list.remove(id) != (expected.erase(id) == 1))
+				std::cout << "\n > Remove mismatch for " << id;
+		} else {
+			if (list.add(id) != expected.insert(id).second)
+				std::cout << "\n > Add mismatch for " << id;
+		}
+	}
+	std::vector<uint32_t> walked;
+	list.forEach([&walked](uint32_t id) { walked.push_back(id); });
+	std::cout << "\n > Cardinality : " << list.cardinality() << ", Expected : " << expected.size();
+	std::cout << "\n > forEach matches in order : " << std::equal(walked.begin(), walked.end(), expected.begin(), expected.end());
+	std::cout << "\n > Bytes Used : " << list.memoryUsage() << std::endl;
+	putline();
+
+	StringHelper::Title("Test Bitmap shrinks back to Array");
+	PostingList dense;
+	for (uint32_t id = 0; id < 10000; id++)
+		dense.add(id);
+	for (uint32_t id = 0; id < 9000; id++)
+		dense.remove(id);
+	std::cout << "\n > Cardinality after removing 9000 of 10000 IDs : " << dense.cardinality();
+	std::cout << "\n > Contains 9500 : " << dense.contains(9500) << ", Contains 500 : " << dense.contains(500);
+	std::cout << "\n > First ID : ";
+	bool first = true;
+	dense.forEach([&first](uint32_t id) { if (first) std::cout << id; first = false; });
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test intersect, unite and subtract against std::set");
+	/* Chunk 0 is dense in both (Bitmap with Bitmap), Chunk 1 dense in one (Bitmap with Array),
+	   Chunk 2 sparse in both (Array with Array) and Chunk 3 only present in one */
+	PostingList left, right;
+	std::set<uint32_t> leftSet, rightSet;
+	for (int index = 0; index < 60000; index++) {
+		uint32_t id = random() % 65536;
+		left.add(id), leftSet.insert(id);
+		id = random() % 65536;
+		right.add(id), rightSet.insert(id);
+		id = 65536 + random() % 65536;
+		left.add(id), leftSet.insert(id);
+		if (index % 20 == 0) {
+			id = 65536 + random() % 65536;
+			right.add(id), rightSet.insert(id);
+			id = 131072 + random() % 4096;
+			left.add(id), leftSet.insert(id);
+			id = 131072 + random() % 4096;
+			right.add(id), rightSet.insert(id);
+			id = 196608 + random() % 65536;
+			left.add(id), leftSet.insert(id);
+		}
+	}
+	auto matches = [](const PostingList& list, const std::set<uint32_t>& expected) {
+		std::vector<uint32_t> walked;
+		list.forEach([&walked](uint32_t id) { walked.push_back(id); });
+		return list.cardinality() == expected.size() && std::equal(walked.begin(), walked.end(), expected.begin(), expected.end());
+	};
+	std::set<uint32_t> both, either, only;
+	std::set_intersection(leftSet.begin(), leftSet.end(), rightSet.begin(), rightSet.end(), std::inserter(both, both.end()));
+	std::set_union(leftSet.begin(), leftSet.end(), rightSet.begin(), rightSet.end(), std::inserter(either, either.end()));
+	std::set_difference(leftSet.begin(), leftSet.end(), rightSet.begin(), rightSet.end(), std::inserter(only, only.end()));
+	std::cout << "\n > intersect matches : " << matches(PostingList::intersect(left, right), both) << " (" << both.size() << " IDs)";
+	std::cout << "\n > unite matches : " << matches(PostingList::unite(left, right), either) << " (" << either.size() << " IDs)";
+	std::cout << "\n > subtract matches : " << matches(PostingList::subtract(left, right), only) << " (" << only.size() << " IDs)";
+	PostingList sparse;
+	for (uint32_t id = 0; id < 65536; id += 4096)
+		sparse.add(id);
+	std::set<uint32_t> sparseSet, galloped;
+	sparse.forEach([&sparseSet](uint32_t id) { sparseSet.insert(id); });
+	std::set_intersection(sparseSet.begin(), sparseSet.end(), leftSet.begin(), leftSet.end(), std::inserter(galloped, galloped.end()));
+	std::cout << "\n > intersect of 16 IDs with a large List matches : " << matches(PostingList::intersect(sparse, left), galloped) << std::endl;
+	putline();
+
+	StringHelper::Title("Test serialize and deserialize");
+	std::string buffer;
+	left.serialize(buffer);
+	PostingList restored;
+	const char * cursor = buffer.data();
+	bool valid = restored.deserialize(cursor, buffer.data() + buffer.size());
+	std::cout << "\n > Serialized " << left.cardinality() << " IDs into " << buffer.size() << " bytes";
+	std::cout << "\n > Deserialized : " << valid << ", matches : " << matches(restored, leftSet);
+	cursor = buffer.data();
+	std::cout << "\n > Truncated Buffer rejected : " << !restored.deserialize(cursor, buffer.data() + buffer.size() / 2) << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_POSTINGLIST
+
+#ifdef BENCH_POSTINGLIST
+
+#include <atomic>
+#include <iterator>
+#include <chrono>
+#include <random>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_set>
+#include <unordered_map>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/* Bytes currently allocated through operator new */
+static std::atomic<long long> allocatedBytes(0);
+
+/// <summary>
+/// Global operator new which keeps count of the allocated Bytes.
+/// </summary>
+void * operator new(size_t size) {
+	size_t * block = static_cast<size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+	if (block == nullptr)
+		throw std::bad_alloc();
+	*block = size;
+	allocatedBytes += size;
+	return reinterpret_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+/// <summary>
+/// Global operator delete matching the counting operator new.
+/// </summary>
+void operator delete(void * pointer) noexcept {
+	if (pointer == nullptr)
+		return;
+	size_t * block = reinterpret_cast<size_t*>(static_cast<char*>(pointer) - sizeof(std::max_align_t));
+	allocatedBytes -= *block;
+	std::free(block);
+}
+
+/// <summary>
+/// Global sized operator delete matching the counting operator new.
+/// </summary>
+void operator delete(void * pointer, size_t) noexcept {
+	operator delete(pointer);
+}
+
+/// <summary>
+/// Function to get Milliseconds elapsed since a Start Time.
+/// </summary>
+/// <param name="start">Start Time</param>
+/// <returns>Milliseconds elapsed</returns>
+double elapsed(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// <summary>
+/// Function to Benchmark the Tag Index layouts with Keys x Tags. Tag t is carried
+/// by roughly 1 / (t + 2) of the Keys, so there are a few very popular Tags and a
+/// long tail of rare ones. Then Benchmark Intersecting a pair of Tags against
+/// probing an unordered_set and std::set_intersection of sorted vectors.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [keys] [tags] (default 1000000 50)</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	uint32_t keyCount = argc > 1 ? (uint32_t)std::stoul(argv[1]) : 1000000;
+	uint32_t tagCount = argc > 2 ? (uint32_t)std::stoul(argv[2]) : 50;
+
+	StringHelper::Title("BENCHMARKING POSTINGLIST", '=');
+	std::cout << "\n Keys : " << keyCount << ", Tags : " << tagCount << "\n";
+	std::vector<std::string> keys;
+	std::vector<std::vector<uint32_t>> postings(tagCount);
+	std::mt19937 random(3);
+	for (uint32_t id = 0; id < keyCount; id++) {
+		keys.push_back("key" + std::to_string(id));
+		for (uint32_t tag = 0; tag < tagCount; tag++) {
+			if (random() % (tag + 2) == 0)
+				postings[tag].push_back(id);
+		}
+	}
+	size_t total = 0;
+	for (std::vector<uint32_t>& posting : postings)
+		total += posting.size();
+	std::cout << " Postings : " << total << "\n";
+
+	/* Previous Layout : Tag -> Set of Key Strings */
+	long long before = allocatedBytes;
+	auto start = std::chrono::steady_clock::now();
+	std::unordered_map<uint32_t, std::unordered_set<std::string>> * keySets = new std::unordered_map<uint32_t, std::unordered_set<std::string>>();
+	for (uint32_t tag = 0; tag < tagCount; tag++) {
+		for (uint32_t id : postings[tag])
+			(*keySets)[tag].insert(keys[id]);
+	}
+	double buildTime = elapsed(start);
+	long long bytes = allocatedBytes - before;
+	size_t checksum = 0;
+	start = std::chrono::steady_clock::now();
+	for (uint32_t tag = 0; tag < tagCount; tag++) {
+		for (const std::string& key : (*keySets)[tag])
+			checksum += key.size();
+	}
+	double scanTime = elapsed(start);
+	std::cout << "\n unordered_set<string>\t Build : " << buildTime << " ms\t Scan : " << scanTime * 1e6 / total
+		<< " ns/posting\t Bytes/Posting : " << (double)bytes / total;
+	delete keySets;
+
+	/* New Layout : Tag -> PostingList of Document IDs resolved through a Key Table */
+	before = allocatedBytes;
+	start = std::chrono::steady_clock::now();
+	std::unordered_map<uint32_t, PostingList> * lists = new std::unordered_map<uint32_t, PostingList>();
+	for (uint32_t tag = 0; tag < tagCount; tag++) {
+		for (uint32_t id : postings[tag])
+			(*lists)[tag].add(id);
+	}
+	buildTime = elapsed(start);
+	bytes = allocatedBytes - before;
+	size_t listChecksum = 0;
+	start = std::chrono::steady_clock::now();
+	for (uint32_t tag = 0; tag < tagCount; tag++)
+		(*lists)[tag].forEach([&](uint32_t id) { listChecksum += keys[id].size(); });
+	scanTime = elapsed(start);
+	std::cout << "\n PostingList\t\t Build : " << buildTime << " ms\t Scan : " << scanTime * 1e6 / total
+		<< " ns/posting\t Bytes/Posting : " << (double)bytes / total
+		<< (checksum != listChecksum ? "\t (scan mismatch)" : "");
+	std::cout << "\n (PostingList resolves Document IDs through a Key Table of " << keyCount * sizeof(std::string)
+		<< " bytes shared by all Tags)";
+
+	/* Intersections of a Tag pair : Dense with Dense, Dense with Sparse and Sparse with Sparse */
+	StringHelper::Title("Intersection");
+	uint32_t pairs[3][2] = { { 0, 1 }, { 0, tagCount - 1 }, { tagCount - 2, tagCount - 1 } };
+	for (auto& pair : pairs) {
+		std::unordered_set<uint32_t> leftSet(postings[pair[0]].begin(), postings[pair[0]].end());
+		std::unordered_set<uint32_t> rightSet(postings[pair[1]].begin(), postings[pair[1]].end());
+		const std::unordered_set<uint32_t>& smaller = leftSet.size() <= rightSet.size() ? leftSet : rightSet;
+		const std::unordered_set<uint32_t>& larger = leftSet.size() <= rightSet.size() ? rightSet : leftSet;
+		int rounds = 20;
+		size_t naiveCount = 0, sortedCount = 0, listCount = 0;
+		start = std::chrono::steady_clock::now();
+		for (int round = 0; round < rounds; round++) {
+			std::vector<uint32_t> result;
+			for (uint32_t id : smaller) {
+				if (larger.count(id))
+					result.push_back(id);
+			}
+			naiveCount = result.size();
+		}
+		double naiveTime = elapsed(start) / rounds;
+		start = std::chrono::steady_clock::now();
+		for (int round = 0; round < rounds; round++) {
+			std::vector<uint32_t> result;
+			std::set_intersection(postings[pair[0]].begin(), postings[pair[0]].end(), postings[pair[1]].begin(), postings[pair[1]].end(), std::back_inserter(result));
+			sortedCount = result.size();
+		}
+		double sortedTime = elapsed(start) / rounds;
+		start = std::chrono::steady_clock::now();
+		for (int round = 0; round < rounds; round++)
+			listCount = PostingList::intersect((*lists)[pair[0]], (*lists)[pair[1]]).cardinality();
+		double listTime = elapsed(start) / rounds;
+		std::cout << "\n Tags " << pair[0] << " (" << postings[pair[0]].size() << ") & " << pair[1] << " (" << postings[pair[1]].size() << ") -> " << listCount
+			<< "\n   unordered_set probe : " << naiveTime << " ms\t std::set_intersection : " << sortedTime
+			<< " ms\t PostingList::intersect : " << listTime << " ms"
+			<< (naiveCount != listCount || sortedCount != listCount ? "\t (mismatch)" : "");
+	}
+	delete lists;
+
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_POSTINGLIST
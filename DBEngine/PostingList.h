@@ -0,0 +1,213 @@
+//////////////////////////////////////////////////////////////////
+// PostingList.h    - Compressed Set of Document IDs used by    //
+//                    the DBEngine Tag Index.                   //
+// Version          - 1.2                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides PostingList class which holds the Document IDs of every
+ * DBElement carrying a Tag. It is laid out like a Roaring Bitmap: Document IDs are
+ * split into Chunks of 65536 by their high 16 bits, and each Chunk is stored in a
+ * Container which is either a sorted array of the low 16 bits (while the Chunk has
+ * at most 4096 Document IDs) or a 65536 bit Bitmap (once it has more). Sparse Tags
+ * therefore cost 2 bytes per DBElement and dense Tags at most 1 bit per Document ID,
+ * and iterating a PostingList walks Document IDs in ascending order through
+ * contiguous memory.
+ *
+ * PostingLists can be Intersected, United and Subtracted Container by Container.
+ * Array Containers are Intersected using SSE2 block comparisons (8 Document IDs
+ * against 8 at a time) or galloping when one side is much smaller, and Bitmap
+ * Containers are combined 128 bits at a time. This is what DBEngine uses to
+ * evaluate Boolean Tag Expressions without materializing Key Strings.
+ *
+ * PostingList is not Thread Safe, DBEngine guards it with the Shard's Lock.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool add(uint32_t id)
+ * Method to Add a Document ID. Returns False if it was already present.
+ *
+ * - bool remove(uint32_t id)
+ * Method to Remove a Document ID. Returns False if it was not present.
+ *
+ * - bool contains(uint32_t id) const
+ * Method to Check whether a Document ID is present.
+ *
+ * - size_t cardinality() const
+ * Method to get the Number of Document IDs.
+ *
+ * - bool empty() const
+ * Method to Check whether the PostingList has no Document IDs.
+ *
+ * - size_t memoryUsage() const
+ * Method to get the Bytes used by the PostingList.
+ *
+ * - void forEach(Function function) const
+ * Method to call function(id) for every Document ID in ascending order.
+ *
+ * - static PostingList intersect(const PostingList& left, const PostingList& right)
+ * Method to get the Document IDs present in both PostingLists.
+ *
+ * - static PostingList unite(const PostingList& left, const PostingList& right)
+ * Method to get the Document IDs present in either PostingList.
+ *
+ * - static PostingList subtract(const PostingList& left, const PostingList& right)
+ * Method to get the Document IDs present in left but not in right.
+ *
+ * - void serialize(std::string& out) const
+ * Method to Append the PostingList in it's Container layout to a Buffer.
+ *
+ * - bool deserialize(const char *& cursor, const char * end)
+ * Method to Replace the PostingList with one Written by serialize.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added intersect, unite and subtract with SSE2 Array and Bitmap kernels.
+ *
+ * ver 1.2 : 10/17/2026
+ * - Added serialize and deserialize used by DBEngine Snapshots.
+ *
+ */
+#ifndef POSTINGLIST_H
+#define POSTINGLIST_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/// <summary>
+/// Roaring style Set of 32-bit Document IDs.
+/// </summary>
+class PostingList {
+public:
+	static const uint32_t ARRAY_LIMIT = 4096;		// Largest Number of Document IDs kept in an Array Container
+	static const uint32_t BITMAP_WORDS = 1024;		// Number of 64-bit Words in a Bitmap Container
+
+	/// <summary>
+	/// Document IDs sharing the same high 16 bits. Exactly one of array and
+	/// bitmap is in use.
+	/// </summary>
+	struct Container {
+		uint16_t high;								// High 16 bits shared by the Document IDs
+		uint32_t cardinality;						// Number of Document IDs in the Container
+		std::vector<uint16_t> array;				// Sorted low 16 bits (Array Container)
+		std::vector<uint64_t> bitmap;				// Bit per low 16 bits (Bitmap Container)
+
+		bool isBitmap() const { return !bitmap.empty(); }
+	};
+private:
+	std::vector<Container> _containers;				// Containers sorted by high 16 bits
+	size_t _cardinality;							// Number of Document IDs
+
+	size_t lowerBound(uint16_t high) const;
+	void append(Container& container);
+	static void toBitmap(Container& container);
+	static void toArray(Container& container);
+	static uint32_t lowestBit(uint64_t word);
+	static uint32_t bitCount(uint64_t word);
+	static size_t intersectArrays(const uint16_t * left, size_t leftSize, const uint16_t * right, size_t rightSize, uint16_t * out);
+	static size_t gallopArrays(const uint16_t * small, size_t smallSize, const uint16_t * large, size_t largeSize, uint16_t * out);
+	static uint32_t andBitmaps(const uint64_t * left, const uint64_t * right, uint64_t * out);
+	static uint32_t orBitmaps(const uint64_t * left, const uint64_t * right, uint64_t * out);
+	static uint32_t andNotBitmaps(const uint64_t * left, const uint64_t * right, uint64_t * out);
+	static void intersectContainers(const Container& left, const Container& right, Container& out);
+	static void uniteContainers(const Container& left, const Container& right, Container& out);
+	static void subtractContainers(const Container& left, const Container& right, Container& out);
+public:
+	/* Constructor */
+	PostingList();
+
+	/* Member Functions */
+	bool add(uint32_t id);
+	bool remove(uint32_t id);
+	bool contains(uint32_t id) const;
+	size_t cardinality() const;
+	bool empty() const;
+	size_t memoryUsage() const;
+	template <typename Function> void forEach(Function function) const;
+	static PostingList intersect(const PostingList& left, const PostingList& right);
+	static PostingList unite(const PostingList& left, const PostingList& right);
+	static PostingList subtract(const PostingList& left, const PostingList& right);
+	void serialize(std::string& out) const;
+	bool deserialize(const char *& cursor, const char * end);
+};
+
+/// <summary>
+/// Function to get the Index of the Lowest Set Bit of a 64-bit Word.
+/// </summary>
+/// <param name="word">Non Zero Word</param>
+/// <returns>Index of the Lowest Set Bit</returns>
+inline uint32_t PostingList::lowestBit(uint64_t word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)word))
+		return index;
+	_BitScanForward(&index, (unsigned long)(word >> 32));
+	return index + 32;
+#else
+	return (uint32_t)__builtin_ctzll(word);
+#endif
+}
+
+/// <summary>
+/// Function to get the Number of Set Bits of a 64-bit Word.
+/// </summary>
+/// <param name="word">Word</param>
+/// <returns>Number of Set Bits</returns>
+inline uint32_t PostingList::bitCount(uint64_t word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+	return (uint32_t)__popcnt64(word);
+#elif defined(_MSC_VER)
+	return __popcnt((unsigned int)word) + __popcnt((unsigned int)(word >> 32));
+#else
+	return (uint32_t)__builtin_popcountll(word);
+#endif
+}
+
+/// <summary>
+/// Function to call function(id) for every Document ID in ascending order.
+/// </summary>
+/// <param name="function">Function accepting (uint32_t)</param>
+template <typename Function>
+void PostingList::forEach(Function function) const {
+	for (const Container& container : _containers) {
+		uint32_t base = (uint32_t)container.high << 16;
+		if (!container.isBitmap()) {
+			for (uint16_t low : container.array)
+				function(base | low);
+			continue;
+		}
+		for (uint32_t index = 0; index < BITMAP_WORDS; index++) {
+			for (uint64_t word = container.bitmap[index]; word != 0; word &= word - 1)
+				function(base | (index << 6) | lowestBit(word));
+		}
+	}
+}
+
+#endif // !POSTINGLIST_H
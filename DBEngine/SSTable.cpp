@@ -0,0 +1,776 @@
+//////////////////////////////////////////////////////////////////
+// SSTable.cpp      - Immutable Sorted Run of DBEngine          //
+//                    Keys with Block Index and Bloom Filter.   //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "SSTable.h"
+#include "Snapshot.h"
+#include "WriteAheadLog.h"
+
+#include <cstring>
+#include <algorithm>
+
+/* Magic Bytes at the start and in the Footer of every SSTable File */
+static const char SSTABLE_MAGIC[8] = { 'N', 'O', 'S', 'Q', 'L', 'S', 'S', 'T' };
+
+/* Bytes collected by a Writer before they are Written to the File */
+static const size_t WRITE_BUFFER = 1 << 20;
+
+/// <summary>
+/// Function to get the Step between the Bloom Filter Bits of a Key. The Bits are
+/// derived from one Hash by Double Hashing.
+/// </summary>
+/// <param name="hash">Hash of the Key</param>
+/// <returns>Step added to the Hash for every further Probe</returns>
+static uint64_t bloomDelta(uint64_t hash) {
+	return (hash >> 21) | (hash << 43);
+}
+
+/// <summary>
+/// Function to Read a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint32_t SSTable::getU32(const char * bytes) {
+	const unsigned char * value = reinterpret_cast<const unsigned char*>(bytes);
+	return value[0] | (value[1] << 8) | (value[2] << 16) | ((uint32_t)value[3] << 24);
+}
+
+/// <summary>
+/// Function to Read a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint64_t SSTable::getU64(const char * bytes) {
+	return getU32(bytes) | ((uint64_t)getU32(bytes + 4) << 32);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void SSTable::putU32(std::string& out, uint32_t value) {
+	char bytes[4] = { (char)value, (char)(value >> 8), (char)(value >> 16), (char)(value >> 24) };
+	out.append(bytes, 4);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void SSTable::putU64(std::string& out, uint64_t value) {
+	putU32(out, (uint32_t)value);
+	putU32(out, (uint32_t)(value >> 32));
+}
+
+/// <summary>
+/// Function to get one of the Tag IDs of an Entry.
+/// </summary>
+/// <param name="index">Position of the Tag ID, less than tagCount</param>
+/// <returns>Tag ID</returns>
+uint32_t SSTable::Entry::tagId(uint32_t index) const {
+	return SSTable::getU32(tags + 4 * (size_t)index);
+}
+
+/// <summary>
+/// Default Constructor. No SSTable is open.
+/// </summary>
+SSTable::SSTable() : _bloom(nullptr), _bloomBits(0), _probes(0), _entries(0) {}
+
+/// <summary>
+/// Function to Map an SSTable File and Check it's Footer, Block Index and Bloom
+/// Filter. Key Blocks and Values are Checked when they are Read.
+/// </summary>
+/// <param name="path">Path of the SSTable File</param>
+/// <returns>True if the SSTable is open, False if it does not Exist, is Corrupted or has a different Version</returns>
+bool SSTable::open(const std::string& path) {
+	close();
+	if (!_file.map(path) || _file.size() < HEADER_SIZE + FOOTER_SIZE) {
+		close();
+		return false;
+	}
+	const char * data = _file.data();
+	const char * footer = data + _file.size() - FOOTER_SIZE;
+	if (std::memcmp(data, SSTABLE_MAGIC, 8) != 0 || getU32(data + 8) != VERSION ||
+		std::memcmp(footer, SSTABLE_MAGIC, 8) != 0 || getU32(footer + 8) != VERSION ||
+		WriteAheadLog::crc32c(footer, FOOTER_SIZE - 4) != getU32(footer + 68)) {
+		close();
+		return false;
+	}
+	uint32_t blocks = getU32(footer + 12);
+	uint64_t index = getU64(footer + 16);
+	uint64_t indexSize = getU64(footer + 24);
+	uint64_t bloom = getU64(footer + 32);
+	uint64_t bloomSize = getU64(footer + 40);
+	uint64_t limit = _file.size() - FOOTER_SIZE;
+	if (blocks == 0 || index < HEADER_SIZE || index > limit || indexSize > limit - index ||
+		bloom < HEADER_SIZE || bloom > limit || bloomSize > limit - bloom || bloomSize <= 8 ||
+		WriteAheadLog::crc32c(data + index, (size_t)indexSize) != getU32(footer + 56) ||
+		WriteAheadLog::crc32c(data + bloom, (size_t)bloomSize) != getU32(footer + 60)) {
+		close();
+		return false;
+	}
+	const char * cursor = data + index;
+	const char * end = cursor + indexSize;
+	if (end - cursor < 4 || getU32(cursor) != blocks) {
+		close();
+		return false;
+	}
+	cursor += 4;
+	for (uint32_t position = 0; position <= blocks; position++) {
+		size_t header = position < blocks ? 20 : 4;
+		if ((size_t)(end - cursor) < header || (uint64_t)(end - cursor - header) < getU32(cursor + header - 4)) {
+			close();
+			return false;
+		}
+		std::string_view key(cursor + header, getU32(cursor + header - 4));
+		if (position == blocks) {
+			_largest = key;
+			cursor += header + key.size();
+			break;
+		}
+		Block block;
+		block.offset = getU64(cursor);
+		block.size = getU32(cursor + 8);
+		block.crc = getU32(cursor + 12);
+		block.first = key;
+		if (block.offset < HEADER_SIZE || block.offset > index || block.size > index - block.offset) {
+			close();
+			return false;
+		}
+		_blocks.push_back(block);
+		cursor += header + key.size();
+	}
+	if (cursor != end) {
+		close();
+		return false;
+	}
+	_probes = getU32(data + bloom);
+	_bloom = data + bloom + 8;
+	_bloomBits = (bloomSize - 8) * 8;
+	_entries = getU64(footer + 48);
+	return true;
+}
+
+/// <summary>
+/// Function to Unmap the SSTable File. Views returned by the SSTable become invalid.
+/// </summary>
+void SSTable::close() {
+	_file.unmap();
+	_blocks.clear();
+	_largest = std::string_view();
+	_bloom = nullptr;
+	_bloomBits = 0;
+	_probes = 0;
+	_entries = 0;
+}
+
+/// <summary>
+/// Function to Check whether an SSTable is open.
+/// </summary>
+/// <returns>True if an SSTable is Mapped</returns>
+bool SSTable::isOpen() const {
+	return !_blocks.empty();
+}
+
+/// <summary>
+/// Function to Ask the Bloom Filter whether the SSTable may hold a Key. A False
+/// answer is always right, a True answer is wrong for about 1% of the Keys the
+/// SSTable does not hold with 10 Bits per Key.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>False if the SSTable does not hold the Key</returns>
+bool SSTable::mayContain(std::string_view key) const {
+	uint64_t hash = Snapshot::hashKey(key);
+	uint64_t delta = bloomDelta(hash);
+	for (uint32_t probe = 0; probe < _probes; probe++, hash += delta) {
+		uint64_t bit = hash % _bloomBits;
+		if ((_bloom[bit >> 3] & (1 << (bit & 7))) == 0)
+			return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Check a Key Block against it's CRC32C.
+/// </summary>
+/// <param name="block">Position of the Key Block</param>
+/// <returns>True if the Key Block is intact</returns>
+bool SSTable::checkBlock(size_t block) const {
+	const Block& info = _blocks[block];
+	return WriteAheadLog::crc32c(_file.data() + info.offset, info.size) == info.crc;
+}
+
+/// <summary>
+/// Function to Decode the Entry at the Cursor and move the Cursor past it.
+/// </summary>
+/// <param name="cursor">Position of the Entry, moved to the next Entry</param>
+/// <param name="end">End of the Key Block</param>
+/// <param name="entry">Decoded Entry</param>
+/// <returns>True if the Entry lies within the Key Block</returns>
+bool SSTable::decode(const char *& cursor, const char * end, Entry& entry) {
+	if ((size_t)(end - cursor) < ENTRY_HEADER)
+		return false;
+	uint64_t keyLength = getU32(cursor);
+	uint64_t tagCount = getU32(cursor + 8);
+	if ((uint64_t)(end - cursor - ENTRY_HEADER) < keyLength + 4 * tagCount)
+		return false;
+	entry.document = getU32(cursor + 4);
+	entry.tagCount = (uint32_t)tagCount;
+	entry.removed = (getU32(cursor + 12) & REMOVED) != 0;
+	entry.separated = (getU32(cursor + 12) & SEPARATED) != 0;
+	entry.timestamp = (long long int)getU64(cursor + 16);
+	entry.value = getU64(cursor + 24);
+	entry.key = std::string_view(cursor + ENTRY_HEADER, (size_t)keyLength);
+	entry.tags = entry.key.data() + keyLength;
+	cursor = entry.tags + 4 * tagCount;
+	return true;
+}
+
+/// <summary>
+/// Function to Look a Key up. Binary Searches the Block Index for the only Key Block
+/// which may hold the Key, Checks it and scans it. Does not ask the Bloom Filter.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="entry">Set to the Entry of the Key if it is found, it's Views point into the Mapping</param>
+/// <returns>True if the SSTable holds the Key, False if not or the Key Block is Corrupted</returns>
+bool SSTable::find(std::string_view key, Entry& entry) const {
+	if (_blocks.empty() || key < _blocks.front().first || key > _largest)
+		return false;
+	auto next = std::upper_bound(_blocks.begin(), _blocks.end(), key,
+		[](std::string_view key, const Block& block) { return key < block.first; });
+	size_t block = (size_t)(next - _blocks.begin()) - 1;
+	if (!checkBlock(block))
+		return false;
+	const char * cursor = _file.data() + _blocks[block].offset;
+	const char * end = cursor + _blocks[block].size;
+	while (cursor < end && decode(cursor, end, entry)) {
+		if (entry.key == key)
+			return true;
+		if (entry.key > key)
+			return false;
+	}
+	return false;
+}
+
+/// <summary>
+/// Function to Check the Value of an Entry against it's CRC32C and get it's Data.
+/// </summary>
+/// <param name="entry">Entry returned by find or an Iterator, not a Tombstone</param>
+/// <param name="data">Set to the Data, it points into the Mapping</param>
+/// <returns>True if the Value is intact</returns>
+bool SSTable::value(const Entry& entry, std::string_view& data) const {
+	if (entry.removed || entry.value < HEADER_SIZE || entry.value > _file.size() || _file.size() - entry.value < 8)
+		return false;
+	const char * value = _file.data() + entry.value;
+	uint64_t length = getU32(value);
+	if (_file.size() - entry.value - 8 < length || WriteAheadLog::crc32c(value + 8, (size_t)length) != getU32(value + 4))
+		return false;
+	data = std::string_view(value + 8, (size_t)length);
+	return true;
+}
+
+/// <summary>
+/// Function to get the smallest Key of the SSTable.
+/// </summary>
+/// <returns>First Key</returns>
+std::string_view SSTable::smallest() const {
+	return _blocks.empty() ? std::string_view() : _blocks.front().first;
+}
+
+/// <summary>
+/// Function to get the largest Key of the SSTable.
+/// </summary>
+/// <returns>Last Key</returns>
+std::string_view SSTable::largest() const {
+	return _largest;
+}
+
+/// <summary>
+/// Function to get the Number of Entries, Tombstones included.
+/// </summary>
+/// <returns>Number of Entries</returns>
+uint64_t SSTable::entryCount() const {
+	return _entries;
+}
+
+/// <summary>
+/// Function to get the Size of the SSTable File.
+/// </summary>
+/// <returns>Size in Bytes</returns>
+uint64_t SSTable::fileSize() const {
+	return _file.size();
+}
+
+/// <summary>
+/// Default Constructor. The Iterator is not valid till seek is called.
+/// </summary>
+SSTable::Iterator::Iterator() : _table(nullptr), _block(0), _cursor(nullptr), _end(nullptr), _entry(), _valid(false), _failed(false) {}
+
+/// <summary>
+/// Function to Start Walking an SSTable from it's smallest Key.
+/// </summary>
+/// <param name="table">Open SSTable, must outlive the Iterator</param>
+/// <returns>True if the Iterator is at an Entry</returns>
+bool SSTable::Iterator::seek(const SSTable * table) {
+	_table = table;
+	_block = 0;
+	_valid = false;
+	_failed = false;
+	_cursor = _end = nullptr;
+	if (loadBlock())
+		next();
+	return _valid;
+}
+
+/// <summary>
+/// Function to Check the current Key Block and point the Cursor at it's first Entry.
+/// </summary>
+/// <returns>True if there is a Key Block and it is intact</returns>
+bool SSTable::Iterator::loadBlock() {
+	if (_block >= _table->_blocks.size())
+		return false;
+	if (!_table->checkBlock(_block)) {
+		_failed = true;
+		return false;
+	}
+	_cursor = _table->_file.data() + _table->_blocks[_block].offset;
+	_end = _cursor + _table->_blocks[_block].size;
+	return true;
+}
+
+/// <summary>
+/// Function to Check whether the Iterator is at an Entry.
+/// </summary>
+/// <returns>True if entry() can be called</returns>
+bool SSTable::Iterator::valid() const {
+	return _valid;
+}
+
+/// <summary>
+/// Function to Check whether the Walk stopped at a Corrupted Key Block.
+/// </summary>
+/// <returns>True if a Key Block failed it's CRC32C or could not be Decoded</returns>
+bool SSTable::Iterator::failed() const {
+	return _failed;
+}
+
+/// <summary>
+/// Function to get the current Entry.
+/// </summary>
+/// <returns>Entry, it's Views point into the Mapping</returns>
+const SSTable::Entry& SSTable::Iterator::entry() const {
+	return _entry;
+}
+
+/// <summary>
+/// Function to move to the next Entry, in the next Key Block if needed.
+/// </summary>
+void SSTable::Iterator::next() {
+	_valid = false;
+	while (_table != nullptr && !_failed) {
+		if (_cursor < _end) {
+			_valid = decode(_cursor, _end, _entry);
+			_failed = !_valid;
+			return;
+		}
+		_block++;
+		if (!loadBlock())
+			return;
+	}
+}
+
+/// <summary>
+/// Default Constructor. Nothing is being Written.
+/// </summary>
+SSTable::Writer::Writer() : _offset(0), _entries(0), _bitsPerKey(10), _failed(false) {}
+
+/// <summary>
+/// Destructor. Deletes the SSTable if it was not finished.
+/// </summary>
+SSTable::Writer::~Writer() {
+	abandon();
+}
+
+/// <summary>
+/// Function to Start Writing a new SSTable. The SSTable File itself is only
+/// Created by finish().
+/// </summary>
+/// <param name="path">Path of the SSTable File</param>
+/// <param name="bloomBitsPerKey">Bloom Filter Bits per Key, 10 gives about 1% False Positives</param>
+/// <returns>True if the Temporary File could be Created</returns>
+bool SSTable::Writer::open(const std::string& path, unsigned bloomBitsPerKey) {
+	abandon();
+	_path = path;
+	_temp = path + ".tmp";
+	_bitsPerKey = std::max(1u, bloomBitsPerKey);
+	_failed = !_file.open(_temp, File::CREATE);
+	if (_failed)
+		return false;
+	write(SSTABLE_MAGIC, 8);
+	std::string version;
+	putU32(version, VERSION);
+	putU32(version, 0);
+	write(version.data(), version.size());
+	return true;
+}
+
+/// <summary>
+/// Function to Write Bytes through the Buffer.
+/// </summary>
+/// <param name="data">Bytes</param>
+/// <param name="size">Number of Bytes</param>
+void SSTable::Writer::write(const void * data, size_t size) {
+	_buffer.append(static_cast<const char*>(data), size);
+	_offset += size;
+	if (_buffer.size() >= WRITE_BUFFER) {
+		if (!_failed && !_file.write(_buffer.data(), _buffer.size()))
+			_failed = true;
+		_buffer.clear();
+	}
+}
+
+/// <summary>
+/// Function to Write the Value of an Entry and Append the Entry to the open Key Block.
+/// </summary>
+/// <param name="key">Key, larger than every Key Added before</param>
+/// <param name="document">Document ID of the Key</param>
+/// <param name="flags">REMOVED for a Tombstone, which has no Value, SEPARATED for a Value Log Pointer</param>
+/// <param name="timestamp">Last Modified Timestamp</param>
+/// <param name="tags">Encoded Tag IDs</param>
+/// <param name="data">Data of the DBElement or Encoded Value Log Pointer</param>
+void SSTable::Writer::addEntry(std::string_view key, uint32_t document, uint32_t flags, long long int timestamp, std::string_view tags, std::string_view data) {
+	uint64_t value = 0;
+	if (!(flags & REMOVED)) {
+		std::string header;
+		putU32(header, (uint32_t)data.size());
+		putU32(header, WriteAheadLog::crc32c(data.data(), data.size()));
+		value = _offset;
+		write(header.data(), header.size());
+		write(data.data(), data.size());
+	}
+	putU32(_blocks, (uint32_t)key.size());
+	putU32(_blocks, document);
+	putU32(_blocks, (uint32_t)(tags.size() / 4));
+	putU32(_blocks, flags);
+	putU64(_blocks, (uint64_t)timestamp);
+	putU64(_blocks, value);
+	_blocks.append(key.data(), key.size());
+	_blocks.append(tags.data(), tags.size());
+	_hashes.push_back(Snapshot::hashKey(key));
+	_lastKey.assign(key.data(), key.size());
+	_entries++;
+	size_t start = _blockEnds.empty() ? 0 : _blockEnds.back();
+	if (_blocks.size() - start >= BLOCK_SIZE)
+		endBlock();
+}
+
+/// <summary>
+/// Function to Close the open Key Block, if it holds any Entry.
+/// </summary>
+void SSTable::Writer::endBlock() {
+	size_t start = _blockEnds.empty() ? 0 : _blockEnds.back();
+	if (_blocks.size() > start)
+		_blockEnds.push_back(_blocks.size());
+}
+
+/// <summary>
+/// Function to Add a Key and it's DBElement.
+/// </summary>
+/// <param name="key">Key, larger than every Key Added before</param>
+/// <param name="document">Document ID of the Key</param>
+/// <param name="element">DBElement, it's Tag IDs are Written as they are</param>
+void SSTable::Writer::add(std::string_view key, uint32_t document, const DBElement& element) {
+	std::string tags, buffer;
+	tags.reserve(4 * element.getTagCount());
+	for (size_t index = 0; index < element.getTagCount(); index++)
+		putU32(tags, element.tagIds()[index]);
+	addEntry(key, document, 0, element.getlastModified(), tags, element.getDataView(buffer));
+}
+
+/// <summary>
+/// Function to Add a Key whose Data was Appended to the Value Log. The Entry keeps
+/// the Tags and Timestamp of the DBElement and stores the Pointer as it's Value.
+/// </summary>
+/// <param name="key">Key, larger than every Key Added before</param>
+/// <param name="document">Document ID of the Key</param>
+/// <param name="element">DBElement, it's Data is not Written</param>
+/// <param name="pointer">Encoded ValueLog::Pointer to the Data</param>
+void SSTable::Writer::addSeparated(std::string_view key, uint32_t document, const DBElement& element, std::string_view pointer) {
+	std::string tags;
+	tags.reserve(4 * element.getTagCount());
+	for (size_t index = 0; index < element.getTagCount(); index++)
+		putU32(tags, element.tagIds()[index]);
+	addEntry(key, document, SEPARATED, element.getlastModified(), tags, pointer);
+}
+
+/// <summary>
+/// Function to Add a Tombstone for a Removed Key, so older SSTables are not
+/// consulted for it.
+/// </summary>
+/// <param name="key">Key, larger than every Key Added before</param>
+/// <param name="document">Document ID the Key had</param>
+void SSTable::Writer::addRemoved(std::string_view key, uint32_t document) {
+	addEntry(key, document, REMOVED, 0, std::string_view(), std::string_view());
+}
+
+/// <summary>
+/// Function to Copy an Entry Read from another SSTable, used by Compaction.
+/// </summary>
+/// <param name="entry">Entry, it's Key larger than every Key Added before</param>
+/// <param name="data">Data returned by value for the Entry, ignored for a Tombstone</param>
+void SSTable::Writer::add(const Entry& entry, std::string_view data) {
+	addEntry(entry.key, entry.document, (entry.removed ? REMOVED : 0) | (entry.separated ? SEPARATED : 0), entry.timestamp, std::string_view(entry.tags, 4 * (size_t)entry.tagCount), data);
+}
+
+/// <summary>
+/// Function to Write the Key Blocks, Block Index, Bloom Filter and Footer, fsync
+/// the SSTable and Rename it over the SSTable File.
+/// </summary>
+/// <returns>True if the SSTable File was Created, False if Writing failed or no Entry was Added</returns>
+bool SSTable::Writer::finish() {
+	endBlock();
+	if (!_file.isOpen() || _entries == 0) {
+		abandon();
+		return false;
+	}
+	uint64_t keys = _offset;
+	write(_blocks.data(), _blocks.size());
+	std::string bytes;
+	putU32(bytes, (uint32_t)_blockEnds.size());
+	size_t start = 0;
+	for (size_t end : _blockEnds) {
+		putU64(bytes, keys + start);
+		putU32(bytes, (uint32_t)(end - start));
+		putU32(bytes, WriteAheadLog::crc32c(_blocks.data() + start, end - start));
+		uint32_t length = getU32(_blocks.data() + start);
+		putU32(bytes, length);
+		bytes.append(_blocks.data() + start + ENTRY_HEADER, length);
+		start = end;
+	}
+	putU32(bytes, (uint32_t)_lastKey.size());
+	bytes.append(_lastKey);
+	uint64_t index = _offset;
+	uint32_t indexCrc = WriteAheadLog::crc32c(bytes.data(), bytes.size());
+	write(bytes.data(), bytes.size());
+	uint64_t indexSize = bytes.size();
+
+	/* Bloom Filter : k = Bits per Key * ln 2 Probes minimize the False Positive Rate */
+	uint32_t probes = std::min(30u, std::max(1u, (uint32_t)(_bitsPerKey * 0.69)));
+	uint64_t bits = std::max<uint64_t>(64, (uint64_t)_hashes.size() * _bitsPerKey);
+	bits = (bits + 7) / 8 * 8;
+	std::string bloom(8 + (size_t)(bits / 8), '\0');
+	for (int shift = 0; shift < 4; shift++)
+		bloom[shift] = (char)(probes >> (8 * shift));
+	for (uint64_t hash : _hashes) {
+		uint64_t delta = bloomDelta(hash);
+		for (uint32_t probe = 0; probe < probes; probe++, hash += delta) {
+			uint64_t bit = hash % bits;
+			bloom[8 + (size_t)(bit >> 3)] |= (char)(1 << (bit & 7));
+		}
+	}
+	uint64_t bloomOffset = _offset;
+	uint32_t bloomCrc = WriteAheadLog::crc32c(bloom.data(), bloom.size());
+	write(bloom.data(), bloom.size());
+
+	std::string footer(SSTABLE_MAGIC, 8);
+	putU32(footer, VERSION);
+	putU32(footer, (uint32_t)_blockEnds.size());
+	putU64(footer, index);
+	putU64(footer, indexSize);
+	putU64(footer, bloomOffset);
+	putU64(footer, bloom.size());
+	putU64(footer, _entries);
+	putU32(footer, indexCrc);
+	putU32(footer, bloomCrc);
+	putU32(footer, 0);
+	putU32(footer, WriteAheadLog::crc32c(footer.data(), footer.size()));
+	write(footer.data(), footer.size());
+
+	if (!_failed && !_buffer.empty() && !_file.write(_buffer.data(), _buffer.size()))
+		_failed = true;
+	_buffer.clear();
+	if (!_failed && !_file.sync())
+		_failed = true;
+	_file.close();
+	if (_failed || !File::replace(_temp, _path)) {
+		abandon();
+		return false;
+	}
+	_temp.clear();
+	std::string().swap(_blocks);
+	std::vector<size_t>().swap(_blockEnds);
+	std::vector<uint64_t>().swap(_hashes);
+	return true;
+}
+
+/// <summary>
+/// Function to Stop Writing and Delete the Temporary File.
+/// </summary>
+void SSTable::Writer::abandon() {
+	_file.close();
+	if (!_temp.empty())
+		File::remove(_temp);
+	_temp.clear();
+	_buffer.clear();
+	std::string().swap(_blocks);
+	std::vector<size_t>().swap(_blockEnds);
+	std::vector<uint64_t>().swap(_hashes);
+	_lastKey.clear();
+	_offset = 0;
+	_entries = 0;
+	_failed = false;
+}
+
+/// <summary>
+/// Function to get the Number of Bytes Written so far, Key Blocks included once
+/// they are Written by finish().
+/// </summary>
+/// <returns>Bytes Written</returns>
+uint64_t SSTable::Writer::size() const {
+	return _offset + _blocks.size();
+}
+
+/// <summary>
+/// Function to get the Number of Entries Added so far.
+/// </summary>
+/// <returns>Entries, Tombstones included</returns>
+uint64_t SSTable::Writer::entryCount() const {
+	return _entries;
+}
+
+#ifdef TEST_SSTABLE
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test SSTable Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	const std::string path = "SSTable.test.sst";
+	const std::string damaged = "SSTable.test.damaged";
+	TagDictionary * dictionary = TagDictionary::defaultDictionary();
+	auto print = [dictionary](const SSTable& table, std::string_view key) {
+		SSTable::Entry entry;
+		std::string_view data;
+		if (!table.find(key, entry)) {
+			std::cout << "\n > " << key << " : Not Found";
+			return;
+		}
+		if (entry.removed) {
+			std::cout << "\n > " << key << " : Removed";
+			return;
+		}
+		std::cout << "\n > " << key << " : Document " << entry.document << ", Data : ";
+		if (table.value(entry, data))
+			std::cout << data;
+		else
+			std::cout << "(Corrupted)";
+		std::cout << ", Tags :";
+		for (uint32_t index = 0; index < entry.tagCount; index++)
+			std::cout << " " << dictionary->name(entry.tagId(index));
+	};
+
+	StringHelper::Title("TESTING SSTABLE PACKAGE", '=');
+	StringHelper::Title("Test Writer and find");
+	{
+		SSTable::Writer writer;
+		std::cout << "\n > Writer opened : " << writer.open(path);
+		writer.add("han", 2, DBElement("Han Solo", { "Rebel" }));
+		writer.add("leia", 1, DBElement("Leia Organa", { "Rebel" }));
+		writer.add("luke", 0, DBElement("Luke Skywalker", { "Jedi", "Rebel" }));
+		writer.addRemoved("obiwan", 3);
+		writer.add("vader", 4, DBElement("Anakin Skywalker", { "Sith" }));
+		std::cout << "\n > Finished : " << writer.finish();
+	}
+	SSTable table;
+	std::cout << "\n > Opened : " << table.open(path) << ", Entries : " << table.entryCount()
+		<< ", Range : " << table.smallest() << " - " << table.largest();
+	print(table, "luke");
+	print(table, "vader");
+	print(table, "obiwan");
+	print(table, "yoda");
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Iterator");
+	SSTable::Iterator iterator;
+	for (iterator.seek(&table); iterator.valid(); iterator.next())
+		std::cout << "\n > " << iterator.entry().key << (iterator.entry().removed ? " (Removed)" : "");
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Bloom Filter");
+	{
+		SSTable::Writer writer;
+		writer.open(damaged);
+		for (int index = 0; index < 10000; index++)
+			writer.add(std::to_string(100000 + index), index, DBElement("value"));
+		writer.finish();
+		SSTable keys;
+		keys.open(damaged);
+		size_t present = 0, falsePositives = 0;
+		for (int index = 0; index < 10000; index++) {
+			present += keys.mayContain(std::to_string(100000 + index));
+			falsePositives += keys.mayContain(std::to_string(200000 + index));
+		}
+		std::cout << "\n > Entries : " << keys.entryCount() << ", Present Keys Passing : " << present << " / 10000"
+			<< "\n > Missing Keys Passing : " << falsePositives << " / 10000 (about 1% expected)" << std::endl;
+	}
+	putline();
+
+	StringHelper::Title("Test Corruption is Detected");
+	table.close();
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		std::string copy = bytes;
+		copy[copy.size() - 1] ^= 0x5a;
+		std::ofstream(damaged, std::ios::binary | std::ios::trunc).write(copy.data(), copy.size());
+		SSTable check;
+		std::cout << "\n > Damaged Footer Opened : " << check.open(damaged);
+		copy = bytes;
+		copy[bytes.find("Luke Skywalker")] ^= 0x5a;
+		std::ofstream(damaged, std::ios::binary | std::ios::trunc).write(copy.data(), copy.size());
+		std::cout << "\n > Damaged Value, SSTable Opened : " << check.open(damaged);
+		print(check, "luke");
+		print(check, "leia");
+		copy = bytes;
+		copy[bytes.find("vader")] ^= 0x5a;
+		std::ofstream(damaged, std::ios::binary | std::ios::trunc).write(copy.data(), copy.size());
+		std::cout << "\n > Damaged Key Block, SSTable Opened : " << check.open(damaged);
+		print(check, "vader");
+		check.close();
+	}
+	std::cout << std::endl;
+	std::remove(path.c_str());
+	std::remove(damaged.c_str());
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_SSTABLE
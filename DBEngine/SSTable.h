@@ -0,0 +1,279 @@
+//////////////////////////////////////////////////////////////////
+// SSTable.h        - Immutable Sorted Run of DBEngine          //
+//                    Keys with Block Index and Bloom Filter.   //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides SSTable class, an immutable File holding Keys of one
+ * DBEngine Shard in sorted order along with their DBElements, which is Read through
+ * a Read Only Memory Mapping. SSTables are the Sorted Runs of the LSM Tier (see
+ * LSMTree) : a Memtable is Flushed into one, and Compaction Merges several of them
+ * into new ones.
+ *
+ * The File is laid out as :
+ *   [Magic "NOSQLSST"][u32 Version][u32 Reserved]
+ *   [Value]...             [u32 Data Length][u32 CRC32C of Data][Data], in Key order
+ *   [Key Block]...         Entries of about BLOCK_SIZE Bytes, in Key order
+ *   [Block Index]          [u32 Block Count]([u64 Offset][u32 Size][u32 CRC32C]
+ *                          [u32 Key Length][First Key])...
+ *                          [u32 Key Length][Last Key]
+ *   [Bloom Filter]         [u32 Probes][u32 Reserved][Bits]...
+ *   [Footer]               [Magic][u32 Version][u32 Block Count][u64 Index Offset]
+ *                          [u64 Index Size][u64 Bloom Offset][u64 Bloom Size]
+ *                          [u64 Entry Count][u32 Index CRC32C][u32 Bloom CRC32C]
+ *                          [u32 Reserved][u32 Footer CRC32C]
+ * and every Entry of a Key Block is :
+ *   [u32 Key Length][u32 Document ID][u32 Tag Count][u32 Flags][i64 Timestamp]
+ *   [u64 Value Offset][Key][u32 Tag ID]...
+ * Integers are stored Little Endian. An Entry Flagged REMOVED is a Tombstone : the
+ * Key was Removed and older SSTables must not be consulted for it. The Value of an
+ * Entry Flagged SEPARATED is an Encoded ValueLog::Pointer to the Data, which was
+ * Appended to the Value Log instead (see ValueLog).
+ *
+ * Keys, Document IDs and Tag IDs are kept in the Key Blocks apart from the Values,
+ * so the Tag Index of a Shard can be Rebuilt by Reading only the Key Blocks, and a
+ * Point Read touches one Key Block and one Value.
+ *
+ * open() checks the Footer, the Block Index and the Bloom Filter and keeps the
+ * Block Index in memory. Readers first ask the Bloom Filter (mayContain), which rules
+ * out most SSTables not holding the Key without touching the File, then find()
+ * Binary Searches the Block Index and scans the one Key Block which may hold the
+ * Key. Key Blocks and Values are checked against their CRC32C when they are Read.
+ *
+ * SSTable::Writer takes the Entries in Key order, Writes the Values as they come
+ * and the Key Blocks, Block Index and Bloom Filter once finished, to "<path>.tmp"
+ * which is fsynced and Renamed over path.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool open(const std::string& path)
+ * Method to Map an SSTable File and Check it's Block Index and Bloom Filter.
+ *
+ * - void close()
+ * Method to Unmap the SSTable File.
+ *
+ * - bool isOpen() const
+ * Method to Check whether an SSTable is Mapped.
+ *
+ * - bool mayContain(std::string_view key) const
+ * Method to Ask the Bloom Filter whether the SSTable may hold a Key.
+ *
+ * - bool find(std::string_view key, Entry& entry) const
+ * Method to Look a Key up, Binary Searching the Block Index and scanning one Key Block.
+ *
+ * - bool value(const Entry& entry, std::string_view& data) const
+ * Method to Check and get the Data of an Entry.
+ *
+ * - std::string_view smallest() const / std::string_view largest() const
+ * Methods to get the Key Range of the SSTable.
+ *
+ * - uint64_t entryCount() const / uint64_t fileSize() const
+ * Methods to get the Number of Entries and the Size of the File.
+ *
+ * - bool Iterator::seek(const SSTable * table)
+ * Method to Start Walking the Entries of an SSTable in Key order.
+ *
+ * - bool Iterator::valid() const / const Entry& Iterator::entry() const / void Iterator::next()
+ * Methods to Read the current Entry and move to the next one.
+ *
+ * - bool Writer::open(const std::string& path, unsigned bloomBitsPerKey)
+ * Method to Start Writing a new SSTable.
+ *
+ * - void Writer::add(std::string_view key, uint32_t document, const DBElement& element)
+ * Method to Add a Key and it's DBElement, Keys must be Added in increasing order.
+ *
+ * - void Writer::addSeparated(std::string_view key, uint32_t document, const DBElement& element, std::string_view pointer)
+ * Method to Add a Key whose Data lives in the Value Log.
+ *
+ * - void Writer::addRemoved(std::string_view key, uint32_t document)
+ * Method to Add a Tombstone for a Removed Key.
+ *
+ * - void Writer::add(const Entry& entry, std::string_view data)
+ * Method to Copy an Entry Read from another SSTable.
+ *
+ * - bool Writer::finish()
+ * Method to Write the Key Blocks, Block Index, Bloom Filter and Footer and Replace the SSTable File.
+ *
+ * - void Writer::abandon()
+ * Method to Delete an SSTable which is only partially Written.
+ *
+ * - uint64_t Writer::size() const / uint64_t Writer::entryCount() const
+ * Methods to get the Bytes and Entries Written so far.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * DBElement.h, DBElement.cpp, FileSystem.h, FileSystem.cpp, WriteAheadLog.h,
+ * WriteAheadLog.cpp, Snapshot.h, Snapshot.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added SEPARATED Entries holding a Value Log Pointer and Writer::addSeparated.
+ *
+ */
+#ifndef SSTABLE_H
+#define SSTABLE_H
+
+#include "FileSystem.h"
+#include "../DBElement/DBElement.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+/// <summary>
+/// Read Only, Memory Mapped Sorted Run of Keys.
+/// </summary>
+class SSTable {
+public:
+	static const uint32_t VERSION = 1;
+	static const uint32_t BLOCK_SIZE = 4096;				// Key Blocks are closed once they hold this many Bytes
+
+	/// <summary>
+	/// Decoded Entry of a Key Block. Key and Tag IDs point into the Mapping.
+	/// </summary>
+	struct Entry {
+		std::string_view key;
+		uint32_t document;									// Document ID of the Key in it's Shard
+		bool removed;										// Tombstone of a Removed Key, it has no Value
+		bool separated;										// Value is an Encoded ValueLog::Pointer
+		long long int timestamp;
+		const char * tags;									// Tag IDs, not aligned
+		uint32_t tagCount;
+		uint64_t value;										// File Offset of the Value
+
+		uint32_t tagId(uint32_t index) const;
+	};
+
+	/// <summary>
+	/// Walks the Entries of an SSTable in Key order.
+	/// </summary>
+	class Iterator {
+	private:
+		const SSTable * _table;
+		size_t _block;										// Key Block holding the current Entry
+		const char * _cursor;								// Next Entry of the Key Block
+		const char * _end;									// End of the Key Block
+		Entry _entry;
+		bool _valid;
+		bool _failed;
+
+		bool loadBlock();
+	public:
+		/* Constructor */
+		Iterator();
+
+		/* Member Functions */
+		bool seek(const SSTable * table);
+		bool valid() const;
+		bool failed() const;
+		const Entry& entry() const;
+		void next();
+	};
+
+	/// <summary>
+	/// Writes a new SSTable from Entries Added in Key order.
+	/// </summary>
+	class Writer {
+	private:
+		File _file;
+		std::string _path;
+		std::string _temp;
+		std::string _buffer;								// Bytes not Written to the File yet
+		uint64_t _offset;									// File Offset of the end of the Buffer
+		uint64_t _entries;
+		std::string _blocks;								// Key Blocks, Written after the Values
+		std::vector<size_t> _blockEnds;						// End of every closed Key Block in _blocks
+		std::string _lastKey;
+		std::vector<uint64_t> _hashes;						// Key Hashes for the Bloom Filter
+		unsigned _bitsPerKey;
+		bool _failed;
+
+		void write(const void * data, size_t size);
+		void addEntry(std::string_view key, uint32_t document, uint32_t flags, long long int timestamp, std::string_view tags, std::string_view data);
+		void endBlock();
+	public:
+		/* Constructor */
+		Writer();
+		Writer(const Writer&) = delete;
+		Writer& operator=(const Writer&) = delete;
+
+		/* Destructor */
+		~Writer();
+
+		/* Member Functions */
+		bool open(const std::string& path, unsigned bloomBitsPerKey = 10);
+		void add(std::string_view key, uint32_t document, const DBElement& element);
+		void addSeparated(std::string_view key, uint32_t document, const DBElement& element, std::string_view pointer);
+		void addRemoved(std::string_view key, uint32_t document);
+		void add(const Entry& entry, std::string_view data);
+		bool finish();
+		void abandon();
+		uint64_t size() const;
+		uint64_t entryCount() const;
+	};
+private:
+	static const uint32_t HEADER_SIZE = 16;
+	static const uint32_t FOOTER_SIZE = 72;
+	static const uint32_t ENTRY_HEADER = 32;				// Key Length, Document ID, Tag Count, Flags, Timestamp and Value Offset
+	static const uint32_t REMOVED = 1;						// Flag of a Tombstone
+	static const uint32_t SEPARATED = 2;					// Flag of a Value Log Pointer
+
+	/// <summary>
+	/// Location and First Key of a Key Block.
+	/// </summary>
+	struct Block {
+		uint64_t offset;
+		uint32_t size;
+		uint32_t crc;
+		std::string_view first;								// First Key, points into the Mapping
+	};
+
+	MappedFile _file;
+	std::vector<Block> _blocks;
+	std::string_view _largest;
+	const char * _bloom;									// Bloom Filter Bits
+	uint64_t _bloomBits;
+	uint32_t _probes;
+	uint64_t _entries;
+
+	bool checkBlock(size_t block) const;
+	static bool decode(const char *& cursor, const char * end, Entry& entry);
+	static uint32_t getU32(const char * bytes);
+	static uint64_t getU64(const char * bytes);
+	static void putU32(std::string& out, uint32_t value);
+	static void putU64(std::string& out, uint64_t value);
+public:
+	/* Constructor */
+	SSTable();
+	SSTable(const SSTable&) = delete;
+	SSTable& operator=(const SSTable&) = delete;
+
+	/* Member Functions */
+	bool open(const std::string& path);
+	void close();
+	bool isOpen() const;
+	bool mayContain(std::string_view key) const;
+	bool find(std::string_view key, Entry& entry) const;
+	bool value(const Entry& entry, std::string_view& data) const;
+	std::string_view smallest() const;
+	std::string_view largest() const;
+	uint64_t entryCount() const;
+	uint64_t fileSize() const;
+};
+
+#endif // !SSTABLE_H
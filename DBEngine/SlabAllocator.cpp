@@ -0,0 +1,304 @@
+//////////////////////////////////////////////////////////////////
+// SlabAllocator.cpp - Size Class Slab Allocator for            //
+//                     DBElements owned by DBEngine.            //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "SlabAllocator.h"
+
+#include <new>
+#include <sstream>
+#include <iomanip>
+
+/* Block Sizes of the Size Classes, all multiples of the Slab Alignment */
+const size_t SlabAllocator::CLASS_SIZES[SlabAllocator::CLASS_COUNT] = {
+	16, 32, 48, 64, 80, 96, 128, 160, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+/// <summary>
+/// Function to Add another Allocator's Statistics to these ones.
+/// </summary>
+/// <param name="other">Statistics to Add</param>
+/// <returns>Sum of the Statistics</returns>
+SlabAllocator::Stats& SlabAllocator::Stats::operator+=(const Stats& other) {
+	slabs += other.slabs;
+	slabBytes += other.slabBytes;
+	largeBlocks += other.largeBlocks;
+	largeBytes += other.largeBytes;
+	liveBlocks += other.liveBlocks;
+	bytesInUse += other.bytesInUse;
+	bytesRequested += other.bytesRequested;
+	allocations += other.allocations;
+	deallocations += other.deallocations;
+	return *this;
+}
+
+/// <summary>
+/// Constructor for SlabAllocator with the Size of each Slab as Argument.
+/// </summary>
+/// <param name="slabSize">Size of each Slab (at least the largest Size Class)</param>
+SlabAllocator::SlabAllocator(size_t slabSize) : _slabSize(slabSize), _large(nullptr) {
+	if (_slabSize < CLASS_SIZES[CLASS_COUNT - 1])
+		_slabSize = CLASS_SIZES[CLASS_COUNT - 1];
+}
+
+/// <summary>
+/// Default Destructor for SlabAllocator. Releases every Slab and Large Block.
+/// </summary>
+SlabAllocator::~SlabAllocator() {
+	release();
+}
+
+/// <summary>
+/// Function to get the Size Class which serves a Request.
+/// </summary>
+/// <param name="bytes">Requested Size</param>
+/// <param name="alignment">Requested Alignment</param>
+/// <returns>Index of the Size Class, CLASS_COUNT if the Request must be passed to the heap</returns>
+size_t SlabAllocator::classFor(size_t bytes, size_t alignment) {
+	if (alignment > alignof(std::max_align_t) || bytes > CLASS_SIZES[CLASS_COUNT - 1])
+		return CLASS_COUNT;
+	size_t sizeClass = 0;
+	while (CLASS_SIZES[sizeClass] < bytes)
+		sizeClass++;
+	return sizeClass;
+}
+
+/// <summary>
+/// Function to start a New Slab for a Size Class. Caller must hold the Lock.
+/// </summary>
+/// <param name="sizeClass">Index of the Size Class</param>
+/// <returns>First Block of the New Slab</returns>
+char * SlabAllocator::refill(size_t sizeClass) {
+	size_t blockSize = CLASS_SIZES[sizeClass];
+	size_t blocks = _slabSize / blockSize;
+	char * slab = static_cast<char*>(::operator new(blocks * blockSize));
+	_slabs.push_back(slab);
+	_stats.slabs++;
+	_stats.slabBytes += blocks * blockSize;
+	_classes[sizeClass].cursor = slab + blockSize;
+	_classes[sizeClass].end = slab + blocks * blockSize;
+	return slab;
+}
+
+/// <summary>
+/// Function to Allocate a Block. Small Blocks come from the Size Class Free List
+/// or Current Slab, others are passed to the heap and tracked.
+/// </summary>
+/// <param name="bytes">Requested Size</param>
+/// <param name="alignment">Requested Alignment</param>
+/// <returns>Allocated Block</returns>
+void * SlabAllocator::do_allocate(size_t bytes, size_t alignment) {
+	size_t sizeClass = classFor(bytes, alignment);
+	std::lock_guard<std::mutex> lock(_lock);
+	_stats.allocations++;
+	if (sizeClass == CLASS_COUNT) {
+		size_t offset = alignment > sizeof(LargeBlock) ? alignment : sizeof(LargeBlock);
+		size_t blockAlignment = alignment > alignof(LargeBlock) ? alignment : alignof(LargeBlock);
+		char * memory = static_cast<char*>(::operator new(offset + bytes, std::align_val_t(blockAlignment)));
+		LargeBlock * block = reinterpret_cast<LargeBlock*>(memory + offset - sizeof(LargeBlock));
+		block->prev = nullptr;
+		block->next = _large;
+		block->bytes = bytes;
+		block->alignment = alignment;
+		if (_large != nullptr)
+			_large->prev = block;
+		_large = block;
+		_stats.largeBlocks++;
+		_stats.largeBytes += bytes;
+		return memory + offset;
+	}
+	SizeClass& slot = _classes[sizeClass];
+	_stats.liveBlocks++;
+	_stats.bytesInUse += CLASS_SIZES[sizeClass];
+	_stats.bytesRequested += bytes;
+	if (slot.free != nullptr) {
+		FreeBlock * block = slot.free;
+		slot.free = block->next;
+		return block;
+	}
+	if (slot.cursor == slot.end)
+		return refill(sizeClass);
+	char * block = slot.cursor;
+	slot.cursor += CLASS_SIZES[sizeClass];
+	return block;
+}
+
+/// <summary>
+/// Function to Deallocate a Block. Small Blocks are pushed on their Size Class
+/// Free List, Large Blocks are given back to the heap.
+/// </summary>
+/// <param name="pointer">Block to Deallocate</param>
+/// <param name="bytes">Size the Block was Allocated with</param>
+/// <param name="alignment">Alignment the Block was Allocated with</param>
+void SlabAllocator::do_deallocate(void * pointer, size_t bytes, size_t alignment) {
+	size_t sizeClass = classFor(bytes, alignment);
+	std::lock_guard<std::mutex> lock(_lock);
+	_stats.deallocations++;
+	if (sizeClass == CLASS_COUNT) {
+		size_t offset = alignment > sizeof(LargeBlock) ? alignment : sizeof(LargeBlock);
+		size_t blockAlignment = alignment > alignof(LargeBlock) ? alignment : alignof(LargeBlock);
+		char * memory = static_cast<char*>(pointer) - offset;
+		LargeBlock * block = reinterpret_cast<LargeBlock*>(memory + offset - sizeof(LargeBlock));
+		if (block->prev != nullptr)
+			block->prev->next = block->next;
+		else
+			_large = block->next;
+		if (block->next != nullptr)
+			block->next->prev = block->prev;
+		_stats.largeBlocks--;
+		_stats.largeBytes -= bytes;
+		::operator delete(memory, std::align_val_t(blockAlignment));
+		return;
+	}
+	FreeBlock * block = static_cast<FreeBlock*>(pointer);
+	block->next = _classes[sizeClass].free;
+	_classes[sizeClass].free = block;
+	_stats.liveBlocks--;
+	_stats.bytesInUse -= CLASS_SIZES[sizeClass];
+	_stats.bytesRequested -= bytes;
+}
+
+/// <summary>
+/// Function to Check whether another Memory Resource is this SlabAllocator.
+/// </summary>
+/// <param name="other">Memory Resource to Compare with</param>
+/// <returns>True if Blocks Allocated from one can be Deallocated by the other</returns>
+bool SlabAllocator::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
+
+/// <summary>
+/// Function to Free every Slab and Large Block at once. Objects Allocated from
+/// the SlabAllocator are not Destroyed.
+/// </summary>
+void SlabAllocator::release() {
+	std::lock_guard<std::mutex> lock(_lock);
+	for (char * slab : _slabs)
+		::operator delete(slab);
+	_slabs.clear();
+	while (_large != nullptr) {
+		LargeBlock * block = _large;
+		_large = block->next;
+		size_t offset = block->alignment > sizeof(LargeBlock) ? block->alignment : sizeof(LargeBlock);
+		size_t blockAlignment = block->alignment > alignof(LargeBlock) ? block->alignment : alignof(LargeBlock);
+		::operator delete(reinterpret_cast<char*>(block) + sizeof(LargeBlock) - offset, std::align_val_t(blockAlignment));
+	}
+	for (SizeClass& slot : _classes)
+		slot = SizeClass();
+	size_t allocations = _stats.allocations;
+	size_t deallocations = _stats.deallocations;
+	_stats = Stats();
+	_stats.allocations = allocations;
+	_stats.deallocations = deallocations;
+}
+
+/// <summary>
+/// Function to get the Allocator Statistics.
+/// </summary>
+/// <returns>Snapshot of the Allocator Statistics</returns>
+SlabAllocator::Stats SlabAllocator::stats() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _stats;
+}
+
+/// <summary>
+/// Function to get Allocator Statistics in a Nicely Formatted Manner.
+/// </summary>
+/// <param name="stats">Allocator Statistics</param>
+/// <returns>Allocator Statistics in Nicely Formatted Manner</returns>
+std::string SlabAllocator::format(const Stats& stats) {
+	std::ostringstream out;
+	double utilization = stats.slabBytes == 0 ? 0.0 : 100.0 * stats.bytesInUse / stats.slabBytes;
+	double fragmentation = stats.bytesInUse == 0 ? 0.0 : 100.0 * (stats.bytesInUse - stats.bytesRequested) / stats.bytesInUse;
+	out << std::fixed << std::setprecision(1);
+	out << " Slabs          : " << stats.slabs << " (" << stats.slabBytes << " bytes)\n";
+	out << " Slab Blocks    : " << stats.liveBlocks << " (" << stats.bytesInUse << " bytes, " << utilization << "% of Slabs)\n";
+	out << " Fragmentation  : " << fragmentation << "% of Slab Block bytes unused\n";
+	out << " Large Blocks   : " << stats.largeBlocks << " (" << stats.largeBytes << " bytes)\n";
+	out << " Allocations    : " << stats.allocations << "\n";
+	out << " Deallocations  : " << stats.deallocations << "\n";
+	return out.str();
+}
+
+#ifdef TEST_SLABALLOCATOR
+
+#include <thread>
+#include <iostream>
+#include <unordered_map>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test SlabAllocator Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	SlabAllocator slabs;
+
+	StringHelper::Title("TESTING SLABALLOCATOR PACKAGE", '=');
+	StringHelper::Title("Test Strings Allocated from Slabs");
+	{
+		std::pmr::vector<std::pmr::string> strings(&slabs);
+		for (int index = 0; index < 10000; index++)
+			strings.emplace_back("slab allocated string number " + std::to_string(index));
+		std::cout << "\n > Strings : " << strings.size() << ", Last : " << strings.back() << "\n";
+		std::cout << SlabAllocator::format(slabs.stats());
+	}
+	std::cout << "\n > After Strings are Destroyed\n" << SlabAllocator::format(slabs.stats());
+	putline();
+
+	StringHelper::Title("Test Freed Blocks are Reused");
+	size_t slabsBefore = slabs.stats().slabs;
+	for (int round = 0; round < 100; round++) {
+		std::pmr::unordered_map<int, std::pmr::string> map(&slabs);
+		for (int index = 0; index < 1000; index++)
+			map.emplace(index, std::string(40, 'x'));
+	}
+	std::cout << "\n > Slabs Allocated by 100 Rounds of 1000 Entries : " << slabs.stats().slabs - slabsBefore << std::endl;
+	putline();
+
+	StringHelper::Title("Test Concurrent Allocations");
+	std::vector<std::thread> threads;
+	for (int id = 0; id < 4; id++) {
+		threads.push_back(std::thread([&slabs]() {
+			std::vector<void*> blocks;
+			for (int index = 0; index < 10000; index++)
+				blocks.push_back(slabs.allocate(16 + index % 200));
+			for (int index = 0; index < 10000; index++)
+				slabs.deallocate(blocks[index], 16 + index % 200);
+		}));
+	}
+	for (std::thread& thread : threads)
+		thread.join();
+	std::cout << "\n > Live Blocks after Threads Finished : " << slabs.stats().liveBlocks << std::endl;
+	putline();
+
+	StringHelper::Title("Test Release");
+	for (int index = 0; index < 1000; index++) {
+		slabs.allocate(64);
+		slabs.allocate(10000);
+	}
+	std::cout << "\n > Before Release\n" << SlabAllocator::format(slabs.stats());
+	slabs.release();
+	std::cout << "\n > After Release\n" << SlabAllocator::format(slabs.stats());
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_SLABALLOCATOR
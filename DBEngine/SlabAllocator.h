@@ -0,0 +1,158 @@
+//////////////////////////////////////////////////////////////////
+// SlabAllocator.h  - Size Class Slab Allocator for DBElements  //
+//                    owned by DBEngine.                        //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides SlabAllocator class which is a std::pmr::memory_resource
+ * that DBEngine uses to Allocate DBElements, their Data and their Tags.
+ *
+ * Small Requests are rounded up to one of a fixed set of Size Classes. Every Size
+ * Class carves it's Blocks out of large Slabs requested from the heap and keeps a
+ * Free List of Blocks which have been Deallocated, so Allocating and Deallocating
+ * a Block is a couple of pointer operations and millions of small DBElements cost
+ * a few thousand heap Allocations instead of millions. Requests larger than the
+ * largest Size Class (or with unusual Alignment) are passed to the heap but are
+ * still tracked so they can be Released in bulk.
+ *
+ * Releasing the SlabAllocator frees every Slab at once without visiting the Objects
+ * which were Allocated from it. Objects Allocated from a SlabAllocator must not be
+ * used after it is Released.
+ *
+ * The SlabAllocator is Thread Safe, DBElements Retired by one Shard can be freed
+ * by whichever Thread Reclaims them.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - SlabAllocator(size_t slabSize = DEFAULT_SLAB_SIZE)
+ * Constructor with the Size of each Slab as Argument.
+ *
+ * - void * allocate(size_t bytes, size_t alignment)
+ * Method (inherited from std::pmr::memory_resource) to Allocate a Block.
+ *
+ * - void deallocate(void * pointer, size_t bytes, size_t alignment)
+ * Method (inherited from std::pmr::memory_resource) to Deallocate a Block.
+ *
+ * - void release()
+ * Method to Free every Slab and Large Block at once.
+ *
+ * - Stats stats()
+ * Method to get the Allocator Statistics.
+ *
+ * - static std::string format(const Stats& stats)
+ * Method to get Allocator Statistics in a Nicely Formatted Manner.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef SLABALLOCATOR_H
+#define SLABALLOCATOR_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <memory_resource>
+
+/// <summary>
+/// Memory Resource which serves small Blocks from Size Class Slabs and
+/// frees all of them at once when Released.
+/// </summary>
+class SlabAllocator : public std::pmr::memory_resource {
+public:
+	/// <summary>
+	/// Allocator Statistics. Bytes In Use are counted in Size Class Blocks,
+	/// so the difference from Bytes Requested is internal fragmentation.
+	/// </summary>
+	struct Stats {
+		size_t slabs = 0;					// Number of Slabs Allocated from the heap
+		size_t slabBytes = 0;				// Bytes Reserved in Slabs
+		size_t largeBlocks = 0;				// Number of Live Blocks passed to the heap
+		size_t largeBytes = 0;				// Bytes in Live Blocks passed to the heap
+		size_t liveBlocks = 0;				// Number of Live Blocks served from Slabs
+		size_t bytesInUse = 0;				// Bytes in Live Blocks served from Slabs
+		size_t bytesRequested = 0;			// Bytes Requested for Live Blocks served from Slabs
+		size_t allocations = 0;				// Total Number of Allocations
+		size_t deallocations = 0;			// Total Number of Deallocations
+
+		Stats& operator+=(const Stats& other);
+	};
+
+	static const size_t DEFAULT_SLAB_SIZE = 64 * 1024;
+
+	/* Constructor */
+	SlabAllocator(size_t slabSize = DEFAULT_SLAB_SIZE);
+	SlabAllocator(const SlabAllocator&) = delete;
+	SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+	/* Destructor */
+	~SlabAllocator();
+
+	/* Member Functions */
+	void release();
+	Stats stats();
+	static std::string format(const Stats& stats);
+protected:
+	void * do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void * pointer, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+private:
+	/// <summary>
+	/// Block on a Size Class Free List.
+	/// </summary>
+	struct FreeBlock {
+		FreeBlock * next;
+	};
+
+	/// <summary>
+	/// Free List and the unused part of the Current Slab of a Size Class.
+	/// </summary>
+	struct SizeClass {
+		FreeBlock * free = nullptr;			// Blocks which have been Deallocated
+		char * cursor = nullptr;			// Next unused Block in the Current Slab
+		char * end = nullptr;				// End of the Current Slab
+	};
+
+	/// <summary>
+	/// Header placed in front of Blocks passed to the heap so they can be
+	/// Released in bulk.
+	/// </summary>
+	struct alignas(std::max_align_t) LargeBlock {
+		LargeBlock * prev;
+		LargeBlock * next;
+		size_t bytes;
+		size_t alignment;
+	};
+
+	static const size_t CLASS_COUNT = 16;
+	static const size_t CLASS_SIZES[CLASS_COUNT];
+
+	std::mutex _lock;						// Lock guarding the Allocator
+	size_t _slabSize;						// Size of each Slab
+	SizeClass _classes[CLASS_COUNT];		// Size Classes
+	std::vector<char*> _slabs;				// Slabs Allocated from the heap
+	LargeBlock * _large;					// Live Blocks passed to the heap
+	Stats _stats;							// Allocator Statistics
+
+	static size_t classFor(size_t bytes, size_t alignment);
+	char * refill(size_t sizeClass);
+};
+
+#endif // !SLABALLOCATOR_H
@@ -0,0 +1,803 @@
+//////////////////////////////////////////////////////////////////
+// Snapshot.cpp     - Versioned Binary Snapshot of a            //
+//                    DBEngine which can be Memory Mapped.      //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "Snapshot.h"
+#include "WriteAheadLog.h"
+
+#include <cstring>
+#include <algorithm>
+
+/* Magic Bytes at the start and in the Footer of every Snapshot File */
+static const char SNAPSHOT_MAGIC[8] = { 'N', 'O', 'S', 'Q', 'L', 'S', 'N', 'P' };
+
+/* Bytes collected by a Writer before they are Written to the File */
+static const size_t WRITE_BUFFER = 1 << 20;
+
+/// <summary>
+/// Function to Read a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint32_t Snapshot::getU32(const char * bytes) {
+	const unsigned char * value = reinterpret_cast<const unsigned char*>(bytes);
+	return value[0] | (value[1] << 8) | (value[2] << 16) | ((uint32_t)value[3] << 24);
+}
+
+/// <summary>
+/// Function to Read a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint64_t Snapshot::getU64(const char * bytes) {
+	return getU32(bytes) | ((uint64_t)getU32(bytes + 4) << 32);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void Snapshot::putU32(std::string& out, uint32_t value) {
+	char bytes[4] = { (char)value, (char)(value >> 8), (char)(value >> 16), (char)(value >> 24) };
+	out.append(bytes, 4);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void Snapshot::putU64(std::string& out, uint64_t value) {
+	putU32(out, (uint32_t)value);
+	putU32(out, (uint32_t)(value >> 32));
+}
+
+/// <summary>
+/// Function to Hash a Key. Uses FNV-1a followed by a 64-bit Finalizer so the Hash
+/// is the same on every Platform and Build, unlike std::hash.
+/// </summary>
+/// <param name="key">Key</param>
+/// <returns>64-bit Hash of the Key</returns>
+uint64_t Snapshot::hashKey(std::string_view key) {
+	uint64_t hash = 14695981039346656037ull;
+	for (char byte : key) {
+		hash ^= (unsigned char)byte;
+		hash *= 1099511628211ull;
+	}
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ull;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+/// <summary>
+/// Function to get one of the Tag IDs of a Record.
+/// </summary>
+/// <param name="index">Position of the Tag ID, less than tagCount</param>
+/// <returns>Tag ID</returns>
+uint32_t Snapshot::Record::tagId(uint32_t index) const {
+	return Snapshot::getU32(tags + 4 * (size_t)index);
+}
+
+/// <summary>
+/// Default Constructor. No Snapshot is open.
+/// </summary>
+Snapshot::Snapshot() {}
+
+/// <summary>
+/// Function to Check that a Section lies within the Mapping and matches it's CRC32C.
+/// </summary>
+/// <param name="offset">File Offset of the Section</param>
+/// <param name="size">Size of the Section in Bytes</param>
+/// <param name="crc">CRC32C stored in the Directory</param>
+/// <returns>True if the Section is intact</returns>
+bool Snapshot::checkSection(uint64_t offset, uint64_t size, uint32_t crc) const {
+	uint64_t limit = _file.size() - FOOTER_SIZE;
+	if (offset < HEADER_SIZE || offset > limit || size > limit - offset)
+		return false;
+	return WriteAheadLog::crc32c(_file.data() + offset, (size_t)size) == crc;
+}
+
+/// <summary>
+/// Function to Map a Snapshot File and Check it's Footer, Directory, Document Tables,
+/// Key Indexes, Postings and Dictionary. Records are Checked when they are Read.
+/// </summary>
+/// <param name="path">Path of the Snapshot File</param>
+/// <returns>True if the Snapshot is open, False if it does not Exist, is Corrupted or has a different Version</returns>
+bool Snapshot::open(const std::string& path) {
+	close();
+	if (!_file.map(path) || _file.size() < HEADER_SIZE + FOOTER_SIZE) {
+		close();
+		return false;
+	}
+	const char * data = _file.data();
+	const char * footer = data + _file.size() - FOOTER_SIZE;
+	if (std::memcmp(data, SNAPSHOT_MAGIC, 8) != 0 || getU32(data + 8) != VERSION ||
+		std::memcmp(footer, SNAPSHOT_MAGIC, 8) != 0 || getU32(footer + 8) != VERSION ||
+		WriteAheadLog::crc32c(footer, FOOTER_SIZE - 4) != getU32(footer + 36)) {
+		close();
+		return false;
+	}
+	uint32_t shards = getU32(footer + 12);
+	uint64_t directory = getU64(footer + 16);
+	uint64_t directorySize = getU64(footer + 24);
+	if (shards == 0 || directorySize != (uint64_t)shards * SHARD_ENTRY + 24 || !checkSection(directory, directorySize, getU32(footer + 32))) {
+		close();
+		return false;
+	}
+	const char * entry = data + directory;
+	for (uint32_t index = 0; index < shards; index++, entry += SHARD_ENTRY) {
+		ShardInfo shard;
+		shard.documents = getU64(entry);
+		shard.documentCount = getU32(entry + 8);
+		shard.indexMask = getU32(entry + 12);
+		shard.index = getU64(entry + 16);
+		shard.postings = getU64(entry + 24);
+		shard.postingsSize = getU64(entry + 32);
+		uint64_t slots = (uint64_t)shard.indexMask + 1;
+		if ((slots & (slots - 1)) != 0 || slots < (uint64_t)shard.documentCount + 1 ||
+			!checkSection(shard.documents, (uint64_t)shard.documentCount * 8, getU32(entry + 40)) ||
+			!checkSection(shard.index, slots * 8, getU32(entry + 44)) ||
+			!checkSection(shard.postings, shard.postingsSize, getU32(entry + 48))) {
+			close();
+			return false;
+		}
+		_shards.push_back(shard);
+	}
+	uint64_t dictionary = getU64(entry);
+	uint64_t dictionarySize = getU64(entry + 8);
+	if (dictionarySize < 4 || !checkSection(dictionary, dictionarySize, getU32(entry + 16))) {
+		close();
+		return false;
+	}
+	const char * cursor = data + dictionary;
+	const char * end = cursor + dictionarySize;
+	uint32_t count = getU32(cursor);
+	cursor += 4;
+	for (uint32_t index = 0; index < count; index++) {
+		if (end - cursor < 4 || (uint64_t)(end - cursor - 4) < getU32(cursor)) {
+			close();
+			return false;
+		}
+		uint32_t length = getU32(cursor);
+		_tags.emplace_back(cursor + 4, length);
+		cursor += 4 + (size_t)length;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Unmap the Snapshot File. Views returned by the Snapshot become invalid.
+/// </summary>
+void Snapshot::close() {
+	_file.unmap();
+	_shards.clear();
+	_tags.clear();
+}
+
+/// <summary>
+/// Function to Check whether a Snapshot is open.
+/// </summary>
+/// <returns>True if a Snapshot is Mapped</returns>
+bool Snapshot::isOpen() const {
+	return !_shards.empty();
+}
+
+/// <summary>
+/// Function to get the Number of Shards stored in the Snapshot.
+/// </summary>
+/// <returns>Number of Shards, 0 if no Snapshot is open</returns>
+size_t Snapshot::shardCount() const {
+	return _shards.size();
+}
+
+/// <summary>
+/// Function to get the Number of Records stored for a Shard. Document IDs of the
+/// Shard are 0 to documentCount - 1.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <returns>Number of Records</returns>
+uint32_t Snapshot::documentCount(size_t shard) const {
+	return _shards[shard].documentCount;
+}
+
+/// <summary>
+/// Function to get the File Offset of a Record from the Document Table.
+/// </summary>
+/// <param name="shard">Shard holding the Record</param>
+/// <param name="document">Document ID</param>
+/// <returns>File Offset of the Record</returns>
+uint64_t Snapshot::documentOffset(const ShardInfo& shard, uint32_t document) const {
+	return getU64(_file.data() + shard.documents + 8 * (uint64_t)document);
+}
+
+/// <summary>
+/// Function to Look a Key up in the Key Index of a Shard. Only the Keys of Records
+/// whose Hash Check matches are compared.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="key">Key</param>
+/// <param name="document">Set to the Document ID of the Key if it is found</param>
+/// <returns>True if the Snapshot holds the Key</returns>
+bool Snapshot::find(size_t shard, std::string_view key, uint32_t& document) const {
+	const ShardInfo& info = _shards[shard];
+	uint64_t hash = hashKey(key);
+	uint32_t check = (uint32_t)(hash >> 32);
+	const char * index = _file.data() + info.index;
+	for (uint64_t slot = hash & info.indexMask;; slot = (slot + 1) & info.indexMask) {
+		uint32_t stored = getU32(index + 8 * slot + 4);
+		if (stored == 0 || stored > info.documentCount)
+			return false;
+		if (getU32(index + 8 * slot) == check && this->key(shard, stored - 1) == key) {
+			document = stored - 1;
+			return true;
+		}
+	}
+}
+
+/// <summary>
+/// Function to get the Key of a Document ID. The Record is not Checked, so the Key
+/// may be wrong if the Record is Corrupted, but it never points outside the Mapping.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="document">Document ID</param>
+/// <returns>Key, empty if the Record lies outside the File</returns>
+std::string_view Snapshot::key(size_t shard, uint32_t document) const {
+	uint64_t offset = documentOffset(_shards[shard], document);
+	if (offset > _file.size() || _file.size() - offset < RECORD_HEADER)
+		return std::string_view();
+	uint32_t length = getU32(_file.data() + offset + 16);
+	if (_file.size() - offset - RECORD_HEADER < length)
+		return std::string_view();
+	return std::string_view(_file.data() + offset + RECORD_HEADER, length);
+}
+
+/// <summary>
+/// Function to Check the CRC32C of the Record of a Document ID and Decode it.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="document">Document ID</param>
+/// <param name="record">Decoded Record, it's Views point into the Mapping</param>
+/// <returns>True if the Record is intact</returns>
+bool Snapshot::record(size_t shard, uint32_t document, Record& record) const {
+	std::string_view raw = rawRecord(shard, document);
+	if (raw.size() < RECORD_HEADER || WriteAheadLog::crc32c(raw.data() + 8, raw.size() - 8) != getU32(raw.data() + 4))
+		return false;
+	uint64_t keyLength = getU32(raw.data() + 16);
+	uint64_t dataLength = getU32(raw.data() + 20);
+	uint64_t tagCount = getU32(raw.data() + 24);
+	if (RECORD_HEADER + keyLength + dataLength + 4 * tagCount != raw.size())
+		return false;
+	record.timestamp = (long long int)getU64(raw.data() + 8);
+	record.key = std::string_view(raw.data() + RECORD_HEADER, (size_t)keyLength);
+	record.data = std::string_view(record.key.data() + keyLength, (size_t)dataLength);
+	record.tags = record.data.data() + dataLength;
+	record.tagCount = (uint32_t)tagCount;
+	for (uint32_t index = 0; index < record.tagCount; index++) {
+		if (record.tagId(index) >= _tags.size())
+			return false;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to get the Encoded Record of a Document ID, Length and CRC32C included,
+/// so it can be Copied into a new Snapshot without Decoding it.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="document">Document ID</param>
+/// <returns>Encoded Record, empty if it lies outside the File</returns>
+std::string_view Snapshot::rawRecord(size_t shard, uint32_t document) const {
+	uint64_t offset = documentOffset(_shards[shard], document);
+	if (offset > _file.size() || _file.size() - offset < 8)
+		return std::string_view();
+	uint64_t length = getU32(_file.data() + offset);
+	if (_file.size() - offset - 8 < length)
+		return std::string_view();
+	return std::string_view(_file.data() + offset, (size_t)(8 + length));
+}
+
+/// <summary>
+/// Function to Load the Live Document IDs and the Tag Index of a Shard.
+/// </summary>
+/// <param name="shard">Shard Number</param>
+/// <param name="live">Set to the Document IDs of the Shard</param>
+/// <param name="tags">Filled with the PostingList of every Tag ID</param>
+/// <returns>True if the Postings could be Decoded</returns>
+bool Snapshot::postings(size_t shard, PostingList& live, std::unordered_map<uint32_t, PostingList>& tags) const {
+	const char * cursor = _file.data() + _shards[shard].postings;
+	const char * end = cursor + _shards[shard].postingsSize;
+	if (!live.deserialize(cursor, end) || end - cursor < 4)
+		return false;
+	uint32_t count = getU32(cursor);
+	cursor += 4;
+	tags.reserve(count);
+	for (uint32_t index = 0; index < count; index++) {
+		if (end - cursor < 4)
+			return false;
+		uint32_t id = getU32(cursor);
+		cursor += 4;
+		if (id >= _tags.size() || !tags[id].deserialize(cursor, end))
+			return false;
+	}
+	return cursor == end;
+}
+
+/// <summary>
+/// Function to get the Tag Dictionary of the Snapshot. Tag IDs in Records and
+/// Postings are Positions in this vector.
+/// </summary>
+/// <returns>Tag Strings in Tag ID order</returns>
+const std::vector<std::string>& Snapshot::tags() const {
+	return _tags;
+}
+
+/// <summary>
+/// Default Constructor. Nothing is being Written.
+/// </summary>
+Snapshot::Writer::Writer() : _offset(0), _shards(0), _failed(false) {}
+
+/// <summary>
+/// Destructor. Deletes the Snapshot if it was not finished.
+/// </summary>
+Snapshot::Writer::~Writer() {
+	abandon();
+}
+
+/// <summary>
+/// Function to Start Writing a new Snapshot. The Snapshot File itself is only
+/// Replaced by finish().
+/// </summary>
+/// <param name="path">Path of the Snapshot File</param>
+/// <returns>True if the Temporary File could be Created</returns>
+bool Snapshot::Writer::open(const std::string& path) {
+	abandon();
+	_path = path;
+	_temp = path + ".tmp";
+	_failed = !_file.open(_temp, File::CREATE);
+	if (_failed)
+		return false;
+	write(SNAPSHOT_MAGIC, 8);
+	std::string version;
+	putU32(version, VERSION);
+	putU32(version, 0);
+	write(version.data(), version.size());
+	return true;
+}
+
+/// <summary>
+/// Function to Write Bytes through the Buffer.
+/// </summary>
+/// <param name="data">Bytes</param>
+/// <param name="size">Number of Bytes</param>
+void Snapshot::Writer::write(const void * data, size_t size) {
+	_buffer.append(static_cast<const char*>(data), size);
+	_offset += size;
+	if (_buffer.size() >= WRITE_BUFFER) {
+		if (!_failed && !_file.write(_buffer.data(), _buffer.size()))
+			_failed = true;
+		_buffer.clear();
+	}
+}
+
+/// <summary>
+/// Function to Pad the File to a Multiple of 8 Bytes before a Section.
+/// </summary>
+void Snapshot::Writer::align() {
+	static const char zeros[8] = {};
+	if (_offset % 8 != 0)
+		write(zeros, (size_t)(8 - _offset % 8));
+}
+
+/// <summary>
+/// Function to Write a Section and compute it's CRC32C.
+/// </summary>
+/// <param name="bytes">Contents of the Section</param>
+/// <param name="crc">Set to the CRC32C of the Section</param>
+/// <returns>File Offset of the Section</returns>
+uint64_t Snapshot::Writer::section(const std::string& bytes, uint32_t& crc) {
+	align();
+	uint64_t offset = _offset;
+	crc = WriteAheadLog::crc32c(bytes.data(), bytes.size());
+	write(bytes.data(), bytes.size());
+	return offset;
+}
+
+/// <summary>
+/// Function to Add a DBElement to the current Shard.
+/// </summary>
+/// <param name="key">Key of the DBElement</param>
+/// <param name="element">DBElement, it's Tag IDs are Written as they are</param>
+/// <returns>Document ID of the DBElement in the Snapshot</returns>
+uint32_t Snapshot::Writer::add(std::string_view key, const DBElement& element) {
+	std::string buffer, record;
+	std::string_view data = element.getDataView(buffer);
+	record.reserve(RECORD_HEADER + key.size() + data.size() + 4 * element.getTagCount());
+	putU32(record, 0);
+	putU32(record, 0);
+	putU64(record, (uint64_t)element.getlastModified());
+	putU32(record, (uint32_t)key.size());
+	putU32(record, (uint32_t)data.size());
+	putU32(record, (uint32_t)element.getTagCount());
+	record.append(key.data(), key.size());
+	record.append(data.data(), data.size());
+	for (size_t index = 0; index < element.getTagCount(); index++)
+		putU32(record, element.tagIds()[index]);
+	uint32_t length = (uint32_t)(record.size() - 8);
+	uint32_t crc = WriteAheadLog::crc32c(record.data() + 8, length);
+	for (int shift = 0; shift < 4; shift++) {
+		record[shift] = (char)(length >> (8 * shift));
+		record[4 + shift] = (char)(crc >> (8 * shift));
+	}
+	return addRaw(key, record);
+}
+
+/// <summary>
+/// Function to Add an Encoded Record to the current Shard.
+/// </summary>
+/// <param name="key">Key of the Record</param>
+/// <param name="record">Record returned by rawRecord or Encoded by add</param>
+/// <returns>Document ID of the Record in the Snapshot</returns>
+uint32_t Snapshot::Writer::addRaw(std::string_view key, std::string_view record) {
+	_documents.push_back(_offset);
+	_hashes.push_back(hashKey(key));
+	write(record.data(), record.size());
+	return (uint32_t)(_documents.size() - 1);
+}
+
+/// <summary>
+/// Function to Write the Document Table, Key Index and Postings of the current Shard
+/// and Start the next one. Every Document ID Added to the Shard is Live.
+/// </summary>
+/// <param name="tags">PostingList of every Tag ID, using the Document IDs returned by add</param>
+void Snapshot::Writer::endShard(const std::unordered_map<uint32_t, PostingList>& tags) {
+	uint32_t count = (uint32_t)_documents.size();
+	std::string bytes;
+	bytes.reserve(8 * (size_t)count);
+	for (uint64_t offset : _documents)
+		putU64(bytes, offset);
+	uint32_t documentsCrc;
+	uint64_t documents = section(bytes, documentsCrc);
+
+	/* Key Index : at most half full so Lookups of missing Keys stop early */
+	uint64_t slots = 16;
+	while (slots < 2 * (uint64_t)count)
+		slots *= 2;
+	std::vector<uint32_t> index(2 * slots, 0);
+	for (uint32_t document = 0; document < count; document++) {
+		uint64_t slot = _hashes[document] & (slots - 1);
+		while (index[2 * slot + 1] != 0)
+			slot = (slot + 1) & (slots - 1);
+		index[2 * slot] = (uint32_t)(_hashes[document] >> 32);
+		index[2 * slot + 1] = document + 1;
+	}
+	bytes.clear();
+	bytes.reserve(8 * slots);
+	for (uint32_t value : index)
+		putU32(bytes, value);
+	std::vector<uint32_t>().swap(index);
+	uint32_t indexCrc;
+	uint64_t indexOffset = section(bytes, indexCrc);
+
+	PostingList live;
+	for (uint32_t document = 0; document < count; document++)
+		live.add(document);
+	std::vector<uint32_t> ids;
+	ids.reserve(tags.size());
+	for (const auto& tag : tags) {
+		if (!tag.second.empty())
+			ids.push_back(tag.first);
+	}
+	std::sort(ids.begin(), ids.end());
+	bytes.clear();
+	live.serialize(bytes);
+	putU32(bytes, (uint32_t)ids.size());
+	for (uint32_t id : ids) {
+		putU32(bytes, id);
+		tags.at(id).serialize(bytes);
+	}
+	uint32_t postingsCrc;
+	uint64_t postings = section(bytes, postingsCrc);
+
+	putU64(_directory, documents);
+	putU32(_directory, count);
+	putU32(_directory, (uint32_t)(slots - 1));
+	putU64(_directory, indexOffset);
+	putU64(_directory, postings);
+	putU64(_directory, bytes.size());
+	putU32(_directory, documentsCrc);
+	putU32(_directory, indexCrc);
+	putU32(_directory, postingsCrc);
+	putU32(_directory, 0);
+	_documents.clear();
+	_hashes.clear();
+	_shards++;
+}
+
+/// <summary>
+/// Function to Write the Dictionary, Directory and Footer, fsync the Snapshot and
+/// Rename it over the Snapshot File.
+/// </summary>
+/// <param name="tags">Tag Strings in Tag ID order</param>
+/// <returns>True if the Snapshot File was Replaced, False if Writing failed</returns>
+bool Snapshot::Writer::finish(const std::vector<std::string>& tags) {
+	if (!_file.isOpen())
+		return false;
+	std::string bytes;
+	putU32(bytes, (uint32_t)tags.size());
+	for (const std::string& tag : tags) {
+		putU32(bytes, (uint32_t)tag.size());
+		bytes.append(tag);
+	}
+	uint32_t dictionaryCrc;
+	uint64_t dictionary = section(bytes, dictionaryCrc);
+	putU64(_directory, dictionary);
+	putU64(_directory, bytes.size());
+	putU32(_directory, dictionaryCrc);
+	putU32(_directory, 0);
+	uint32_t directoryCrc;
+	uint64_t directory = section(_directory, directoryCrc);
+
+	std::string footer(SNAPSHOT_MAGIC, 8);
+	putU32(footer, VERSION);
+	putU32(footer, _shards);
+	putU64(footer, directory);
+	putU64(footer, _directory.size());
+	putU32(footer, directoryCrc);
+	putU32(footer, WriteAheadLog::crc32c(footer.data(), footer.size()));
+	write(footer.data(), footer.size());
+
+	if (!_failed && !_buffer.empty() && !_file.write(_buffer.data(), _buffer.size()))
+		_failed = true;
+	_buffer.clear();
+	if (!_failed && !_file.sync())
+		_failed = true;
+	_file.close();
+	if (_failed || _shards == 0 || !File::replace(_temp, _path)) {
+		abandon();
+		return false;
+	}
+	_temp.clear();
+	_directory.clear();
+	return true;
+}
+
+/// <summary>
+/// Function to Stop Writing and Delete the Temporary File. The Snapshot File is
+/// left untouched.
+/// </summary>
+void Snapshot::Writer::abandon() {
+	_file.close();
+	if (!_temp.empty())
+		File::remove(_temp);
+	_temp.clear();
+	_buffer.clear();
+	_directory.clear();
+	_documents.clear();
+	_hashes.clear();
+	_offset = 0;
+	_shards = 0;
+	_failed = false;
+}
+
+/// <summary>
+/// Function to get the Number of Bytes Written to the Snapshot so far, the whole
+/// File Size once finish() was called.
+/// </summary>
+/// <returns>Bytes Written</returns>
+uint64_t Snapshot::Writer::size() const {
+	return _offset;
+}
+
+#if defined(TEST_SNAPSHOT) || defined(BENCH_SNAPSHOT)
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+#endif // TEST_SNAPSHOT || BENCH_SNAPSHOT
+
+#ifdef TEST_SNAPSHOT
+
+/// <summary>
+/// Function to Copy a File with one Byte Flipped or the last Byte Cut off.
+/// </summary>
+/// <param name="source">File to Copy</param>
+/// <param name="path">Path of the Damaged Copy</param>
+/// <param name="fromEnd">Distance of the Flipped Byte from the end of the File</param>
+/// <param name="truncate">Cut the last Byte off instead of Flipping one</param>
+void damageFile(const std::string& source, const std::string& path, size_t fromEnd, bool truncate) {
+	std::ifstream in(source, std::ios::binary);
+	std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+	if (truncate)
+		bytes.pop_back();
+	else
+		bytes[bytes.size() - fromEnd] ^= 0x5a;
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), bytes.size());
+}
+
+/// <summary>
+/// Function to Test Snapshot Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	const std::string path = "Snapshot.test.snapshot";
+	const std::string damaged = "Snapshot.test.damaged";
+	TagDictionary * dictionary = TagDictionary::defaultDictionary();
+	uint32_t jedi = dictionary->intern("Jedi"), sith = dictionary->intern("Sith"), rebel = dictionary->intern("Rebel");
+	std::vector<std::string> tags;
+	for (uint32_t id = 0; id < (uint32_t)dictionary->size(); id++)
+		tags.push_back(dictionary->name(id));
+	auto print = [](const Snapshot& snapshot, size_t shard, std::string_view key) {
+		uint32_t document;
+		Snapshot::Record record;
+		if (!snapshot.find(shard, key, document) || !snapshot.record(shard, document, record)) {
+			std::cout << "\n > " << key << " : Not Found";
+			return;
+		}
+		std::cout << "\n > " << key << " : Document " << document << ", Data : " << record.data << ", Tags :";
+		for (uint32_t index = 0; index < record.tagCount; index++)
+			std::cout << " " << snapshot.tags()[record.tagId(index)];
+		std::cout << ", Timestamp : " << record.timestamp;
+	};
+
+	StringHelper::Title("TESTING SNAPSHOT PACKAGE", '=');
+	StringHelper::Title("Test Writer and open");
+	{
+		Snapshot::Writer writer;
+		std::cout << "\n > Writer opened : " << writer.open(path);
+		std::unordered_map<uint32_t, PostingList> postings;
+		uint32_t luke = writer.add("luke", DBElement("Luke Skywalker", { "Jedi", "Rebel" }));
+		uint32_t leia = writer.add("leia", DBElement("Leia Organa", { "Rebel" }));
+		postings[jedi].add(luke);
+		postings[rebel].add(luke);
+		postings[rebel].add(leia);
+		writer.endShard(postings);
+		postings.clear();
+		postings[sith].add(writer.add("vader", DBElement("Anakin Skywalker", { "Sith" })));
+		writer.endShard(postings);
+		std::cout << "\n > Finished : " << writer.finish(tags);
+	}
+	Snapshot snapshot;
+	std::cout << "\n > Opened : " << snapshot.open(path) << ", Shards : " << snapshot.shardCount()
+		<< ", Records : " << snapshot.documentCount(0) << " + " << snapshot.documentCount(1);
+	print(snapshot, 0, "luke");
+	print(snapshot, 0, "leia");
+	print(snapshot, 1, "vader");
+	print(snapshot, 0, "vader");
+	PostingList live;
+	std::unordered_map<uint32_t, PostingList> postings;
+	std::cout << "\n > Postings of Shard 0 Loaded : " << snapshot.postings(0, live, postings) << ", Live : " << live.cardinality()
+		<< ", Rebels : " << postings[rebel].cardinality() << std::endl;
+	putline();
+
+	StringHelper::Title("Test Copying Raw Records");
+	{
+		Snapshot::Writer writer;
+		writer.open(damaged);
+		writer.addRaw(snapshot.key(1, 0), snapshot.rawRecord(1, 0));
+		writer.endShard(std::unordered_map<uint32_t, PostingList>());
+		writer.finish(tags);
+		Snapshot copy;
+		std::cout << "\n > Copy Opened : " << copy.open(damaged);
+		print(copy, 0, "vader");
+	}
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Corruption is Detected");
+	Snapshot check;
+	damageFile(path, damaged, 0, true);
+	std::cout << "\n > Truncated File Opened : " << check.open(damaged);
+	damageFile(path, damaged, 60, false);
+	std::cout << "\n > Damaged Directory Opened : " << check.open(damaged);
+	damageFile(path, damaged, 1, false);
+	std::cout << "\n > Damaged Footer Opened : " << check.open(damaged);
+	snapshot.close();
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		damageFile(path, damaged, bytes.size() - bytes.find("Luke Skywalker"), false);
+	}
+	std::cout << "\n > Damaged Record, Snapshot Opened : " << check.open(damaged);
+	print(check, 0, "luke");
+	print(check, 0, "leia");
+	std::cout << std::endl;
+	check.close();
+	std::remove(path.c_str());
+	std::remove(damaged.c_str());
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_SNAPSHOT
+
+#ifdef BENCH_SNAPSHOT
+
+#include <chrono>
+#include <random>
+
+#include "DBEngine.h"
+
+/// <summary>
+/// Function to Benchmark Startup from a Snapshot. Compares Loading every DBElement
+/// against Attaching the Memory Mapped Snapshot, and measures the first Reads of
+/// the Attached Database which Load their DBElement from the Mapping.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [keys] [value size] [snapshot path]</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	size_t keys = argc > 1 ? std::stoul(argv[1]) : 10000000;
+	size_t size = argc > 2 ? std::stoul(argv[2]) : 64;
+	std::string path = argc > 3 ? argv[3] : "Snapshot.bench.snapshot";
+	typedef std::chrono::steady_clock Clock;
+	auto elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+
+	StringHelper::Title("BENCHMARKING SNAPSHOT STARTUP", '=');
+	std::cout << "\n Keys : " << keys << ", Value Size : " << size << " B\n";
+	{
+		DBEngine db("benchmark", 16);
+		std::string tags[] = { "Red", "Green", "Blue", "Black" };
+		for (size_t index = 0; index < keys; index++)
+			db.insert("key" + std::to_string(index), DBElement(std::string(size, 'a' + index % 26), { tags[index % 4], "Data" }));
+		Clock::time_point start = Clock::now();
+		db.saveSnapshot(path);
+		std::cout << "\n Save Snapshot : " << elapsed(start) << " ms";
+	}
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	std::cout << "\n Snapshot Size : " << (size_t)file.tellg() / (1 << 20) << " MB\n";
+
+	DBEngineConfig config(16);
+	config.snapshot = path;
+	std::mt19937_64 random(42);
+	for (bool map : { false, true }) {
+		config.mapSnapshot = map;
+		Clock::time_point start = Clock::now();
+		DBEngine * db = new DBEngine("benchmark", config);
+		double startup = elapsed(start);
+		start = Clock::now();
+		size_t found = 0;
+		for (int read = 0; read < 1000; read++)
+			found += db->getView("key" + std::to_string(random() % keys)).valid();
+		double reads = elapsed(start);
+		start = Clock::now();
+		size_t red = db->getKeysWithTags("Red & Data").size();
+		double query = elapsed(start);
+		std::cout << "\n " << (map ? "Attach (mmap)  " : "Full Load      ") << "\t Startup : " << startup << " ms"
+			<< "\t First 1000 Reads : " << reads << " ms (" << found << " found)"
+			<< "\t Tag Query : " << query << " ms (" << red << " Keys)";
+		start = Clock::now();
+		delete db;
+		std::cout << "\t Shutdown : " << elapsed(start) << " ms";
+	}
+	std::remove(path.c_str());
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_SNAPSHOT
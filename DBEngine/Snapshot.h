@@ -0,0 +1,244 @@
+//////////////////////////////////////////////////////////////////
+// Snapshot.h       - Versioned Binary Snapshot of a            //
+//                    DBEngine which can be Memory Mapped.      //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides Snapshot class which stores the whole contents of a DBEngine
+ * (DBElements, Document IDs, Tag Index and Tag Dictionary) in one versioned and
+ * checksummed Binary File, and reads it back through a Read Only Memory Mapping.
+ *
+ * The File is laid out as :
+ *   [Magic "NOSQLSNP"][u32 Version][u32 Reserved]
+ *   for every Shard :
+ *     [Record]...          one per Document ID, in Document ID order
+ *     [Document Table]     u64 File Offset of every Record
+ *     [Key Index]          Open Addressing Hash Table of [u32 Key Hash Check][u32 Document ID + 1]
+ *     [Postings]           Live Document IDs followed by [u32 Tag Count]([u32 Tag ID][PostingList])...
+ *   [Dictionary]           [u32 Tag Count]([u32 Length][Bytes])... in Tag ID order
+ *   [Directory]            Offsets, Counts and CRC32C of every Section above
+ *   [Footer]               [Magic][u32 Version][u32 Shard Count][u64 Directory Offset]
+ *                          [u64 Directory Size][u32 Directory CRC32C][u32 Footer CRC32C]
+ * and every Record is :
+ *   [u32 Payload Length][u32 CRC32C of Payload][i64 Timestamp][u32 Key Length]
+ *   [u32 Data Length][u32 Tag Count][Key][Data][u32 Tag ID]...
+ * Integers are stored Little Endian.
+ *
+ * open() maps the File and checks the Footer, the Directory and the CRC32C of every
+ * Section except the Records, so a File which was Truncated, Corrupted or Written
+ * by a different Version is rejected before anything is served from it. A Record
+ * is only checked when it is Read, so opening a Snapshot touches the Index pages
+ * but none of the Data pages and costs the same no matter how large the Data is.
+ *
+ * The Key Index uses a stable Hash (hashKey) instead of std::hash, so a Snapshot
+ * Written by one build can be opened by another. DBEngine uses the same Hash to
+ * pick the Shard of a Key, so every Shard of the Snapshot can be served by the
+ * DBEngine Shard with the same number.
+ *
+ * Snapshot::Writer writes a new Snapshot to "<path>.tmp", fsyncs it and renames it
+ * over the Snapshot File, so a Crash while Writing leaves the previous Snapshot in
+ * place.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool open(const std::string& path)
+ * Method to Map a Snapshot File and Check it's Sections.
+ *
+ * - void close()
+ * Method to Unmap the Snapshot File.
+ *
+ * - bool isOpen() const
+ * Method to Check whether a Snapshot is Mapped.
+ *
+ * - size_t shardCount() const
+ * Method to get the Number of Shards stored in the Snapshot.
+ *
+ * - uint32_t documentCount(size_t shard) const
+ * Method to get the Number of Records stored for a Shard.
+ *
+ * - bool find(size_t shard, std::string_view key, uint32_t& document) const
+ * Method to Look a Key up in the Key Index of a Shard.
+ *
+ * - std::string_view key(size_t shard, uint32_t document) const
+ * Method to get the Key of a Document ID without Checking the Record.
+ *
+ * - bool record(size_t shard, uint32_t document, Record& record) const
+ * Method to Check and Decode the Record of a Document ID.
+ *
+ * - std::string_view rawRecord(size_t shard, uint32_t document) const
+ * Method to get the Encoded Record of a Document ID so it can be Copied into a new Snapshot.
+ *
+ * - bool postings(size_t shard, PostingList& live, std::unordered_map<uint32_t, PostingList>& tags) const
+ * Method to Load the Live Document IDs and the Tag Index of a Shard.
+ *
+ * - const std::vector<std::string>& tags() const
+ * Method to get the Tag Dictionary, indexed by Tag ID.
+ *
+ * - static uint64_t hashKey(std::string_view key)
+ * Method to Hash a Key the same way on every Platform and Build.
+ *
+ * - bool Writer::open(const std::string& path)
+ * Method to Start Writing a new Snapshot.
+ *
+ * - uint32_t Writer::add(std::string_view key, const DBElement& element)
+ * Method to Add a DBElement to the current Shard, returns it's Document ID.
+ *
+ * - uint32_t Writer::addRaw(std::string_view key, std::string_view record)
+ * Method to Add a Record returned by rawRecord to the current Shard, returns it's Document ID.
+ *
+ * - void Writer::endShard(const std::unordered_map<uint32_t, PostingList>& tags)
+ * Method to Write the Document Table, Key Index and Postings of the current Shard.
+ *
+ * - bool Writer::finish(const std::vector<std::string>& tags)
+ * Method to Write the Dictionary, Directory and Footer and Replace the Snapshot File.
+ *
+ * - void Writer::abandon()
+ * Method to Delete a Snapshot which is only partially Written.
+ *
+ * - uint64_t Writer::size() const
+ * Method to get the Number of Bytes Written so far.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * DBElement.h, DBElement.cpp, PostingList.h, PostingList.cpp, FileSystem.h,
+ * FileSystem.cpp, WriteAheadLog.h, WriteAheadLog.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added Writer::size().
+ *
+ */
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "FileSystem.h"
+#include "PostingList.h"
+#include "../DBElement/DBElement.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+/// <summary>
+/// Read Only, Memory Mapped Snapshot of a DBEngine.
+/// </summary>
+class Snapshot {
+public:
+	static const uint32_t VERSION = 1;
+
+	/// <summary>
+	/// Decoded Record. Key, Data and Tag IDs point into the Mapping.
+	/// </summary>
+	struct Record {
+		long long int timestamp;
+		std::string_view key;
+		std::string_view data;
+		const char * tags;									// Tag IDs, not aligned
+		uint32_t tagCount;
+
+		uint32_t tagId(uint32_t index) const;
+	};
+
+	/// <summary>
+	/// Writes a new Snapshot one Shard at a time.
+	/// </summary>
+	class Writer {
+	private:
+		File _file;
+		std::string _path;
+		std::string _temp;
+		std::string _buffer;								// Bytes not Written to the File yet
+		uint64_t _offset;									// File Offset of the end of the Buffer
+		std::vector<uint64_t> _documents;					// Record Offsets of the current Shard
+		std::vector<uint64_t> _hashes;						// Key Hashes of the current Shard
+		std::string _directory;
+		uint32_t _shards;
+		bool _failed;
+
+		void write(const void * data, size_t size);
+		uint64_t section(const std::string& bytes, uint32_t& crc);
+		void align();
+	public:
+		/* Constructor */
+		Writer();
+		Writer(const Writer&) = delete;
+		Writer& operator=(const Writer&) = delete;
+
+		/* Destructor */
+		~Writer();
+
+		/* Member Functions */
+		bool open(const std::string& path);
+		uint32_t add(std::string_view key, const DBElement& element);
+		uint32_t addRaw(std::string_view key, std::string_view record);
+		void endShard(const std::unordered_map<uint32_t, PostingList>& tags);
+		bool finish(const std::vector<std::string>& tags);
+		void abandon();
+		uint64_t size() const;
+	};
+private:
+	static const uint32_t HEADER_SIZE = 16;
+	static const uint32_t FOOTER_SIZE = 40;
+	static const uint32_t RECORD_HEADER = 28;				// Length, CRC32C, Timestamp, Key, Data and Tag Count
+	static const uint32_t SHARD_ENTRY = 56;
+
+	/// <summary>
+	/// Location of the Sections of one Shard.
+	/// </summary>
+	struct ShardInfo {
+		uint64_t documents;									// File Offset of the Document Table
+		uint32_t documentCount;
+		uint32_t indexMask;									// Key Index Slots - 1
+		uint64_t index;										// File Offset of the Key Index
+		uint64_t postings;									// File Offset of the Postings
+		uint64_t postingsSize;
+	};
+
+	MappedFile _file;
+	std::vector<ShardInfo> _shards;
+	std::vector<std::string> _tags;
+
+	uint64_t documentOffset(const ShardInfo& shard, uint32_t document) const;
+	bool checkSection(uint64_t offset, uint64_t size, uint32_t crc) const;
+	static uint32_t getU32(const char * bytes);
+	static uint64_t getU64(const char * bytes);
+	static void putU32(std::string& out, uint32_t value);
+	static void putU64(std::string& out, uint64_t value);
+public:
+	/* Constructor */
+	Snapshot();
+	Snapshot(const Snapshot&) = delete;
+	Snapshot& operator=(const Snapshot&) = delete;
+
+	/* Member Functions */
+	bool open(const std::string& path);
+	void close();
+	bool isOpen() const;
+	size_t shardCount() const;
+	uint32_t documentCount(size_t shard) const;
+	bool find(size_t shard, std::string_view key, uint32_t& document) const;
+	std::string_view key(size_t shard, uint32_t document) const;
+	bool record(size_t shard, uint32_t document, Record& record) const;
+	std::string_view rawRecord(size_t shard, uint32_t document) const;
+	bool postings(size_t shard, PostingList& live, std::unordered_map<uint32_t, PostingList>& tags) const;
+	const std::vector<std::string>& tags() const;
+	static uint64_t hashKey(std::string_view key);
+};
+
+#endif // !SNAPSHOT_H
@@ -0,0 +1,391 @@
+//////////////////////////////////////////////////////////////////
+// TagExpression.cpp - Parses and Evaluates Boolean Tag         //
+//                     Expressions over PostingLists.           //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "TagExpression.h"
+
+#include <cctype>
+#include <iterator>
+#include <algorithm>
+#include <algorithm>
+
+/// <summary>
+/// Function to get the next Character of the Expression which is not whitespace
+/// or a double quote, without consuming it.
+/// </summary>
+/// <returns>Next Character, '\0' at the end of the Expression</returns>
+char TagExpression::peek() {
+	while (_position < _text.size() && (std::isspace((unsigned char)_text[_position]) || _text[_position] == '"'))
+		_position++;
+	return _position < _text.size() ? _text[_position] : '\0';
+}
+
+/// <summary>
+/// Function to Parse an Expression : Terms separated by '|'.
+/// </summary>
+/// <param name="node">Node receiving the parsed Expression</param>
+/// <returns>True if the Expression was parsed, False if otherwise</returns>
+bool TagExpression::parseExpression(Node& node) {
+	Node term;
+	if (!parseTerm(term))
+		return false;
+	if (peek() != '|') {
+		node = std::move(term);
+		return true;
+	}
+	node.kind = Node::OR;
+	node.children.push_back(std::move(term));
+	while (peek() == '|') {
+		_position++;
+		Node next;
+		if (!parseTerm(next))
+			return false;
+		if (next.kind == Node::OR)
+			std::move(next.children.begin(), next.children.end(), std::back_inserter(node.children));
+		else
+			node.children.push_back(std::move(next));
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Parse a Term : Factors separated by '&'. Parenthesized ANDs are
+/// flattened into the Term so all of their operands can be ordered together.
+/// </summary>
+/// <param name="node">Node receiving the parsed Term</param>
+/// <returns>True if the Term was parsed, False if otherwise</returns>
+bool TagExpression::parseTerm(Node& node) {
+	Node factor;
+	if (!parseFactor(factor))
+		return false;
+	if (peek() != '&') {
+		node = std::move(factor);
+		return true;
+	}
+	node.kind = Node::AND;
+	if (factor.kind == Node::AND)
+		node.children = std::move(factor.children);
+	else
+		node.children.push_back(std::move(factor));
+	while (peek() == '&') {
+		_position++;
+		Node next;
+		if (!parseFactor(next))
+			return false;
+		if (next.kind == Node::AND)
+			std::move(next.children.begin(), next.children.end(), std::back_inserter(node.children));
+		else
+			node.children.push_back(std::move(next));
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to Parse a Factor : a negated Factor, a parenthesized Expression or a Tag.
+/// </summary>
+/// <param name="node">Node receiving the parsed Factor</param>
+/// <returns>True if the Factor was parsed, False if otherwise</returns>
+bool TagExpression::parseFactor(Node& node) {
+	char next = peek();
+	if (next == '!') {
+		_position++;
+		node.kind = Node::NOT;
+		node.children.resize(1);
+		return parseFactor(node.children[0]);
+	}
+	if (next == '(') {
+		_position++;
+		if (!parseExpression(node) || peek() != ')')
+			return false;
+		_position++;
+		return true;
+	}
+	size_t start = _position;
+	while (_position < _text.size() && std::string("&|!()\"").find(_text[_position]) == std::string::npos)
+		_position++;
+	size_t end = _position;
+	while (end > start && std::isspace((unsigned char)_text[end - 1]))
+		end--;
+	if (end == start)
+		return false;
+	node.kind = Node::TAG;
+	node.tag = _text.substr(start, end - start);
+	return true;
+}
+
+/// <summary>
+/// Function to Parse an Expression. Replaces any previously parsed Expression.
+/// </summary>
+/// <param name="expression">Expression such as "Machine & AI & !Westworld"</param>
+/// <returns>True if the whole Expression is valid, False if otherwise</returns>
+bool TagExpression::parse(const std::string& expression) {
+	_text = expression;
+	_position = 0;
+	_root = Node();
+	return parseExpression(_root) && peek() == '\0';
+}
+
+/// <summary>
+/// Function to look up the Tag ID of every Tag under a Node. Tags which are not
+/// in the Dictionary keep INVALID and match no Document IDs.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="dictionary">TagDictionary of the DBEngine</param>
+void TagExpression::resolve(Node& node, TagDictionary& dictionary) {
+	if (node.kind == Node::TAG) {
+		node.id = TagDictionary::INVALID;
+		dictionary.find(node.tag, node.id);
+		return;
+	}
+	for (Node& child : node.children)
+		resolve(child, dictionary);
+}
+
+/// <summary>
+/// Function to look up the Tag ID of every Tag in the parsed Expression.
+/// </summary>
+/// <param name="dictionary">TagDictionary of the DBEngine</param>
+void TagExpression::resolve(TagDictionary& dictionary) {
+	resolve(_root, dictionary);
+}
+
+/// <summary>
+/// Function to get the PostingList of an operand. Tags refer to the Index
+/// directly and only other Nodes are evaluated into scratch.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="index">Tag Index of the Shard</param>
+/// <param name="universe">Every live Document ID of the Shard</param>
+/// <param name="scratch">Storage for evaluated Nodes</param>
+/// <returns>PostingList of the operand</returns>
+const PostingList * TagExpression::operand(const Node& node, const Index& index, const PostingList& universe, PostingList& scratch) {
+	static const PostingList empty;
+	if (node.kind == Node::TAG) {
+		auto posting = index.find(node.id);
+		return posting == index.end() ? &empty : &posting->second;
+	}
+	scratch = evaluate(node, index, universe);
+	return &scratch;
+}
+
+/// <summary>
+/// Function to evaluate an AND Node. Positive operands are Intersected smallest
+/// first and negated operands are then Subtracted from the result, stopping as
+/// soon as the result is empty.
+/// </summary>
+/// <param name="node">AND Node</param>
+/// <param name="index">Tag Index of the Shard</param>
+/// <param name="universe">Every live Document ID of the Shard</param>
+/// <returns>Document IDs matching the Node</returns>
+PostingList TagExpression::evaluateAnd(const Node& node, const Index& index, const PostingList& universe) {
+	std::vector<PostingList> scratch(node.children.size());
+	std::vector<const PostingList*> positives;
+	std::vector<const Node*> negatives;
+	for (size_t child = 0; child < node.children.size(); child++) {
+		const Node& operandNode = node.children[child];
+		if (operandNode.kind == Node::NOT)
+			negatives.push_back(&operandNode.children[0]);
+		else
+			positives.push_back(operand(operandNode, index, universe, scratch[child]));
+	}
+	std::sort(positives.begin(), positives.end(),
+		[](const PostingList * left, const PostingList * right) { return left->cardinality() < right->cardinality(); });
+	PostingList result;
+	if (positives.empty())
+		result = universe;
+	else if (positives.size() == 1)
+		result = *positives[0];
+	else
+		result = PostingList::intersect(*positives[0], *positives[1]);
+	for (size_t next = 2; next < positives.size() && !result.empty(); next++)
+		result = PostingList::intersect(result, *positives[next]);
+	for (const Node * negative : negatives) {
+		if (result.empty())
+			break;
+		PostingList negated;
+		result = PostingList::subtract(result, *operand(*negative, index, universe, negated));
+	}
+	return result;
+}
+
+/// <summary>
+/// Function to evaluate a Node.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="index">Tag Index of the Shard</param>
+/// <param name="universe">Every live Document ID of the Shard</param>
+/// <returns>Document IDs matching the Node</returns>
+PostingList TagExpression::evaluate(const Node& node, const Index& index, const PostingList& universe) {
+	PostingList scratch;
+	if (node.kind == Node::AND)
+		return evaluateAnd(node, index, universe);
+	if (node.kind == Node::NOT)
+		return PostingList::subtract(universe, *operand(node.children[0], index, universe, scratch));
+	if (node.kind == Node::TAG)
+		return *operand(node, index, universe, scratch);
+	PostingList result;
+	for (const Node& child : node.children)
+		result = PostingList::unite(result, *operand(child, index, universe, scratch));
+	return result;
+}
+
+/// <summary>
+/// Function to get the Document IDs matching the parsed Expression. resolve must
+/// have been called with the Dictionary the Index is keyed on.
+/// </summary>
+/// <param name="index">Tag Index of the Shard</param>
+/// <param name="universe">Every live Document ID of the Shard, used for NOT</param>
+/// <returns>Document IDs matching the Expression</returns>
+PostingList TagExpression::evaluate(const Index& index, const PostingList& universe) const {
+	return evaluate(_root, index, universe);
+}
+
+/// <summary>
+/// Function to Check whether the Tag IDs of one DBElement match a Node.
+/// </summary>
+/// <param name="node">Node</param>
+/// <param name="ids">Tag IDs, sorted</param>
+/// <param name="count">Number of Tag IDs</param>
+/// <returns>True if the Tag IDs match the Node</returns>
+bool TagExpression::matches(const Node& node, const uint32_t * ids, size_t count) {
+	switch (node.kind) {
+	case Node::TAG:
+		return node.id != TagDictionary::INVALID && std::binary_search(ids, ids + count, node.id);
+	case Node::NOT:
+		return !matches(node.children.front(), ids, count);
+	case Node::AND:
+		for (const Node& child : node.children) {
+			if (!matches(child, ids, count))
+				return false;
+		}
+		return true;
+	default:
+		for (const Node& child : node.children) {
+			if (matches(child, ids, count))
+				return true;
+		}
+		return false;
+	}
+}
+
+/// <summary>
+/// Function to Check whether the Tag IDs of one DBElement match the Expression.
+/// Must be called after resolve.
+/// </summary>
+/// <param name="ids">Tag IDs, sorted</param>
+/// <param name="count">Number of Tag IDs</param>
+/// <returns>True if the Tag IDs match the Expression</returns>
+bool TagExpression::matches(const uint32_t * ids, size_t count) const {
+	return matches(_root, ids, count);
+}
+
+/// <summary>
+/// Function to get a Node fully parenthesized.
+/// </summary>
+/// <param name="node">Node</param>
+/// <returns>Node as a String</returns>
+std::string TagExpression::toString(const Node& node) {
+	if (node.kind == Node::TAG)
+		return node.tag;
+	if (node.kind == Node::NOT)
+		return "!" + toString(node.children[0]);
+	std::string aggregator = "(";
+	for (size_t child = 0; child < node.children.size(); child++) {
+		if (child > 0)
+			aggregator.append(node.kind == Node::AND ? " & " : " | ");
+		aggregator.append(toString(node.children[child]));
+	}
+	return aggregator + ")";
+}
+
+/// <summary>
+/// Function to get the parsed Expression fully parenthesized.
+/// </summary>
+/// <returns>Expression as a String</returns>
+std::string TagExpression::toString() const {
+	return toString(_root);
+}
+
+#ifdef TEST_TAGEXPRESSION
+
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test TagExpression Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+
+	StringHelper::Title("TESTING TAGEXPRESSION PACKAGE", '=');
+	/* Document d carries Tag "Machine" if d % 2 == 0, "AI" if d % 3 == 0 and "Westworld" if d % 5 == 0 */
+	TagDictionary dictionary;
+	TagExpression::Index index;
+	PostingList universe;
+	for (uint32_t document = 0; document < 30; document++) {
+		universe.add(document);
+		if (document % 2 == 0)
+			index[dictionary.intern("Machine")].add(document);
+		if (document % 3 == 0)
+			index[dictionary.intern("AI")].add(document);
+		if (document % 5 == 0)
+			index[dictionary.intern("Westworld")].add(document);
+	}
+
+	StringHelper::Title("Test parse and evaluate Methods");
+	for (std::string text : { "\"Machine & AI & !Westworld\"", "AI | Westworld & Machine", "!(Machine | AI)", "!!Westworld & Unknown", "Machine & (AI & !AI)" }) {
+		TagExpression expression;
+		std::cout << "\n > " << text;
+		if (!expression.parse(text)) {
+			std::cout << "\n   Invalid Expression";
+			continue;
+		}
+		expression.resolve(dictionary);
+		std::cout << "\n   Parsed : " << expression.toString() << "\n   Documents :";
+		PostingList documents = expression.evaluate(index, universe);
+		documents.forEach([](uint32_t document) { std::cout << " " << document; });
+		/* matches() on the sorted Tag IDs of every Document must agree with evaluate() */
+		bool agrees = true;
+		for (uint32_t document = 0; document < 30; document++) {
+			std::vector<uint32_t> ids;
+			for (const auto& posting : index) {
+				if (posting.second.contains(document))
+					ids.push_back(posting.first);
+			}
+			std::sort(ids.begin(), ids.end());
+			agrees = agrees && expression.matches(ids.data(), ids.size()) == documents.contains(document);
+		}
+		std::cout << "\n   matches agrees : " << agrees;
+	}
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Invalid Expressions");
+	for (std::string text : { "", "Machine &", "(AI | Machine", "AI ! Machine", "AI)" }) {
+		TagExpression expression;
+		std::cout << "\n > \"" << text << "\" is valid : " << expression.parse(text);
+	}
+	std::cout << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_TAGEXPRESSION
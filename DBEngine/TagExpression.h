@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////
+// TagExpression.h  - Parses and Evaluates Boolean Tag          //
+//                    Expressions over PostingLists.            //
+// Version          - 1.1                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides TagExpression class which parses Boolean Tag Expressions
+ * such as "Machine & AI & !Westworld" and evaluates them against the Tag Index of
+ * a DBEngine Shard.
+ *
+ * Grammar (loosest binding first) :
+ *   Expression := Term { '|' Term }
+ *   Term       := Factor { '&' Factor }
+ *   Factor     := '!' Factor | '(' Expression ')' | Tag
+ *
+ * A Tag is any run of characters other than & | ! ( ) and ", with surrounding
+ * whitespace trimmed, so Tags may contain spaces ("Star Wars & Jedi"). Double
+ * quotes are ignored which allows the Expression to be quoted in a Query.
+ *
+ * The Expression is evaluated on PostingLists of Document IDs. Operands of an AND
+ * are Intersected smallest first so every following Intersection works on the
+ * smallest possible intermediate result, and NOT operands inside an AND are
+ * Subtracted from that result instead of being complemented. A NOT which is not
+ * inside an AND is complemented against every live Document ID of the Shard.
+ *
+ * matches() evaluates the Expression on the sorted Tag IDs of a single DBElement
+ * instead, for Readers which look at an older Version than the Tag Index holds.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool parse(const std::string& expression)
+ * Method to Parse an Expression. Returns False if the Expression is not valid.
+ *
+ * - void resolve(TagDictionary& dictionary)
+ * Method to look up the Tag ID of every Tag in the parsed Expression.
+ *
+ * - PostingList evaluate(const Index& index, const PostingList& universe) const
+ * Method to get the Document IDs matching the Expression.
+ *
+ * - bool matches(const uint32_t * ids, size_t count) const
+ * Method to Check whether a sorted array of Tag IDs matches the Expression.
+ *
+ * - std::string toString() const
+ * Method to get the parsed Expression fully parenthesized.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * PostingList.h, PostingList.cpp, TagDictionary.h, TagDictionary.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added matches() to evaluate the Expression on the Tag IDs of one DBElement.
+ *
+ */
+#ifndef TAGEXPRESSION_H
+#define TAGEXPRESSION_H
+
+#include "PostingList.h"
+#include "../DBElement/TagDictionary.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+/// <summary>
+/// Boolean Expression over Tags evaluated using PostingLists.
+/// </summary>
+class TagExpression {
+public:
+	typedef std::unordered_map<uint32_t, PostingList> Index;	// Tag ID -> PostingList of Document IDs
+
+	/// <summary>
+	/// Node of the parsed Expression. AND and OR Nodes hold any number of
+	/// Children, NOT Nodes hold exactly one.
+	/// </summary>
+	struct Node {
+		enum Kind { TAG, AND, OR, NOT };
+		Kind kind;
+		std::string tag;							// Tag of a TAG Node
+		uint32_t id = TagDictionary::INVALID;		// Tag ID of a TAG Node once resolved
+		std::vector<Node> children;					// Operands of AND, OR and NOT Nodes
+	};
+private:
+	Node _root;
+	std::string _text;								// Expression being Parsed
+	size_t _position = 0;							// Parse position in _text
+
+	char peek();
+	bool parseExpression(Node& node);
+	bool parseTerm(Node& node);
+	bool parseFactor(Node& node);
+	static void resolve(Node& node, TagDictionary& dictionary);
+	static const PostingList * operand(const Node& node, const Index& index, const PostingList& universe, PostingList& scratch);
+	static PostingList evaluate(const Node& node, const Index& index, const PostingList& universe);
+	static PostingList evaluateAnd(const Node& node, const Index& index, const PostingList& universe);
+	static bool matches(const Node& node, const uint32_t * ids, size_t count);
+	static std::string toString(const Node& node);
+public:
+	/* Member Functions */
+	bool parse(const std::string& expression);
+	void resolve(TagDictionary& dictionary);
+	PostingList evaluate(const Index& index, const PostingList& universe) const;
+	bool matches(const uint32_t * ids, size_t count) const;
+	std::string toString() const;
+};
+
+#endif // !TAGEXPRESSION_H
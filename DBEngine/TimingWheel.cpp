@@ -0,0 +1,175 @@
+//////////////////////////////////////////////////////////////////
+// TimingWheel.cpp  - Hierarchical Timing Wheel of Key          //
+//                    Expiry Deadlines.                         //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "TimingWheel.h"
+
+#include <chrono>
+
+/// <summary>
+/// Constructor with the Length of a Tick. The first Tick handed out is the
+/// current one.
+/// </summary>
+/// <param name="tickMillis">Length of a Tick in Milliseconds (Minimum 1)</param>
+TimingWheel::TimingWheel(long long int tickMillis) : _tickMillis(tickMillis < 1 ? 1 : tickMillis) {
+	_current = (uint64_t)(now() / _tickMillis);
+}
+
+/// <summary>
+/// Function to get the current time.
+/// </summary>
+/// <returns>Milliseconds since the Unix Epoch</returns>
+long long int TimingWheel::now() {
+	using namespace std::chrono;
+	return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+/// <summary>
+/// Function to add a Timer. Deadlines which have already passed are handed out
+/// by the next call to advance.
+/// </summary>
+/// <param name="key">Key to Expire</param>
+/// <param name="deadline">Milliseconds since the Unix Epoch</param>
+void TimingWheel::schedule(std::string_view key, long long int deadline) {
+	place(Timer{ std::string(key), deadline });
+	_size++;
+}
+
+/// <summary>
+/// Function to put a Timer in the Slot of the lowest Level whose range reaches it's
+/// Tick, rounding the Deadline up so a Timer is never handed out early.
+/// </summary>
+/// <param name="timer">Timer to place</param>
+void TimingWheel::place(Timer&& timer) {
+	uint64_t tick = timer.deadline <= 0 ? 0 : (uint64_t)((timer.deadline + _tickMillis - 1) / _tickMillis);
+	if (tick < _current)
+		tick = _current;
+	uint64_t delta = tick - _current;
+	for (unsigned int level = 0; level < LEVELS; level++) {
+		if (delta < ((uint64_t)1 << (SLOT_BITS * (level + 1)))) {
+			_slots[level][(tick >> (SLOT_BITS * level)) & (SLOTS - 1)].push_back(std::move(timer));
+			return;
+		}
+	}
+	_overflow.push_back(std::move(timer));
+}
+
+/// <summary>
+/// Function called when the Slots of Level 0 wrap around. Moves the Timers of the
+/// next Slot of Level 1 down, and of the Levels above as long as the Level below
+/// wrapped as well. The Overflow List is placed again once the top Level wraps.
+/// </summary>
+void TimingWheel::cascade() {
+	std::vector<Timer> timers;
+	for (unsigned int level = 1; level < LEVELS; level++) {
+		unsigned int index = (unsigned int)((_current >> (SLOT_BITS * level)) & (SLOTS - 1));
+		timers.clear();
+		timers.swap(_slots[level][index]);
+		for (Timer& timer : timers)
+			place(std::move(timer));
+		if (index != 0)
+			return;
+	}
+	timers.clear();
+	timers.swap(_overflow);
+	for (Timer& timer : timers)
+		place(std::move(timer));
+}
+
+/// <summary>
+/// Function to get the Number of Timers in the Wheel, including Timers which the
+/// Caller will ignore.
+/// </summary>
+/// <returns>Number of Timers</returns>
+size_t TimingWheel::size() const {
+	return _size;
+}
+
+/// <summary>
+/// Function to get the Length of a Tick.
+/// </summary>
+/// <returns>Milliseconds per Tick</returns>
+long long int TimingWheel::tickMillis() const {
+	return _tickMillis;
+}
+
+#ifdef TEST_TIMINGWHEEL
+
+#include <random>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test TimingWheel Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	const long long int tick = 10;
+
+	StringHelper::Title("TESTING TIMINGWHEEL PACKAGE", '=');
+	StringHelper::Title("Test Timers Expire in Deadline order");
+	TimingWheel wheel(tick);
+	long long int start = TimingWheel::now();
+	wheel.schedule("vader", start + 250);
+	wheel.schedule("luke", start + 50);
+	wheel.schedule("leia", start - 1000);
+	wheel.schedule("yoda", start + 900LL * 24 * 3600 * 1000);
+	std::cout << "\n > Timers : " << wheel.size() << ", Expired :";
+	for (long long int now = start; now <= start + 300; now += tick)
+		wheel.advance(now, SIZE_MAX, [](const TimingWheel::Timer& timer) { std::cout << " " << timer.key; });
+	std::cout << "\n > Timers left : " << wheel.size() << std::endl;
+	putline();
+
+	StringHelper::Title("Test Random Deadlines across every Level");
+	TimingWheel random(tick);
+	std::mt19937_64 generator(42);
+	start = TimingWheel::now();
+	const size_t count = 100000;
+	for (size_t index = 0; index < count; index++) {
+		long long int span = 1LL << (generator() % 26);
+		random.schedule(std::to_string(index), start + (long long int)(generator() % span));
+	}
+	size_t expired = 0, early = 0, late = 0;
+	long long int now = start;
+	for (; random.size() != 0; now += tick * 50) {
+		random.advance(now, SIZE_MAX, [&](const TimingWheel::Timer& timer) {
+			expired++;
+			early += timer.deadline > now;
+			late += timer.deadline <= now - tick * 51;
+		});
+	}
+	std::cout << "\n > Expired : " << expired << " of " << count << ", Early : " << early << ", Late : " << late << std::endl;
+	putline();
+
+	StringHelper::Title("Test advance Budget");
+	TimingWheel budget(tick);
+	start = TimingWheel::now();
+	for (size_t index = 0; index < 100; index++)
+		budget.schedule(std::to_string(index), start);
+	size_t batches = 0;
+	while (budget.advance(start + tick, 32, [](const TimingWheel::Timer&) {}) == 32)
+		batches++;
+	std::cout << "\n > Full Batches : " << batches << ", Timers left : " << budget.size() << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_TIMINGWHEEL
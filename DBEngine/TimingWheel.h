@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////
+// TimingWheel.h    - Hierarchical Timing Wheel of Key          //
+//                    Expiry Deadlines.                         //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides TimingWheel class which holds Timers, each a Key and the
+ * Deadline at which it Expires, and hands them back once their Deadline has passed.
+ *
+ * Time is divided into Ticks of tickMillis. The Wheel has LEVELS Levels of SLOTS
+ * Slots each, a Slot of Level L covering SLOTS^L Ticks. A Timer is put in the Slot
+ * of the lowest Level whose range reaches it's Deadline, Timers further away than
+ * the top Level wait in an Overflow List. advance() walks the Slots of Level 0 Tick
+ * by Tick, and every time the Slots of a Level wrap around the next Slot of the
+ * Level above is Cascaded down into the lower Levels. A Timer is therefore moved at
+ * most LEVELS times, so scheduling and expiring a Timer costs O(1) amortized no
+ * matter how many Timers are held or how far away their Deadlines are.
+ *
+ * Timers are never Cancelled. When a Deadline is changed or the Key is Removed the
+ * old Timer stays in the Wheel and the Caller ignores it once it fires, by checking
+ * whether the Key still has that Deadline.
+ *
+ * advance() takes a budget of Timers to hand out, so a Caller holding a Lock can
+ * Expire a large batch of Keys a few at a time. TimingWheel is not Thread Safe, the
+ * Caller must guard it.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - TimingWheel(long long int tickMillis = 100)
+ * Constructor with the Length of a Tick in Milliseconds. The Wheel starts at the current time.
+ *
+ * - void schedule(std::string_view key, long long int deadline)
+ * Method to add a Timer for a Key which Expires at the Deadline (Milliseconds since the Unix Epoch).
+ *
+ * - size_t advance(long long int now, size_t budget, Function function)
+ * Method to call function(timer) for up to budget Timers whose Deadline is not after now.
+ *
+ * - void forEach(Function function) const
+ * Method to call function(timer) for every Timer in the Wheel.
+ *
+ * - size_t size() const
+ * Method to get the Number of Timers in the Wheel.
+ *
+ * - long long int tickMillis() const
+ * Method to get the Length of a Tick in Milliseconds.
+ *
+ * - static long long int now()
+ * Method to get the current time in Milliseconds since the Unix Epoch.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * N/A
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <string_view>
+
+/// <summary>
+/// Hierarchical Timing Wheel which hands out Timers once their Deadline
+/// has passed, with O(1) amortized cost per Timer.
+/// </summary>
+class TimingWheel {
+public:
+	static const unsigned int LEVELS = 4;
+	static const unsigned int SLOT_BITS = 6;
+	static const unsigned int SLOTS = 1 << SLOT_BITS;
+
+	/// <summary>
+	/// Key and the Deadline at which it Expires.
+	/// </summary>
+	struct Timer {
+		std::string key;															// Key to Expire
+		long long int deadline;														// Milliseconds since the Unix Epoch
+	};
+
+	/* Constructor */
+	explicit TimingWheel(long long int tickMillis = 100);
+
+	/* Member Functions */
+	void schedule(std::string_view key, long long int deadline);
+	template <typename Function> size_t advance(long long int now, size_t budget, Function function);
+	template <typename Function> void forEach(Function function) const;
+	size_t size() const;
+	long long int tickMillis() const;
+	static long long int now();
+private:
+	long long int _tickMillis;														// Length of a Tick
+	uint64_t _current;																// Tick whose Slot of Level 0 is Expired next
+	size_t _size = 0;																// Number of Timers in the Wheel
+	std::vector<Timer> _slots[LEVELS][SLOTS];										// Timers of every Slot of every Level
+	std::vector<Timer> _overflow;													// Timers beyond the range of the top Level
+
+	void place(Timer&& timer);
+	void cascade();
+};
+
+/// <summary>
+/// Function to hand out Timers whose Deadline is not after now, Slot by Slot in
+/// Deadline order at Tick precision. Stops after budget Timers, the rest of the Slot
+/// is handed out by the next call. Timers are removed from the Wheel before the
+/// function is called, so it may schedule new Timers.
+/// </summary>
+/// <param name="now">Current time in Milliseconds since the Unix Epoch</param>
+/// <param name="budget">Maximum Number of Timers to hand out</param>
+/// <param name="function">Function accepting (const Timer&amp;)</param>
+/// <returns>Number of Timers handed out, budget if more may be due</returns>
+template <typename Function>
+size_t TimingWheel::advance(long long int now, size_t budget, Function function) {
+	uint64_t target = (uint64_t)(now / _tickMillis);
+	size_t handed = 0;
+	while (_current <= target) {
+		if (_size == 0) {
+			/* Nothing to Cascade, so the Wheel can jump straight to the target */
+			_current = target + 1;
+			break;
+		}
+		std::vector<Timer>& slot = _slots[0][_current & (SLOTS - 1)];
+		while (!slot.empty()) {
+			if (handed == budget)
+				return handed;
+			Timer timer = std::move(slot.back());
+			slot.pop_back();
+			_size--;
+			handed++;
+			function(timer);
+		}
+		_current++;
+		if ((_current & (SLOTS - 1)) == 0)
+			cascade();
+	}
+	return handed;
+}
+
+/// <summary>
+/// Function to call function(timer) for every Timer in the Wheel, in no particular order.
+/// </summary>
+/// <param name="function">Function accepting (const Timer&amp;)</param>
+template <typename Function>
+void TimingWheel::forEach(Function function) const {
+	for (unsigned int level = 0; level < LEVELS; level++) {
+		for (unsigned int slot = 0; slot < SLOTS; slot++) {
+			for (const Timer& timer : _slots[level][slot])
+				function(timer);
+		}
+	}
+	for (const Timer& timer : _overflow)
+		function(timer);
+}
+
+#endif // !TIMINGWHEEL_H
@@ -0,0 +1,456 @@
+//////////////////////////////////////////////////////////////////
+// ValueLog.cpp     - Append Only Segments holding large        //
+//                    DBElement Values of the LSM Tier.         //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "ValueLog.h"
+#include "WriteAheadLog.h"
+
+#include <cstring>
+
+/* Magic Bytes at the start of every Segment File */
+static const char VALUELOG_MAGIC[8] = { 'N', 'O', 'S', 'Q', 'L', 'V', 'L', 'G' };
+
+/* Bytes collected by a Writer before they are Written to the File */
+static const size_t WRITE_BUFFER = 1 << 20;
+
+/// <summary>
+/// Function to Read a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint32_t ValueLog::getU32(const char * bytes) {
+	const unsigned char * value = reinterpret_cast<const unsigned char*>(bytes);
+	return value[0] | (value[1] << 8) | (value[2] << 16) | ((uint32_t)value[3] << 24);
+}
+
+/// <summary>
+/// Function to Read a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="bytes">First Byte of the Integer</param>
+/// <returns>Integer</returns>
+uint64_t ValueLog::getU64(const char * bytes) {
+	return getU32(bytes) | ((uint64_t)getU32(bytes + 4) << 32);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 32-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void ValueLog::putU32(std::string& out, uint32_t value) {
+	char bytes[4] = { (char)value, (char)(value >> 8), (char)(value >> 16), (char)(value >> 24) };
+	out.append(bytes, 4);
+}
+
+/// <summary>
+/// Function to Append a Little Endian 64-bit Integer.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void ValueLog::putU64(std::string& out, uint64_t value) {
+	putU32(out, (uint32_t)value);
+	putU32(out, (uint32_t)(value >> 32));
+}
+
+/// <summary>
+/// Function to Encode a Pointer as the Value of an SSTable Entry.
+/// </summary>
+/// <returns>POINTER_SIZE Bytes</returns>
+std::string ValueLog::Pointer::encode() const {
+	std::string bytes;
+	putU64(bytes, segment);
+	putU64(bytes, offset);
+	putU32(bytes, length);
+	return bytes;
+}
+
+/// <summary>
+/// Function to Decode a Pointer stored as the Value of an SSTable Entry.
+/// </summary>
+/// <param name="bytes">Encoded Pointer</param>
+/// <returns>True if bytes holds a Pointer</returns>
+bool ValueLog::Pointer::decode(std::string_view bytes) {
+	if (bytes.size() != POINTER_SIZE)
+		return false;
+	segment = getU64(bytes.data());
+	offset = getU64(bytes.data() + 8);
+	length = getU32(bytes.data() + 16);
+	return true;
+}
+
+/// <summary>
+/// Default Constructor. Nothing is Mapped.
+/// </summary>
+ValueLog::ValueLog() : _number(0) {}
+
+/// <summary>
+/// Function to Map a Segment File and Check it's Header.
+/// </summary>
+/// <param name="path">Path of the Segment File</param>
+/// <param name="number">Segment Number Pointers use to refer to it</param>
+/// <returns>True if the Segment is Mapped</returns>
+bool ValueLog::open(const std::string& path, uint64_t number) {
+	close();
+	if (!_file.map(path) || _file.size() < HEADER_SIZE || std::memcmp(_file.data(), VALUELOG_MAGIC, 8) != 0 ||
+		getU32(_file.data() + 8) != VERSION) {
+		close();
+		return false;
+	}
+	_number = number;
+	return true;
+}
+
+/// <summary>
+/// Function to Unmap the Segment File.
+/// </summary>
+void ValueLog::close() {
+	_file.unmap();
+	_number = 0;
+}
+
+/// <summary>
+/// Function to Check whether a Segment is Mapped.
+/// </summary>
+/// <returns>True if the Segment can be Read</returns>
+bool ValueLog::isOpen() const {
+	return _file.data() != nullptr;
+}
+
+/// <summary>
+/// Function to Check the Record a Pointer refers to against it's CRC32C and get
+/// it's Data.
+/// </summary>
+/// <param name="pointer">Pointer into this Segment</param>
+/// <param name="data">Set to the Data, it points into the Mapping</param>
+/// <returns>True if the Record is intact and matches the Pointer</returns>
+bool ValueLog::read(const Pointer& pointer, std::string_view& data) const {
+	if (pointer.segment != _number || pointer.offset < HEADER_SIZE || pointer.offset > _file.size() ||
+		_file.size() - pointer.offset < RECORD_HEADER)
+		return false;
+	const char * record = _file.data() + pointer.offset;
+	uint64_t length = (uint64_t)getU32(record) + getU32(record + 4);
+	if (getU32(record + 4) != pointer.length || _file.size() - pointer.offset - RECORD_HEADER < length ||
+		WriteAheadLog::crc32c(record + RECORD_HEADER, (size_t)length) != getU32(record + 8))
+		return false;
+	data = std::string_view(record + RECORD_HEADER + getU32(record), pointer.length);
+	return true;
+}
+
+/// <summary>
+/// Function to get the Number of the Segment.
+/// </summary>
+/// <returns>Segment Number</returns>
+uint64_t ValueLog::number() const {
+	return _number;
+}
+
+/// <summary>
+/// Function to get the Size of the Segment File.
+/// </summary>
+/// <returns>Bytes</returns>
+uint64_t ValueLog::fileSize() const {
+	return _file.size();
+}
+
+/// <summary>
+/// Default Constructor. No Segment is being Written.
+/// </summary>
+ValueLog::Writer::Writer() : _number(0), _offset(0), _failed(false) {}
+
+/// <summary>
+/// Destructor. Deletes the Segment if it was not finished.
+/// </summary>
+ValueLog::Writer::~Writer() {
+	abandon();
+}
+
+/// <summary>
+/// Function to Start Writing a new Segment. The Segment File itself is only
+/// Created by finish().
+/// </summary>
+/// <param name="path">Path of the Segment File</param>
+/// <param name="number">Segment Number the Pointers will refer to</param>
+/// <returns>True if the Temporary File could be Created</returns>
+bool ValueLog::Writer::open(const std::string& path, uint64_t number) {
+	abandon();
+	_path = path;
+	_temp = path + ".tmp";
+	_number = number;
+	_failed = !_file.open(_temp, File::CREATE);
+	if (_failed)
+		return false;
+	std::string header(VALUELOG_MAGIC, 8);
+	putU32(header, VERSION);
+	putU32(header, 0);
+	write(header.data(), header.size());
+	return true;
+}
+
+/// <summary>
+/// Function to Write Bytes through the Buffer.
+/// </summary>
+/// <param name="data">Bytes</param>
+/// <param name="size">Number of Bytes</param>
+void ValueLog::Writer::write(const void * data, size_t size) {
+	_buffer.append(static_cast<const char*>(data), size);
+	_offset += size;
+	if (_buffer.size() >= WRITE_BUFFER) {
+		if (!_failed && !_file.write(_buffer.data(), _buffer.size()))
+			_failed = true;
+		_buffer.clear();
+	}
+}
+
+/// <summary>
+/// Function to Append a Record holding a Key and it's Data.
+/// </summary>
+/// <param name="key">Key the Data belongs to</param>
+/// <param name="data">Data of the DBElement</param>
+/// <returns>Pointer to the Record</returns>
+ValueLog::Pointer ValueLog::Writer::append(std::string_view key, std::string_view data) {
+	Pointer pointer;
+	pointer.segment = _number;
+	pointer.offset = _offset;
+	pointer.length = (uint32_t)data.size();
+	std::string header;
+	putU32(header, (uint32_t)key.size());
+	putU32(header, (uint32_t)data.size());
+	putU32(header, WriteAheadLog::crc32c(data.data(), data.size(), WriteAheadLog::crc32c(key.data(), key.size())));
+	write(header.data(), header.size());
+	write(key.data(), key.size());
+	write(data.data(), data.size());
+	return pointer;
+}
+
+/// <summary>
+/// Function to Write the Buffered Records, fsync the Segment and Rename it over the
+/// Segment File.
+/// </summary>
+/// <returns>True if the Segment is Durable</returns>
+bool ValueLog::Writer::finish() {
+	if (!_file.isOpen()) {
+		abandon();
+		return false;
+	}
+	if (!_failed && !_buffer.empty() && !_file.write(_buffer.data(), _buffer.size()))
+		_failed = true;
+	_buffer.clear();
+	if (!_failed && !_file.sync())
+		_failed = true;
+	_file.close();
+	if (_failed || !File::replace(_temp, _path)) {
+		abandon();
+		return false;
+	}
+	_temp.clear();
+	return true;
+}
+
+/// <summary>
+/// Function to Stop Writing and Delete the Temporary File.
+/// </summary>
+void ValueLog::Writer::abandon() {
+	_file.close();
+	if (!_temp.empty())
+		File::remove(_temp);
+	_temp.clear();
+	std::string().swap(_buffer);
+	_offset = 0;
+	_failed = false;
+}
+
+/// <summary>
+/// Function to get the Number of Bytes Written so far.
+/// </summary>
+/// <returns>Bytes Written, Header included</returns>
+uint64_t ValueLog::Writer::size() const {
+	return _offset;
+}
+
+/// <summary>
+/// Function to Check whether a Segment is being Written.
+/// </summary>
+/// <returns>True between open() and finish()</returns>
+bool ValueLog::Writer::isOpen() const {
+	return _file.isOpen();
+}
+
+#ifdef TEST_VALUELOG
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test ValueLog Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	const std::string path = "ValueLog.test.vlog";
+	const std::string damaged = "ValueLog.test.damaged";
+	ValueLog::Pointer luke, vader;
+
+	StringHelper::Title("TESTING VALUELOG PACKAGE", '=');
+	StringHelper::Title("Test Writer and read");
+	{
+		ValueLog::Writer writer;
+		std::cout << "\n > Writer opened : " << writer.open(path, 7);
+		luke = writer.append("luke", std::string(5000, 'L'));
+		writer.append("leia", "Leia Organa");
+		vader = writer.append("vader", "Anakin Skywalker");
+		std::cout << "\n > Finished : " << writer.finish() << ", Bytes : " << writer.size();
+	}
+	ValueLog segment;
+	std::string_view data;
+	std::cout << "\n > Opened : " << segment.open(path, 7) << ", Segment : " << segment.number();
+	std::cout << "\n > luke : " << segment.read(luke, data) << ", " << data.size() << " Bytes";
+	std::cout << "\n > vader : " << segment.read(vader, data) << ", " << data;
+	ValueLog::Pointer decoded;
+	std::cout << "\n > Pointer Encoded and Decoded : " << (decoded.decode(vader.encode()) && decoded.offset == vader.offset && decoded.length == vader.length);
+	ValueLog::Pointer wrong = vader;
+	wrong.length++;
+	std::cout << "\n > Pointer with a wrong Length Read : " << segment.read(wrong, data);
+	wrong = vader;
+	wrong.segment = 8;
+	std::cout << "\n > Pointer into another Segment Read : " << segment.read(wrong, data) << std::endl;
+	putline();
+
+	StringHelper::Title("Test forEach");
+	segment.forEach([](const ValueLog::Record& record) {
+		std::cout << "\n > " << record.key << " at " << record.offset << " : " << record.data.size() << " Bytes";
+	});
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Corruption is Detected");
+	segment.close();
+	{
+		std::ifstream in(path, std::ios::binary);
+		std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+		bytes[bytes.find("Anakin")] ^= 0x5a;
+		std::ofstream(damaged, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size());
+	}
+	ValueLog check;
+	std::cout << "\n > Damaged Segment Opened : " << check.open(damaged, 7);
+	std::cout << "\n > luke : " << check.read(luke, data) << ", vader : " << check.read(vader, data);
+	size_t records = 0;
+	std::cout << "\n > forEach intact : " << check.forEach([&records](const ValueLog::Record&) { records++; }) << ", Records before the Damage : " << records << std::endl;
+	check.close();
+	std::remove(path.c_str());
+	std::remove(damaged.c_str());
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_VALUELOG
+
+#ifdef BENCH_VALUELOG
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <iostream>
+
+#include "DBEngine.h"
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Benchmark the LSM Tier with large Values kept in the SSTables against
+/// the same Tier with the Values Separated into the Value Log. Every Key is Inserted
+/// and three of every four Overwritten, then Write Amplification, Bytes on Disk, Garbage
+/// Collection and Point Reads are compared.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [keys] [value size] [memtable MB] [directory]</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	size_t keys = argc > 1 ? std::stoul(argv[1]) : 100000;
+	size_t size = argc > 2 ? std::stoul(argv[2]) : 4096;
+	size_t memtable = argc > 3 ? std::stoul(argv[3]) : 32;
+	std::string directory = argc > 4 ? argv[4] : "ValueLog.bench";
+	const uint64_t prime = 2654435761ULL;
+	const size_t reads = 100000;
+	typedef std::chrono::steady_clock Clock;
+	auto elapsed = [](Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); };
+
+	StringHelper::Title("BENCHMARKING VALUE LOG", '=');
+	std::cout << "\n Keys : " << keys << ", Value Size : " << size << " B, Memtables : " << memtable << " MB";
+	for (bool separated : { false, true }) {
+		DBEngineConfig config(4);
+		config.lsm.directory = directory + (separated ? ".separated" : ".inline");
+		config.lsm.memtableBytes = memtable << 20;
+		config.lsm.levelBytes = 2 * config.lsm.memtableBytes / config.shards;
+		config.lsm.valueThreshold = separated ? 1024 : 0;
+		std::remove((config.lsm.directory + "/MANIFEST").c_str());
+		for (int number = 1; number < 100000; number++) {
+			char name[32];
+			std::snprintf(name, sizeof(name), "/%06d.sst", number);
+			std::remove((config.lsm.directory + name).c_str());
+			std::snprintf(name, sizeof(name), "/%06d.vlog", number);
+			std::remove((config.lsm.directory + name).c_str());
+		}
+		DBEngine db("benchmark", config);
+		uint64_t userBytes = 0;
+		Clock::time_point start = Clock::now();
+		for (size_t index = 0; index < keys + 3 * keys / 4; index++) {
+			/* Keys are Inserted in a scattered order, then every Key but every fourth is Overwritten */
+			std::string key = "key" + std::to_string(index < keys ? index * prime % keys : (index - keys) / 3 * 4 + (index - keys) % 3 + 1);
+			userBytes += key.size() + size;
+			if (index < keys)
+				db.insert(key, DBElement(std::string(size, 'a' + index % 26), { "Droid" }));
+			else
+				db.update(key, DBElement(std::string(size, 'a' + index % 26), { "Droid" }));
+		}
+		double writing = elapsed(start);
+		LSMTree::Stats stats = db.tierStats();
+		double settled = elapsed(start);
+		uint64_t disk = stats.segmentBytes;
+		for (size_t level = 0; level < LSMTree::LEVELS; level++)
+			disk += stats.levelBytes[level];
+
+		std::mt19937_64 random(42);
+		size_t found = 0;
+		start = Clock::now();
+		for (size_t read = 0; read < reads; read++)
+			found += db.getView("key" + std::to_string(random() % keys)).valid();
+		double reading = elapsed(start);
+
+		std::cout << "\n\n " << (separated ? "Values Separated" : "Values in SSTables") << "\t User Data : " << userBytes / (1 << 20) << " MB";
+		std::cout << "\n Writes : " << (uint64_t)((keys + 3 * keys / 4) / (writing / 1000)) << " /s, Compaction settled after " << settled / 1000 << " s";
+		std::cout << "\n Write Amplification : " << (double)(stats.flushedBytes + stats.compactionWrittenBytes + stats.valueLogBytesWritten) / userBytes
+			<< " (Flushed " << stats.flushedBytes / (1 << 20) << " MB, Compacted " << stats.compactionWrittenBytes / (1 << 20)
+			<< " MB, Value Log " << stats.valueLogBytesWritten / (1 << 20) << " MB)";
+		std::cout << "\n On Disk : " << disk / (1 << 20) << " MB (SSTables " << (disk - stats.segmentBytes) / (1 << 20) << " MB, Segments "
+			<< stats.segmentBytes / (1 << 20) << " MB of which Garbage " << stats.garbageBytes / (1 << 20) << " MB)";
+		std::cout << "\n Garbage Collection : " << stats.collections << " Segments, Relocated " << stats.relocatedBytes / (1 << 20)
+			<< " MB, Reclaimed " << stats.reclaimedBytes / (1 << 20) << " MB";
+		std::cout << "\n Reads : " << (uint64_t)(reads / (reading / 1000)) << " /s (" << found << " found)";
+	}
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_VALUELOG
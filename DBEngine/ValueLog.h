@@ -0,0 +1,208 @@
+//////////////////////////////////////////////////////////////////
+// ValueLog.h       - Append Only Segments holding large        //
+//                    DBElement Values of the LSM Tier.         //
+// Version          - 1.0                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides ValueLog class, one Segment of the Value Log of the LSM
+ * Tier (see LSMTree). When Key-Value Separation is enabled, a Flush Appends the Data
+ * of every DBElement at least Options::valueThreshold Bytes large to a new Segment
+ * and the SSTable only stores a Pointer to it. Compaction then Merges and Rewrites
+ * the small Pointers instead of the large Values, and the Key Blocks stay small
+ * enough for the Keys and Tags to be Read quickly.
+ *
+ * A Segment is Written once by ValueLog::Writer to "<path>.tmp", fsynced and Renamed
+ * into place, and Read through a Read Only Memory Mapping afterwards. It is laid
+ * out as :
+ *   [Magic "NOSQLVLG"][u32 Version][u32 Reserved]
+ *   [Record]...            [u32 Key Length][u32 Data Length][u32 CRC32C of Key and Data]
+ *                          [Key][Data]
+ * The Key is kept along with the Data so the Garbage Collector can find out which
+ * Records are still Live by Looking their Key up in the LSM Tier.
+ *
+ * A Pointer names the Segment, the Offset of the Record and the Length of the Data
+ * and is stored Encoded in POINTER_SIZE Bytes as the Value of an SSTable Entry.
+ * read() checks the Record against it's CRC32C and the Pointer's Length.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool open(const std::string& path, uint64_t number)
+ * Method to Map a Segment File.
+ *
+ * - void close()
+ * Method to Unmap the Segment File.
+ *
+ * - bool isOpen() const
+ * Method to Check whether a Segment is Mapped.
+ *
+ * - bool read(const Pointer& pointer, std::string_view& data) const
+ * Method to Check and get the Data a Pointer refers to.
+ *
+ * - bool forEach(Function function) const
+ * Method to call function(record) for every Record of the Segment.
+ *
+ * - uint64_t number() const / uint64_t fileSize() const
+ * Methods to get the Segment Number and the Size of the File.
+ *
+ * - std::string Pointer::encode() const / bool Pointer::decode(std::string_view bytes)
+ * Methods to Convert a Pointer to and from the Value of an SSTable Entry.
+ *
+ * - bool Writer::open(const std::string& path, uint64_t number)
+ * Method to Start Writing a new Segment.
+ *
+ * - Pointer Writer::append(std::string_view key, std::string_view data)
+ * Method to Append a Record and get a Pointer to it.
+ *
+ * - bool Writer::finish()
+ * Method to fsync the Segment and Rename it over the Segment File.
+ *
+ * - void Writer::abandon()
+ * Method to Delete a Segment which is only partially Written.
+ *
+ * - uint64_t Writer::size() const / bool Writer::isOpen() const
+ * Methods to get the Bytes Written so far and whether a Segment is being Written.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * FileSystem.h, FileSystem.cpp, WriteAheadLog.h, WriteAheadLog.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ */
+#ifndef VALUELOG_H
+#define VALUELOG_H
+
+#include "FileSystem.h"
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+/// <summary>
+/// Read Only, Memory Mapped Segment of the Value Log.
+/// </summary>
+class ValueLog {
+public:
+	static const uint32_t VERSION = 1;
+	static const size_t POINTER_SIZE = 20;				// Bytes of an Encoded Pointer
+	static const uint32_t HEADER_SIZE = 16;
+	static const uint32_t RECORD_HEADER = 12;			// Key Length, Data Length and CRC32C
+
+	/// <summary>
+	/// Location of a Value in the Value Log.
+	/// </summary>
+	struct Pointer {
+		uint64_t segment = 0;							// Segment Number
+		uint64_t offset = 0;							// File Offset of the Record
+		uint32_t length = 0;							// Length of the Data
+
+		std::string encode() const;
+		bool decode(std::string_view bytes);
+	};
+
+	/// <summary>
+	/// Record of a Segment, Key and Data point into the Mapping.
+	/// </summary>
+	struct Record {
+		std::string_view key;
+		std::string_view data;
+		uint64_t offset;								// File Offset of the Record
+	};
+
+	/// <summary>
+	/// Writes a new Segment.
+	/// </summary>
+	class Writer {
+	private:
+		File _file;
+		std::string _path;
+		std::string _temp;
+		std::string _buffer;							// Bytes not Written to the File yet
+		uint64_t _number;
+		uint64_t _offset;								// File Offset of the end of the Buffer
+		bool _failed;
+
+		void write(const void * data, size_t size);
+	public:
+		/* Constructor */
+		Writer();
+		Writer(const Writer&) = delete;
+		Writer& operator=(const Writer&) = delete;
+
+		/* Destructor */
+		~Writer();
+
+		/* Member Functions */
+		bool open(const std::string& path, uint64_t number);
+		Pointer append(std::string_view key, std::string_view data);
+		bool finish();
+		void abandon();
+		uint64_t size() const;
+		bool isOpen() const;
+	};
+private:
+	MappedFile _file;
+	uint64_t _number;
+
+	static uint32_t getU32(const char * bytes);
+	static uint64_t getU64(const char * bytes);
+	static void putU32(std::string& out, uint32_t value);
+	static void putU64(std::string& out, uint64_t value);
+public:
+	/* Constructor */
+	ValueLog();
+	ValueLog(const ValueLog&) = delete;
+	ValueLog& operator=(const ValueLog&) = delete;
+
+	/* Member Functions */
+	bool open(const std::string& path, uint64_t number);
+	void close();
+	bool isOpen() const;
+	bool read(const Pointer& pointer, std::string_view& data) const;
+	template <typename Function> bool forEach(Function function) const;
+	uint64_t number() const;
+	uint64_t fileSize() const;
+};
+
+/// <summary>
+/// Function to call function(record) for every Record of the Segment in the order
+/// they were Appended. Stops at the first Record which is Truncated or fails it's
+/// CRC32C.
+/// </summary>
+/// <param name="function">Function accepting (const Record&amp;)</param>
+/// <returns>True if every Record was intact</returns>
+template <typename Function>
+bool ValueLog::forEach(Function function) const {
+	uint64_t offset = HEADER_SIZE;
+	Record record;
+	while (offset < _file.size()) {
+		Pointer pointer;
+		if (_file.size() - offset < RECORD_HEADER)
+			return false;
+		pointer.segment = _number;
+		pointer.offset = offset;
+		pointer.length = getU32(_file.data() + offset + 4);
+		if (!read(pointer, record.data))
+			return false;
+		record.key = std::string_view(_file.data() + offset + RECORD_HEADER, getU32(_file.data() + offset));
+		record.offset = offset;
+		function(record);
+		offset += RECORD_HEADER + record.key.size() + record.data.size();
+	}
+	return true;
+}
+
+#endif // !VALUELOG_H
@@ -0,0 +1,761 @@
+//////////////////////////////////////////////////////////////////
+// WriteAheadLog.cpp - Append-Only Binary Log of DBEngine       //
+//                     Mutations with Group Commit.             //
+// Version          - 1.4                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+
+#include "WriteAheadLog.h"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define WRITEAHEADLOG_SSE42
+#include <nmmintrin.h>
+#endif
+
+namespace {
+	/// <summary>
+	/// Records the Calling Thread gathers between beginBatch and endBatch.
+	/// </summary>
+	struct PendingBatch {
+		const WriteAheadLog * log = nullptr;				// Log the Records are gathered for, NULL if none
+		std::string payloads;								// Payload of every Record, each as [u32 Length][Bytes]
+		uint32_t count = 0;
+	};
+
+	thread_local PendingBatch pendingBatch;
+}
+
+/// <summary>
+/// Default Constructor. The Log does not Record anything till it is opened.
+/// </summary>
+WriteAheadLog::WriteAheadLog() : _appended(0), _durable(0), _closing(false), _failed(false) {}
+
+/// <summary>
+/// Destructor. Writes the remaining Records and closes the File.
+/// </summary>
+WriteAheadLog::~WriteAheadLog() {
+	close();
+}
+
+/// <summary>
+/// Function to Compute the CRC32C (Castagnoli) of a Block of Bytes. Passing the
+/// CRC of a previous Block as crc Extends it.
+/// </summary>
+/// <param name="data">Bytes</param>
+/// <param name="size">Number of Bytes</param>
+/// <param name="crc">CRC32C of the preceding Bytes, 0 to start a new CRC</param>
+/// <returns>CRC32C</returns>
+uint32_t WriteAheadLog::crc32c(const void * data, size_t size, uint32_t crc) {
+	const unsigned char * bytes = static_cast<const unsigned char*>(data);
+	crc = ~crc;
+#ifdef WRITEAHEADLOG_SSE42
+#if defined(__x86_64__) || defined(_M_X64)
+	for (; size >= 8; bytes += 8, size -= 8) {
+		uint64_t word;
+		std::memcpy(&word, bytes, 8);
+		crc = (uint32_t)_mm_crc32_u64(crc, word);
+	}
+#endif
+	for (; size > 0; bytes++, size--)
+		crc = _mm_crc32_u8(crc, *bytes);
+#else
+	static const struct Table {
+		uint32_t entries[256];
+		Table() {
+			for (uint32_t index = 0; index < 256; index++) {
+				uint32_t entry = index;
+				for (int bit = 0; bit < 8; bit++)
+					entry = (entry >> 1) ^ (entry & 1 ? 0x82F63B78u : 0);
+				entries[index] = entry;
+			}
+		}
+	} table;
+	for (; size > 0; bytes++, size--)
+		crc = table.entries[(crc ^ *bytes) & 0xFF] ^ (crc >> 8);
+#endif
+	return ~crc;
+}
+
+/// <summary>
+/// Function to Append a 32-bit Integer in Little Endian order.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">Integer</param>
+void WriteAheadLog::putU32(std::string& out, uint32_t value) {
+	char bytes[4] = { (char)value, (char)(value >> 8), (char)(value >> 16), (char)(value >> 24) };
+	out.append(bytes, 4);
+}
+
+/// <summary>
+/// Function to Append a Length Prefixed String.
+/// </summary>
+/// <param name="out">String to Append to</param>
+/// <param name="value">String</param>
+void WriteAheadLog::putString(std::string& out, std::string_view value) {
+	putU32(out, (uint32_t)value.size());
+	out.append(value.data(), value.size());
+}
+
+/// <summary>
+/// Function to Read a Little Endian 32-bit Integer and Advance the Cursor.
+/// </summary>
+/// <param name="cursor">Position to Read from</param>
+/// <param name="end">End of the Readable Bytes</param>
+/// <param name="value">Integer Read</param>
+/// <returns>False if fewer than 4 Bytes are left</returns>
+bool WriteAheadLog::getU32(const char *& cursor, const char * end, uint32_t& value) {
+	if (end - cursor < 4)
+		return false;
+	const unsigned char * bytes = reinterpret_cast<const unsigned char*>(cursor);
+	value = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+	cursor += 4;
+	return true;
+}
+
+/// <summary>
+/// Function to Read a Length Prefixed String and Advance the Cursor.
+/// </summary>
+/// <param name="cursor">Position to Read from</param>
+/// <param name="end">End of the Readable Bytes</param>
+/// <param name="value">String Read</param>
+/// <returns>False if the String runs past the end</returns>
+bool WriteAheadLog::getString(const char *& cursor, const char * end, std::string& value) {
+	uint32_t length;
+	if (!getU32(cursor, end, length) || (size_t)(end - cursor) < length)
+		return false;
+	value.assign(cursor, length);
+	cursor += length;
+	return true;
+}
+
+/// <summary>
+/// Function to Start Encoding a Record. Leaves room for the Header which is filled
+/// in by endRecord.
+/// </summary>
+/// <param name="record">Buffer receiving the Record</param>
+/// <param name="operation">Mutation</param>
+/// <param name="key">Key</param>
+/// <param name="value">Data or Tag</param>
+/// <param name="timestamp">Last Modified Timestamp after the Mutation</param>
+void WriteAheadLog::beginRecord(std::string& record, Operation operation, std::string_view key, std::string_view value, long long int timestamp) {
+	record.assign(HEADER_SIZE, '\0');
+	record.push_back((char)operation);
+	putU32(record, (uint32_t)((uint64_t)timestamp));
+	putU32(record, (uint32_t)((uint64_t)timestamp >> 32));
+	putString(record, key);
+	putString(record, value);
+}
+
+/// <summary>
+/// Function to Finish Encoding a Record by filling in it's Length and CRC32C.
+/// </summary>
+/// <param name="record">Buffer holding the Record</param>
+void WriteAheadLog::endRecord(std::string& record) {
+	uint32_t length = (uint32_t)(record.size() - HEADER_SIZE);
+	std::string header;
+	putU32(header, length);
+	putU32(header, crc32c(record.data() + HEADER_SIZE, length));
+	record.replace(0, HEADER_SIZE, header);
+}
+
+/// <summary>
+/// Function to Decode the Payload of a Record.
+/// </summary>
+/// <param name="payload">Payload whose CRC32C has been Verified</param>
+/// <param name="size">Size of the Payload</param>
+/// <param name="record">Decoded Record</param>
+/// <param name="nested">Whether the Payload is held by a BATCH Record, which can not hold another</param>
+/// <returns>False if the Payload is Malformed</returns>
+bool WriteAheadLog::decode(const char * payload, size_t size, Record& record, bool nested) {
+	const char * cursor = payload;
+	const char * end = payload + size;
+	uint32_t low, high, tags;
+	if (size < 1 || payload[0] < INSERT || payload[0] > (nested ? EXPIRE : BATCH))
+		return false;
+	record.operation = (Operation)*cursor++;
+	if (!getU32(cursor, end, low) || !getU32(cursor, end, high))
+		return false;
+	record.timestamp = (long long int)(((uint64_t)high << 32) | low);
+	if (!getString(cursor, end, record.key) || !getString(cursor, end, record.value) || !getU32(cursor, end, tags) || tags > (size_t)(end - cursor) / 4)
+		return false;
+	record.tags.resize(tags);
+	for (std::string& tag : record.tags) {
+		if (!getString(cursor, end, tag))
+			return false;
+	}
+	record.batch.resize(record.operation == BATCH ? tags : 0);
+	for (size_t index = 0; index < record.batch.size(); index++) {
+		if (!decode(record.tags[index].data(), record.tags[index].size(), record.batch[index], true))
+			return false;
+	}
+	return cursor == end;
+}
+
+/// <summary>
+/// Function to Replay the Records of one Log File up to the first Truncated or
+/// Corrupt Record.
+/// </summary>
+/// <param name="path">Log File</param>
+/// <param name="replay">Function called with every valid Record</param>
+/// <param name="valid">Set to the Size of the valid Records</param>
+/// <param name="size">Set to the Size of the File</param>
+/// <returns>True if the File Exists</returns>
+bool WriteAheadLog::replayFile(const std::string& path, const std::function<void(const Record&)>& replay, uint64_t& valid, uint64_t& size) {
+	valid = size = 0;
+	std::ifstream log(path, std::ios::binary | std::ios::ate);
+	if (!log.is_open())
+		return false;
+	size = (uint64_t)log.tellg();
+	log.seekg(0);
+	std::vector<char> payload;
+	char header[HEADER_SIZE];
+	Record record;
+	while (log.read(header, HEADER_SIZE)) {
+		const char * cursor = header;
+		uint32_t length, crc;
+		getU32(cursor, header + HEADER_SIZE, length);
+		getU32(cursor, header + HEADER_SIZE, crc);
+		if (length > MAX_RECORD)
+			break;
+		payload.resize(length);
+		if (!log.read(payload.data(), length))
+			break;
+		if (crc32c(payload.data(), length) != crc || !decode(payload.data(), length, record))
+			break;
+		if (replay)
+			replay(record);
+		valid += HEADER_SIZE + length;
+	}
+	return true;
+}
+
+/// <summary>
+/// Function to get the Path of the Rotated Log File.
+/// </summary>
+/// <returns>Log File Path followed by ".old"</returns>
+std::string WriteAheadLog::rotatedPath() const {
+	return _options.path + ".old";
+}
+
+/// <summary>
+/// Function to Replay every Record in the Log File and open it for Appending. A
+/// Rotated Log File left by an unfinished Snapshot is Replayed first. Replay
+/// stops at the first Truncated or Corrupt Record and the File is cut back to the
+/// Records before it. Must not be called while Mutations are being Logged.
+/// </summary>
+/// <param name="options">Log File and SyncMode</param>
+/// <param name="replay">Function called with every valid Record in the order they were Logged</param>
+/// <returns>True if the Log is open, False if no Path was given or the File could not be opened</returns>
+bool WriteAheadLog::open(const Options& options, std::function<void(const Record&)> replay) {
+	close();
+	_options = options;
+	if (_options.path.empty())
+		return false;
+	uint64_t valid, size;
+	replayFile(rotatedPath(), replay, valid, size);
+	bool readable = replayFile(_options.path, replay, valid, size);
+	if (!_file.open(_options.path, File::APPEND))
+		return false;
+	if (readable && valid < size && !_file.truncate(valid)) {
+		_file.close();
+		return false;
+	}
+	_appended = _durable = 0;
+	_closing = _failed = false;
+	_stats = Stats();
+	if (_options.sync == SYNC_GROUP)
+		_writer = std::thread(&WriteAheadLog::writerLoop, this);
+	return true;
+}
+
+/// <summary>
+/// Function to Finish an Encoded Record, add it to the Buffer and assign it the next
+/// LSN. Between beginBatch and endBatch the Payload is gathered instead.
+/// </summary>
+/// <param name="record">Record Encoded up to it's last Tag</param>
+/// <returns>LSN of the Record, 0 if it was gathered for a BATCH Record</returns>
+uint64_t WriteAheadLog::enqueue(std::string& record) {
+	if (pendingBatch.log == this) {
+		putString(pendingBatch.payloads, std::string_view(record).substr(HEADER_SIZE));
+		pendingBatch.count++;
+		return 0;
+	}
+	endRecord(record);
+	std::lock_guard<std::mutex> lock(_lock);
+	_pending.append(record);
+	_stats.records++;
+	_stats.bytes += record.size();
+	if (_options.sync == SYNC_GROUP)
+		_wake.notify_one();
+	return ++_appended;
+}
+
+/// <summary>
+/// Function to Log a Mutation which carries a single Value : the Tag of ADD_TAG and
+/// REMOVE_TAG, the Data of UPDATE_DATA and nothing for REMOVE and EXPIRE. Call while
+/// holding the Lock which orders Mutations of the Key.
+/// </summary>
+/// <param name="operation">Mutation</param>
+/// <param name="key">Key</param>
+/// <param name="value">Data or Tag</param>
+/// <param name="timestamp">Last Modified Timestamp after the Mutation, Expiry Deadline of EXPIRE</param>
+/// <returns>LSN to pass to commit, 0 if the Log is not open</returns>
+uint64_t WriteAheadLog::append(Operation operation, std::string_view key, std::string_view value, long long int timestamp) {
+	if (!_file.isOpen())
+		return 0;
+	thread_local std::string record;
+	beginRecord(record, operation, key, value, timestamp);
+	putU32(record, 0);
+	return enqueue(record);
+}
+
+/// <summary>
+/// Function to Log an INSERT or UPDATE along with the whole DBElement. Call while
+/// holding the Lock which orders Mutations of the Key.
+/// </summary>
+/// <param name="operation">Mutation</param>
+/// <param name="key">Key</param>
+/// <param name="element">DBElement associated with the Key after the Mutation</param>
+/// <returns>LSN to pass to commit, 0 if the Log is not open</returns>
+uint64_t WriteAheadLog::append(Operation operation, std::string_view key, const DBElement& element) {
+	if (!_file.isOpen())
+		return 0;
+	thread_local std::string record, buffer;
+	beginRecord(record, operation, key, element.getDataView(buffer), element.getlastModified());
+	putU32(record, (uint32_t)element.getTagCount());
+	element.forEachTag([](const std::string& tag) { putString(record, tag); });
+	return enqueue(record);
+}
+
+/// <summary>
+/// Function to Start gathering the Records the calling Thread Appends, so endBatch
+/// can Log them as one BATCH Record. The Thread must hold the Locks which order the
+/// Mutations of every Key it Logs till endBatch.
+/// </summary>
+void WriteAheadLog::beginBatch() {
+	if (!_file.isOpen())
+		return;
+	pendingBatch.log = this;
+	pendingBatch.payloads.clear();
+	pendingBatch.count = 0;
+}
+
+/// <summary>
+/// Function to Log the Records gathered since beginBatch as one BATCH Record.
+/// </summary>
+/// <returns>LSN to pass to commit, 0 if the Log is not open or nothing was gathered</returns>
+uint64_t WriteAheadLog::endBatch() {
+	if (pendingBatch.log != this)
+		return 0;
+	pendingBatch.log = nullptr;
+	if (pendingBatch.count == 0)
+		return 0;
+	thread_local std::string record;
+	beginRecord(record, BATCH, std::string_view(), std::string_view(), 0);
+	putU32(record, pendingBatch.count);
+	record.append(pendingBatch.payloads);
+	return enqueue(record);
+}
+
+/// <summary>
+/// Function to Write every Buffered Record to the File unless the given LSN is
+/// already Durable. Writes are serialized so Records reach the File in LSN order.
+/// </summary>
+/// <param name="lsn">LSN which must be Durable</param>
+/// <param name="sync">Whether to fsync after Writing</param>
+/// <returns>True if the LSN is Durable</returns>
+bool WriteAheadLog::flush(uint64_t lsn, bool sync) {
+	std::lock_guard<std::mutex> file(_fileLock);
+	uint64_t target;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		if (_durable >= lsn || _failed)
+			return _durable >= lsn;
+		_flushing.swap(_pending);
+		target = _appended;
+	}
+	bool written = _file.write(_flushing.data(), _flushing.size()) && (!sync || _file.sync());
+	_flushing.clear();
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		if (written)
+			_durable = target;
+		else
+			_failed = true;
+		_stats.writes++;
+		if (sync)
+			_stats.syncs++;
+	}
+	_done.notify_all();
+	return written;
+}
+
+/// <summary>
+/// Function run by the Log Writer Thread of SYNC_GROUP. Once a Record arrives it
+/// waits groupCommitMicros for more and then Writes and fsyncs all of them at once.
+/// </summary>
+void WriteAheadLog::writerLoop() {
+	std::unique_lock<std::mutex> lock(_lock);
+	while (true) {
+		_wake.wait(lock, [this]() { return _closing || (_appended > _durable && !_failed); });
+		if (_closing)
+			break;
+		lock.unlock();
+		std::this_thread::sleep_for(std::chrono::microseconds(_options.groupCommitMicros));
+		lock.lock();
+		uint64_t lsn = _appended;
+		lock.unlock();
+		flush(lsn, true);
+		lock.lock();
+	}
+}
+
+/// <summary>
+/// Function to Wait till the Record with the given LSN is Durable according to the
+/// SyncMode. Call after Releasing the Lock held during append so concurrent Writers
+/// can share one fsync.
+/// </summary>
+/// <param name="lsn">LSN returned by append</param>
+/// <returns>True if the Record is Durable or nothing was Logged, False if Writing the Log failed</returns>
+bool WriteAheadLog::commit(uint64_t lsn) {
+	if (lsn == 0)
+		return true;
+	if (_options.sync != SYNC_GROUP)
+		return flush(lsn, _options.sync == SYNC_EACH);
+	std::unique_lock<std::mutex> lock(_lock);
+	_done.wait(lock, [this, lsn]() { return _durable >= lsn || _failed; });
+	return _durable >= lsn;
+}
+
+/// <summary>
+/// Function to Write the remaining Records, stop the Log Writer Thread and close
+/// the File. Must not be called while Mutations are being Logged.
+/// </summary>
+void WriteAheadLog::close() {
+	if (!_file.isOpen())
+		return;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_closing = true;
+	}
+	_wake.notify_all();
+	if (_writer.joinable())
+		_writer.join();
+	uint64_t lsn;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		lsn = _appended;
+	}
+	flush(lsn, _options.sync != SYNC_OS);
+	_file.close();
+	_done.notify_all();
+}
+
+/// <summary>
+/// Function to Discard every Record once the Mutations they describe are Durable
+/// elsewhere (in a Snapshot). Buffered Records are Written first so Committers
+/// waiting for them return, then the File is Emptied. Must not be called while
+/// Mutations are being Logged.
+/// </summary>
+/// <returns>True if the Log is open and was Emptied</returns>
+bool WriteAheadLog::reset() {
+	if (!_file.isOpen())
+		return false;
+	uint64_t lsn;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		lsn = _appended;
+	}
+	flush(lsn, _options.sync != SYNC_OS);
+	std::lock_guard<std::mutex> file(_fileLock);
+	if (!_file.truncate(0) || !_file.sync()) {
+		std::lock_guard<std::mutex> lock(_lock);
+		_failed = true;
+		return false;
+	}
+	dropRotated();
+	return true;
+}
+
+/// <summary>
+/// Function to Start a new Log File and keep the Records Logged so far in the
+/// Rotated Log File, so they can be Discarded with dropRotated() once a Snapshot
+/// taken at this point is Durable. If a Rotated Log File is still there (its
+/// Snapshot failed) the Records are Appended to it instead. Must not be called
+/// while Mutations are being Logged.
+/// </summary>
+/// <returns>True if the Log was Rotated</returns>
+bool WriteAheadLog::rotate() {
+	if (!_file.isOpen())
+		return false;
+	uint64_t lsn;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		lsn = _appended;
+	}
+	if (!flush(lsn, _options.sync != SYNC_OS))
+		return false;
+	std::lock_guard<std::mutex> file(_fileLock);
+	_file.close();
+	bool moved;
+	MappedFile rotated;
+	if (rotated.map(rotatedPath())) {
+		rotated.unmap();
+		MappedFile current;
+		File target;
+		moved = target.open(rotatedPath(), File::APPEND) &&
+			(!current.map(_options.path) || target.write(current.data(), current.size())) && target.sync();
+	} else {
+		moved = File::replace(_options.path, rotatedPath());
+	}
+	if (!_file.open(_options.path, moved ? File::CREATE : File::APPEND)) {
+		std::lock_guard<std::mutex> lock(_lock);
+		_failed = true;
+		return false;
+	}
+	return moved;
+}
+
+/// <summary>
+/// Function to Delete the Rotated Log File once a Snapshot taken when the Log was
+/// Rotated is Durable.
+/// </summary>
+void WriteAheadLog::dropRotated() {
+	if (!_options.path.empty())
+		File::remove(rotatedPath());
+}
+
+/// <summary>
+/// Function to Check whether Mutations are being Logged.
+/// </summary>
+/// <returns>True if the Log File is open</returns>
+bool WriteAheadLog::isOpen() {
+	return _file.isOpen();
+}
+
+/// <summary>
+/// Function to Check whether Writing the Log File failed. Once it has failed no
+/// further Records are made Durable.
+/// </summary>
+/// <returns>True if a Write or fsync failed</returns>
+bool WriteAheadLog::failed() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _failed;
+}
+
+/// <summary>
+/// Function to get the Counters of the Log since it was opened.
+/// </summary>
+/// <returns>Stats of the Log</returns>
+WriteAheadLog::Stats WriteAheadLog::stats() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _stats;
+}
+
+#if defined(TEST_WRITEAHEADLOG) || defined(BENCH_WRITEAHEADLOG)
+
+#include <cstdio>
+#include <atomic>
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Commit Mutations from several Threads at once.
+/// </summary>
+/// <param name="log">Open WriteAheadLog</param>
+/// <param name="threads">Number of Threads</param>
+/// <param name="commits">Number of Commits per Thread</param>
+/// <returns>Number of Commits which were not Durable</returns>
+int commitConcurrently(WriteAheadLog& log, int threads, int commits) {
+	std::atomic<int> failures(0);
+	std::vector<std::thread> writers;
+	for (int id = 0; id < threads; id++) {
+		writers.push_back(std::thread([&log, &failures, id, commits]() {
+			std::string key = "thread" + std::to_string(id);
+			for (int index = 0; index < commits; index++) {
+				if (!log.commit(log.append(WriteAheadLog::UPDATE_DATA, key, "Clone " + std::to_string(index), 0)))
+					failures++;
+			}
+		}));
+	}
+	for (std::thread& writer : writers)
+		writer.join();
+	return failures;
+}
+
+#endif
+
+#ifdef TEST_WRITEAHEADLOG
+
+/// <summary>
+/// Function to Test WriteAheadLog Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+	const char * path = "WriteAheadLog.test.wal";
+	std::remove(path);
+	WriteAheadLog::Options options;
+	options.path = path;
+	std::function<void(const WriteAheadLog::Record&)> print = [&print](const WriteAheadLog::Record& record) {
+		if (record.operation == WriteAheadLog::BATCH) {
+			std::cout << "\n > Batch of " << record.batch.size() << " Records :";
+			for (const WriteAheadLog::Record& inner : record.batch)
+				print(inner);
+			return;
+		}
+		std::cout << "\n > Operation : " << (int)record.operation << ", Key : " << record.key << ", Value : " << record.value
+			<< ", Tags : " << record.tags.size() << ", Timestamp : " << record.timestamp;
+	};
+
+	StringHelper::Title("TESTING WRITEAHEADLOG PACKAGE", '=');
+	StringHelper::Title("Test crc32c Method");
+	std::cout << "\n > CRC32C of \"123456789\" : " << std::hex << WriteAheadLog::crc32c("123456789", 9) << std::dec << " (expected e3069283)" << std::endl;
+	putline();
+
+	StringHelper::Title("Test append and Replay");
+	{
+		WriteAheadLog log;
+		options.sync = WriteAheadLog::SYNC_EACH;
+		std::cout << "\n > Opened : " << log.open(options, print);
+		DBElement element("Luke Skywalker", { "Jedi", "Rebel" });
+		log.commit(log.append(WriteAheadLog::INSERT, "luke", element));
+		log.commit(log.append(WriteAheadLog::ADD_TAG, "luke", "Pilot", element.getlastModified()));
+		log.commit(log.append(WriteAheadLog::UPDATE_DATA, "luke", "Luke Skywalker, Jedi Knight", element.getlastModified()));
+		log.commit(log.append(WriteAheadLog::REMOVE, "luke", "", 0));
+		log.beginBatch();
+		std::cout << "\n > LSN while gathering a Batch : " << log.append(WriteAheadLog::INSERT, "leia", DBElement("Leia Organa", { "Rebel" }))
+			+ log.append(WriteAheadLog::ADD_TAG, "leia", "General", element.getlastModified());
+		log.commit(log.endBatch());
+	}
+	{
+		WriteAheadLog log;
+		std::cout << "\n Replaying :";
+		log.open(options, print);
+	}
+	std::cout << std::endl;
+	putline();
+
+	StringHelper::Title("Test Replay stops at a Torn Record");
+	{
+		std::ofstream torn(path, std::ios::binary | std::ios::app);
+		torn.write("\x20\x00\x00\x00\xde\xad\xbe\xef torn", 13);
+	}
+	int replayed = 0;
+	{
+		WriteAheadLog log;
+		log.open(options, [&replayed](const WriteAheadLog::Record&) { replayed++; });
+	}
+	{
+		WriteAheadLog log;
+		int again = 0;
+		log.open(options, [&again](const WriteAheadLog::Record&) { again++; });
+		std::cout << "\n > Records Replayed with Torn Tail : " << replayed << ", after Truncation : " << again << std::endl;
+	}
+	putline();
+
+	StringHelper::Title("Test rotate and dropRotated");
+	std::remove(path);
+	{
+		WriteAheadLog log;
+		options.sync = WriteAheadLog::SYNC_EACH;
+		log.open(options, nullptr);
+		log.commit(log.append(WriteAheadLog::INSERT, "han", DBElement("Han Solo")));
+		log.commit(log.append(WriteAheadLog::INSERT, "chewie", DBElement("Chewbacca")));
+		std::cout << "\n > Rotated : " << log.rotate();
+		log.commit(log.append(WriteAheadLog::REMOVE, "han", "", 0));
+	}
+	{
+		WriteAheadLog log;
+		int count = 0;
+		log.open(options, [&count](const WriteAheadLog::Record&) { count++; });
+		std::cout << "\n > Records Replayed from both Files : " << count;
+		log.dropRotated();
+	}
+	{
+		WriteAheadLog log;
+		int count = 0;
+		log.open(options, [&count](const WriteAheadLog::Record&) { count++; });
+		std::cout << "\n > Records Replayed after dropRotated : " << count << std::endl;
+	}
+	putline();
+
+	StringHelper::Title("Test Group Commit");
+	for (WriteAheadLog::SyncMode mode : { WriteAheadLog::SYNC_EACH, WriteAheadLog::SYNC_GROUP, WriteAheadLog::SYNC_OS }) {
+		std::remove(path);
+		WriteAheadLog log;
+		options.sync = mode;
+		log.open(options, nullptr);
+		int failures = commitConcurrently(log, 8, 200);
+		WriteAheadLog::Stats stats = log.stats();
+		std::cout << "\n > Mode " << mode << " : Records : " << stats.records << ", Failures : " << failures
+			<< ", fsyncs fewer than Records : " << (stats.syncs < stats.records);
+		log.close();
+		int count = 0;
+		log.open(options, [&count](const WriteAheadLog::Record&) { count++; });
+		std::cout << ", Replayed : " << count;
+	}
+	std::cout << std::endl;
+	std::remove(path);
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_WRITEAHEADLOG
+
+#ifdef BENCH_WRITEAHEADLOG
+
+/// <summary>
+/// Function to Benchmark Commit Throughput of every SyncMode with an increasing
+/// Number of Committing Threads.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments : [commits per thread] [log path]</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	int commits = argc > 1 ? std::stoi(argv[1]) : 500;
+	std::string path = argc > 2 ? argv[2] : "WriteAheadLog.bench.wal";
+	const char * names[] = { "SYNC_EACH ", "SYNC_GROUP", "SYNC_OS   " };
+
+	StringHelper::Title("BENCHMARKING WRITEAHEADLOG COMMIT THROUGHPUT", '=');
+	for (WriteAheadLog::SyncMode mode : { WriteAheadLog::SYNC_EACH, WriteAheadLog::SYNC_GROUP, WriteAheadLog::SYNC_OS }) {
+		for (int threads : { 1, 4, 16 }) {
+			std::remove(path.c_str());
+			WriteAheadLog log;
+			WriteAheadLog::Options options;
+			options.path = path;
+			options.sync = mode;
+			log.open(options, nullptr);
+			auto start = std::chrono::steady_clock::now();
+			commitConcurrently(log, threads, commits);
+			double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			WriteAheadLog::Stats stats = log.stats();
+			std::cout << "\n " << names[mode] << "\t Threads : " << threads << "\t Commits/s : " << (size_t)(stats.records / elapsed)
+				<< "\t Records per fsync : " << (stats.syncs == 0 ? 0.0 : (double)stats.records / stats.syncs);
+		}
+	}
+	std::remove(path.c_str());
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // BENCH_WRITEAHEADLOG
@@ -0,0 +1,248 @@
+//////////////////////////////////////////////////////////////////
+// WriteAheadLog.h  - Append-Only Binary Log of DBEngine        //
+//                    Mutations with Group Commit.              //
+// Version          - 1.4                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides WriteAheadLog class which records every Mutation of a
+ * DBEngine (insert, update, remove, addTag, removeTag, updateData, setExpiry) in an Append-Only
+ * Binary File, so the Database can be Rebuilt by Replaying the Log when the Process
+ * is Restarted.
+ *
+ * Every Record is Framed as :
+ *   [u32 Payload Length][u32 CRC32C of Payload][Payload]
+ * and the Payload is :
+ *   [u8 Operation][i64 Timestamp][Key][Value][u32 Tag Count][Tag]...
+ * where Key, Value and every Tag are [u32 Length][Bytes]. Integers are stored
+ * Little Endian. Replay stops at the first Record which is Truncated or fails it's
+ * CRC32C check (a Write torn by a Crash) and cuts the File back to the last good
+ * Record so new Records are Appended after valid data.
+ *
+ * Mutations are Logged in two steps. append() encodes the Record and adds it to an
+ * in-memory Buffer, it is called while the DBEngine Shard's Writer Lock is held so
+ * Records of a Key are Logged in the order they are Applied, and returns the Log
+ * Sequence Number (LSN) of the Record. commit() is then called after the Lock is
+ * Released and returns once the Record is Durable according to the SyncMode :
+ *
+ *   SYNC_EACH  : The Committing Thread Writes the Buffer and fsyncs it itself.
+ *   SYNC_GROUP : A dedicated Log Writer Thread collects Records for up to
+ *                groupCommitMicros after the first one arrives and then Writes and
+ *                fsyncs all of them at once. Concurrent Committers wait for that
+ *                single fsync instead of issuing one each.
+ *   SYNC_OS    : The Committing Thread Writes the Buffer but never fsyncs, the OS
+ *                decides when the data reaches the Disk. Survives a Process Crash
+ *                but not a Power Loss.
+ *
+ * rotate() moves the Records Logged so far to a Rotated Log File ("<path>.old") and
+ * starts an empty Log, so a background Snapshot can capture the Database at that
+ * point while new Mutations keep being Logged. dropRotated() deletes the Rotated
+ * Log once the Snapshot is Durable, until then open() Replays it before the Log.
+ *
+ * A Thread which holds the Locks of several Keys can Log it's Mutations of them as
+ * one BATCH Record : between beginBatch() and endBatch() append() gathers the
+ * Records of the calling Thread instead of Logging them, and endBatch() Logs them
+ * as the Tags of a BATCH Record, each the Payload of one Record. The BATCH Record
+ * is Replayed as the Records it holds, in order, and since it has one CRC32C a
+ * Crash Replays all of them or none.
+ *
+ * CRC32C uses the SSE4.2 crc32 instruction when the Compiler targets it and a
+ * Lookup Table otherwise.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - bool open(const Options& options, std::function<void(const Record&)> replay)
+ * Method to Replay the Records in the Log File and open it for Appending.
+ *
+ * - uint64_t append(Operation operation, std::string_view key, std::string_view value, long long int timestamp)
+ * Method to Log a Mutation carrying a single Value (Data or Tag). Returns the LSN of the Record.
+ *
+ * - uint64_t append(Operation operation, std::string_view key, const DBElement& element)
+ * Method to Log a Mutation carrying a whole DBElement. Returns the LSN of the Record.
+ *
+ * - void beginBatch()
+ * Method to gather the Records the calling Thread Appends till endBatch() instead of Logging them.
+ *
+ * - uint64_t endBatch()
+ * Method to Log the gathered Records as one BATCH Record. Returns the LSN of the Record.
+ *
+ * - bool commit(uint64_t lsn)
+ * Method to Wait till the Record with the given LSN is Durable.
+ *
+ * - void close()
+ * Method to Write the remaining Records, stop the Log Writer Thread and close the File.
+ *
+ * - bool reset()
+ * Method to Discard every Record once the Mutations are Durable in a Snapshot.
+ *
+ * - bool rotate()
+ * Method to Start a new Log File, keeping the Records Logged so far in the Rotated Log File.
+ *
+ * - void dropRotated()
+ * Method to Delete the Rotated Log File once a Snapshot covering it is Durable.
+ *
+ * - bool isOpen()
+ * Method to Check whether Mutations are being Logged.
+ *
+ * - bool failed()
+ * Method to Check whether Writing the Log File failed.
+ *
+ * - Stats stats()
+ * Method to get the Number of Records, Bytes, Writes and fsyncs of the Log.
+ *
+ * - static uint32_t crc32c(const void * data, size_t size, uint32_t crc = 0)
+ * Method to Compute (or Extend) the CRC32C of a Block of Bytes.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * DBElement.h, DBElement.cpp, TagDictionary.h, TagDictionary.cpp, FileSystem.h,
+ * FileSystem.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - File operations moved to the FileSystem package.
+ * - Added reset() to Empty the Log after a Snapshot.
+ *
+ * ver 1.2 : 10/17/2026
+ * - Added rotate() and dropRotated() for Snapshots taken in the background, the
+ *   Rotated Log File is Replayed before the Log.
+ *
+ * ver 1.3 : 10/17/2026
+ * - Added the EXPIRE Operation, whose Timestamp is the Expiry Deadline of the Key.
+ *
+ * ver 1.4 : 10/17/2026
+ * - Added the BATCH Operation and beginBatch() / endBatch() to Log the Mutations
+ *   of several Keys as one Record.
+ *
+ */
+#ifndef WRITEAHEADLOG_H
+#define WRITEAHEADLOG_H
+
+#include "FileSystem.h"
+#include "../DBElement/DBElement.h"
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <condition_variable>
+
+/// <summary>
+/// Append-Only Log of DBEngine Mutations.
+/// </summary>
+class WriteAheadLog {
+public:
+	/// <summary>
+	/// When Committed Records are made Durable.
+	/// </summary>
+	enum SyncMode { SYNC_EACH, SYNC_GROUP, SYNC_OS };
+
+	/// <summary>
+	/// Mutation recorded by a Record.
+	/// </summary>
+	enum Operation : uint8_t { INSERT = 1, UPDATE, REMOVE, ADD_TAG, REMOVE_TAG, UPDATE_DATA, EXPIRE, BATCH };
+
+	/// <summary>
+	/// Options used to open the Log.
+	/// </summary>
+	struct Options {
+		std::string path;									// Log File, empty to not Log at all
+		SyncMode sync = SYNC_GROUP;							// When Committed Records are made Durable
+		unsigned groupCommitMicros = 200;					// Time SYNC_GROUP waits for more Records before fsyncing
+	};
+
+	/// <summary>
+	/// Decoded Record passed to the Replay Function.
+	/// </summary>
+	struct Record {
+		Operation operation;
+		long long int timestamp;							// Last Modified Timestamp after the Mutation, Expiry Deadline of EXPIRE
+		std::string key;
+		std::string value;									// Data of INSERT, UPDATE and UPDATE_DATA, Tag of ADD_TAG and REMOVE_TAG
+		std::vector<std::string> tags;						// Tags of INSERT and UPDATE, Payloads of BATCH
+		std::vector<Record> batch;							// Records of BATCH, in the order they were Appended
+	};
+
+	/// <summary>
+	/// Counters of the Log since it was opened.
+	/// </summary>
+	struct Stats {
+		uint64_t records = 0;								// Records Appended
+		uint64_t bytes = 0;									// Bytes Appended
+		uint64_t writes = 0;								// Writes issued to the File
+		uint64_t syncs = 0;									// fsyncs issued to the File
+	};
+private:
+	static const uint32_t HEADER_SIZE = 8;
+	static const uint32_t MAX_RECORD = 1u << 30;
+
+	Options _options;
+	File _file;												// Log File, not open if nothing is Logged
+	std::mutex _lock;										// Lock guarding the Buffer, LSNs and Stats
+	std::condition_variable _wake;							// Signals the Log Writer Thread that Records are waiting
+	std::condition_variable _done;							// Signals Committers that the Durable LSN advanced
+	std::string _pending;									// Records Appended but not Written yet
+	uint64_t _appended;										// LSN of the last Appended Record
+	uint64_t _durable;										// LSN of the last Durable Record
+	bool _closing;
+	bool _failed;
+	std::mutex _fileLock;									// Lock serializing Writes to the File
+	std::string _flushing;									// Records being Written, guarded by _fileLock
+	std::thread _writer;									// Log Writer Thread of SYNC_GROUP
+	Stats _stats;
+
+	uint64_t enqueue(std::string& record);
+	bool flush(uint64_t lsn, bool sync);
+	void writerLoop();
+	static void beginRecord(std::string& record, Operation operation, std::string_view key, std::string_view value, long long int timestamp);
+	static void endRecord(std::string& record);
+	static void putU32(std::string& out, uint32_t value);
+	static void putString(std::string& out, std::string_view value);
+	static bool getU32(const char *& cursor, const char * end, uint32_t& value);
+	static bool getString(const char *& cursor, const char * end, std::string& value);
+	static bool decode(const char * payload, size_t size, Record& record, bool nested = false);
+	static bool replayFile(const std::string& path, const std::function<void(const Record&)>& replay, uint64_t& valid, uint64_t& size);
+	std::string rotatedPath() const;
+public:
+	/* Constructor */
+	WriteAheadLog();
+	WriteAheadLog(const WriteAheadLog&) = delete;
+	WriteAheadLog& operator=(const WriteAheadLog&) = delete;
+
+	/* Destructor */
+	~WriteAheadLog();
+
+	/* Member Functions */
+	bool open(const Options& options, std::function<void(const Record&)> replay);
+	uint64_t append(Operation operation, std::string_view key, std::string_view value, long long int timestamp);
+	uint64_t append(Operation operation, std::string_view key, const DBElement& element);
+	void beginBatch();
+	uint64_t endBatch();
+	bool commit(uint64_t lsn);
+	void close();
+	bool reset();
+	bool rotate();
+	void dropRotated();
+	bool isOpen();
+	bool failed();
+	Stats stats();
+	static uint32_t crc32c(const void * data, size_t size, uint32_t crc = 0);
+};
+
+#endif // !WRITEAHEADLOG_H
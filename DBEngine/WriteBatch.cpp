@@ -0,0 +1,207 @@
+//////////////////////////////////////////////////////////////////
+// WriteBatch.cpp   - Ordered Group of DBEngine Writes          //
+//                    Applied All-or-Nothing.                   //
+// Version          - 1.2                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+#include "WriteBatch.h"
+
+/// <summary>
+/// Function to add a Write to the end of the Batch.
+/// </summary>
+/// <param name="operation">Write Ahead Log Operation of the Write</param>
+/// <param name="key">Key</param>
+/// <param name="value">Tag or Data</param>
+void WriteBatch::add(WriteAheadLog::Operation operation, std::string_view key, std::string_view value) {
+	_writes.push_back({ operation, std::string(key), std::string(value), std::nullopt, false, 0 });
+}
+
+/// <summary>
+/// Function to add the Insert of a Copy of a DBElement.
+/// </summary>
+/// <param name="key">Key, must not Exist</param>
+/// <param name="value">DBElement to be Inserted</param>
+void WriteBatch::insert(std::string_view key, const DBElement& value) {
+	add(WriteAheadLog::INSERT, key, std::string_view());
+	_writes.back().element.emplace(value);
+}
+
+/// <summary>
+/// Function to add the Insert of a DBElement by Moving it into the Batch.
+/// </summary>
+/// <param name="key">Key, must not Exist</param>
+/// <param name="value">DBElement to be Inserted, left without Data and Tags</param>
+void WriteBatch::insert(std::string_view key, DBElement&& value) {
+	add(WriteAheadLog::INSERT, key, std::string_view());
+	_writes.back().element.emplace(std::move(value));
+}
+
+/// <summary>
+/// Function to add the Update of a Key with a Copy of a DBElement.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+/// <param name="value">New DBElement of the Key</param>
+void WriteBatch::update(std::string_view key, const DBElement& value) {
+	add(WriteAheadLog::UPDATE, key, std::string_view());
+	_writes.back().element.emplace(value);
+}
+
+/// <summary>
+/// Function to add the Update of a Key by Moving a DBElement into the Batch.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+/// <param name="value">New DBElement of the Key, left without Data and Tags</param>
+void WriteBatch::update(std::string_view key, DBElement&& value) {
+	add(WriteAheadLog::UPDATE, key, std::string_view());
+	_writes.back().element.emplace(std::move(value));
+}
+
+/// <summary>
+/// Function to add the Insert of a Copy of a DBElement, which Updates the Key
+/// instead if it Exists by the time the Write is Applied.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement of the Key</param>
+void WriteBatch::put(std::string_view key, const DBElement& value) {
+	insert(key, value);
+	_writes.back().put = true;
+}
+
+/// <summary>
+/// Function to add the Insert of a DBElement by Moving it into the Batch, which
+/// Updates the Key instead if it Exists by the time the Write is Applied.
+/// </summary>
+/// <param name="key">Key</param>
+/// <param name="value">DBElement of the Key, left without Data and Tags</param>
+void WriteBatch::put(std::string_view key, DBElement&& value) {
+	insert(key, std::move(value));
+	_writes.back().put = true;
+}
+
+/// <summary>
+/// Function to add the Removal of a Key.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+void WriteBatch::remove(std::string_view key) {
+	add(WriteAheadLog::REMOVE, key, std::string_view());
+}
+
+/// <summary>
+/// Function to add a Tag to the DBElement of a Key. Adding a Tag it already has
+/// leaves the DBElement as it is.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+/// <param name="tag">Tag to be Added</param>
+void WriteBatch::addTag(std::string_view key, std::string_view tag) {
+	add(WriteAheadLog::ADD_TAG, key, tag);
+}
+
+/// <summary>
+/// Function to remove a Tag from the DBElement of a Key. Removing a Tag it does
+/// not have leaves the DBElement as it is.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+/// <param name="tag">Tag to be Removed</param>
+void WriteBatch::removeTag(std::string_view key, std::string_view tag) {
+	add(WriteAheadLog::REMOVE_TAG, key, tag);
+}
+
+/// <summary>
+/// Function to add the Update of the Data of a Key, it's Tags are kept.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+/// <param name="data">New Data</param>
+void WriteBatch::updateData(std::string_view key, std::string_view data) {
+	add(WriteAheadLog::UPDATE_DATA, key, data);
+}
+
+/// <summary>
+/// Function to add the Deadline at which a Key Expires, or to keep it forever.
+/// </summary>
+/// <param name="key">Key, must Exist</param>
+/// <param name="deadline">Milliseconds since the Unix Epoch, 0 to never Expire</param>
+void WriteBatch::setExpiry(std::string_view key, long long int deadline) {
+	add(WriteAheadLog::EXPIRE, key, std::string_view());
+	_writes.back().deadline = deadline;
+}
+
+/// <summary>
+/// Function to get the Writes of the Batch.
+/// </summary>
+/// <returns>Writes in the order they were added</returns>
+std::vector<WriteBatch::Write>& WriteBatch::writes() {
+	return _writes;
+}
+
+/// <summary>
+/// Function to get the Number of Writes in the Batch.
+/// </summary>
+/// <returns>Number of Writes</returns>
+size_t WriteBatch::size() const {
+	return _writes.size();
+}
+
+/// <summary>
+/// Function to Check whether the Batch has no Writes.
+/// </summary>
+/// <returns>True if there are no Writes</returns>
+bool WriteBatch::empty() const {
+	return _writes.empty();
+}
+
+/// <summary>
+/// Function to Remove every Write from the Batch.
+/// </summary>
+void WriteBatch::clear() {
+	_writes.clear();
+}
+
+#ifdef TEST_WRITEBATCH
+
+#include <iostream>
+
+#include "../Utilities/Utilities.h"
+
+/* Include Utilities Namespace for StringHelper Functions */
+using namespace Utilities;
+
+/// <summary>
+/// Function to Test WriteBatch Package.
+/// </summary>
+/// <param name="argc">Argument Count</param>
+/// <param name="argv">Arguments</param>
+/// <returns></returns>
+int main(int argc, char* argv[]) {
+	Timer time;
+	time.StartClock();
+
+	StringHelper::Title("TESTING WRITEBATCH PACKAGE", '=');
+	StringHelper::Title("Test adding Writes");
+	WriteBatch batch;
+	DBElement element("Dolores", { "Host" });
+	batch.insert("key0", element);
+	batch.addTag("key0", "Westworld");
+	batch.updateData("key1", "Maeve");
+	batch.update("key2", DBElement("Bernard", { "Host", "Engineer" }));
+	batch.removeTag("key2", "Engineer");
+	batch.remove("key3");
+	batch.put("key4", DBElement("Teddy"));
+	batch.setExpiry("key4", 1900000000000LL);
+	const char * names[] = { "", "INSERT", "UPDATE", "REMOVE", "ADD_TAG", "REMOVE_TAG", "UPDATE_DATA", "EXPIRE", "BATCH" };
+	for (const WriteBatch::Write& write : batch.writes())
+		std::cout << "\n > " << names[write.operation] << (write.put ? " (put)" : "") << "\t" << write.key << "\t" << (write.operation == WriteAheadLog::EXPIRE ? std::to_string(write.deadline) : write.value) << "\t" << (write.element ? write.element->getData() + " (" + std::to_string(write.element->getTagCount()) + " Tags)" : "");
+	std::cout << "\n\n Writes : " << batch.size() << ", Copied DBElement kept it's Data : " << (element.getData() == "Dolores");
+	batch.clear();
+	std::cout << "\n After clear, Empty : " << batch.empty() << std::endl;
+	putline();
+
+	std::cout << "\n [Execution Time] : " << time.StopClock() << " ms";
+	std::cout << "\n ";
+	return 0;
+}
+
+#endif // TEST_WRITEBATCH
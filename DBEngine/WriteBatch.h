@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////
+// WriteBatch.h     - Ordered Group of DBEngine Writes          //
+//                    Applied All-or-Nothing.                   //
+// Version          - 1.2                                       //
+// Last Modified    - 10/17/2026                                //
+// Language         - Visual C++, Visual Studio 2017            //
+// Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
+// Author           - Venkata Bharani Krishna Chekuri           //
+// e-mail           - bharanikrishna7@gmail.com                 //
+//////////////////////////////////////////////////////////////////
+/*
+ * INFORMATION
+ * -----------
+ * This package provides WriteBatch class which collects Writes (insert, update,
+ * put, remove, addTag, removeTag, updateData and setExpiry) for DBEngine::write to Apply
+ * together. The Writes are Applied in the order they were added, all of them or
+ * none : if one of them can not be Applied (Inserting a Key which Exists, or
+ * Updating, Tagging or Removing one which does not, counting the Writes before it
+ * in the Batch) the Database is left as it was. A put can always be Applied. The Writes of a Batch are Logged as one
+ * Record of the Write Ahead Log, so after a Crash either all of them are Replayed
+ * or none.
+ *
+ * The WriteBatch only holds the Writes, it does not Lock or look at a Database. It
+ * keeps the DBElements of insert and update by value, DBEngine::write Moves them
+ * into the Database and Clears the Batch.
+ *
+ * A WriteBatch is not Thread Safe.
+ *
+ *
+ * PACKAGE OPERATIONS
+ * ------------------
+ * - void insert(std::string_view key, const DBElement& value) / void insert(std::string_view key, DBElement&& value)
+ * Methods to add the Insert of a Key which must not Exist.
+ *
+ * - void update(std::string_view key, const DBElement& value) / void update(std::string_view key, DBElement&& value)
+ * Methods to add the Update of the DBElement of a Key which must Exist.
+ *
+ * - void put(std::string_view key, const DBElement& value) / void put(std::string_view key, DBElement&& value)
+ * Methods to add the Insert of a Key, or the Update of it's DBElement if the Key Exists.
+ *
+ * - void remove(std::string_view key)
+ * Method to add the Removal of a Key which must Exist.
+ *
+ * - void addTag(std::string_view key, std::string_view tag)
+ * Method to add a Tag to the DBElement of a Key which must Exist.
+ *
+ * - void removeTag(std::string_view key, std::string_view tag)
+ * Method to remove a Tag from the DBElement of a Key which must Exist.
+ *
+ * - void updateData(std::string_view key, std::string_view data)
+ * Method to add the Update of the Data of a Key which must Exist, keeping it's Tags.
+ *
+ * - void setExpiry(std::string_view key, long long int deadline)
+ * Method to set the Deadline of a Key which must Exist, 0 to keep it forever.
+ *
+ * - std::vector<Write>& writes()
+ * Method to get the Writes in the order they were added.
+ *
+ * - size_t size() const / bool empty() const
+ * Methods to get the Number of Writes in the Batch.
+ *
+ * - void clear()
+ * Method to Remove every Write from the Batch.
+ *
+ *
+ * REQUIRED FILES
+ * --------------
+ * DBElement.h, DBElement.cpp, WriteAheadLog.h, WriteAheadLog.cpp
+ *
+ *
+ * CHANGELOG
+ * ---------
+ * ver 1.0 : 10/17/2026
+ * - First release.
+ *
+ * ver 1.1 : 10/17/2026
+ * - Added put() which Inserts or Updates a Key, whichever it needs.
+ *
+ * ver 1.2 : 10/17/2026
+ * - Added setExpiry() so a Write and the Deadline it sets are Applied together.
+ *
+ */
+#ifndef WRITEBATCH_H
+#define WRITEBATCH_H
+
+#include "WriteAheadLog.h"
+#include "../DBElement/DBElement.h"
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <string_view>
+
+/// <summary>
+/// Writes to be Applied to a DBEngine together, in order and All-or-Nothing.
+/// </summary>
+class WriteBatch {
+public:
+	/// <summary>
+	/// One Write of the Batch. The Operations are those of the Write Ahead Log.
+	/// </summary>
+	struct Write {
+		WriteAheadLog::Operation operation;
+		std::string key;
+		std::string value;											// Tag of ADD_TAG and REMOVE_TAG, Data of UPDATE_DATA
+		std::optional<DBElement> element;							// DBElement of INSERT and UPDATE, none otherwise
+		bool put;													// INSERT which Updates the Key instead if it Exists
+		long long int deadline;										// Deadline of EXPIRE, 0 to never Expire
+	};
+private:
+	std::vector<Write> _writes;
+
+	void add(WriteAheadLog::Operation operation, std::string_view key, std::string_view value);
+public:
+	/* Member Functions */
+	void insert(std::string_view key, const DBElement& value);
+	void insert(std::string_view key, DBElement&& value);
+	void update(std::string_view key, const DBElement& value);
+	void update(std::string_view key, DBElement&& value);
+	void put(std::string_view key, const DBElement& value);
+	void put(std::string_view key, DBElement&& value);
+	void remove(std::string_view key);
+	void addTag(std::string_view key, std::string_view tag);
+	void removeTag(std::string_view key, std::string_view tag);
+	void updateData(std::string_view key, std::string_view data);
+	void setExpiry(std::string_view key, long long int deadline);
+	std::vector<Write>& writes();
+	size_t size() const;
+	bool empty() const;
+	void clear();
+};
+
+#endif // !WRITEBATCH_H
@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////
 // QueryEngine.cpp  - Perform Client Requests on DBEngine. //
-// Version          - 1.1                                  //
-// Last Modified    - 08/09/2017                           //
+// Version          - 2.1                                  //
+// Last Modified    - 10/17/2026                           //
 // Language         - Visual C++, Visual Studio 2017       //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10    //
 // Author           - Venkata Bharani Krishna Chekuri      //
@@ -9,6 +9,9 @@
 /////////////////////////////////////////////////////////////
 #include "QueryEngine.h"
 
+#include <cmath>
+#include <algorithm>
+
 using namespace QueryScanner;
 
 /// <summary>
@@ -32,6 +35,15 @@ std::unordered_map<char, std::string> QueryEngine::ParseQuery(const char* query,
 std::string QueryEngine::ProcessQuery(DBEngine * db, std::string query, bool verbose) {
 	/* Done to make sure that pop back token would not mess up the last token */
 	query.push_back(' ');
+	size_t separator = query.find(';');
+	if (separator != std::string::npos) {
+		std::string head = query.substr(0, separator) + ' ';
+		std::string type = ParseQuery(head.c_str(), verbose)['t'];
+		if (type == "BATCH")
+			return ProcessBatchQuery(db, query.substr(separator + 1), verbose);
+		if (type == "MSET")
+			return ProcessMultiSetQuery(db, query.substr(separator + 1), verbose);
+	}
 	std::unordered_map<char, std::string> arguments = ParseQuery(query.c_str(), verbose);
 	if (arguments.find('t') == arguments.end())
 		return "Invalid Query Syntax. Query Type is Undefined.";
@@ -43,6 +55,12 @@ std::string QueryEngine::ProcessQuery(DBEngine * db, std::string query, bool ver
 		return ProcessUpdateQuery(db, arguments);
 	if (arguments['t'] == "SHOW")
 		return ProcessShowQuery(db, arguments);
+	if (arguments['t'] == "MGET")
+		return ProcessMultiGetQuery(db, arguments);
+	if (arguments['t'] == "BATCH")
+		return "Invalid Query Syntax. Batch Query Requires Queries separated by ';'.";
+	if (arguments['t'] == "MSET")
+		return "Invalid Query Syntax. MSET Query Requires Keys and Values separated by ';'.";
 	return "Invalid Query Syntax. Given Query Type is Not Supported.";
 }
 
@@ -57,8 +75,12 @@ std::string QueryEngine::ProcessInsertQuery(DBEngine * db, std::unordered_map<ch
 		return "Invalid Query Syntax. Insert Query Requires both Key and Value Arguments.";
 	if (arguments.find('o') != arguments.end() || arguments.find('o') != arguments.end())
 		return "Invalid Query Syntax. Insert Query Should not contain Operation or Parameter Arguments.";
-	DBElement * value = new DBElement(arguments['v']);
-	if (db->insert(arguments['k'], value))
+	long long int deadline;
+	if (!ExpiryHelper(arguments, deadline))
+		return "Invalid Query Syntax. Expiry Argument should be a Positive Number of Seconds.";
+	DBElement element(arguments['v']);
+	element.setExpiry(deadline);
+	if (db->insert(arguments['k'], std::move(element)))
 		return "Object Successfully inserted into Database.";
 	return "An object with given key already exists in the Database.";
 }
@@ -73,8 +95,8 @@ std::string QueryEngine::ProcessDeleteQuery(DBEngine * db, std::unordered_map<ch
 	if (arguments.find('k') == arguments.end())
 		return "Invalid Query Syntax. Delete Query Required Key Argument.";
 	if (arguments.find('v') != arguments.end() || arguments.find('o') != arguments.end()
-		|| arguments.find('p') != arguments.end())
-		return "Invalid Query Syntax. Delete Query Should not contain Value or Operation or Parameter Arguments.";
+		|| arguments.find('p') != arguments.end() || arguments.find('x') != arguments.end())
+		return "Invalid Query Syntax. Delete Query Should not contain Value or Operation or Parameter or Expiry Arguments.";
 	if (db->remove(arguments['k']))
 		return "Object with key successfully removed from the Database.";
 	return "No Object with given key exists in the Database.";
@@ -116,34 +138,294 @@ int QueryEngine::QueryHelper(std::unordered_map<char, std::string>& arguments) {
 }
 
 /// <summary>
-/// Static Function to Perform Update Type Queries on DBEngine.
+/// Helper Function to turn the Expiry Argument (Seconds from now) of INSERT and UPDATE
+/// Queries into a Deadline.
+/// </summary>
+/// <param name="arguments">List of Parameters extracted from Query</param>
+/// <param name="deadline">Milliseconds since the Unix Epoch, 0 if there is no Expiry Argument</param>
+/// <returns>False if the Expiry Argument is not a Positive Number</returns>
+bool QueryEngine::ExpiryHelper(std::unordered_map<char, std::string>& arguments, long long int& deadline) {
+	deadline = 0;
+	auto expiry = arguments.find('x');
+	if (expiry == arguments.end())
+		return true;
+	double seconds;
+	size_t parsed = 0;
+	try {
+		seconds = std::stod(expiry->second, &parsed);
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+	/* Ten Years at most, so the Deadline can not Overflow */
+	if (parsed != expiry->second.size() || !(seconds > 0) || seconds > 315360000)
+		return false;
+	deadline = TimingWheel::now() + (long long int)std::ceil(seconds * 1000);
+	return true;
+}
+
+/// <summary>
+/// Helper Function to turn the Timestamp or Count Argument of Show Queries into a Number.
+/// </summary>
+/// <param name="text">Argument, only Digits</param>
+/// <param name="number">Parsed Number</param>
+/// <returns>False if the Argument is empty, not only Digits or longer than a Timestamp</returns>
+bool QueryEngine::NumberHelper(const std::string& text, long long int& number) {
+	if (text.empty() || text.size() > 14)
+		return false;
+	number = 0;
+	for (char digit : text) {
+		if (digit < '0' || digit > '9')
+			return false;
+		number = number * 10 + (digit - '0');
+	}
+	return true;
+}
+
+/// <summary>
+/// Helper Function to turn the last Key of a Page into the Cursor of Paged Show Queries,
+/// the Key in Hexadecimal so it always Parses as one Argument.
+/// </summary>
+/// <param name="key">Last Key of the Page, empty if there is no next Page</param>
+/// <returns>Cursor, "0" if there is no next Page</returns>
+std::string QueryEngine::CursorHelper(const std::string& key) {
+	if (key.empty())
+		return "0";
+	static const char digits[] = "0123456789abcdef";
+	std::string cursor;
+	cursor.reserve(key.size() * 2);
+	for (unsigned char byte : key) {
+		cursor.push_back(digits[byte >> 4]);
+		cursor.push_back(digits[byte & 15]);
+	}
+	return cursor;
+}
+
+/// <summary>
+/// Helper Function to turn the Cursor Argument of Paged Show Queries back into the
+/// last Key of the previous Page.
+/// </summary>
+/// <param name="cursor">Cursor Argument, "0" for the first Page</param>
+/// <param name="key">Last Key of the previous Page, empty for the first Page</param>
+/// <returns>False if the Cursor is not "0" or a Hexadecimal Key</returns>
+bool QueryEngine::CursorHelper(const std::string& cursor, std::string& key) {
+	key.clear();
+	if (cursor == "0")
+		return true;
+	if (cursor.empty() || cursor.size() % 2 != 0)
+		return false;
+	auto value = [](char digit) {
+		if (digit >= '0' && digit <= '9')
+			return digit - '0';
+		if (digit >= 'a' && digit <= 'f')
+			return digit - 'a' + 10;
+		if (digit >= 'A' && digit <= 'F')
+			return digit - 'A' + 10;
+		return -1;
+	};
+	for (size_t index = 0; index < cursor.size(); index += 2) {
+		int high = value(cursor[index]), low = value(cursor[index + 1]);
+		if (high < 0 || low < 0)
+			return false;
+		key.push_back((char)(high * 16 + low));
+	}
+	return true;
+}
+
+/// <summary>
+/// Static Function to Perform Update Type Queries on DBEngine. An Update which also
+/// sets an Expiry is Applied as one WriteBatch, so the Key can not Expire or be
+/// Removed between the Update and it's Deadline.
 /// </summary>
 /// <param name="db">DBEngine on which Query will be performed</param>
 /// <param name="arguments">List of Parameters extracted from Query</param>
 /// <returns>String describing the Status of Executed Query</returns>
 std::string QueryEngine::ProcessUpdateQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments) {
 	int querySubType = QueryHelper(arguments);
+	long long int deadline;
+	if (!ExpiryHelper(arguments, deadline))
+		return "Invalid Query Syntax. Expiry Argument should be a Positive Number of Seconds.";
+	auto apply = [db, &arguments, deadline](WriteBatch& batch) {
+		if (deadline != 0)
+			batch.setExpiry(arguments['k'], deadline);
+		return db->write(batch);
+	};
+	WriteBatch batch;
 	if (querySubType == 1) {
-		if (db->updateData(arguments['k'], arguments['v']))
+		batch.updateData(arguments['k'], arguments['v']);
+		if (apply(batch))
 			return "Successfully updated the value associated with the given key.";
 		return "No Object with given key exists in the Database.";
 	}
 	if (querySubType == 2) {
 		if (arguments['o'] == "AddTag") {
-			if (db->addTag(arguments['k'], arguments['p']))
+			batch.addTag(arguments['k'], arguments['p']);
+			if (apply(batch))
 				return "Successfully Added Tag to Object with given Key in Database.";
 			return "No Object with given key exists in the Database.";
 		}
 		if (arguments['o'] == "RemoveTag") {
-			if (db->removeTag(arguments['k'], arguments['p']))
+			batch.removeTag(arguments['k'], arguments['p']);
+			if (apply(batch))
 				return "Successfully Removed Tag from Object with given Key in Database.";
 			return "No Object with given key exists in the Database.";
 		}
 		return "Invalid Query Syntax. Invalid Operation Argument.";
 	}
+	/* Set Expiry of Object with given Key */
+	if (querySubType == 3 && deadline != 0) {
+		if (db->setExpiry(arguments['k'], deadline))
+			return "Successfully set the Expiry of Object with given Key in Database.";
+		return "No Object with given key exists in the Database.";
+	}
 	return "Invalid Query Syntax.";
 }
 
+/// <summary>
+/// Helper Function to add the Write of an INSERT, DELETE or UPDATE Query to a Batch.
+/// </summary>
+/// <param name="batch">WriteBatch receiving the Write</param>
+/// <param name="arguments">List of Parameters extracted from Query</param>
+/// <returns>Empty String if the Write was added, else what is wrong with the Query</returns>
+std::string QueryEngine::BatchHelper(WriteBatch& batch, std::unordered_map<char, std::string>& arguments) {
+	auto type = arguments.find('t');
+	if (type == arguments.end() || arguments.find('k') == arguments.end())
+		return "Query Type and Key Arguments are Required.";
+	if (type->second == "INSERT") {
+		long long int deadline;
+		if (arguments.find('v') == arguments.end() || arguments.find('o') != arguments.end() || arguments.find('p') != arguments.end())
+			return "Insert Query Requires a Value and no Operation or Parameter Arguments.";
+		if (!ExpiryHelper(arguments, deadline))
+			return "Expiry Argument should be a Positive Number of Seconds.";
+		DBElement element(arguments['v']);
+		element.setExpiry(deadline);
+		batch.insert(arguments['k'], std::move(element));
+		return "";
+	}
+	if (type->second == "DELETE") {
+		if (arguments.size() != 2)
+			return "Delete Query Should only contain the Key Argument.";
+		batch.remove(arguments['k']);
+		return "";
+	}
+	if (type->second != "UPDATE")
+		return "Only INSERT, DELETE and UPDATE Queries can be Batched.";
+	long long int deadline;
+	if (!ExpiryHelper(arguments, deadline))
+		return "Expiry Argument should be a Positive Number of Seconds.";
+	int querySubType = QueryHelper(arguments);
+	if (querySubType == 1)
+		batch.updateData(arguments['k'], arguments['v']);
+	else if (querySubType == 2 && arguments['o'] == "AddTag")
+		batch.addTag(arguments['k'], arguments['p']);
+	else if (querySubType == 2 && arguments['o'] == "RemoveTag")
+		batch.removeTag(arguments['k'], arguments['p']);
+	else if (querySubType != 3 || deadline == 0)
+		return "Invalid Update Query.";
+	/* An Update of the Expiry alone is only it's Deadline */
+	if (deadline != 0)
+		batch.setExpiry(arguments['k'], deadline);
+	return "";
+}
+
+/// <summary>
+/// Static Function to Perform Batch Type Queries on DBEngine. Every Query of the
+/// Batch is Parsed before the DBEngine is touched, then all of them are Applied as
+/// one WriteBatch.
+/// </summary>
+/// <param name="db">DBEngine on which Query will be performed</param>
+/// <param name="queries">Queries following "-t BATCH", separated by ';'</param>
+/// <param name="verbose">Enable or Disable Verbose Mode (Debugging)</param>
+/// <returns>String describing the Status of Executed Query</returns>
+std::string QueryEngine::ProcessBatchQuery(DBEngine * db, const std::string& queries, bool verbose) {
+	WriteBatch batch;
+	for (const std::string& query : SplitHelper(queries)) {
+		std::unordered_map<char, std::string> arguments = ParseQuery(query.c_str(), verbose);
+		std::string error = BatchHelper(batch, arguments);
+		if (!error.empty())
+			return "Invalid Query Syntax in Query " + std::to_string(batch.size() + 1) + " of Batch. " + error;
+	}
+	if (batch.empty())
+		return "Invalid Query Syntax. Batch Query contains no Queries.";
+	size_t count = batch.size();
+	if (db->write(batch))
+		return "Batch of " + std::to_string(count) + " Queries Successfully Applied to Database.";
+	return "Batch Rejected, none of it's Queries was Applied. A Key it Inserts already exists or a Key it Updates or Deletes does not.";
+}
+
+/// <summary>
+/// Helper Function to Split the Queries of BATCH and MSET Queries at ';'.
+/// </summary>
+/// <param name="queries">Queries separated by ';'</param>
+/// <returns>Queries which are not Blank, each followed by a Space for the Parser</returns>
+std::vector<std::string> QueryEngine::SplitHelper(const std::string& queries) {
+	std::vector<std::string> split;
+	size_t start = 0;
+	while (start < queries.size()) {
+		size_t end = std::min(queries.find(';', start), queries.size());
+		std::string query = queries.substr(start, end - start);
+		start = end + 1;
+		if (query.find_first_not_of(" \t\r\n") == std::string::npos)
+			continue;
+		query.push_back(' ');
+		split.push_back(std::move(query));
+	}
+	return split;
+}
+
+/// <summary>
+/// Static Function to Perform MGET Queries on DBEngine, which Show the Objects of
+/// many Keys.
+/// </summary>
+/// <param name="db">DBEngine on which Query will be performed</param>
+/// <param name="arguments">List of Parameters extracted from Query</param>
+/// <returns>Objects of the Keys in the order given, in Nicely Formatted Manner</returns>
+std::string QueryEngine::ProcessMultiGetQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments) {
+	if (arguments.find('k') == arguments.end() || arguments.size() != 2)
+		return "Invalid Query Syntax. MGET Query Requires Key Arguments only.";
+	std::vector<std::string> keys;
+	const std::string& list = arguments['k'];
+	size_t start = list.find_first_not_of(" \t");
+	while (start != std::string::npos) {
+		size_t end = std::min(list.find_first_of(" \t", start), list.size());
+		keys.push_back(list.substr(start, end - start));
+		start = list.find_first_not_of(" \t", end);
+	}
+	return db->getData(keys);
+}
+
+/// <summary>
+/// Static Function to Perform MSET Queries on DBEngine. Every Key and Value is
+/// Parsed before the DBEngine is touched, then all of them are Written as one
+/// WriteBatch of puts.
+/// </summary>
+/// <param name="db">DBEngine on which Query will be performed</param>
+/// <param name="queries">Keys and Values following "-t MSET", separated by ';'</param>
+/// <param name="verbose">Enable or Disable Verbose Mode (Debugging)</param>
+/// <returns>String describing the Status of Executed Query</returns>
+std::string QueryEngine::ProcessMultiSetQuery(DBEngine * db, const std::string& queries, bool verbose) {
+	WriteBatch batch;
+	for (const std::string& query : SplitHelper(queries)) {
+		std::unordered_map<char, std::string> arguments = ParseQuery(query.c_str(), verbose);
+		std::string position = std::to_string(batch.size() + 1);
+		long long int deadline;
+		if (arguments.find('k') == arguments.end() || arguments.find('v') == arguments.end()
+			|| arguments.size() != (arguments.find('x') == arguments.end() ? 2 : 3))
+			return "Invalid Query Syntax in Part " + position + " of MSET. Key and Value Arguments are Required, only Expiry may be added.";
+		if (!ExpiryHelper(arguments, deadline))
+			return "Invalid Query Syntax in Part " + position + " of MSET. Expiry Argument should be a Positive Number of Seconds.";
+		DBElement element(arguments['v']);
+		element.setExpiry(deadline);
+		batch.put(arguments['k'], std::move(element));
+	}
+	if (batch.empty())
+		return "Invalid Query Syntax. MSET Query contains no Keys.";
+	size_t count = batch.size();
+	if (db->write(batch))
+		return std::to_string(count) + " Objects Successfully set in Database.";
+	return std::to_string(count) + " Objects set in Database, but they could not be Logged.";
+}
+
 /// <summary>
 /// Static Function to Perform Show Type Queries on DBEngine.
 /// </summary>
@@ -151,14 +433,51 @@ std::string QueryEngine::ProcessUpdateQuery(DBEngine * db, std::unordered_map<ch
 /// <param name="arguments">List of Parameters extracted from Query</param>
 /// <returns>String describing the Status of Executed Query</returns>
 std::string QueryEngine::ProcessShowQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments) {
+	if (arguments.find('l') != arguments.end() || arguments.find('c') != arguments.end())
+		return ProcessPagedShowQuery(db, arguments);
 	int querySubType = QueryHelper(arguments);
 	if (querySubType == 3) {
 		return db->getData(arguments['k']);
 	}
 	if (querySubType == 4) {
-		if (arguments['o'] != "ByTag")
-			return "Invalid Query Syntax. Operation Not Defined for Show Query.";
-		return db->showUsingTag(arguments['p']);
+		if (arguments['o'] == "ByTag")
+			return db->showUsingTag(arguments['p']);
+		if (arguments['o'] == "ByTags")
+			return db->showUsingTags(arguments['p']);
+		if (arguments['o'] == "ByTagPrefix")
+			return db->showUsingTagPrefix(arguments['p']);
+		if (arguments['o'] == "ByTagGlob")
+			return db->showUsingTagGlob(arguments['p']);
+		if (arguments['o'] == "ByPrefix")
+			return db->showByPrefix(arguments['p']);
+		if (arguments['o'] == "ByRange") {
+			size_t separator = arguments['p'].find("..");
+			if (separator == std::string::npos)
+				return "Invalid Query Syntax. Range must be of the form <from>..<to>.";
+			return db->showByRange(arguments['p'].substr(0, separator), arguments['p'].substr(separator + 2));
+		}
+		if (arguments['o'] == "ModifiedSince") {
+			long long int since;
+			if (!NumberHelper(arguments['p'], since))
+				return "Invalid Query Syntax. Timestamp must be of the form YYYYmmDDHHMMSS.";
+			return db->showModifiedSince(since);
+		}
+		if (arguments['o'] == "ModifiedBetween") {
+			size_t separator = arguments['p'].find("..");
+			long long int from, to;
+			if (separator == std::string::npos || !NumberHelper(arguments['p'].substr(0, separator), from) || !NumberHelper(arguments['p'].substr(separator + 2), to))
+				return "Invalid Query Syntax. Range must be of the form <YYYYmmDDHHMMSS>..<YYYYmmDDHHMMSS>.";
+			return db->showModifiedBetween(from, to);
+		}
+		if (arguments['o'] == "Recent" || arguments['o'] == "RecentByTag") {
+			bool tagged = arguments['o'] == "RecentByTag";
+			size_t separator = tagged ? arguments['p'].find(':') : arguments['p'].size();
+			long long int count;
+			if (separator == std::string::npos || !NumberHelper(arguments['p'].substr(0, separator), count))
+				return tagged ? "Invalid Query Syntax. Parameter must be of the form <count>:<tag>." : "Invalid Query Syntax. Parameter must be a Count.";
+			return db->showRecentlyModified((size_t)count, tagged ? std::string_view(arguments['p']).substr(separator + 1) : std::string_view());
+		}
+		return "Invalid Query Syntax. Operation Not Defined for Show Query.";
 	}
 	if (querySubType == 5) {
 		return db->show();
@@ -166,6 +485,33 @@ std::string QueryEngine::ProcessShowQuery(DBEngine * db, std::unordered_map<char
 	return "Invalid Query Syntax.";
 }
 
+/// <summary>
+/// Static Function to Perform Show Type Queries with a Limit and a Cursor on DBEngine,
+/// which Show one Page of the Objects and the Cursor of the next Page.
+/// </summary>
+/// <param name="db">DBEngine on which Query will be performed</param>
+/// <param name="arguments">List of Parameters extracted from Query</param>
+/// <returns>Objects of the Page in Nicely Formatted Manner followed by the Cursor of the next Page</returns>
+std::string QueryEngine::ProcessPagedShowQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments) {
+	long long int limit;
+	if (arguments.find('l') == arguments.end() || !NumberHelper(arguments['l'], limit) || limit == 0)
+		return "Invalid Query Syntax. Paged Show Query Requires a Positive Limit Argument.";
+	std::string cursor;
+	if (arguments.find('c') != arguments.end() && !CursorHelper(arguments['c'], cursor))
+		return "Invalid Query Syntax. Cursor must be one returned by a Paged Show Query.";
+	std::string next, shown;
+	int querySubType = QueryHelper(arguments);
+	if (querySubType == 5)
+		shown = db->showPage(cursor, (size_t)limit, next);
+	else if (querySubType == 4 && arguments['o'] == "ByTag")
+		shown = db->showUsingTagPage(arguments['p'], cursor, (size_t)limit, next);
+	else if (querySubType == 4 && arguments['o'] == "ByPrefix")
+		shown = db->showPage(cursor, (size_t)limit, next, arguments['p']);
+	else
+		return "Invalid Query Syntax. Only Show All, ByTag and ByPrefix Queries can be Paged.";
+	return shown + " Next Cursor : " + CursorHelper(next);
+}
+
 
 #ifdef TEST_QUERYENGINE
 
@@ -196,6 +542,53 @@ void TestShowQueries(DBEngine * db)
 	query = "-t SHOW -o ByTag -p Machine";
 	std::cout << "\n Query : \"" << query << "\"";
 	std::cout << "\n - List of Objects with Matching Tag\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+
+	StringHelper::Title("Show Objects matching a Tag Expression in Database", '~');
+	query = "-t SHOW -o ByTags -p \"Data & Machine & !Westworld\"";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects matching the Expression\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+
+	StringHelper::Title("Show Objects with a Tag starting with a Prefix in Database", '~');
+	query = "-t SHOW -o ByTagPrefix -p Sent";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects with Matching Tags\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+
+	StringHelper::Title("Show Objects with a Tag matching a Glob Pattern in Database", '~');
+	query = "-t SHOW -o ByTagGlob -p S*";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects with Matching Tags\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+
+	StringHelper::Title("Show Objects whose Key starts with a Prefix in Database", '~');
+	query = "-t SHOW -o ByPrefix -p key";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects ordered by Key\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+
+	StringHelper::Title("Show Objects whose Key is within a Range in Database", '~');
+	query = "-t SHOW -o ByRange -p key1..key2";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects ordered by Key\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+	query = "-t SHOW -o ByRange -p key1";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query.c_str()) << std::endl;
+
+	StringHelper::Title("Show Objects Modified since a Timestamp in Database", '~');
+	query = "-t SHOW -o ModifiedSince -p 20000101000000";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects, oldest first\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+	query = "-t SHOW -o ModifiedBetween -p 20000101000000..20000102000000";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query.c_str()) << std::endl;
+
+	StringHelper::Title("Show most recently Modified Objects in Database", '~');
+	query = "-t SHOW -o Recent -p 2";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects, newest first\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+	query = "-t SHOW -o RecentByTag -p 1:Machine";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - List of Objects, newest first\n\n" << QueryEngine::ProcessQuery(db, query.c_str());
+	query = "-t SHOW -o Recent -p two";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query.c_str()) << std::endl;
 }
 
 /// <summary>
@@ -227,6 +620,111 @@ void TestUpdateQueries(DBEngine * db) {
 	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
 	std::cout << "\n\n After Remove Tag from Object.\n" << db->getData("key2");
 	putline();
+
+	StringHelper::Title("Set Expiry of a Specified Key in Database", '~');
+	query = "-t UPDATE -k key2 -x 3600";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	std::cout << "\n\n Expires within the Hour ? " << (db->getDataRaw("key2").getExpiry() - TimingWheel::now() <= 3600 * 1000);
+	query = "-t UPDATE -k key2 -x soon";
+	std::cout << "\n\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	/* The Update and it's Expiry are one WriteBatch, so neither is Applied without the other */
+	query = "-t UPDATE -k key2 -o AddTag -p Host -x 7200";
+	std::cout << "\n\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	std::cout << "\n Tagged Host : " << db->getDataRaw("key2").tagExist("Host")
+		<< ", Expires after the Hour : " << (db->getDataRaw("key2").getExpiry() - TimingWheel::now() > 3600 * 1000);
+	query = "-t UPDATE -k key9 -v Nobody -x 60";
+	std::cout << "\n\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	putline();
+}
+
+/// <summary>
+/// Function to Test Batch Type of Queries.
+/// </summary>
+/// <param name="db">DBEngine</param>
+void TestBatchQueries(DBEngine * db) {
+	StringHelper::Title("Test Batch Type Query");
+	StringHelper::Title("Insert, Tag and Update a Sibling in one Batch", '~');
+	std::string query = "-t BATCH ; -t INSERT -k key8 -v Teddy ; -t UPDATE -k key8 -o AddTag -p Host ; -t UPDATE -k key2 -v T-1001";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	std::cout << "\n\n" << db->getData("key8") << "\n" << db->getData("key2");
+	putline();
+
+	StringHelper::Title("Batch with a Query which can not be Applied", '~');
+	query = "-t BATCH ; -t DELETE -k key8 ; -t UPDATE -k key9 -v Nobody";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	std::cout << "\n\n Object With \"key8\" still in Database ? " << db->exists("key8");
+	query = "-t BATCH ; -t SHOW -k key8";
+	std::cout << "\n\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	query = "-t BATCH";
+	std::cout << "\n\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query) << std::endl;
+	putline();
+}
+
+/// <summary>
+/// Function to Test MGET and MSET Queries.
+/// </summary>
+/// <param name="db">DBEngine</param>
+void TestMultiKeyQueries(DBEngine * db) {
+	StringHelper::Title("Test MSET and MGET Type Queries");
+	StringHelper::Title("Set a new and an existing Key", '~');
+	std::string query = "-t MSET ; -k key10 -v Clementine ; -k key2 -v Maeve Millay -x 3600";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	query = "-t MSET ; -k key11";
+	std::cout << "\n\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query);
+	std::cout << "\n\n Object With \"key11\" in Database ? " << db->exists("key11");
+	putline();
+
+	StringHelper::Title("Show many Keys at once", '~');
+	query = "-t MGET -k key10 key2 nokey";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Objects in the order of the Keys\n\n" << QueryEngine::ProcessQuery(db, query);
+	query = "-t MGET -k key10 -v value";
+	std::cout << " Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query) << std::endl;
+	putline();
+}
+
+/// <summary>
+/// Function to Test Show Queries a Page at a time, following the Cursor from Page to Page.
+/// </summary>
+/// <param name="db">DBEngine</param>
+void TestPagedShowQueries(DBEngine * db) {
+	StringHelper::Title("Test Paged Show Type Query");
+	StringHelper::Title("Show All Objects in Database two at a time", '~');
+	std::string cursor = "0";
+	do {
+		std::string query = "-t SHOW -l 2 -c " + cursor;
+		std::string response = QueryEngine::ProcessQuery(db, query);
+		size_t at = response.rfind(" Next Cursor : ");
+		cursor = at == std::string::npos ? "0" : response.substr(at + 15);
+		std::cout << "\n Query : \"" << query << "\"\n\n" << response << "\n";
+	} while (cursor != "0");
+	putline();
+
+	StringHelper::Title("Show Objects with Specified Tag one at a time", '~');
+	std::string query = "-t SHOW -o ByTag -p Machine -l 1";
+	std::string response = QueryEngine::ProcessQuery(db, query);
+	std::cout << "\n Query : \"" << query << "\"\n\n" << response;
+	query = "-t SHOW -o ByTag -p Machine -l 1 -c " + response.substr(response.rfind(" Next Cursor : ") + 15);
+	std::cout << "\n\n Query : \"" << query << "\"\n\n" << QueryEngine::ProcessQuery(db, query);
+	putline();
+
+	StringHelper::Title("Invalid Paged Show Queries", '~');
+	for (std::string invalid : { "-t SHOW -c 0", "-t SHOW -l 0", "-t SHOW -l 2 -c xyz", "-t SHOW -k key0 -l 2", "-t SHOW -o Recent -p 2 -l 2" }) {
+		std::cout << "\n Query : \"" << invalid << "\"";
+		std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, invalid) << "\n";
+	}
+	putline();
 }
 
 /// <summary>
@@ -249,8 +747,20 @@ void TestQueries(DBEngine * db) {
 	std::cout << "\n\n Object With \"key6\" in Database After Executing Query ? " << db->exists("key6") << "\n";
 	putline();
 
+	StringHelper::Title("Test Insert Type Query with Expiry");
+	query = "-t INSERT -k key7 -v Clementine -x 0.2";
+	std::cout << "\n Query : \"" << query << "\"";
+	std::cout << "\n - Response : " << QueryEngine::ProcessQuery(db, query.c_str());
+	std::cout << "\n\n Object With \"key7\" in Database Before it Expires ? " << db->exists("key7");
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+	std::cout << "\n Object With \"key7\" in Database After it Expires ? " << db->exists("key7") << "\n";
+	putline();
+
 	TestShowQueries(db);
 	TestUpdateQueries(db);
+	TestBatchQueries(db);
+	TestMultiKeyQueries(db);
+	TestPagedShowQueries(db);
 
 }
 
@@ -1,7 +1,7 @@
 /////////////////////////////////////////////////////////////
 // QueryEngine.h    - Perform Client Requests on DBEngine. //
-// Version          - 1.1                                  //
-// Last Modified    - 08/09/2017                           //
+// Version          - 2.1                                  //
+// Last Modified    - 10/17/2026                           //
 // Language         - Visual C++, Visual Studio 2017       //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10    //
 // Author           - Venkata Bharani Krishna Chekuri      //
@@ -19,6 +19,48 @@
  * Function to Parse Query, Perform Operation on DBEngine and Finally return
  * Response to the Client.
  *
+ * Show Queries support "-o ByTag -p <tag>" for a single Tag and "-o ByTags -p
+ * <expression>" for a Boolean Tag Expression using & (AND), | (OR), ! (NOT) and
+ * parentheses, which is evaluated by the DBEngine.
+ *
+ * Show Queries support "-o ByTagPrefix -p <prefix>" for the Objects with a Tag
+ * starting with a Prefix and "-o ByTagGlob -p <pattern>" for the Objects with a Tag
+ * matching a Glob Pattern such as "region/??/east", where ? and * stay within a '/'
+ * Separated Segment and ** does not.
+ *
+ * Show Queries also support "-o ByPrefix -p <prefix>" for the Objects whose Key
+ * starts with a Prefix and "-o ByRange -p <from>..<to>" for the Objects whose Key
+ * lies between two Keys, both included ("<from>.." has no end). Both Show the
+ * Objects ordered by Key.
+ *
+ * Show Queries support "-o ModifiedSince -p <timestamp>" and "-o ModifiedBetween -p
+ * <from>..<to>" for the Objects Modified since or between Timestamps of the form
+ * YYYYmmDDHHMMSS, oldest first, and "-o Recent -p <count>" and "-o RecentByTag -p
+ * <count>:<tag>" for the count most recently Modified Objects, newest first.
+ *
+ * Insert and Update Queries support "-x <seconds>" to make the Key Expire after
+ * the given Number of Seconds, "-t UPDATE -k <key> -x <seconds>" only sets the
+ * Expiry. Update Queries without "-x" keep the Expiry of the Key.
+ *
+ * Batch Queries "-t BATCH ; <query> ; <query> ..." Apply the INSERT, DELETE and
+ * UPDATE (Value, AddTag and RemoveTag) Queries following "-t BATCH", separated by
+ * ';', as one DBEngine WriteBatch : all of them or none, with one Log Record.
+ * Values in a Batch can not contain ';'. An Update which takes "-x" sets the Data or
+ * Tag and the Expiry together, in or out of a Batch.
+ *
+ * "-t MGET -k <key> <key> ..." Shows the Objects of many Keys, separated by Spaces,
+ * in the order given and "Invalid Key" for those which do not Exist. The Keys are
+ * Looked up together (DBEngine::getData) so their Cache Misses overlap.
+ * "-t MSET ; -k <key> -v <value> [-x <seconds>] ; ..." Inserts the Keys, replacing
+ * the Objects of those which Exist, as one WriteBatch of puts.
+ *
+ * Show Queries for every Object, "-o ByTag" and "-o ByPrefix" take "-l <limit>" to
+ * Show a Page of at most limit Objects ordered by Key, followed by " Next Cursor :
+ * <cursor>". Passing the Cursor back with "-c <cursor>" Shows the next Page, Cursor
+ * 0 is the first Page and is returned after the last one, like Redis SCAN. The
+ * Cursor is the last Key of the Page in Hexadecimal, so Keys containing Spaces or
+ * Flags can be carried by it. The Server only builds one Page at a time.
+ *
  * DEPENDANT FILES
  * ---------------
  * QueryParser.h, QueryParser.cpp, DBEngine.h, DBEngine.cpp,
@@ -34,6 +76,44 @@
  * - Fixed a Bug Which would cause last Argument to be incorrectly processed (It would
  * be missing the last character).
  *
+ * ver 1.2 : 10/17/2026
+ * - Added "-t SHOW -o ByTags -p <expression>" to Show Objects matching a Boolean
+ *   Tag Expression such as "Machine & AI & !Westworld".
+ *
+ * ver 1.3 : 10/17/2026
+ * - Insert Queries Move a stack DBElement into the Database instead of leaking a
+ *   heap Allocated one.
+ *
+ * ver 1.4 : 10/17/2026
+ * - Added "-x <seconds>" to Insert and Update Queries for Keys which Expire.
+ *
+ * ver 1.5 : 10/17/2026
+ * - Added "-t SHOW -o ByPrefix -p <prefix>" and "-t SHOW -o ByRange -p <from>..<to>"
+ *   to Show Objects ordered by Key.
+ *
+ * ver 1.6 : 10/17/2026
+ * - Added "-t SHOW -o ByTagPrefix -p <prefix>" and "-t SHOW -o ByTagGlob -p <pattern>"
+ *   for Hierarchical Tags.
+ *
+ * ver 1.7 : 10/17/2026
+ * - Added "-t SHOW -o ModifiedSince", "ModifiedBetween", "Recent" and "RecentByTag"
+ *   to Show Objects by their Last Modified Timestamp.
+ *
+ * ver 1.8 : 10/17/2026
+ * - Added "-t BATCH ; <query> ; ..." to Apply several Write Queries All-or-Nothing.
+ *
+ * ver 1.9 : 10/17/2026
+ * - Added "-t MGET -k <keys>" and "-t MSET ; -k <key> -v <value> ; ..." to Read and
+ *   Write many Keys at once.
+ *
+ * ver 2.0 : 10/17/2026
+ * - Added "-l <limit>" and "-c <cursor>" to Show Queries to Show Objects a Page at
+ *   a time.
+ *
+ * ver 2.1 : 10/17/2026
+ * - Update Queries with "-x" Apply the Update and the Expiry as one WriteBatch,
+ *   and take "-x" in a Batch too.
+ *
  * 
  * TO-DO
  * -----
@@ -45,6 +125,7 @@
 #ifndef QUERYENGINE_H
 #define QUERYENGINE_H
 
+#include <vector>
 #include <unordered_map>
 
 #include "QueryParser.h"
@@ -57,11 +138,21 @@
 /// </summary>
 class QueryEngine {
 	static int QueryHelper(std::unordered_map<char, std::string>& arguments);
+	static bool ExpiryHelper(std::unordered_map<char, std::string>& arguments, long long int& deadline);
+	static bool NumberHelper(const std::string& text, long long int& number);
+	static std::string BatchHelper(WriteBatch& batch, std::unordered_map<char, std::string>& arguments);
+	static std::vector<std::string> SplitHelper(const std::string& queries);
+	static std::string CursorHelper(const std::string& key);
+	static bool CursorHelper(const std::string& cursor, std::string& key);
 	static std::unordered_map<char, std::string> ParseQuery(const char* query, bool verbose);
 	static std::string ProcessShowQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments);
+	static std::string ProcessPagedShowQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments);
 	static std::string ProcessInsertQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments);
 	static std::string ProcessDeleteQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments);
 	static std::string ProcessUpdateQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments);
+	static std::string ProcessBatchQuery(DBEngine * db, const std::string& queries, bool verbose);
+	static std::string ProcessMultiGetQuery(DBEngine * db, std::unordered_map<char, std::string>& arguments);
+	static std::string ProcessMultiSetQuery(DBEngine * db, const std::string& queries, bool verbose);
 public:
 	static std::string ProcessQuery(DBEngine * db, std::string query, bool verbose = false);
 };
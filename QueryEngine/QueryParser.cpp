@@ -1,7 +1,7 @@
 //////////////////////////////////////////////////////////////////////
 // QueryParser.cpp  - Parses Client Requests to retrieve arguments. //
-// Version          - 1.1                                           //
-// Last Modified    - 08/10/2017                                    //
+// Version          - 1.4                                           //
+// Last Modified    - 10/17/2026                                    //
 // Language         - Visual C++, Visual Studio 2017                //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10             //
 // Author           - Venkata Bharani Krishna Chekuri               //
@@ -44,6 +44,9 @@ namespace QueryScanner {
 		State * _pEatValue;
 		State * _pEatOperation;
 		State * _pEatParameter;
+		State * _pEatExpiry;
+		State * _pEatLimit;
+		State * _pEatCursor;
 		State * _pEatWhitespace;
 
 	};
@@ -68,10 +71,18 @@ namespace QueryScanner {
 			_pContext->_pState = NextState();
 		}
 		bool nextCharMatch(char ch) {
-			if (ch == 't' || ch == 'k' || ch == 'v' || ch == 'p' || ch == 'o' || ch == 'u')
+			if (ch == 't' || ch == 'k' || ch == 'v' || ch == 'p' || ch == 'o' || ch == 'u' || ch == 'x' || ch == 'l' || ch == 'c')
 				return true;
 			return false;
 		}
+		/* A '-' only starts a Flag after Whitespace, so Values like "high-level" stay whole */
+		bool AtFlag() {
+			if (_pContext->currChar != '-' || !(_pContext->_pIn->good()))
+				return false;
+			if (_pContext->prevChar != EOF && !std::isspace(_pContext->prevChar))
+				return false;
+			return nextCharMatch(_pContext->_pIn->peek());
+		}
 		bool CanRead() { return _pContext->_pIn->good(); }
 		std::string GetTok() { return _pContext->token; }
 		bool HasTok() { return _pContext->token.size() > 0; }
@@ -172,6 +183,24 @@ State* State::NextState()
 		CollectChar();
 		return _pContext->_pEatParameter;
 	}
+	if (_pContext->currChar == '-' && chNext == 'x') {
+		if (_pContext->VERBOSE)
+			std::cout << "\n State := EatExpiry";
+		CollectChar();
+		return _pContext->_pEatExpiry;
+	}
+	if (_pContext->currChar == '-' && chNext == 'l') {
+		if (_pContext->VERBOSE)
+			std::cout << "\n State := EatLimit";
+		CollectChar();
+		return _pContext->_pEatLimit;
+	}
+	if (_pContext->currChar == '-' && chNext == 'c') {
+		if (_pContext->VERBOSE)
+			std::cout << "\n State := EatCursor";
+		CollectChar();
+		return _pContext->_pEatCursor;
+	}
 	if (chNext == '\0') {
 		_pContext->_pIn->clear();
 		/* if peek() reads end of file character, EOF, then eofbit is set and
@@ -228,7 +257,7 @@ public:
 			if (!CollectChar())
 				break;
 			_pContext->token.push_back(_pContext->currChar);
-		} while (!(_pContext->currChar == '-' && (_pContext->_pIn->good() && nextCharMatch(_pContext->_pIn->peek()))));
+		} while (!AtFlag());
 		_pContext->_pIn->unget();
 		_pContext->token.pop_back();
 		if(!_pContext->token.empty()) {
@@ -257,7 +286,7 @@ public:
 			if (!CollectChar())
 				break;
 			_pContext->token.push_back(_pContext->currChar);
-		} while (!(_pContext->currChar == '-' && (_pContext->_pIn->good() && nextCharMatch(_pContext->_pIn->peek()))));
+		} while (!AtFlag());
 		_pContext->_pIn->unget();
 		_pContext->token.pop_back();
 		if(!_pContext->token.empty()) {
@@ -286,7 +315,7 @@ public:
 			if (!CollectChar())
 				break;
 			_pContext->token.push_back(_pContext->currChar);
-		} while (!(_pContext->currChar == '-' && (_pContext->_pIn->good() && nextCharMatch(_pContext->_pIn->peek()))));
+		} while (!AtFlag());
 		_pContext->_pIn->unget();
 		_pContext->token.pop_back();
 		if(!_pContext->token.empty()) {
@@ -316,7 +345,7 @@ public:
 			if (!CollectChar())
 				break;
 			_pContext->token.push_back(_pContext->currChar);
-		} while (!(_pContext->currChar == '-' && (_pContext->_pIn->good() && nextCharMatch(_pContext->_pIn->peek()))));
+		} while (!AtFlag());
 		_pContext->_pIn->unget();
 		_pContext->token.pop_back();
 		if(!_pContext->token.empty()) {
@@ -346,7 +375,7 @@ public:
 			if (!CollectChar())
 				break;
 			_pContext->token.push_back(_pContext->currChar);
-		} while (!(_pContext->currChar == '-' && (_pContext->_pIn->good() && nextCharMatch(_pContext->_pIn->peek()))));
+		} while (!AtFlag());
 		_pContext->_pIn->unget();
 		_pContext->token.pop_back();
 		if (!_pContext->token.empty()) {
@@ -376,7 +405,7 @@ public:
 			if (!CollectChar())
 				break;
 			_pContext->token.push_back(_pContext->currChar);
-		} while (!(_pContext->currChar == '-' && (_pContext->_pIn->good() && nextCharMatch(_pContext->_pIn->peek()))));
+		} while (!AtFlag());
 		_pContext->_pIn->unget();
 		_pContext->token.pop_back();
 		if (!_pContext->token.empty()) {
@@ -387,6 +416,93 @@ public:
 	}
 };
 
+/// <summary>
+/// State for parsing Expiry Query Parameter. Implementation of State Class.
+/// </summary>
+class EatExpiry : public State {
+public:
+	EatExpiry(Context * pContext) { _pContext = pContext; }
+
+	/// <summary>
+	/// Function to parse Expiry Query Parameter (Seconds till the Key Expires). It will
+	/// keep on reading and storing the stringstream characters till it encounters one
+	/// of the Query Flags or end of query (whichever comes first).
+	/// </summary>
+	virtual void EatChars() {
+		_pContext->token.clear();
+		do {
+			if (!CollectChar())
+				break;
+			_pContext->token.push_back(_pContext->currChar);
+		} while (!AtFlag());
+		_pContext->_pIn->unget();
+		_pContext->token.pop_back();
+		if (!_pContext->token.empty()) {
+			_pContext->_queryParams['x'] = Utilities::StringHelper::lrtrim(_pContext->token);
+			if (_pContext->VERBOSE)
+				std::cout << "\n Query Expiry := " + _pContext->_queryParams['x'] + "\n";
+		}
+	}
+};
+
+/// <summary>
+/// State for parsing Limit Query Parameter. Implementation of State Class.
+/// </summary>
+class EatLimit : public State {
+public:
+	EatLimit(Context * pContext) { _pContext = pContext; }
+
+	/// <summary>
+	/// Function to parse Limit Query Parameter (Objects per Page of a Show Query). It
+	/// will keep on reading and storing the stringstream characters till it encounters
+	/// one of the Query Flags or end of query (whichever comes first).
+	/// </summary>
+	virtual void EatChars() {
+		_pContext->token.clear();
+		do {
+			if (!CollectChar())
+				break;
+			_pContext->token.push_back(_pContext->currChar);
+		} while (!AtFlag());
+		_pContext->_pIn->unget();
+		_pContext->token.pop_back();
+		if (!_pContext->token.empty()) {
+			_pContext->_queryParams['l'] = Utilities::StringHelper::lrtrim(_pContext->token);
+			if (_pContext->VERBOSE)
+				std::cout << "\n Query Limit := " + _pContext->_queryParams['l'] + "\n";
+		}
+	}
+};
+
+/// <summary>
+/// State for parsing Cursor Query Parameter. Implementation of State Class.
+/// </summary>
+class EatCursor : public State {
+public:
+	EatCursor(Context * pContext) { _pContext = pContext; }
+
+	/// <summary>
+	/// Function to parse Cursor Query Parameter (where the next Page of a Show Query
+	/// starts). It will keep on reading and storing the stringstream characters till
+	/// it encounters one of the Query Flags or end of query (whichever comes first).
+	/// </summary>
+	virtual void EatChars() {
+		_pContext->token.clear();
+		do {
+			if (!CollectChar())
+				break;
+			_pContext->token.push_back(_pContext->currChar);
+		} while (!AtFlag());
+		_pContext->_pIn->unget();
+		_pContext->token.pop_back();
+		if (!_pContext->token.empty()) {
+			_pContext->_queryParams['c'] = Utilities::StringHelper::lrtrim(_pContext->token);
+			if (_pContext->VERBOSE)
+				std::cout << "\n Query Cursor := " + _pContext->_queryParams['c'] + "\n";
+		}
+	}
+};
+
 /// <summary>
 /// Default Constructor for Context Structure. It will Initialize all
 /// the States and Scopes.
@@ -398,9 +514,14 @@ Context::Context() {
 	_pEatValue = new EatValue(this);
 	_pEatOperation = new EatOperation(this);
 	_pEatParameter = new EatParameter(this);
+	_pEatExpiry = new EatExpiry(this);
+	_pEatLimit = new EatLimit(this);
+	_pEatCursor = new EatCursor(this);
 	_pEatWhitespace = new EatWhitespace(this);
 	_pState = _pEatWhitespace;
 	_lineCount = 0;
+	prevChar = EOF;
+	currChar = EOF;
 
 	_queryParams.clear();
 }
@@ -417,6 +538,9 @@ Context::~Context() {
 	delete _pEatValue;
 	delete _pEatOperation;
 	delete _pEatParameter;
+	delete _pEatExpiry;
+	delete _pEatLimit;
+	delete _pEatCursor;
 	delete _pEatWhitespace;
 }
 
@@ -534,7 +658,7 @@ using namespace Utilities;
 /// <returns></returns>
 int main(int argc, char* argv[]) {
 	StringHelper::Title("TEST QUERY PARSER", '=');
-	std::string query = "-u Anonymous -t INSERT -k key3 -v Dolores -o ADDTAG -p AI";
+	std::string query = "-u Anonymous -t INSERT -k key3 -v Dolores -o ADDTAG -p AI -x 60";
 
 	StringHelper::Title("Declaring Parser");
 	Toker * toker = new Toker(false);
@@ -553,9 +677,18 @@ int main(int argc, char* argv[]) {
 	std::cout << "\n";
 
 	StringHelper::Title("Display Query Parameters");
+	for (std::pair<char, std::string> pr : queryParams)
+		std::cout << "\n -" << pr.first << " | " << pr.second;
+	std::cout << "\n";
+
+	query = "-t UPDATE -k re-create -v high-level max-x -p Top-Level";
+	StringHelper::Title(std::string("Processing Query with '-' inside Values : \"" + query + "\""));
+	Toker * other = new Toker(false);
+	queryParams = other->Compute(query.c_str());
 	for (std::pair<char, std::string> pr : queryParams)
 		std::cout << "\n -" << pr.first << " | " << pr.second;
 	std::cout << "\n\n ";
+	delete other;
 
 	return 0;
 }
@@ -1,7 +1,7 @@
 //////////////////////////////////////////////////////////////////////
 // QueryParser.h    - Parses Client Requests to retrieve arguments. //
-// Version          - 1.1                                           //
-// Last Modified    - 08/10/2017                                    //
+// Version          - 1.4                                           //
+// Last Modified    - 10/17/2026                                    //
 // Language         - Visual C++, Visual Studio 2017                //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10             //
 // Author           - Venkata Bharani Krishna Chekuri               //
@@ -44,6 +44,17 @@
  * ver 1.1 : 08/10/2017
  * - Updated Context and Added a new State to Parse User Argument (EatUser).
  *
+ * ver 1.2 : 10/17/2026
+ * - Added a new State to Parse Expiry Argument (EatExpiry).
+ *
+ * ver 1.3 : 10/17/2026
+ * - Added new States to Parse Limit and Cursor Arguments of Paged Show Queries
+ *   (EatLimit and EatCursor).
+ *
+ * ver 1.4 : 10/17/2026
+ * - A '-' now only starts a Query Flag at the start of the Query or after
+ *   Whitespace, so Values like "high-level" or "re-create" are not cut.
+ *
  */
 #ifndef QUERYPARSER_H
 #define QUERYPARSER_H
@@ -1,7 +1,7 @@
 //////////////////////////////////////////////////////////////////
 // Utilities.cpp    - small, generally useful, helper classes   //
-// Version          - 1.1                                       //
-// Last Modified    - 05/05/2016                                //
+// Version          - 1.3                                       //
+// Last Modified    - 10/17/2026                                //
 // Language         - Visual C++, Visual Studio 2017            //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
 // Author           - Venkata Bharani Krishna Chekuri           //
@@ -29,7 +29,7 @@ void StringHelper::Title(const std::string& src, char underline)
 /// <param name="s">String to Left Trim</param>
 /// <returns>Left Trimmed String</returns>
 std::string StringHelper::ltrim(std::string &s) {
-	s.erase(s.begin(), std::find_if(s.begin(), s.end(), std::not1(std::ptr_fun<int, int>(std::isspace))));
+	s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](int ch) { return !std::isspace(ch); }));
 	return s;
 }
 
@@ -39,7 +39,7 @@ std::string StringHelper::ltrim(std::string &s) {
 /// <param name="s">String to Right Trim</param>
 /// <returns>Right Trimmed String</returns>
 std::string StringHelper::rtrim(std::string &s) {
-	s.erase(std::find_if(s.rbegin(), s.rend(), std::not1(std::ptr_fun<int, int>(std::isspace))).base(), s.end());
+	s.erase(std::find_if(s.rbegin(), s.rend(), [](int ch) { return !std::isspace(ch); }).base(), s.end());
 	return s;
 }
 
@@ -122,7 +122,14 @@ std::string TimeHelper::leftpadZero(int val) {
 /// <returns>Current Timestamp in yyyyMMddhhmmss Format as long long int</returns>
 long long int TimeHelper::getCurrentTimestamp() {
 	time_t t = time(0);							// get current time
-	struct tm * now = now = localtime(&t);
+	struct tm local;
+	/* localtime shares a static buffer between threads */
+#ifdef _WIN32
+	localtime_s(&local, &t);
+#else
+	localtime_r(&t, &local);
+#endif
+	struct tm * now = &local;
 	long long int ts = 1;
 	ts = (now->tm_year + 1900);
 	ts = ts * 100 + now->tm_mon + 1;
@@ -1,7 +1,7 @@
 //////////////////////////////////////////////////////////////////
 // Utilities.h      - small, generally useful, helper classes	//
-// Version          - 1.1                                       //
-// Last Modified    - 05/05/2016                                //
+// Version          - 1.3                                       //
+// Last Modified    - 10/17/2026                                //
 // Language         - Visual C++, Visual Studio 2017            //
 // Platform         - MSI GE62 2QD, Core-i7, Windows 10         //
 // Author           - Venkata Bharani Krishna Chekuri           //
@@ -33,6 +33,12 @@
  *	> Test Stub helper functions are now member functions
  *	  (This has no impact on Utilities class)
  *
+ * ver 1.2 : 10/17/2026
+ * - Trim functions no longer use std::ptr_fun which was removed in C++17.
+ *
+ * ver 1.3 : 10/17/2026
+ * - getCurrentTimestamp is now safe to call from multiple threads.
+ *
  */
 #ifndef UTILITIES_H
 #define UTILITIES_H